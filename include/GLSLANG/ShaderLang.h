@@ -48,7 +48,7 @@ typedef unsigned int GLenum;
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 142
+#define ANGLE_SH_VERSION 146
 
 typedef enum {
   SH_GLES2_SPEC = 0x8B40,
@@ -208,6 +208,31 @@ typedef enum {
   // This flag works around bugs in Mac drivers related to do-while by
   // transforming them into an other construct.
   SH_REWRITE_DO_WHILE_LOOPS = 0x400000,
+
+  // This flag makes ShCompile look up the results of the compile in the
+  // process-wide translation cache before translating the shader, and store
+  // them there afterwards. Compiles are matched on their sources, compile
+  // options, output type and built-in resources. It has no effect when a
+  // name hashing function is set in the built-in resources.
+  // See ShSetTranslationCacheOptions().
+  SH_CACHE_TRANSLATION = 0x800000,
+
+  // This flag makes ShCompile measure the wall time spent in each phase of
+  // the compile. Measuring the preprocessing separately from the parsing has
+  // a per-token cost, so the timings are only collected when asked for.
+  // See ShGetCompileStatistics().
+  SH_COLLECT_COMPILE_STATISTICS = 0x1000000,
+
+  // This flag bounds the work ShCompile does on a shader by the compile
+  // budget of the built-in resources: the wall time of the compile, the
+  // number of tokens produced by the preprocessor and the number of
+  // allocations made for the AST and the other compile data. The compile
+  // fails with an error in the info log once any of them is exceeded, which
+  // protects the embedder against shaders crafted to stall the compiler,
+  // such as recursive macro expansions.
+  // See MaxCompileTimeMilliseconds, MaxPreprocessedTokens and
+  // MaxCompileAllocations in ShBuiltInResources.
+  SH_LIMIT_COMPILE_BUDGET = 0x2000000,
 } ShCompileOptions;
 
 // Defines alternate strategies for implementing array index clamping.
@@ -224,6 +249,10 @@ typedef enum {
 // compiler operations.
 // If the function succeeds, the return value is true, else false.
 //
+// Once the translator is initialized, different ShHandles may be used
+// concurrently from different threads. A single ShHandle must only be
+// used by one thread at a time.
+//
 COMPILER_EXPORT bool ShInitialize();
 //
 // Driver should call this at shutdown.
@@ -304,6 +333,15 @@ typedef struct
 
     // The maximum depth a call stack can be.
     int MaxCallStackDepth;
+
+    // The compile budget enforced with SH_LIMIT_COMPILE_BUDGET. A limit of 0
+    // leaves that part of the budget unlimited.
+    // The maximum wall time of a compile, in milliseconds.
+    int MaxCompileTimeMilliseconds;
+    // The maximum number of tokens the preprocessor can produce for a shader.
+    int MaxPreprocessedTokens;
+    // The maximum number of allocations a compile can make from its pool.
+    int MaxCompileAllocations;
 } ShBuiltInResources;
 
 //
@@ -330,6 +368,29 @@ typedef void *ShHandle;
 // handle: Specifies the handle of the compiler to be used.
 COMPILER_EXPORT const std::string &ShGetBuiltInResourcesString(const ShHandle handle);
 
+//
+// Configures the process-wide translation cache used by compiles that pass
+// SH_CACHE_TRANSLATION. The cache is kept across ShFinalize() calls.
+// If the function succeeds, the return value is true, else false.
+// Parameters:
+// maxMemoryBytes: Upper bound on the memory used by cached results. The least
+//                 recently used results are evicted first.
+// cacheFilePath: Path of a file that persists the cache across processes.
+//                The most recent results found in it that fit in
+//                maxMemoryBytes are loaded right away, and new results are
+//                appended to it. The file is rewritten from the cached
+//                results when it grows past twice maxMemoryBytes. Pass NULL
+//                to keep the cache in memory only.
+//
+COMPILER_EXPORT bool ShSetTranslationCacheOptions(size_t maxMemoryBytes,
+                                                  const char *cacheFilePath);
+
+//
+// Drops all the results held in memory by the translation cache. The cache
+// file, if any, is left untouched.
+//
+COMPILER_EXPORT void ShClearTranslationCache();
+
 //
 // Driver calls these to create and destroy compiler objects.
 //
@@ -420,6 +481,93 @@ COMPILER_EXPORT const std::vector<sh::Attribute> *ShGetAttributes(const ShHandle
 COMPILER_EXPORT const std::vector<sh::OutputVariable> *ShGetOutputVariables(const ShHandle handle);
 COMPILER_EXPORT const std::vector<sh::InterfaceBlock> *ShGetInterfaceBlocks(const ShHandle handle);
 
+// Wall time spent in a phase of the last compile.
+typedef struct
+{
+    // Name of the phase, valid for the lifetime of the process.
+    const char *name;
+    double seconds;
+} ShPhaseTiming;
+
+typedef struct
+{
+    // The phases that ran, in order, if the last compile was given
+    // SH_COLLECT_COMPILE_STATISTICS. The phases are "Preprocess", "Parse",
+    // the AST transformations and validations by name, including
+    // "CollectVariables", then the transformations of the output backend and
+    // "Output" for the code generation itself. Passes that share a traversal
+    // of the AST are timed as one phase.
+    std::vector<ShPhaseTiming> phaseTimings;
+
+    // Pool allocator usage of the last compile. These are always collected.
+    // poolPeakBytes: Peak size of the pool pages used by the compile at the
+    //                same time.
+    // poolPagesAllocated: Number of pages newly allocated from the system.
+    // poolPagesReused: Number of pages reused from the pages freed by
+    //                  previous compiles.
+    // poolAllocations, poolAllocatedBytes: Number and total size of the
+    //                                      allocations made from the pool.
+    size_t poolPeakBytes;
+    size_t poolPagesAllocated;
+    size_t poolPagesReused;
+    size_t poolAllocations;
+    size_t poolAllocatedBytes;
+} ShCompileStatistics;
+
+// Returns the statistics of the last compile, or NULL on failure. Compiles
+// whose results come from the translation cache report no phases and no
+// pool usage.
+// Parameters:
+// handle: Specifies the compiler
+COMPILER_EXPORT const ShCompileStatistics *ShGetCompileStatistics(const ShHandle handle);
+
+// A shader to compile with ShCompileBatch.
+// shaderStrings, numStrings, compileOptions: Same as the ShCompile parameters.
+typedef struct
+{
+    const char *const *shaderStrings;
+    size_t numStrings;
+    int compileOptions;
+} ShBatchShader;
+
+// The results of compiling one shader of a batch, as the ShGet* functions
+// would return them after compiling it with ShCompile.
+typedef struct
+{
+    bool success;
+    int shaderVersion;
+    std::string infoLog;
+    std::string objectCode;
+    std::vector<sh::Attribute> attributes;
+    std::vector<sh::OutputVariable> outputVariables;
+    std::vector<sh::Uniform> uniforms;
+    std::vector<sh::Varying> varyings;
+    std::vector<sh::InterfaceBlock> interfaceBlocks;
+    ShCompileStatistics statistics;
+} ShBatchResult;
+
+// Compiles many shaders with the type, spec, output and built-in resources
+// of the compiler, spreading them over several threads. The compilers used
+// by the threads are kept with the handle and reused by the next batches,
+// and all of them share the built-in symbol table of the handle.
+// The results of the handle itself are cleared, and the HLSL register
+// assignments are not reported.
+// Returns true if all the shaders compiled successfully.
+// Parameters:
+// handle: Specifies the compiler
+// shaders: Specifies an array of numShaders shaders.
+// numShaders: Specifies the number of shaders.
+// numThreads: Specifies the largest number of threads compiling at the same
+//             time, including the calling thread. Zero uses one thread per
+//             hardware thread.
+// results: Specifies an array of numShaders results, written in the order
+//          of the shaders.
+COMPILER_EXPORT bool ShCompileBatch(const ShHandle handle,
+                                    const ShBatchShader *shaders,
+                                    size_t numShaders,
+                                    size_t numThreads,
+                                    ShBatchResult *results);
+
 typedef struct
 {
     sh::GLenum type;
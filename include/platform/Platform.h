@@ -145,6 +145,12 @@ class Platform
     // Boolean histograms track two-state variables.
     virtual void histogramBoolean(const char *name, bool sample) { }
 
+    // Program cache -------------------------------------------------------
+
+    // Existing directory in which linked programs are kept between runs. Returning null keeps
+    // the program cache in memory only.
+    virtual const char *getProgramCacheDirectory() { return nullptr; }
+
   protected:
     virtual ~Platform() { }
 };
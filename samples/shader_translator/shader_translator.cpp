@@ -31,7 +31,10 @@ static sh::GLenum FindShaderType(const char *fileName);
 static bool CompileFile(char *fileName, ShHandle compiler, int compileOptions);
 static void LogMsg(const char *msg, const char *name, const int num, const char *logName);
 static void PrintVariable(const std::string &prefix, size_t index, const sh::ShaderVariable &var);
-static void PrintActiveVariables(ShHandle compiler);
+static void PrintActiveVariables(const ShBatchResult &result);
+static void PrintCompileStatistics(const ShCompileStatistics &statistics);
+static void GetResult(ShHandle compiler, bool compiled, ShBatchResult *result);
+static void PrintResult(int num, int compileOptions, const ShBatchResult &result);
 
 // If NUM_SOURCE_STRINGS is set to a value > 1, the input file data is
 // broken into that many chunks. This will affect file/line numbering in
@@ -41,6 +44,19 @@ typedef std::vector<char *> ShaderSource;
 static bool ReadShaderSource(const char *fileName, ShaderSource &source);
 static void FreeShaderSource(ShaderSource &source);
 
+// A file compiled as part of a batch.
+struct BatchJob
+{
+    ShHandle compiler;
+    int compileOptions;
+    ShaderSource source;
+};
+static bool CompileBatches(const std::vector<BatchJob> &jobs,
+                           ShHandle vertexCompiler,
+                           ShHandle fragmentCompiler,
+                           int numThreads,
+                           std::vector<ShBatchResult> *results);
+
 static bool ParseGLSLOutputVersion(const std::string &, ShShaderOutput *outResult);
 static bool ParseIntValue(const std::string &, int emptyDefault, int *outValue);
 
@@ -71,6 +87,9 @@ int main(int argc, char *argv[])
 
     int compileOptions = 0;
     int numCompiles = 0;
+    // Number of threads compiling the files in batches, or -1 to compile them one at a time.
+    int numBatchThreads = -1;
+    std::vector<BatchJob> batchJobs;
     ShHandle vertexCompiler = 0;
     ShHandle fragmentCompiler = 0;
     ShShaderSpec spec = SH_GLES2_SPEC;
@@ -97,6 +116,18 @@ int main(int argc, char *argv[])
               case 'd': compileOptions |= SH_DEPENDENCY_GRAPH; break;
               case 't': compileOptions |= SH_TIMING_RESTRICTIONS; break;
               case 'p': resources.WEBGL_debug_shader_precision = 1; break;
+              case 'c': compileOptions |= SH_COLLECT_COMPILE_STATISTICS; break;
+              case 'j':
+                if (argv[0][2] == '\0')
+                {
+                    numBatchThreads = 0;
+                }
+                else if (argv[0][2] != '=' || !ParseIntValue(&argv[0][3], 0, &numBatchThreads) ||
+                         numBatchThreads < 0)
+                {
+                    failCode = EFailUsage;
+                }
+                break;
               case 's':
                 if (argv[0][2] == '=')
                 {
@@ -232,31 +263,24 @@ int main(int argc, char *argv[])
                 break;
               default: break;
             }
-            if (compiler)
+            if (compiler && numBatchThreads >= 0)
+            {
+                BatchJob job;
+                job.compiler       = compiler;
+                job.compileOptions = compileOptions;
+                if (ReadShaderSource(argv[0], job.source))
+                    batchJobs.push_back(job);
+                else
+                    failCode = EFailCompile;
+            }
+            else if (compiler)
             {
                 bool compiled = CompileFile(argv[0], compiler, compileOptions);
 
-                LogMsg("BEGIN", "COMPILER", numCompiles, "INFO LOG");
-                std::string log = ShGetInfoLog(compiler);
-                puts(log.c_str());
-                LogMsg("END", "COMPILER", numCompiles, "INFO LOG");
-                printf("\n\n");
+                ShBatchResult result;
+                GetResult(compiler, compiled, &result);
+                PrintResult(numCompiles, compileOptions, result);
 
-                if (compiled && (compileOptions & SH_OBJECT_CODE))
-                {
-                    LogMsg("BEGIN", "COMPILER", numCompiles, "OBJ CODE");
-                    std::string code = ShGetObjectCode(compiler);
-                    puts(code.c_str());
-                    LogMsg("END", "COMPILER", numCompiles, "OBJ CODE");
-                    printf("\n\n");
-                }
-                if (compiled && (compileOptions & SH_VARIABLES))
-                {
-                    LogMsg("BEGIN", "COMPILER", numCompiles, "VARIABLES");
-                    PrintActiveVariables(compiler);
-                    LogMsg("END", "COMPILER", numCompiles, "VARIABLES");
-                    printf("\n\n");
-                }
                 if (!compiled)
                   failCode = EFailCompile;
                 ++numCompiles;
@@ -268,6 +292,26 @@ int main(int argc, char *argv[])
         }
     }
 
+    if (!batchJobs.empty())
+    {
+        std::vector<ShBatchResult> results;
+        if (failCode == ESuccess &&
+            !CompileBatches(batchJobs, vertexCompiler, fragmentCompiler, numBatchThreads,
+                            &results))
+        {
+            failCode = EFailCompile;
+        }
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            PrintResult(numCompiles, batchJobs[i].compileOptions, results[i]);
+            ++numCompiles;
+        }
+        for (BatchJob &job : batchJobs)
+        {
+            FreeShaderSource(job.source);
+        }
+    }
+
     if ((vertexCompiler == 0) && (fragmentCompiler == 0))
         failCode = EFailUsage;
     if (failCode == EFailUsage)
@@ -289,7 +333,7 @@ void usage()
 {
     // clang-format off
     printf(
-        "Usage: translate [-i -o -u -l -e -t -d -p -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
+        "Usage: translate [-i -o -u -l -e -t -d -p -c -j -b=e -b=g -b=h9 -x=i -x=d] file1 file2 ...\n"
         "Where: filename : filename ending in .frag or .vert\n"
         "       -i       : print intermediate tree\n"
         "       -o       : print translated code\n"
@@ -299,6 +343,8 @@ void usage()
         "       -t       : enforce experimental timing restrictions\n"
         "       -d       : print dependency graph used to enforce timing restrictions\n"
         "       -p       : use precision emulation\n"
+        "       -c       : print the time spent in each compile phase and the pool memory used\n"
+        "       -j[=NUM] : compile the files in batches on NUM threads (NUM default one per core)\n"
         "       -s=e2    : use GLES2 spec (this is by default)\n"
         "       -s=e3    : use GLES3 spec (in development)\n"
         "       -s=w     : use WebGL spec\n"
@@ -419,12 +465,12 @@ void PrintVariable(const std::string &prefix, size_t index, const sh::ShaderVari
     }
 }
 
-static void PrintActiveVariables(ShHandle compiler)
+static void PrintActiveVariables(const ShBatchResult &result)
 {
-    const std::vector<sh::Uniform> *uniforms = ShGetUniforms(compiler);
-    const std::vector<sh::Varying> *varyings = ShGetVaryings(compiler);
-    const std::vector<sh::Attribute> *attributes = ShGetAttributes(compiler);
-    const std::vector<sh::OutputVariable> *outputs = ShGetOutputVariables(compiler);
+    const std::vector<sh::Uniform> *uniforms = &result.uniforms;
+    const std::vector<sh::Varying> *varyings = &result.varyings;
+    const std::vector<sh::Attribute> *attributes = &result.attributes;
+    const std::vector<sh::OutputVariable> *outputs = &result.outputVariables;
     for (size_t varCategory = 0; varCategory < 4; ++varCategory)
     {
         size_t numVars = 0;
@@ -468,6 +514,106 @@ static void PrintActiveVariables(ShHandle compiler)
     }
 }
 
+static void PrintCompileStatistics(const ShCompileStatistics &statistics)
+{
+    double totalSeconds = 0.0;
+    for (const ShPhaseTiming &timing : statistics.phaseTimings)
+    {
+        printf("%s: %.3f ms\n", timing.name, timing.seconds * 1000.0);
+        totalSeconds += timing.seconds;
+    }
+    printf("total: %.3f ms\n", totalSeconds * 1000.0);
+
+    printf("pool peak bytes: %lu\n", static_cast<unsigned long>(statistics.poolPeakBytes));
+    printf("pool pages allocated: %lu, reused: %lu\n",
+           static_cast<unsigned long>(statistics.poolPagesAllocated),
+           static_cast<unsigned long>(statistics.poolPagesReused));
+    printf("pool allocations: %lu (%lu bytes)\n",
+           static_cast<unsigned long>(statistics.poolAllocations),
+           static_cast<unsigned long>(statistics.poolAllocatedBytes));
+}
+
+static void GetResult(ShHandle compiler, bool compiled, ShBatchResult *result)
+{
+    result->success         = compiled;
+    result->shaderVersion   = ShGetShaderVersion(compiler);
+    result->infoLog         = ShGetInfoLog(compiler);
+    result->objectCode      = ShGetObjectCode(compiler);
+    result->attributes      = *ShGetAttributes(compiler);
+    result->outputVariables = *ShGetOutputVariables(compiler);
+    result->uniforms        = *ShGetUniforms(compiler);
+    result->varyings        = *ShGetVaryings(compiler);
+    result->interfaceBlocks = *ShGetInterfaceBlocks(compiler);
+    result->statistics      = *ShGetCompileStatistics(compiler);
+}
+
+static void PrintResult(int num, int compileOptions, const ShBatchResult &result)
+{
+    LogMsg("BEGIN", "COMPILER", num, "INFO LOG");
+    puts(result.infoLog.c_str());
+    LogMsg("END", "COMPILER", num, "INFO LOG");
+    printf("\n\n");
+
+    if (result.success && (compileOptions & SH_OBJECT_CODE))
+    {
+        LogMsg("BEGIN", "COMPILER", num, "OBJ CODE");
+        puts(result.objectCode.c_str());
+        LogMsg("END", "COMPILER", num, "OBJ CODE");
+        printf("\n\n");
+    }
+    if (result.success && (compileOptions & SH_VARIABLES))
+    {
+        LogMsg("BEGIN", "COMPILER", num, "VARIABLES");
+        PrintActiveVariables(result);
+        LogMsg("END", "COMPILER", num, "VARIABLES");
+        printf("\n\n");
+    }
+    if (compileOptions & SH_COLLECT_COMPILE_STATISTICS)
+    {
+        LogMsg("BEGIN", "COMPILER", num, "STATISTICS");
+        PrintCompileStatistics(result.statistics);
+        LogMsg("END", "COMPILER", num, "STATISTICS");
+        printf("\n\n");
+    }
+}
+
+static bool CompileBatches(const std::vector<BatchJob> &jobs,
+                           ShHandle vertexCompiler,
+                           ShHandle fragmentCompiler,
+                           int numThreads,
+                           std::vector<ShBatchResult> *results)
+{
+    results->resize(jobs.size());
+
+    // Each compiler compiles its own files in one batch.
+    bool success = true;
+    ShHandle compilers[] = {vertexCompiler, fragmentCompiler};
+    for (ShHandle compiler : compilers)
+    {
+        std::vector<ShBatchShader> shaders;
+        std::vector<size_t> jobIndices;
+        for (size_t i = 0; i < jobs.size(); ++i)
+        {
+            if (compiler != 0 && jobs[i].compiler == compiler)
+            {
+                ShBatchShader shader = {&jobs[i].source[0], jobs[i].source.size(),
+                                        jobs[i].compileOptions};
+                shaders.push_back(shader);
+                jobIndices.push_back(i);
+            }
+        }
+        if (shaders.empty())
+            continue;
+
+        std::vector<ShBatchResult> batchResults(shaders.size());
+        if (!ShCompileBatch(compiler, &shaders[0], shaders.size(), numThreads, &batchResults[0]))
+            success = false;
+        for (size_t i = 0; i < jobIndices.size(); ++i)
+            (*results)[jobIndices[i]] = batchResults[i];
+    }
+    return success;
+}
+
 static bool ReadShaderSource(const char *fileName, ShaderSource &source)
 {
     FILE *in = fopen(fileName, "rb");
@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SizedLRUCache.h:
+//   A cache of values keyed by strings, bounded by the total size of the keys and values, which
+//   evicts the least recently used entries first. It isn't thread safe; callers that share a cache
+//   across threads guard it themselves.
+//
+
+#ifndef COMMON_SIZEDLRUCACHE_H_
+#define COMMON_SIZEDLRUCACHE_H_
+
+#include <stdint.h>
+
+#include <list>
+#include <map>
+#include <string>
+
+#include "common/angleutils.h"
+#include "common/debug.h"
+#include "common/string_utils.h"
+
+namespace angle
+{
+
+// Value is a container of bytes, like std::string or std::vector<uint8_t>, whose size() counts
+// towards the budget along with the size of its key.
+template <typename Value>
+class SizedLRUCache final : angle::NonCopyable
+{
+  public:
+    explicit SizedLRUCache(size_t maxSize) : mMaxSize(maxSize), mSize(0) {}
+
+    // Returns null if the key isn't in the cache, otherwise makes it the most recently used.
+    const Value *find(const std::string &key)
+    {
+        auto iter = mEntries.find(HashString(key));
+        if (iter == mEntries.end() || iter->second.key != key)
+        {
+            return nullptr;
+        }
+
+        mLRU.splice(mLRU.begin(), mLRU, iter->second.lruPosition);
+        return &iter->second.value;
+    }
+
+    // Replaces the value of the key if it is in the cache. Values that don't fit in the whole
+    // budget aren't kept, and return false.
+    bool insert(const std::string &key, const Value &value)
+    {
+        uint64_t hash = HashString(key);
+        auto iter     = mEntries.find(hash);
+        if (iter != mEntries.end())
+        {
+            erase(iter);
+        }
+
+        if (key.size() + value.size() > mMaxSize)
+        {
+            return false;
+        }
+
+        mLRU.push_front(hash);
+
+        Entry &entry      = mEntries[hash];
+        entry.key         = key;
+        entry.value       = value;
+        entry.lruPosition = mLRU.begin();
+        mSize += key.size() + value.size();
+
+        evictToBudget();
+        return true;
+    }
+
+    void setMaxSize(size_t maxSize)
+    {
+        mMaxSize = maxSize;
+        evictToBudget();
+    }
+
+    void clear()
+    {
+        mEntries.clear();
+        mLRU.clear();
+        mSize = 0;
+    }
+
+    size_t size() const { return mSize; }
+    size_t maxSize() const { return mMaxSize; }
+    size_t entryCount() const { return mEntries.size(); }
+
+    // Calls function(key, value) for every entry, from the least to the most recently used, so
+    // that inserting them in that order into another cache keeps their order.
+    template <typename Function>
+    void forEach(Function function) const
+    {
+        for (auto lruIter = mLRU.rbegin(); lruIter != mLRU.rend(); ++lruIter)
+        {
+            const Entry &entry = mEntries.find(*lruIter)->second;
+            function(entry.key, entry.value);
+        }
+    }
+
+  private:
+    struct Entry
+    {
+        // The full key is kept alongside the value to rule out hash collisions.
+        std::string key;
+        Value value;
+        std::list<uint64_t>::iterator lruPosition;
+    };
+
+    typedef std::map<uint64_t, Entry> EntryMap;
+
+    void erase(typename EntryMap::iterator iter)
+    {
+        mSize -= iter->second.key.size() + iter->second.value.size();
+        mLRU.erase(iter->second.lruPosition);
+        mEntries.erase(iter);
+    }
+
+    void evictToBudget()
+    {
+        while (mSize > mMaxSize)
+        {
+            ASSERT(!mLRU.empty());
+            auto iter = mEntries.find(mLRU.back());
+            ASSERT(iter != mEntries.end());
+            erase(iter);
+        }
+    }
+
+    // Entries indexed by the hash of their key, and their hashes from most to least recently
+    // used.
+    EntryMap mEntries;
+    std::list<uint64_t> mLRU;
+
+    size_t mMaxSize;
+    size_t mSize;
+};
+
+}  // namespace angle
+
+#endif  // COMMON_SIZEDLRUCACHE_H_
@@ -0,0 +1,85 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Unit tests for ANGLE's SizedLRUCache helper class.
+//
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "common/SizedLRUCache.h"
+
+namespace
+{
+
+// Test finding inserted values, and replacing them.
+TEST(SizedLRUCacheTest, InsertAndFind)
+{
+    angle::SizedLRUCache<std::string> cache(100);
+    EXPECT_EQ(nullptr, cache.find("a"));
+
+    cache.insert("a", "1234");
+    ASSERT_NE(nullptr, cache.find("a"));
+    EXPECT_EQ("1234", *cache.find("a"));
+    EXPECT_EQ(5u, cache.size());
+
+    cache.insert("a", "56");
+    EXPECT_EQ("56", *cache.find("a"));
+    EXPECT_EQ(3u, cache.size());
+    EXPECT_EQ(1u, cache.entryCount());
+}
+
+// Test that the least recently used entries are evicted first, and that finding an entry makes it
+// the most recently used.
+TEST(SizedLRUCacheTest, EvictsLeastRecentlyUsed)
+{
+    angle::SizedLRUCache<std::vector<uint8_t>> cache(30);
+    cache.insert("a", std::vector<uint8_t>(9));
+    cache.insert("b", std::vector<uint8_t>(9));
+    cache.insert("c", std::vector<uint8_t>(9));
+    EXPECT_EQ(30u, cache.size());
+
+    EXPECT_NE(nullptr, cache.find("a"));
+    cache.insert("d", std::vector<uint8_t>(9));
+
+    EXPECT_NE(nullptr, cache.find("a"));
+    EXPECT_EQ(nullptr, cache.find("b"));
+    EXPECT_NE(nullptr, cache.find("c"));
+    EXPECT_NE(nullptr, cache.find("d"));
+    EXPECT_EQ(30u, cache.size());
+
+    // Shrinking the budget evicts down to it.
+    cache.setMaxSize(20);
+    EXPECT_EQ(2u, cache.entryCount());
+    EXPECT_EQ(nullptr, cache.find("a"));
+}
+
+// Test that values larger than the whole budget are not kept.
+TEST(SizedLRUCacheTest, SkipsOversizedValues)
+{
+    angle::SizedLRUCache<std::string> cache(10);
+    EXPECT_TRUE(cache.insert("a", "1"));
+    EXPECT_FALSE(cache.insert("b", std::string(20, 'x')));
+    EXPECT_EQ(nullptr, cache.find("b"));
+    EXPECT_NE(nullptr, cache.find("a"));
+    EXPECT_EQ(2u, cache.size());
+}
+
+// Test that forEach visits the entries from the least to the most recently used.
+TEST(SizedLRUCacheTest, ForEachOrder)
+{
+    angle::SizedLRUCache<std::string> cache(100);
+    cache.insert("a", "1");
+    cache.insert("b", "2");
+    cache.insert("c", "3");
+    cache.find("a");
+
+    std::string keys;
+    cache.forEach([&keys](const std::string &key, const std::string &) { keys += key; });
+    EXPECT_EQ("bca", keys);
+}
+
+}  // anonymous namespace
@@ -0,0 +1,738 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// index_utils.cpp: Implements the index range and index conversion kernels.
+
+#include "common/index_utils.h"
+
+#include "common/debug.h"
+#include "common/platform.h"
+#include "common/utilities.h"
+
+#if defined(ANGLE_USE_SSE)
+#include <immintrin.h>
+#endif
+
+namespace gl
+{
+
+namespace
+{
+
+// Accumulates the range of the indices that are not primitive restart indices.
+template <typename T>
+struct IndexRangeState
+{
+    IndexRangeState() : minIndex(std::numeric_limits<T>::max()), maxIndex(0), vertexIndexCount(0)
+    {
+    }
+
+    void add(T index, bool primitiveRestartEnabled)
+    {
+        if (primitiveRestartEnabled && index == std::numeric_limits<T>::max())
+        {
+            return;
+        }
+
+        minIndex = std::min(minIndex, index);
+        maxIndex = std::max(maxIndex, index);
+        vertexIndexCount++;
+    }
+
+    // Adds the minimum and maximum of a block of indices, the minimum may be a primitive restart
+    // index and the maximum must not be.
+    void addBlock(T blockMinIndex, T blockMaxIndex, size_t blockVertexIndexCount)
+    {
+        if (blockVertexIndexCount > 0)
+        {
+            minIndex = std::min(minIndex, blockMinIndex);
+            maxIndex = std::max(maxIndex, blockMaxIndex);
+            vertexIndexCount += blockVertexIndexCount;
+        }
+    }
+
+    IndexRange get() const
+    {
+        if (vertexIndexCount == 0)
+        {
+            return IndexRange();
+        }
+
+        return IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
+                          vertexIndexCount);
+    }
+
+    T minIndex;
+    T maxIndex;
+    size_t vertexIndexCount;
+};
+
+template <typename T>
+void ComputeRangeScalar(const T *indices,
+                        size_t count,
+                        bool primitiveRestartEnabled,
+                        IndexRangeState<T> *range)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        range->add(indices[i], primitiveRestartEnabled);
+    }
+}
+
+template <typename SourceT, typename DestT>
+void ConvertScalar(const SourceT *input,
+                   size_t count,
+                   bool primitiveRestartEnabled,
+                   DestT *output,
+                   IndexRangeState<DestT> *range)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        DestT index = static_cast<DestT>(input[i]);
+        if (primitiveRestartEnabled && input[i] == std::numeric_limits<SourceT>::max())
+        {
+            index = std::numeric_limits<DestT>::max();
+        }
+
+        output[i] = index;
+        if (range)
+        {
+            range->add(index, primitiveRestartEnabled);
+        }
+    }
+}
+
+size_t CountBits(uint32_t bits)
+{
+    bits = bits - ((bits >> 1) & 0x55555555u);
+    bits = (bits & 0x33333333u) + ((bits >> 2) & 0x33333333u);
+    return (((bits + (bits >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+}
+
+#if defined(ANGLE_USE_SSE)
+
+// SSE2 only has unsigned minimum and maximum for bytes, the wider types are compared as signed
+// integers after flipping their sign bit.
+template <typename T>
+struct SSE2Ops;
+
+template <>
+struct SSE2Ops<GLubyte>
+{
+    ANGLE_SSE2_FUNCTION static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+    ANGLE_SSE2_FUNCTION static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+    ANGLE_SSE2_FUNCTION static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+};
+
+template <>
+struct SSE2Ops<GLushort>
+{
+    ANGLE_SSE2_FUNCTION static __m128i Min(__m128i a, __m128i b)
+    {
+        const __m128i sign = _mm_set1_epi16(-0x8000);
+        return _mm_xor_si128(
+            _mm_min_epi16(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign)), sign);
+    }
+    ANGLE_SSE2_FUNCTION static __m128i Max(__m128i a, __m128i b)
+    {
+        const __m128i sign = _mm_set1_epi16(-0x8000);
+        return _mm_xor_si128(
+            _mm_max_epi16(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign)), sign);
+    }
+    ANGLE_SSE2_FUNCTION static __m128i Equal(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi16(a, b);
+    }
+};
+
+template <>
+struct SSE2Ops<GLuint>
+{
+    ANGLE_SSE2_FUNCTION static __m128i Min(__m128i a, __m128i b)
+    {
+        __m128i aGreater = GreaterThan(a, b);
+        return _mm_or_si128(_mm_and_si128(aGreater, b), _mm_andnot_si128(aGreater, a));
+    }
+    ANGLE_SSE2_FUNCTION static __m128i Max(__m128i a, __m128i b)
+    {
+        __m128i aGreater = GreaterThan(a, b);
+        return _mm_or_si128(_mm_and_si128(aGreater, a), _mm_andnot_si128(aGreater, b));
+    }
+    ANGLE_SSE2_FUNCTION static __m128i Equal(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi32(a, b);
+    }
+    ANGLE_SSE2_FUNCTION static __m128i GreaterThan(__m128i a, __m128i b)
+    {
+        const __m128i sign = _mm_set1_epi32(static_cast<int>(0x80000000u));
+        return _mm_cmpgt_epi32(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign));
+    }
+};
+
+// Accumulates the range of the vectors of indices of type T given to add, and merges it in range.
+template <typename T>
+class SSE2RangeAccumulator
+{
+  public:
+    ANGLE_SSE2_FUNCTION SSE2RangeAccumulator(bool primitiveRestartEnabled)
+        : mPrimitiveRestartEnabled(primitiveRestartEnabled),
+          mMin(_mm_set1_epi8(-1)),
+          mMax(_mm_setzero_si128()),
+          mRestart(_mm_set1_epi8(-1)),
+          mCount(0),
+          mRestartCount(0)
+    {
+    }
+
+    ANGLE_SSE2_FUNCTION void add(__m128i indices)
+    {
+        // The primitive restart index is the largest one, it only needs to be excluded from the
+        // maximum.
+        mMin = SSE2Ops<T>::Min(mMin, indices);
+        if (mPrimitiveRestartEnabled)
+        {
+            __m128i restart = SSE2Ops<T>::Equal(indices, mRestart);
+            mMax            = SSE2Ops<T>::Max(mMax, _mm_andnot_si128(restart, indices));
+            mRestartCount += CountBits(static_cast<uint32_t>(_mm_movemask_epi8(restart)));
+        }
+        else
+        {
+            mMax = SSE2Ops<T>::Max(mMax, indices);
+        }
+        mCount += sizeof(__m128i) / sizeof(T);
+    }
+
+    ANGLE_SSE2_FUNCTION void merge(IndexRangeState<T> *range) const
+    {
+        T mins[sizeof(__m128i) / sizeof(T)];
+        T maxs[sizeof(__m128i) / sizeof(T)];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(mins), mMin);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(maxs), mMax);
+
+        T minIndex = mins[0];
+        T maxIndex = maxs[0];
+        for (size_t i = 1; i < sizeof(__m128i) / sizeof(T); i++)
+        {
+            minIndex = std::min(minIndex, mins[i]);
+            maxIndex = std::max(maxIndex, maxs[i]);
+        }
+
+        // The mask of the primitive restart indices has a bit per byte.
+        range->addBlock(minIndex, maxIndex, mCount - mRestartCount / sizeof(T));
+    }
+
+  private:
+    bool mPrimitiveRestartEnabled;
+    __m128i mMin;
+    __m128i mMax;
+    __m128i mRestart;
+    size_t mCount;
+    size_t mRestartCount;
+};
+
+template <typename T>
+ANGLE_SSE2_FUNCTION void ComputeRangeSSE2(const T *indices,
+                                          size_t count,
+                                          bool primitiveRestartEnabled,
+                                          IndexRangeState<T> *range)
+{
+    const size_t lanes = sizeof(__m128i) / sizeof(T);
+
+    SSE2RangeAccumulator<T> accumulator(primitiveRestartEnabled);
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        accumulator.add(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i)));
+    }
+    accumulator.merge(range);
+
+    ComputeRangeScalar(indices + i, count - i, primitiveRestartEnabled, range);
+}
+
+// Widens the indices by interleaving them with zeros, and with the mask of the primitive restart
+// indices to turn them into the wider primitive restart index.
+template <typename SourceT>
+ANGLE_SSE2_FUNCTION void WidenSSE2(__m128i indices, __m128i restart, __m128i *low, __m128i *high);
+
+template <>
+ANGLE_SSE2_FUNCTION void WidenSSE2<GLubyte>(__m128i indices,
+                                            __m128i restart,
+                                            __m128i *low,
+                                            __m128i *high)
+{
+    const __m128i zero = _mm_setzero_si128();
+    *low  = _mm_or_si128(_mm_unpacklo_epi8(indices, zero), _mm_unpacklo_epi8(restart, restart));
+    *high = _mm_or_si128(_mm_unpackhi_epi8(indices, zero), _mm_unpackhi_epi8(restart, restart));
+}
+
+template <>
+ANGLE_SSE2_FUNCTION void WidenSSE2<GLushort>(__m128i indices,
+                                             __m128i restart,
+                                             __m128i *low,
+                                             __m128i *high)
+{
+    const __m128i zero = _mm_setzero_si128();
+    *low  = _mm_or_si128(_mm_unpacklo_epi16(indices, zero), _mm_unpacklo_epi16(restart, restart));
+    *high = _mm_or_si128(_mm_unpackhi_epi16(indices, zero), _mm_unpackhi_epi16(restart, restart));
+}
+
+template <typename SourceT, typename DestT>
+ANGLE_SSE2_FUNCTION void ConvertSSE2(const SourceT *input,
+                                     size_t count,
+                                     bool primitiveRestartEnabled,
+                                     DestT *output,
+                                     IndexRangeState<DestT> *range)
+{
+    static_assert(sizeof(DestT) == 2 * sizeof(SourceT), "Indices must be widened to twice the size");
+    const size_t lanes = sizeof(__m128i) / sizeof(SourceT);
+
+    SSE2RangeAccumulator<DestT> accumulator(primitiveRestartEnabled);
+    const __m128i allOnes = _mm_set1_epi8(-1);
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        __m128i indices = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+        __m128i restart = primitiveRestartEnabled ? SSE2Ops<SourceT>::Equal(indices, allOnes)
+                                                  : _mm_setzero_si128();
+
+        __m128i low;
+        __m128i high;
+        WidenSSE2<SourceT>(indices, restart, &low, &high);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), low);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i + lanes / 2), high);
+
+        if (range)
+        {
+            accumulator.add(low);
+            accumulator.add(high);
+        }
+    }
+
+    if (range)
+    {
+        accumulator.merge(range);
+    }
+    ConvertScalar(input + i, count - i, primitiveRestartEnabled, output + i, range);
+}
+
+template <typename T>
+ANGLE_SSE2_FUNCTION void CopySSE2(const T *input,
+                                  size_t count,
+                                  bool primitiveRestartEnabled,
+                                  T *output,
+                                  IndexRangeState<T> *range)
+{
+    const size_t lanes = sizeof(__m128i) / sizeof(T);
+
+    SSE2RangeAccumulator<T> accumulator(primitiveRestartEnabled);
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        __m128i indices = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), indices);
+        if (range)
+        {
+            accumulator.add(indices);
+        }
+    }
+
+    if (range)
+    {
+        accumulator.merge(range);
+    }
+    ConvertScalar(input + i, count - i, primitiveRestartEnabled, output + i, range);
+}
+
+// AVX2 has unsigned minimum and maximum for all the index types.
+template <typename T>
+struct AVX2Ops;
+
+template <>
+struct AVX2Ops<GLubyte>
+{
+    ANGLE_AVX2_FUNCTION static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu8(a, b); }
+    ANGLE_AVX2_FUNCTION static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu8(a, b); }
+    ANGLE_AVX2_FUNCTION static __m256i Equal(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi8(a, b);
+    }
+};
+
+template <>
+struct AVX2Ops<GLushort>
+{
+    ANGLE_AVX2_FUNCTION static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu16(a, b); }
+    ANGLE_AVX2_FUNCTION static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu16(a, b); }
+    ANGLE_AVX2_FUNCTION static __m256i Equal(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi16(a, b);
+    }
+    // Widens the indices by zero extension, and sign extends the mask of the primitive restart
+    // indices to turn them into the wider primitive restart index.
+    ANGLE_AVX2_FUNCTION static __m256i Widen(__m128i indices, __m128i restart)
+    {
+        return _mm256_or_si256(_mm256_cvtepu8_epi16(indices), _mm256_cvtepi8_epi16(restart));
+    }
+};
+
+template <>
+struct AVX2Ops<GLuint>
+{
+    ANGLE_AVX2_FUNCTION static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu32(a, b); }
+    ANGLE_AVX2_FUNCTION static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu32(a, b); }
+    ANGLE_AVX2_FUNCTION static __m256i Equal(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi32(a, b);
+    }
+    ANGLE_AVX2_FUNCTION static __m256i Widen(__m128i indices, __m128i restart)
+    {
+        return _mm256_or_si256(_mm256_cvtepu16_epi32(indices), _mm256_cvtepi16_epi32(restart));
+    }
+};
+
+template <typename T>
+class AVX2RangeAccumulator
+{
+  public:
+    ANGLE_AVX2_FUNCTION AVX2RangeAccumulator(bool primitiveRestartEnabled)
+        : mPrimitiveRestartEnabled(primitiveRestartEnabled),
+          mMin(_mm256_set1_epi8(-1)),
+          mMax(_mm256_setzero_si256()),
+          mRestart(_mm256_set1_epi8(-1)),
+          mCount(0),
+          mRestartCount(0)
+    {
+    }
+
+    ANGLE_AVX2_FUNCTION void add(__m256i indices)
+    {
+        mMin = AVX2Ops<T>::Min(mMin, indices);
+        if (mPrimitiveRestartEnabled)
+        {
+            __m256i restart = AVX2Ops<T>::Equal(indices, mRestart);
+            mMax            = AVX2Ops<T>::Max(mMax, _mm256_andnot_si256(restart, indices));
+            mRestartCount += CountBits(static_cast<uint32_t>(_mm256_movemask_epi8(restart)));
+        }
+        else
+        {
+            mMax = AVX2Ops<T>::Max(mMax, indices);
+        }
+        mCount += sizeof(__m256i) / sizeof(T);
+    }
+
+    ANGLE_AVX2_FUNCTION void merge(IndexRangeState<T> *range) const
+    {
+        T mins[sizeof(__m256i) / sizeof(T)];
+        T maxs[sizeof(__m256i) / sizeof(T)];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(mins), mMin);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(maxs), mMax);
+
+        T minIndex = mins[0];
+        T maxIndex = maxs[0];
+        for (size_t i = 1; i < sizeof(__m256i) / sizeof(T); i++)
+        {
+            minIndex = std::min(minIndex, mins[i]);
+            maxIndex = std::max(maxIndex, maxs[i]);
+        }
+
+        range->addBlock(minIndex, maxIndex, mCount - mRestartCount / sizeof(T));
+    }
+
+  private:
+    bool mPrimitiveRestartEnabled;
+    __m256i mMin;
+    __m256i mMax;
+    __m256i mRestart;
+    size_t mCount;
+    size_t mRestartCount;
+};
+
+template <typename T>
+ANGLE_AVX2_FUNCTION void ComputeRangeAVX2(const T *indices,
+                                          size_t count,
+                                          bool primitiveRestartEnabled,
+                                          IndexRangeState<T> *range)
+{
+    const size_t lanes = sizeof(__m256i) / sizeof(T);
+
+    AVX2RangeAccumulator<T> accumulator(primitiveRestartEnabled);
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        accumulator.add(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i)));
+    }
+    accumulator.merge(range);
+
+    ComputeRangeScalar(indices + i, count - i, primitiveRestartEnabled, range);
+}
+
+template <typename SourceT, typename DestT>
+ANGLE_AVX2_FUNCTION void ConvertAVX2(const SourceT *input,
+                                     size_t count,
+                                     bool primitiveRestartEnabled,
+                                     DestT *output,
+                                     IndexRangeState<DestT> *range)
+{
+    static_assert(sizeof(DestT) == 2 * sizeof(SourceT), "Indices must be widened to twice the size");
+    const size_t lanes = sizeof(__m128i) / sizeof(SourceT);
+
+    AVX2RangeAccumulator<DestT> accumulator(primitiveRestartEnabled);
+    const __m128i allOnes = _mm_set1_epi8(-1);
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        __m128i indices = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+        __m128i restart = primitiveRestartEnabled ? SSE2Ops<SourceT>::Equal(indices, allOnes)
+                                                  : _mm_setzero_si128();
+
+        __m256i widened = AVX2Ops<DestT>::Widen(indices, restart);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + i), widened);
+        if (range)
+        {
+            accumulator.add(widened);
+        }
+    }
+
+    if (range)
+    {
+        accumulator.merge(range);
+    }
+    ConvertScalar(input + i, count - i, primitiveRestartEnabled, output + i, range);
+}
+
+template <typename T>
+ANGLE_AVX2_FUNCTION void CopyAVX2(const T *input,
+                                  size_t count,
+                                  bool primitiveRestartEnabled,
+                                  T *output,
+                                  IndexRangeState<T> *range)
+{
+    const size_t lanes = sizeof(__m256i) / sizeof(T);
+
+    AVX2RangeAccumulator<T> accumulator(primitiveRestartEnabled);
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes)
+    {
+        __m256i indices = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + i), indices);
+        if (range)
+        {
+            accumulator.add(indices);
+        }
+    }
+
+    if (range)
+    {
+        accumulator.merge(range);
+    }
+    ConvertScalar(input + i, count - i, primitiveRestartEnabled, output + i, range);
+}
+
+#endif  // defined(ANGLE_USE_SSE)
+
+template <typename T>
+IndexRange ComputeTypedIndexRange(IndexKernelSet kernels,
+                                  const T *indices,
+                                  size_t count,
+                                  bool primitiveRestartEnabled)
+{
+    ASSERT(count > 0);
+
+    IndexRangeState<T> range;
+    switch (kernels)
+    {
+#if defined(ANGLE_USE_SSE)
+        case INDEX_KERNELS_AVX2:
+            ComputeRangeAVX2(indices, count, primitiveRestartEnabled, &range);
+            break;
+        case INDEX_KERNELS_SSE2:
+            ComputeRangeSSE2(indices, count, primitiveRestartEnabled, &range);
+            break;
+#endif
+        default:
+            ComputeRangeScalar(indices, count, primitiveRestartEnabled, &range);
+            break;
+    }
+    return range.get();
+}
+
+template <typename SourceT, typename DestT>
+void ConvertTypedIndices(IndexKernelSet kernels,
+                         const SourceT *input,
+                         size_t count,
+                         bool primitiveRestartEnabled,
+                         DestT *output,
+                         IndexRange *outRange)
+{
+    IndexRangeState<DestT> range;
+    IndexRangeState<DestT> *rangePointer = outRange ? &range : nullptr;
+    switch (kernels)
+    {
+#if defined(ANGLE_USE_SSE)
+        case INDEX_KERNELS_AVX2:
+            ConvertAVX2(input, count, primitiveRestartEnabled, output, rangePointer);
+            break;
+        case INDEX_KERNELS_SSE2:
+            ConvertSSE2(input, count, primitiveRestartEnabled, output, rangePointer);
+            break;
+#endif
+        default:
+            ConvertScalar(input, count, primitiveRestartEnabled, output, rangePointer);
+            break;
+    }
+
+    if (outRange)
+    {
+        *outRange = range.get();
+    }
+}
+
+template <typename T>
+void CopyTypedIndices(IndexKernelSet kernels,
+                      const T *input,
+                      size_t count,
+                      bool primitiveRestartEnabled,
+                      T *output,
+                      IndexRange *outRange)
+{
+    if (outRange == nullptr)
+    {
+        memcpy(output, input, count * sizeof(T));
+        return;
+    }
+
+    IndexRangeState<T> range;
+    switch (kernels)
+    {
+#if defined(ANGLE_USE_SSE)
+        case INDEX_KERNELS_AVX2:
+            CopyAVX2(input, count, primitiveRestartEnabled, output, &range);
+            break;
+        case INDEX_KERNELS_SSE2:
+            CopySSE2(input, count, primitiveRestartEnabled, output, &range);
+            break;
+#endif
+        default:
+            ConvertScalar(input, count, primitiveRestartEnabled, output, &range);
+            break;
+    }
+    *outRange = range.get();
+}
+
+}  // anonymous namespace
+
+IndexKernelSet GetSupportedIndexKernelSet()
+{
+#if defined(ANGLE_USE_SSE)
+    static bool checked             = false;
+    static IndexKernelSet supported = INDEX_KERNELS_SCALAR;
+
+    if (!checked)
+    {
+        if (supportsAVX2())
+        {
+            supported = INDEX_KERNELS_AVX2;
+        }
+        else if (supportsSSE2())
+        {
+            supported = INDEX_KERNELS_SSE2;
+        }
+        checked = true;
+    }
+
+    return supported;
+#else
+    return INDEX_KERNELS_SCALAR;
+#endif
+}
+
+IndexRange ComputeIndexRange(IndexKernelSet kernels,
+                             GLenum indexType,
+                             const GLvoid *indices,
+                             size_t count,
+                             bool primitiveRestartEnabled)
+{
+    switch (indexType)
+    {
+        case GL_UNSIGNED_BYTE:
+            return ComputeTypedIndexRange(kernels, static_cast<const GLubyte *>(indices), count,
+                                          primitiveRestartEnabled);
+        case GL_UNSIGNED_SHORT:
+            return ComputeTypedIndexRange(kernels, static_cast<const GLushort *>(indices), count,
+                                          primitiveRestartEnabled);
+        case GL_UNSIGNED_INT:
+            return ComputeTypedIndexRange(kernels, static_cast<const GLuint *>(indices), count,
+                                          primitiveRestartEnabled);
+        default:
+            UNREACHABLE();
+            return IndexRange();
+    }
+}
+
+void ConvertIndices(GLenum sourceType,
+                    GLenum destinationType,
+                    const GLvoid *input,
+                    size_t count,
+                    bool primitiveRestartEnabled,
+                    GLvoid *output,
+                    IndexRange *outRange)
+{
+    ConvertIndices(GetSupportedIndexKernelSet(), sourceType, destinationType, input, count,
+                   primitiveRestartEnabled, output, outRange);
+}
+
+void ConvertIndices(IndexKernelSet kernels,
+                    GLenum sourceType,
+                    GLenum destinationType,
+                    const GLvoid *input,
+                    size_t count,
+                    bool primitiveRestartEnabled,
+                    GLvoid *output,
+                    IndexRange *outRange)
+{
+    if (sourceType == destinationType)
+    {
+        switch (sourceType)
+        {
+            case GL_UNSIGNED_BYTE:
+                CopyTypedIndices(kernels, static_cast<const GLubyte *>(input), count,
+                                 primitiveRestartEnabled, static_cast<GLubyte *>(output),
+                                 outRange);
+                break;
+            case GL_UNSIGNED_SHORT:
+                CopyTypedIndices(kernels, static_cast<const GLushort *>(input), count,
+                                 primitiveRestartEnabled, static_cast<GLushort *>(output),
+                                 outRange);
+                break;
+            case GL_UNSIGNED_INT:
+                CopyTypedIndices(kernels, static_cast<const GLuint *>(input), count,
+                                 primitiveRestartEnabled, static_cast<GLuint *>(output),
+                                 outRange);
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+    }
+    else if (sourceType == GL_UNSIGNED_BYTE)
+    {
+        ASSERT(destinationType == GL_UNSIGNED_SHORT);
+        ConvertTypedIndices(kernels, static_cast<const GLubyte *>(input), count,
+                            primitiveRestartEnabled, static_cast<GLushort *>(output), outRange);
+    }
+    else if (sourceType == GL_UNSIGNED_SHORT)
+    {
+        ASSERT(destinationType == GL_UNSIGNED_INT);
+        ConvertTypedIndices(kernels, static_cast<const GLushort *>(input), count,
+                            primitiveRestartEnabled, static_cast<GLuint *>(output), outRange);
+    }
+    else
+    {
+        UNREACHABLE();
+    }
+}
+
+}  // namespace gl
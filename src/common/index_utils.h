@@ -0,0 +1,60 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// index_utils.h: Kernels computing the range of index arrays and converting them between index
+// types, with SSE2 and AVX2 versions picked at runtime.
+
+#ifndef COMMON_INDEX_UTILS_H_
+#define COMMON_INDEX_UTILS_H_
+
+#include "angle_gl.h"
+#include "common/mathutil.h"
+
+namespace gl
+{
+
+// The instruction sets the index kernels can be run with, from the slowest to the fastest.
+enum IndexKernelSet
+{
+    INDEX_KERNELS_SCALAR,
+    INDEX_KERNELS_SSE2,
+    INDEX_KERNELS_AVX2,
+};
+
+// Returns the fastest kernels the CPU supports, which the overloads without an IndexKernelSet use.
+IndexKernelSet GetSupportedIndexKernelSet();
+
+// Find the range of index values like ComputeIndexRange, with the given kernels, which must be
+// supported.
+IndexRange ComputeIndexRange(IndexKernelSet kernels,
+                             GLenum indexType,
+                             const GLvoid *indices,
+                             size_t count,
+                             bool primitiveRestartEnabled);
+
+// Converts count indices of sourceType to destinationType, which must be the same type or twice
+// as wide. If primitive restart is enabled, the primitive restart indices of sourceType are
+// converted to the one of destinationType. If outRange isn't null, it receives the range of the
+// indices, computed in the same pass.
+void ConvertIndices(GLenum sourceType,
+                    GLenum destinationType,
+                    const GLvoid *input,
+                    size_t count,
+                    bool primitiveRestartEnabled,
+                    GLvoid *output,
+                    IndexRange *outRange);
+void ConvertIndices(IndexKernelSet kernels,
+                    GLenum sourceType,
+                    GLenum destinationType,
+                    const GLvoid *input,
+                    size_t count,
+                    bool primitiveRestartEnabled,
+                    GLvoid *output,
+                    IndexRange *outRange);
+
+}  // namespace gl
+
+#endif  // COMMON_INDEX_UTILS_H_
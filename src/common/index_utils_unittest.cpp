@@ -0,0 +1,203 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// index_utils_unittest.cpp: Unit tests for the index range and conversion kernels.
+//
+
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "common/index_utils.h"
+#include "common/utilities.h"
+
+namespace
+{
+
+template <typename T>
+std::vector<T> GenerateIndices(size_t count, unsigned int seed, bool withRestartIndices)
+{
+    std::vector<T> indices(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        indices[i] = static_cast<T>((seed >> 8) | (seed << 24));
+        if (withRestartIndices && (seed >> 28) == 0)
+        {
+            indices[i] = std::numeric_limits<T>::max();
+        }
+    }
+    return indices;
+}
+
+// Returns the kernel sets this CPU can run, from the slowest to the fastest.
+std::vector<gl::IndexKernelSet> GetKernelSets()
+{
+    std::vector<gl::IndexKernelSet> kernelSets;
+    for (int kernels = gl::INDEX_KERNELS_SCALAR; kernels <= gl::GetSupportedIndexKernelSet();
+         kernels++)
+    {
+        kernelSets.push_back(static_cast<gl::IndexKernelSet>(kernels));
+    }
+    return kernelSets;
+}
+
+void ExpectRangeEq(const gl::IndexRange &expected, const gl::IndexRange &actual)
+{
+    EXPECT_EQ(expected.start, actual.start);
+    EXPECT_EQ(expected.end, actual.end);
+    EXPECT_EQ(expected.vertexIndexCount, actual.vertexIndexCount);
+}
+
+// Computes the range of the indices one by one.
+template <typename T>
+gl::IndexRange ReferenceRange(const std::vector<T> &indices, bool primitiveRestartEnabled)
+{
+    gl::IndexRange range;
+    bool first = true;
+    for (T index : indices)
+    {
+        if (primitiveRestartEnabled && index == std::numeric_limits<T>::max())
+        {
+            continue;
+        }
+
+        range.start = first ? index : std::min<size_t>(range.start, index);
+        range.end   = first ? index : std::max<size_t>(range.end, index);
+        range.vertexIndexCount++;
+        first = false;
+    }
+    return range;
+}
+
+template <typename T>
+void CheckIndexRange(GLenum type)
+{
+    // The counts cover the scalar tail after the vectors of each kernel set.
+    const size_t kCounts[] = {1, 3, 15, 16, 17, 31, 32, 33, 64, 1000, 4099};
+    for (size_t count : kCounts)
+    {
+        for (bool restart : {false, true})
+        {
+            std::vector<T> indices = GenerateIndices<T>(count, static_cast<unsigned int>(count),
+                                                        restart);
+            gl::IndexRange expected = ReferenceRange(indices, restart);
+            for (gl::IndexKernelSet kernels : GetKernelSets())
+            {
+                SCOPED_TRACE(testing::Message() << "count " << count << " restart " << restart
+                                                << " kernels " << kernels);
+                ExpectRangeEq(expected, gl::ComputeIndexRange(kernels, type, indices.data(),
+                                                              count, restart));
+            }
+        }
+    }
+}
+
+// Test the range of unsigned byte indices with every kernel set.
+TEST(IndexUtilsTest, UnsignedByteRange)
+{
+    CheckIndexRange<GLubyte>(GL_UNSIGNED_BYTE);
+}
+
+// Test the range of unsigned short indices with every kernel set.
+TEST(IndexUtilsTest, UnsignedShortRange)
+{
+    CheckIndexRange<GLushort>(GL_UNSIGNED_SHORT);
+}
+
+// Test the range of unsigned int indices with every kernel set.
+TEST(IndexUtilsTest, UnsignedIntRange)
+{
+    CheckIndexRange<GLuint>(GL_UNSIGNED_INT);
+}
+
+// Test that the primitive restart index is only left out of the range when primitive restart is
+// enabled, including when every index is the primitive restart index.
+TEST(IndexUtilsTest, PrimitiveRestartRange)
+{
+    std::vector<GLushort> indices(100, 0xFFFF);
+    for (gl::IndexKernelSet kernels : GetKernelSets())
+    {
+        ExpectRangeEq(gl::IndexRange(0, 0, 0),
+                      gl::ComputeIndexRange(kernels, GL_UNSIGNED_SHORT, indices.data(),
+                                            indices.size(), true));
+        ExpectRangeEq(gl::IndexRange(0xFFFF, 0xFFFF, 100),
+                      gl::ComputeIndexRange(kernels, GL_UNSIGNED_SHORT, indices.data(),
+                                            indices.size(), false));
+    }
+
+    indices[70] = 5;
+    indices[71] = 9;
+    for (gl::IndexKernelSet kernels : GetKernelSets())
+    {
+        ExpectRangeEq(gl::IndexRange(5, 9, 2),
+                      gl::ComputeIndexRange(kernels, GL_UNSIGNED_SHORT, indices.data(),
+                                            indices.size(), true));
+    }
+}
+
+template <typename SourceT, typename DestT>
+void CheckConvertIndices(GLenum sourceType, GLenum destinationType)
+{
+    const size_t kCounts[] = {1, 7, 8, 16, 17, 33, 1000, 4099};
+    for (size_t count : kCounts)
+    {
+        for (bool restart : {false, true})
+        {
+            std::vector<SourceT> input =
+                GenerateIndices<SourceT>(count, static_cast<unsigned int>(count) + 7, true);
+
+            std::vector<DestT> expected(count);
+            for (size_t i = 0; i < count; i++)
+            {
+                expected[i] = (restart && input[i] == std::numeric_limits<SourceT>::max())
+                                  ? std::numeric_limits<DestT>::max()
+                                  : static_cast<DestT>(input[i]);
+            }
+            gl::IndexRange expectedRange = ReferenceRange(expected, restart);
+
+            for (gl::IndexKernelSet kernels : GetKernelSets())
+            {
+                SCOPED_TRACE(testing::Message() << "count " << count << " restart " << restart
+                                                << " kernels " << kernels);
+
+                std::vector<DestT> output(count);
+                gl::ConvertIndices(kernels, sourceType, destinationType, input.data(), count,
+                                   restart, output.data(), nullptr);
+                EXPECT_EQ(expected, output);
+
+                std::vector<DestT> outputWithRange(count);
+                gl::IndexRange range;
+                gl::ConvertIndices(kernels, sourceType, destinationType, input.data(), count,
+                                   restart, outputWithRange.data(), &range);
+                EXPECT_EQ(expected, outputWithRange);
+                ExpectRangeEq(expectedRange, range);
+            }
+        }
+    }
+}
+
+// Test widening unsigned byte indices to unsigned short with every kernel set.
+TEST(IndexUtilsTest, ConvertUnsignedByteToUnsignedShort)
+{
+    CheckConvertIndices<GLubyte, GLushort>(GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT);
+}
+
+// Test widening unsigned short indices to unsigned int with every kernel set.
+TEST(IndexUtilsTest, ConvertUnsignedShortToUnsignedInt)
+{
+    CheckConvertIndices<GLushort, GLuint>(GL_UNSIGNED_SHORT, GL_UNSIGNED_INT);
+}
+
+// Test copying indices of the same type while computing their range with every kernel set.
+TEST(IndexUtilsTest, CopyIndices)
+{
+    CheckConvertIndices<GLubyte, GLubyte>(GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE);
+    CheckConvertIndices<GLushort, GLushort>(GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT);
+    CheckConvertIndices<GLuint, GLuint>(GL_UNSIGNED_INT, GL_UNSIGNED_INT);
+}
+
+}  // anonymous namespace
@@ -149,12 +149,50 @@ inline bool supportsSSE2()
     checked = true;
 
     return supports;
+#elif defined(ANGLE_USE_SSE) && (defined(__GNUC__) || defined(__clang__))
+    return __builtin_cpu_supports("sse2") != 0;
 #else
     UNIMPLEMENTED();
     return false;
 #endif
 }
 
+inline bool supportsAVX2()
+{
+#if defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM)
+    static bool checked = false;
+    static bool supports = false;
+
+    if (checked)
+    {
+        return supports;
+    }
+
+    int info[4];
+    __cpuid(info, 0);
+
+    if (info[0] >= 7)
+    {
+        // The OS must also save the AVX registers on context switches.
+        __cpuid(info, 1);
+        bool osSavesAVX = ((info[2] >> 27) & 1) && ((info[2] >> 28) & 1) &&
+                          (_xgetbv(0) & 0x6) == 0x6;
+
+        __cpuidex(info, 7, 0);
+
+        supports = osSavesAVX && ((info[1] >> 5) & 1);
+    }
+
+    checked = true;
+
+    return supports;
+#elif defined(ANGLE_USE_SSE) && (defined(__GNUC__) || defined(__clang__))
+    return __builtin_cpu_supports("avx2") != 0;
+#else
+    return false;
+#endif
+}
+
 template <typename destType, typename sourceType>
 destType bitCast(const sourceType &source)
 {
@@ -93,8 +93,19 @@
 #   undef far
 #endif
 
-#if !defined(_M_ARM) && !defined(ANGLE_PLATFORM_ANDROID)
+#if (defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)) && \
+    !defined(ANGLE_PLATFORM_ANDROID)
 #   define ANGLE_USE_SSE
 #endif
 
+// GCC and Clang only allow the intrinsics of an instruction set in functions compiled for it, while
+// MSVC allows them anywhere. These functions must only be called once the CPU support is checked.
+#if defined(ANGLE_USE_SSE) && (defined(__GNUC__) || defined(__clang__))
+#   define ANGLE_SSE2_FUNCTION __attribute__((target("sse2")))
+#   define ANGLE_AVX2_FUNCTION __attribute__((target("avx2")))
+#else
+#   define ANGLE_SSE2_FUNCTION
+#   define ANGLE_AVX2_FUNCTION
+#endif
+
 #endif // COMMON_PLATFORM_H_
@@ -133,4 +133,15 @@ bool ReadFileToString(const std::string &path, std::string *stringOut)
     return !inFile.fail();
 }
 
+uint64_t HashString(const std::string &input)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : input)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
 }
@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_STRING_UTILS_H_
 #define LIBANGLE_STRING_UTILS_H_
 
+#include <stdint.h>
+
 #include <string>
 #include <vector>
 
@@ -44,6 +46,9 @@ bool HexStringToUInt(const std::string &input, unsigned int *uintOut);
 
 bool ReadFileToString(const std::string &path, std::string *stringOut);
 
+// 64-bit FNV-1a hash of the bytes of the string.
+uint64_t HashString(const std::string &input);
+
 }
 
 #endif // LIBANGLE_STRING_UTILS_H_
@@ -7,6 +7,7 @@
 // utilities.cpp: Conversion functions and other utility routines.
 
 #include "common/utilities.h"
+#include "common/index_utils.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
 
@@ -19,78 +20,6 @@
 #  include <windows.graphics.display.h>
 #endif
 
-namespace
-{
-
-template <class IndexType>
-gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
-                                      size_t count,
-                                      bool primitiveRestartEnabled,
-                                      GLuint primitiveRestartIndex)
-{
-    ASSERT(count > 0);
-
-    IndexType minIndex                = 0;
-    IndexType maxIndex                = 0;
-    size_t nonPrimitiveRestartIndices = 0;
-
-    if (primitiveRestartEnabled)
-    {
-        // Find the first non-primitive restart index to initialize the min and max values
-        size_t i = 0;
-        for (; i < count; i++)
-        {
-            if (indices[i] != primitiveRestartIndex)
-            {
-                minIndex = indices[i];
-                maxIndex = indices[i];
-                nonPrimitiveRestartIndices++;
-                break;
-            }
-        }
-
-        // Loop over the rest of the indices
-        for (; i < count; i++)
-        {
-            if (indices[i] != primitiveRestartIndex)
-            {
-                if (minIndex > indices[i])
-                {
-                    minIndex = indices[i];
-                }
-                if (maxIndex < indices[i])
-                {
-                    maxIndex = indices[i];
-                }
-                nonPrimitiveRestartIndices++;
-            }
-        }
-    }
-    else
-    {
-        minIndex                   = indices[0];
-        maxIndex                   = indices[0];
-        nonPrimitiveRestartIndices = count;
-
-        for (size_t i = 1; i < count; i++)
-        {
-            if (minIndex > indices[i])
-            {
-                minIndex = indices[i];
-            }
-            if (maxIndex < indices[i])
-            {
-                maxIndex = indices[i];
-            }
-        }
-    }
-
-    return gl::IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
-                          nonPrimitiveRestartIndices);
-}
-
-}  // anonymous namespace
-
 namespace gl
 {
 
@@ -476,24 +405,8 @@ IndexRange ComputeIndexRange(GLenum indexType,
                              size_t count,
                              bool primitiveRestartEnabled)
 {
-    switch (indexType)
-    {
-        case GL_UNSIGNED_BYTE:
-            return ComputeTypedIndexRange(static_cast<const GLubyte *>(indices), count,
-                                          primitiveRestartEnabled,
-                                          GetPrimitiveRestartIndex(indexType));
-        case GL_UNSIGNED_SHORT:
-            return ComputeTypedIndexRange(static_cast<const GLushort *>(indices), count,
-                                          primitiveRestartEnabled,
-                                          GetPrimitiveRestartIndex(indexType));
-        case GL_UNSIGNED_INT:
-            return ComputeTypedIndexRange(static_cast<const GLuint *>(indices), count,
-                                          primitiveRestartEnabled,
-                                          GetPrimitiveRestartIndex(indexType));
-        default:
-            UNREACHABLE();
-            return IndexRange();
-    }
+    return ComputeIndexRange(GetSupportedIndexKernelSet(), indexType, indices, count,
+                             primitiveRestartEnabled);
 }
 
 GLuint GetPrimitiveRestartIndex(GLenum indexType)
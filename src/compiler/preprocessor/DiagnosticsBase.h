@@ -65,6 +65,7 @@ class Diagnostics
         PP_INVALID_FILE_NUMBER,
         PP_INVALID_LINE_DIRECTIVE,
         PP_NON_PP_TOKEN_BEFORE_EXTENSION_ESSL3,
+        PP_TOO_MANY_TOKENS,
         PP_ERROR_END,
 
         PP_WARNING_BEGIN,
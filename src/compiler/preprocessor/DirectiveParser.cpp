@@ -131,7 +131,7 @@ bool isMacroPredefined(const std::string &name,
                        const pp::MacroSet &macroSet)
 {
     pp::MacroSet::const_iterator iter = macroSet.find(name);
-    return iter != macroSet.end() ? iter->second.predefined : false;
+    return iter != macroSet.end() ? iter->second->predefined : false;
 }
 
 }  // namespace anonymous
@@ -141,12 +141,14 @@ namespace pp
 
 DirectiveParser::DirectiveParser(Tokenizer *tokenizer,
                                  MacroSet *macroSet,
+                                 const std::shared_ptr<TokenTextPool> &textPool,
                                  Diagnostics *diagnostics,
                                  DirectiveHandler *directiveHandler)
     : mPastFirstStatement(false),
       mSeenNonPreprocessorToken(false),
       mTokenizer(tokenizer),
       mMacroSet(macroSet),
+      mTextPool(textPool),
       mDiagnostics(diagnostics),
       mDirectiveHandler(directiveHandler),
       mShaderVersion(100)
@@ -301,8 +303,9 @@ void DirectiveParser::parseDefine(Token *token)
     }
 
     Macro macro;
-    macro.type = Macro::kTypeObj;
-    macro.name = token->text;
+    macro.type     = Macro::kTypeObj;
+    macro.name     = token->text;
+    macro.textPool = mTextPool;
 
     mTokenizer->lex(token);
     if (token->type == '(' && !token->hasLeadingSpace())
@@ -353,17 +356,40 @@ void DirectiveParser::parseDefine(Token *token)
         // the replacement list for either form of macro.
         macro.replacements.front().setHasLeadingSpace(false);
     }
+    if (macro.type == Macro::kTypeFunc)
+    {
+        // Look up the parameters once here rather than at every expansion.
+        macro.replacementParameters.reserve(macro.replacements.size());
+        for (const Token &repl : macro.replacements)
+        {
+            int parameter = -1;
+            if (repl.type == Token::IDENTIFIER)
+            {
+                auto paramIter =
+                    std::find(macro.parameters.begin(), macro.parameters.end(), repl.text);
+                if (paramIter != macro.parameters.end())
+                {
+                    parameter = static_cast<int>(paramIter - macro.parameters.begin());
+                }
+            }
+            macro.replacementParameters.push_back(parameter);
+        }
+    }
 
     // Check for macro redefinition.
     MacroSet::const_iterator iter = mMacroSet->find(macro.name);
-    if (iter != mMacroSet->end() && !macro.equals(iter->second))
+    if (iter != mMacroSet->end() && !macro.equals(*iter->second))
     {
         mDiagnostics->report(Diagnostics::PP_MACRO_REDEFINED,
                              token->location,
                              macro.name);
         return;
     }
-    mMacroSet->insert(std::make_pair(macro.name, macro));
+    if (iter == mMacroSet->end())
+    {
+        std::shared_ptr<const Macro> definedMacro = std::make_shared<const Macro>(std::move(macro));
+        mMacroSet->insert(std::make_pair(definedMacro->name, definedMacro));
+    }
 }
 
 void DirectiveParser::parseUndef(Token *token)
@@ -381,7 +407,7 @@ void DirectiveParser::parseUndef(Token *token)
     MacroSet::iterator iter = mMacroSet->find(token->text);
     if (iter != mMacroSet->end())
     {
-        if (iter->second.predefined)
+        if (iter->second->predefined)
         {
             mDiagnostics->report(Diagnostics::PP_MACRO_PREDEFINED_UNDEFINED,
                                  token->location, token->text);
@@ -764,7 +790,7 @@ void DirectiveParser::parseVersion(Token *token)
     {
         mDirectiveHandler->handleVersion(token->location, version);
         mShaderVersion = version;
-        PredefineMacro(mMacroSet, "__VERSION__", version);
+        PredefineMacro(mMacroSet, "__VERSION__", version, mTextPool);
     }
 }
 
@@ -776,7 +802,7 @@ void DirectiveParser::parseLine(Token *token)
     bool parsedFileNumber = false;
     int line = 0, file = 0;
 
-    MacroExpander macroExpander(mTokenizer, mMacroSet, mDiagnostics, false);
+    MacroExpander macroExpander(mTokenizer, mMacroSet, mTextPool.get(), mDiagnostics, false);
 
     // Lex the first token after "#line" so we can check it for EOD.
     macroExpander.lex(token);
@@ -885,7 +911,7 @@ int DirectiveParser::parseExpressionIf(Token *token)
     assert((getDirective(token) == DIRECTIVE_IF) ||
            (getDirective(token) == DIRECTIVE_ELIF));
 
-    MacroExpander macroExpander(mTokenizer, mMacroSet, mDiagnostics, true);
+    MacroExpander macroExpander(mTokenizer, mMacroSet, mTextPool.get(), mDiagnostics, true);
     ExpressionParser expressionParser(&macroExpander, mDiagnostics);
 
     int expression = 0;
@@ -24,6 +24,7 @@ class DirectiveParser : public Lexer
   public:
     DirectiveParser(Tokenizer *tokenizer,
                     MacroSet *macroSet,
+                    const std::shared_ptr<TokenTextPool> &textPool,
                     Diagnostics *diagnostics,
                     DirectiveHandler *directiveHandler);
 
@@ -75,6 +76,7 @@ class DirectiveParser : public Lexer
     std::vector<ConditionalBlock> mConditionalStack;
     Tokenizer *mTokenizer;
     MacroSet *mMacroSet;
+    std::shared_ptr<TokenTextPool> mTextPool;
     Diagnostics *mDiagnostics;
     DirectiveHandler *mDirectiveHandler;
     int mShaderVersion;
@@ -21,20 +21,24 @@ bool Macro::equals(const Macro &other) const
            (replacements == other.replacements);
 }
 
-void PredefineMacro(MacroSet *macroSet, const char *name, int value)
+void PredefineMacro(MacroSet *macroSet,
+                    const char *name,
+                    int value,
+                    const std::shared_ptr<TokenTextPool> &textPool)
 {
     std::ostringstream stream;
     stream << value;
 
     Token token;
     token.type = Token::CONST_INT;
-    token.text = stream.str();
-
-    Macro macro;
-    macro.predefined = true;
-    macro.type       = Macro::kTypeObj;
-    macro.name = name;
-    macro.replacements.push_back(token);
+    token.text = textPool->intern(stream.str());
+
+    std::shared_ptr<Macro> macro = std::make_shared<Macro>();
+    macro->predefined = true;
+    macro->type       = Macro::kTypeObj;
+    macro->name       = name;
+    macro->replacements.push_back(token);
+    macro->textPool   = textPool;
 
     (*macroSet)[name] = macro;
 }
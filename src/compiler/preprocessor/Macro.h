@@ -7,15 +7,16 @@
 #ifndef COMPILER_PREPROCESSOR_MACRO_H_
 #define COMPILER_PREPROCESSOR_MACRO_H_
 
-#include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "Token.h"
+
 namespace pp
 {
 
-struct Token;
-
 struct Macro
 {
     enum Type
@@ -25,27 +26,39 @@ struct Macro
     };
     typedef std::vector<std::string> Parameters;
     typedef std::vector<Token> Replacements;
+    typedef std::vector<int> ReplacementParameters;
 
     Macro()
         : predefined(false),
-          disabled(false),
           type(kTypeObj)
     {
     }
     bool equals(const Macro &other) const;
 
     bool predefined;
-    mutable bool disabled;
 
     Type type;
     std::string name;
     Parameters parameters;
     Replacements replacements;
+
+    // Index in parameters of the parameter named by each token of the replacement list, or -1 if
+    // the token is not a parameter. Only used by function-like macros.
+    ReplacementParameters replacementParameters;
+
+    // The pool the text of the replacement tokens is interned in. Macros can outlive the
+    // preprocessor that defined them when they are shared as predefined macros.
+    std::shared_ptr<TokenTextPool> textPool;
 };
 
-typedef std::map<std::string, Macro> MacroSet;
+// Macros are immutable once added to a set: redefining a macro replaces it. This lets copies of
+// a set share their macros, so that copying a set only copies its hash table.
+typedef std::unordered_map<std::string, std::shared_ptr<const Macro>> MacroSet;
 
-void PredefineMacro(MacroSet *macroSet, const char *name, int value);
+void PredefineMacro(MacroSet *macroSet,
+                    const char *name,
+                    int value,
+                    const std::shared_ptr<TokenTextPool> &textPool);
 
 }  // namespace pp
 
@@ -6,7 +6,7 @@
 
 #include "MacroExpander.h"
 
-#include <algorithm>
+#include <limits>
 #include <sstream>
 
 #include "DiagnosticsBase.h"
@@ -48,9 +48,17 @@ class TokenLexer : public Lexer
 
 MacroExpander::MacroExpander(Lexer *lexer,
                              MacroSet *macroSet,
+                             TokenTextPool *textPool,
                              Diagnostics *diagnostics,
                              bool parseDefined)
-    : mLexer(lexer), mMacroSet(macroSet), mDiagnostics(diagnostics), mParseDefined(parseDefined)
+    : mLexer(lexer),
+      mMacroSet(macroSet),
+      mTextPool(textPool),
+      mDiagnostics(diagnostics),
+      mParseDefined(parseDefined),
+      mParentExpander(nullptr),
+      mNumTokens(0),
+      mMaxTokens(std::numeric_limits<size_t>::max())
 {
 }
 
@@ -110,7 +118,7 @@ void MacroExpander::lex(Token *token)
             // We have a valid defined operator.
             // Convert the current token into a CONST_INT token.
             token->type = Token::CONST_INT;
-            token->text = expression;
+            token->text = mTextPool->intern(expression);
             break;
         }
 
@@ -121,14 +129,14 @@ void MacroExpander::lex(Token *token)
         if (iter == mMacroSet->end())
             break;
 
-        const Macro& macro = iter->second;
-        if (macro.disabled)
+        const std::shared_ptr<const Macro> &macro = iter->second;
+        if (isMacroDisabled(*macro))
         {
             // If a particular token is not expanded, it is never expanded.
             token->setExpansionDisabled(true);
             break;
         }
-        if ((macro.type == Macro::kTypeFunc) && !isNextTokenLeftParen())
+        if ((macro->type == Macro::kTypeFunc) && !isNextTokenLeftParen())
         {
             // If the token immediately after the macro name is not a '(',
             // this macro should not be expanded.
@@ -141,6 +149,14 @@ void MacroExpander::lex(Token *token)
 
 void MacroExpander::getToken(Token *token)
 {
+    // Once the limit is reached, the input ends.
+    if (isTokenLimitReached())
+    {
+        token->reset();
+        token->type = Token::LAST;
+        return;
+    }
+
     if (mReserveToken.get())
     {
         *token = *mReserveToken;
@@ -156,12 +172,19 @@ void MacroExpander::getToken(Token *token)
 
     if (!mContextStack.empty())
     {
-        *token = mContextStack.back()->get();
+        mContextStack.back()->get(token);
     }
     else
     {
         mLexer->lex(token);
     }
+
+    if (++mNumTokens > mMaxTokens)
+    {
+        mDiagnostics->report(Diagnostics::PP_TOO_MANY_TOKENS, token->location, token->text);
+        token->reset();
+        token->type = Token::LAST;
+    }
 }
 
 void MacroExpander::ungetToken(const Token &token)
@@ -170,7 +193,8 @@ void MacroExpander::ungetToken(const Token &token)
     {
         MacroContext *context = mContextStack.back();
         context->unget();
-        assert(context->replacements[context->index] == token);
+        assert(context->replacements->at(context->index).type == token.type &&
+               context->replacements->at(context->index).text == token.text);
     }
     else
     {
@@ -190,23 +214,56 @@ bool MacroExpander::isNextTokenLeftParen()
     return lparen;
 }
 
-bool MacroExpander::pushMacro(const Macro &macro, const Token &identifier)
+bool MacroExpander::isMacroDisabled(const Macro &macro) const
+{
+    // A macro is disabled for expansion while it is on the context stack of this expander, or of
+    // the expanders of the macro arguments that it is nested in.
+    for (const MacroExpander *expander = this; expander != nullptr;
+         expander = expander->mParentExpander)
+    {
+        for (const MacroContext *context : expander->mContextStack)
+        {
+            if (context->macro.get() == &macro)
+                return true;
+        }
+    }
+    return false;
+}
+
+bool MacroExpander::isTokenLimitReached() const
 {
-    assert(!macro.disabled);
+    return mNumTokens > mMaxTokens;
+}
+
+bool MacroExpander::pushMacro(const std::shared_ptr<const Macro> &macroRef,
+                              const Token &identifier)
+{
+    const Macro &macro = *macroRef;
+    assert(!isMacroDisabled(macro));
     assert(!identifier.expansionDisabled());
     assert(identifier.type == Token::IDENTIFIER);
     assert(identifier.text == macro.name);
 
     std::vector<Token> replacements;
-    if (!expandMacro(macro, identifier, &replacements))
+    SourceLocation replacementLocation;
+    if (!expandMacro(macro, identifier, &replacements, &replacementLocation))
         return false;
 
     // Macro is disabled for expansion until it is popped off the stack.
-    macro.disabled = true;
-
     MacroContext *context = new MacroContext;
-    context->macro = &macro;
-    context->replacements.swap(replacements);
+    context->macro = macroRef;
+    if (macro.type == Macro::kTypeObj && !macro.predefined)
+    {
+        context->replacements = &macro.replacements;
+    }
+    else
+    {
+        context->ownReplacements.swap(replacements);
+        context->replacements = &context->ownReplacements;
+    }
+    context->location        = replacementLocation;
+    context->atStartOfLine   = identifier.atStartOfLine();
+    context->hasLeadingSpace = identifier.hasLeadingSpace();
     mContextStack.push_back(context);
     return true;
 }
@@ -219,14 +276,13 @@ void MacroExpander::popMacro()
     mContextStack.pop_back();
 
     assert(context->empty());
-    assert(context->macro->disabled);
-    context->macro->disabled = false;
     delete context;
 }
 
 bool MacroExpander::expandMacro(const Macro &macro,
                                 const Token &identifier,
-                                std::vector<Token> *replacements)
+                                std::vector<Token> *replacements,
+                                SourceLocation *replacementLocation)
 {
     replacements->clear();
 
@@ -234,14 +290,15 @@ bool MacroExpander::expandMacro(const Macro &macro,
     // from the identifier, but in the case of a function-like macro, the replacement
     // list gets its location from the closing parenthesis of the macro invocation.
     // This is tested by dEQP-GLES3.functional.shaders.preprocessor.predefined_macros.*
-    SourceLocation replacementLocation = identifier.location;
+    *replacementLocation = identifier.location;
     if (macro.type == Macro::kTypeObj)
     {
-        replacements->assign(macro.replacements.begin(),
-                             macro.replacements.end());
-
+        // Predefined macros are copied so that __LINE__ and __FILE__ can be patched. The other
+        // object-like macros are read in place from their replacement list.
         if (macro.predefined)
         {
+            replacements->assign(macro.replacements.begin(), macro.replacements.end());
+
             const char kLine[] = "__LINE__";
             const char kFile[] = "__FILE__";
 
@@ -251,13 +308,13 @@ bool MacroExpander::expandMacro(const Macro &macro,
             {
                 std::ostringstream stream;
                 stream << identifier.location.line;
-                repl.text = stream.str();
+                repl.text = mTextPool->intern(stream.str());
             }
             else if (macro.name == kFile)
             {
                 std::ostringstream stream;
                 stream << identifier.location.file;
-                repl.text = stream.str();
+                repl.text = mTextPool->intern(stream.str());
             }
         }
     }
@@ -266,24 +323,11 @@ bool MacroExpander::expandMacro(const Macro &macro,
         assert(macro.type == Macro::kTypeFunc);
         std::vector<MacroArg> args;
         args.reserve(macro.parameters.size());
-        if (!collectMacroArgs(macro, identifier, &args, &replacementLocation))
+        if (!collectMacroArgs(macro, identifier, &args, replacementLocation))
             return false;
 
         replaceMacroParams(macro, args, replacements);
     }
-
-    for (std::size_t i = 0; i < replacements->size(); ++i)
-    {
-        Token& repl = replacements->at(i);
-        if (i == 0)
-        {
-            // The first token in the replacement list inherits the padding
-            // properties of the identifier token.
-            repl.setAtStartOfLine(identifier.atStartOfLine());
-            repl.setHasLeadingSpace(identifier.hasLeadingSpace());
-        }
-        repl.location = replacementLocation;
-    }
     return true;
 }
 
@@ -303,8 +347,12 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
 
         if (token.type == Token::LAST)
         {
-            mDiagnostics->report(Diagnostics::PP_MACRO_UNTERMINATED_INVOCATION,
-                                 identifier.location, identifier.text);
+            // The invocation is only cut short by the token limit, which is already reported.
+            if (!isTokenLimitReached())
+            {
+                mDiagnostics->report(Diagnostics::PP_MACRO_UNTERMINATED_INVOCATION,
+                                     identifier.location, identifier.text);
+            }
             // Do not lose EOF token.
             ungetToken(token);
             return false;
@@ -366,8 +414,13 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
     for (std::size_t i = 0; i < args->size(); ++i)
     {
         MacroArg &arg = args->at(i);
+        if (!isExpansionNeeded(arg))
+            continue;
+
         TokenLexer lexer(&arg);
-        MacroExpander expander(&lexer, mMacroSet, mDiagnostics, mParseDefined);
+        MacroExpander expander(&lexer, mMacroSet, mTextPool, mDiagnostics, mParseDefined);
+        expander.mParentExpander = this;
+        expander.mMaxTokens      = mMaxTokens - mNumTokens;
 
         arg.clear();
         expander.lex(&token);
@@ -376,35 +429,54 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
             arg.push_back(token);
             expander.lex(&token);
         }
+
+        mNumTokens += expander.mNumTokens;
+        if (isTokenLimitReached())
+            return false;
     }
     return true;
 }
 
+bool MacroExpander::isExpansionNeeded(const MacroArg &arg) const
+{
+    // An argument without macro names or defined operators expands to itself.
+    for (const Token &token : arg)
+    {
+        if (token.type != Token::IDENTIFIER || token.expansionDisabled())
+            continue;
+
+        if ((mParseDefined && token.text == "defined") ||
+            mMacroSet->find(token.text) != mMacroSet->end())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void MacroExpander::replaceMacroParams(const Macro &macro,
                                        const std::vector<MacroArg> &args,
                                        std::vector<Token> *replacements)
 {
+    assert(macro.replacementParameters.size() == macro.replacements.size());
+
+    std::size_t numTokens = 0;
+    for (int iArg : macro.replacementParameters)
+    {
+        numTokens += (iArg < 0) ? 1 : args[iArg].size();
+    }
+    replacements->reserve(numTokens);
+
     for (std::size_t i = 0; i < macro.replacements.size(); ++i)
     {
         const Token &repl = macro.replacements[i];
-        if (repl.type != Token::IDENTIFIER)
-        {
-            replacements->push_back(repl);
-            continue;
-        }
-
-        // TODO(alokp): Optimize this.
-        // There is no need to search for macro params every time.
-        // The param index can be cached with the replacement token.
-        Macro::Parameters::const_iterator iter = std::find(
-            macro.parameters.begin(), macro.parameters.end(), repl.text);
-        if (iter == macro.parameters.end())
+        int iArg          = macro.replacementParameters[i];
+        if (iArg < 0)
         {
             replacements->push_back(repl);
             continue;
         }
 
-        std::size_t iArg = std::distance(macro.parameters.begin(), iter);
         const MacroArg &arg = args[iArg];
         if (arg.empty())
         {
@@ -13,22 +13,30 @@
 
 #include "Lexer.h"
 #include "Macro.h"
+#include "Token.h"
 #include "pp_utils.h"
 
 namespace pp
 {
 
 class Diagnostics;
-struct SourceLocation;
 
 class MacroExpander : public Lexer
 {
   public:
-    MacroExpander(Lexer *lexer, MacroSet *macroSet, Diagnostics *diagnostics, bool parseDefined);
+    MacroExpander(Lexer *lexer,
+                  MacroSet *macroSet,
+                  TokenTextPool *textPool,
+                  Diagnostics *diagnostics,
+                  bool parseDefined);
     ~MacroExpander() override;
 
     void lex(Token *token) override;
 
+    // Limits the number of tokens read by the expander, including the tokens of the macro
+    // expansions and macro arguments.
+    void setMaxTokens(size_t maxTokens) { mMaxTokens = maxTokens; }
+
   private:
     PP_DISALLOW_COPY_AND_ASSIGN(MacroExpander);
 
@@ -36,40 +44,66 @@ class MacroExpander : public Lexer
     void ungetToken(const Token &token);
     bool isNextTokenLeftParen();
 
-    bool pushMacro(const Macro &macro, const Token &identifier);
+    bool isMacroDisabled(const Macro &macro) const;
+    bool isTokenLimitReached() const;
+    bool pushMacro(const std::shared_ptr<const Macro> &macroRef, const Token &identifier);
     void popMacro();
 
     bool expandMacro(const Macro &macro,
                      const Token &identifier,
-                     std::vector<Token> *replacements);
+                     std::vector<Token> *replacements,
+                     SourceLocation *replacementLocation);
 
     typedef std::vector<Token> MacroArg;
     bool collectMacroArgs(const Macro &macro,
                           const Token &identifier,
                           std::vector<MacroArg> *args,
                           SourceLocation *closingParenthesisLocation);
+    bool isExpansionNeeded(const MacroArg &arg) const;
     void replaceMacroParams(const Macro &macro,
                             const std::vector<MacroArg> &args,
                             std::vector<Token> *replacements);
 
     struct MacroContext
     {
-        const Macro *macro;
+        std::shared_ptr<const Macro> macro;
         std::size_t index;
-        std::vector<Token> replacements;
+
+        // The tokens that the macro expands to. Object-like macros read the immutable
+        // replacement list of the macro itself, and only the expansions that differ from it,
+        // those of function-like macros and of __LINE__ and __FILE__, are built in
+        // ownReplacements.
+        const std::vector<Token> *replacements;
+        std::vector<Token> ownReplacements;
+
+        // Given to the tokens as they are read, rather than stored in the replacement list.
+        SourceLocation location;
+        bool atStartOfLine;
+        bool hasLeadingSpace;
 
         MacroContext()
-            : macro(0),
-              index(0)
+            : index(0),
+              replacements(nullptr),
+              atStartOfLine(false),
+              hasLeadingSpace(false)
         {
         }
         bool empty() const
         {
-            return index == replacements.size();
+            return index == replacements->size();
         }
-        const Token &get()
+        void get(Token *token)
         {
-            return replacements[index++];
+            *token = (*replacements)[index];
+            token->location = location;
+            if (index == 0)
+            {
+                // The first token in the replacement list inherits the padding
+                // properties of the identifier token.
+                token->setAtStartOfLine(atStartOfLine);
+                token->setHasLeadingSpace(hasLeadingSpace);
+            }
+            index++;
         }
         void unget()
         {
@@ -80,9 +114,18 @@ class MacroExpander : public Lexer
 
     Lexer *mLexer;
     MacroSet *mMacroSet;
+    TokenTextPool *mTextPool;
     Diagnostics *mDiagnostics;
     bool mParseDefined;
 
+    // Set on the expanders of macro arguments, whose expansion is nested in that of the macro.
+    const MacroExpander *mParentExpander;
+
+    // Tokens read so far and their limit. The expanders of macro arguments get the tokens left to
+    // the expander of the macro, which then counts the tokens they read.
+    size_t mNumTokens;
+    size_t mMaxTokens;
+
     std::auto_ptr<Token> mReserveToken;
     std::vector<MacroContext *> mContextStack;
 };
@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "PreprocessedShader.h"
+
+#include <cassert>
+
+#include "Preprocessor.h"
+
+namespace pp
+{
+
+PreprocessedShader::PreprocessedShader() : mNextToken(0), mNextEvent(0)
+{
+}
+
+PreprocessedShader::~PreprocessedShader()
+{
+}
+
+void PreprocessedShader::record(Preprocessor *preprocessor)
+{
+    Token token;
+    do
+    {
+        preprocessor->lex(&token);
+        // The recording outlives the preprocessor, so it keeps the text of the tokens itself.
+        mTokens.push_back(token);
+        mTokens.back().text = mTextPool.intern(token.text);
+    } while (token.type != Token::LAST);
+}
+
+void PreprocessedShader::replay(Token *token,
+                                Diagnostics *diagnostics,
+                                DirectiveHandler *directiveHandler)
+{
+    if (mTokens.empty())
+    {
+        token->reset();
+        return;
+    }
+
+    while (mNextEvent < mEvents.size() && mEvents[mNextEvent].tokenIndex <= mNextToken)
+    {
+        const Event &event = mEvents[mNextEvent++];
+        switch (event.type)
+        {
+          case Event::DIAGNOSTIC:
+            diagnostics->report(static_cast<ID>(event.value), event.location, event.name);
+            break;
+          case Event::ERROR_DIRECTIVE:
+            directiveHandler->handleError(event.location, event.name);
+            break;
+          case Event::PRAGMA:
+            directiveHandler->handlePragma(event.location, event.name, event.argument,
+                                           event.value != 0);
+            break;
+          case Event::EXTENSION:
+            directiveHandler->handleExtension(event.location, event.name, event.argument);
+            break;
+          case Event::VERSION:
+            directiveHandler->handleVersion(event.location, event.value);
+            break;
+          default:
+            assert(false);
+            break;
+        }
+    }
+
+    *token = mTokens[mNextToken];
+    if (mNextToken + 1 < mTokens.size())
+        ++mNextToken;
+}
+
+void PreprocessedShader::handleError(const SourceLocation &loc, const std::string &msg)
+{
+    addEvent(Event::ERROR_DIRECTIVE, loc, 0, msg, std::string());
+}
+
+void PreprocessedShader::handlePragma(const SourceLocation &loc,
+                                      const std::string &name,
+                                      const std::string &value,
+                                      bool stdgl)
+{
+    addEvent(Event::PRAGMA, loc, stdgl ? 1 : 0, name, value);
+}
+
+void PreprocessedShader::handleExtension(const SourceLocation &loc,
+                                         const std::string &name,
+                                         const std::string &behavior)
+{
+    addEvent(Event::EXTENSION, loc, 0, name, behavior);
+}
+
+void PreprocessedShader::handleVersion(const SourceLocation &loc, int version)
+{
+    addEvent(Event::VERSION, loc, version, std::string(), std::string());
+}
+
+void PreprocessedShader::print(ID id, const SourceLocation &loc, const std::string &text)
+{
+    addEvent(Event::DIAGNOSTIC, loc, id, text, std::string());
+}
+
+void PreprocessedShader::addEvent(Event::Type type,
+                                  const SourceLocation &loc,
+                                  int value,
+                                  const std::string &name,
+                                  const std::string &argument)
+{
+    Event event;
+    event.type       = type;
+    event.tokenIndex = mTokens.size();
+    event.location   = loc;
+    event.value      = value;
+    event.name       = name;
+    event.argument   = argument;
+    mEvents.push_back(event);
+}
+
+}  // namespace pp
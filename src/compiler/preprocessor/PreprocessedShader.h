@@ -0,0 +1,100 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifndef COMPILER_PREPROCESSOR_PREPROCESSEDSHADER_H_
+#define COMPILER_PREPROCESSOR_PREPROCESSEDSHADER_H_
+
+#include <vector>
+
+#include "DiagnosticsBase.h"
+#include "DirectiveHandlerBase.h"
+#include "Token.h"
+#include "pp_utils.h"
+
+namespace pp
+{
+
+class Preprocessor;
+
+// The whole output of the preprocessor for a shader: its tokens, and the diagnostics and
+// directives reported while lexing them, in order. Clients can record it up front, for example to
+// look up results keyed by the preprocessed shader, and replay it instead of lexing again.
+//
+// Pass the recording as both the diagnostics and the directive handler of the preprocessor, so
+// that it captures their calls instead of reporting them.
+class PreprocessedShader : public Diagnostics, public DirectiveHandler
+{
+  public:
+    // A diagnostic or a directive reported before lexing the token at tokenIndex.
+    struct Event
+    {
+        enum Type
+        {
+            DIAGNOSTIC,
+            ERROR_DIRECTIVE,
+            PRAGMA,
+            EXTENSION,
+            VERSION
+        };
+
+        Type type;
+        size_t tokenIndex;
+        SourceLocation location;
+        // The diagnostic ID, the version, or whether the pragma is STDGL.
+        int value;
+        // The diagnostic text, error message, pragma or extension name.
+        std::string name;
+        // The pragma value or extension behavior.
+        std::string argument;
+    };
+
+    PreprocessedShader();
+    ~PreprocessedShader() override;
+
+    // Lexes all the tokens of the preprocessor, which must have been constructed with this
+    // recording, up to and including the end of the input.
+    void record(Preprocessor *preprocessor);
+
+    // Returns the next recorded token, after reporting the diagnostics and directives that were
+    // reported before it. The end of the input is returned again once all tokens are replayed.
+    void replay(Token *token, Diagnostics *diagnostics, DirectiveHandler *directiveHandler);
+
+    const std::vector<Token> &getTokens() const { return mTokens; }
+    const std::vector<Event> &getEvents() const { return mEvents; }
+
+    void handleError(const SourceLocation &loc, const std::string &msg) override;
+    void handlePragma(const SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override;
+    void handleExtension(const SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override;
+    void handleVersion(const SourceLocation &loc, int version) override;
+
+  protected:
+    void print(ID id, const SourceLocation &loc, const std::string &text) override;
+
+  private:
+    PP_DISALLOW_COPY_AND_ASSIGN(PreprocessedShader);
+
+    void addEvent(Event::Type type,
+                  const SourceLocation &loc,
+                  int value,
+                  const std::string &name,
+                  const std::string &argument);
+
+    TokenTextPool mTextPool;
+    std::vector<Token> mTokens;
+    std::vector<Event> mEvents;
+
+    size_t mNextToken;
+    size_t mNextEvent;
+};
+
+}  // namespace pp
+
+#endif  // COMPILER_PREPROCESSOR_PREPROCESSEDSHADER_H_
@@ -22,15 +22,17 @@ struct PreprocessorImpl
 {
     Diagnostics *diagnostics;
     MacroSet macroSet;
+    std::shared_ptr<TokenTextPool> textPool;
     Tokenizer tokenizer;
     DirectiveParser directiveParser;
     MacroExpander macroExpander;
 
     PreprocessorImpl(Diagnostics *diag, DirectiveHandler *directiveHandler)
         : diagnostics(diag),
-          tokenizer(diag),
-          directiveParser(&tokenizer, &macroSet, diag, directiveHandler),
-          macroExpander(&directiveParser, &macroSet, diag, false)
+          textPool(std::make_shared<TokenTextPool>()),
+          tokenizer(diag, textPool.get()),
+          directiveParser(&tokenizer, &macroSet, textPool, diag, directiveHandler),
+          macroExpander(&directiveParser, &macroSet, textPool.get(), diag, false)
     {
     }
 };
@@ -52,18 +54,32 @@ bool Preprocessor::init(size_t count,
 {
     static const int kDefaultGLSLVersion = 100;
 
-    // Add standard pre-defined macros.
-    predefineMacro("__LINE__", 0);
-    predefineMacro("__FILE__", 0);
-    predefineMacro("__VERSION__", kDefaultGLSLVersion);
-    predefineMacro("GL_ES", 1);
+    // Add standard pre-defined macros, unless they were given by setPredefinedMacros.
+    if (mImpl->macroSet.empty())
+    {
+        predefineMacro("__LINE__", 0);
+        predefineMacro("__FILE__", 0);
+        predefineMacro("__VERSION__", kDefaultGLSLVersion);
+        predefineMacro("GL_ES", 1);
+    }
 
     return mImpl->tokenizer.init(count, string, length);
 }
 
 void Preprocessor::predefineMacro(const char *name, int value)
 {
-    PredefineMacro(&mImpl->macroSet, name, value);
+    PredefineMacro(&mImpl->macroSet, name, value, mImpl->textPool);
+}
+
+void Preprocessor::setPredefinedMacros(const MacroSet &macroSet)
+{
+    assert(mImpl->macroSet.empty());
+    mImpl->macroSet = macroSet;
+}
+
+const MacroSet &Preprocessor::getMacroSet() const
+{
+    return mImpl->macroSet;
 }
 
 void Preprocessor::lex(Token *token)
@@ -100,4 +116,9 @@ void Preprocessor::setMaxTokenSize(size_t maxTokenSize)
     mImpl->tokenizer.setMaxTokenSize(maxTokenSize);
 }
 
+void Preprocessor::setMaxTokens(size_t maxTokens)
+{
+    mImpl->macroExpander.setMaxTokens(maxTokens);
+}
+
 }  // namespace pp
@@ -9,6 +9,7 @@
 
 #include <stddef.h>
 
+#include "Macro.h"
 #include "pp_utils.h"
 
 namespace pp
@@ -38,10 +39,23 @@ class Preprocessor
     // Adds a pre-defined macro.
     void predefineMacro(const char *name, int value);
 
+    // Starts from the macros predefined by another preprocessor, as returned by its
+    // getMacroSet() after init() and the predefineMacro() calls, instead of predefining the
+    // standard macros again in init(). Must be called before init(). The macros are shared with
+    // the other preprocessor rather than copied.
+    void setPredefinedMacros(const MacroSet &macroSet);
+    const MacroSet &getMacroSet() const;
+
+    // The text of the tokens is owned by the preprocessor and the macros it expands, so it is
+    // only valid as long as the preprocessor.
     void lex(Token *token);
 
     // Set maximum preprocessor token size
     void setMaxTokenSize(size_t maxTokenSize);
+    // Limits the number of tokens read while preprocessing, including those produced by macro
+    // expansions, so that macros expanding to huge numbers of tokens fail quickly. The input
+    // ends after the limit is reached.
+    void setMaxTokens(size_t maxTokens);
 
   private:
     PP_DISALLOW_COPY_AND_ASSIGN(Preprocessor);
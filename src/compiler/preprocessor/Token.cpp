@@ -13,6 +13,26 @@
 namespace pp
 {
 
+namespace
+{
+
+const std::string *EmptyText()
+{
+    static const std::string emptyText;
+    return &emptyText;
+}
+
+}  // anonymous namespace
+
+TokenText::TokenText() : mText(EmptyText())
+{
+}
+
+void TokenText::clear()
+{
+    mText = EmptyText();
+}
+
 void Token::reset()
 {
     type = 0;
@@ -26,7 +46,7 @@ bool Token::equals(const Token &other) const
     return (type == other.type) &&
            (flags == other.flags) &&
            (location == other.location) &&
-           (text == other.text);
+           (text.str() == other.text.str());
 }
 
 void Token::setAtStartOfLine(bool start)
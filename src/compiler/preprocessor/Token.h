@@ -9,12 +9,96 @@
 
 #include <ostream>
 #include <string>
+#include <unordered_set>
 
 #include "SourceLocation.h"
+#include "pp_utils.h"
 
 namespace pp
 {
 
+// Owns the text of the tokens lexed or built by a preprocessor. Each distinct text is stored once
+// and never moves, so tokens only hold a pointer to it and copying them copies no strings. The
+// pool has to outlive the tokens pointing into it.
+class TokenTextPool
+{
+  public:
+    TokenTextPool() {}
+
+    const std::string *intern(const std::string &text) { return &*mTexts.insert(text).first; }
+
+  private:
+    PP_DISALLOW_COPY_AND_ASSIGN(TokenTextPool);
+
+    std::unordered_set<std::string> mTexts;
+};
+
+// The text of a token: a pointer to a string interned in a TokenTextPool, or to the empty string.
+class TokenText
+{
+  public:
+    TokenText();
+    TokenText(const std::string *text) : mText(text) {}
+
+    operator const std::string &() const { return *mText; }
+    const std::string &str() const { return *mText; }
+
+    size_t size() const { return mText->size(); }
+    bool empty() const { return mText->empty(); }
+    const char *c_str() const { return mText->c_str(); }
+
+    void clear();
+
+  private:
+    const std::string *mText;
+};
+
+inline bool operator==(const TokenText &lhs, const TokenText &rhs)
+{
+    return lhs.str() == rhs.str();
+}
+inline bool operator==(const TokenText &lhs, const std::string &rhs)
+{
+    return lhs.str() == rhs;
+}
+inline bool operator==(const std::string &lhs, const TokenText &rhs)
+{
+    return lhs == rhs.str();
+}
+inline bool operator==(const TokenText &lhs, const char *rhs)
+{
+    return lhs.str() == rhs;
+}
+inline bool operator==(const char *lhs, const TokenText &rhs)
+{
+    return lhs == rhs.str();
+}
+inline bool operator!=(const TokenText &lhs, const TokenText &rhs)
+{
+    return !(lhs == rhs);
+}
+inline bool operator!=(const TokenText &lhs, const std::string &rhs)
+{
+    return !(lhs == rhs);
+}
+inline bool operator!=(const std::string &lhs, const TokenText &rhs)
+{
+    return !(lhs == rhs);
+}
+inline bool operator!=(const TokenText &lhs, const char *rhs)
+{
+    return !(lhs == rhs);
+}
+inline bool operator!=(const char *lhs, const TokenText &rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline std::ostream &operator<<(std::ostream &out, const TokenText &text)
+{
+    return out << text.str();
+}
+
 struct Token
 {
     enum Type
@@ -100,7 +184,7 @@ struct Token
     int type;
     unsigned int flags;
     SourceLocation location;
-    std::string text;
+    TokenText text;
 };
 
 inline bool operator==(const Token &lhs, const Token &rhs)
@@ -2333,9 +2333,10 @@ void ppfree (void * ptr , yyscan_t yyscanner)
 
 namespace pp {
 
-Tokenizer::Tokenizer(Diagnostics *diagnostics)
+Tokenizer::Tokenizer(Diagnostics *diagnostics, TokenTextPool *textPool)
     : mHandle(0),
-      mMaxTokenSize(256)
+      mMaxTokenSize(256),
+      mTextPool(textPool)
 {
     mContext.diagnostics = diagnostics;
 }
@@ -2373,13 +2374,14 @@ void Tokenizer::setMaxTokenSize(size_t maxTokenSize)
 
 void Tokenizer::lex(Token *token)
 {
-    token->type = pplex(&token->text,&token->location,mHandle);
-    if (token->text.size() > mMaxTokenSize)
+    token->type = pplex(&mText,&token->location,mHandle);
+    if (mText.size() > mMaxTokenSize)
     {
         mContext.diagnostics->report(Diagnostics::PP_TOKEN_TOO_LONG,
-                                     token->location, token->text);
-        token->text.erase(mMaxTokenSize);
+                                     token->location, mText);
+        mText.erase(mMaxTokenSize);
     }
+    token->text = mTextPool->intern(mText);
 
     token->flags = 0;
 
@@ -7,6 +7,8 @@
 #ifndef COMPILER_PREPROCESSOR_TOKENIZER_H_
 #define COMPILER_PREPROCESSOR_TOKENIZER_H_
 
+#include <string>
+
 #include "Input.h"
 #include "Lexer.h"
 #include "pp_utils.h"
@@ -15,6 +17,7 @@ namespace pp
 {
 
 class Diagnostics;
+class TokenTextPool;
 
 class Tokenizer : public Lexer
 {
@@ -33,7 +36,7 @@ class Tokenizer : public Lexer
         bool lineStart;
     };
 
-    Tokenizer(Diagnostics *diagnostics);
+    Tokenizer(Diagnostics *diagnostics, TokenTextPool *textPool);
     ~Tokenizer();
 
     bool init(size_t count, const char * const string[], const int length[]);
@@ -52,6 +55,10 @@ class Tokenizer : public Lexer
     void *mHandle;  // Scanner handle.
     Context mContext;  // Scanner extra.
     size_t mMaxTokenSize; // Maximum token size
+
+    // The text of the token being lexed, until it is interned in the pool.
+    std::string mText;
+    TokenTextPool *mTextPool;
 };
 
 }  // namespace pp
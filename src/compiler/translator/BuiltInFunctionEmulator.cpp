@@ -178,6 +178,14 @@ void BuiltInFunctionEmulator::MarkBuiltInFunctionsForEmulation(TIntermNode *root
     root->traverse(&marker);
 }
 
+std::unique_ptr<TIntermTraverser> BuiltInFunctionEmulator::CreateEmulationMarker()
+{
+    if (mEmulatedFunctions.empty())
+        return nullptr;
+
+    return std::unique_ptr<TIntermTraverser>(new BuiltInFunctionEmulationMarker(*this));
+}
+
 void BuiltInFunctionEmulator::Cleanup()
 {
     mFunctions.clear();
@@ -7,6 +7,8 @@
 #ifndef COMPILER_TRANSLATOR_BUILTINFUNCTIONEMULATOR_H_
 #define COMPILER_TRANSLATOR_BUILTINFUNCTIONEMULATOR_H_
 
+#include <memory>
+
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/IntermNode.h"
 
@@ -22,6 +24,9 @@ class BuiltInFunctionEmulator
     BuiltInFunctionEmulator();
 
     void MarkBuiltInFunctionsForEmulation(TIntermNode *root);
+    // Returns the traverser used by MarkBuiltInFunctionsForEmulation, to run it along with other
+    // passes in a TFusedTraverser, or nullptr if no function is emulated.
+    std::unique_ptr<TIntermTraverser> CreateEmulationMarker();
 
     void Cleanup();
 
@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// BuiltInSymbolTable.cpp: Builds and shares the built-in levels of the symbol table.
+
+#include "compiler/translator/BuiltInSymbolTable.h"
+
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include "angle_gl.h"
+#include "compiler/translator/Initialize.h"
+
+namespace
+{
+
+class TScopedAllocator : angle::NonCopyable
+{
+  public:
+    TScopedAllocator(TPoolAllocator *allocator) : mPreviousAllocator(GetGlobalPoolAllocator())
+    {
+        SetGlobalPoolAllocator(allocator);
+    }
+    ~TScopedAllocator() { SetGlobalPoolAllocator(mPreviousAllocator); }
+
+  private:
+    TPoolAllocator *mPreviousAllocator;
+};
+
+typedef std::tuple<sh::GLenum, ShShaderSpec, std::string> BuiltInKey;
+typedef std::map<BuiltInKey, std::shared_ptr<const TBuiltInSymbolTable>> BuiltInMap;
+
+// Allocated on first use to avoid a static initializer.
+std::mutex *sBuiltInsMutex = nullptr;
+BuiltInMap *sBuiltIns      = nullptr;
+
+std::mutex &GetBuiltInsMutex()
+{
+    static std::once_flag initOnce;
+    std::call_once(initOnce, []() { sBuiltInsMutex = new std::mutex(); });
+    return *sBuiltInsMutex;
+}
+
+}  // anonymous namespace
+
+std::shared_ptr<const TBuiltInSymbolTable> TBuiltInSymbolTable::Get(
+    sh::GLenum shaderType,
+    ShShaderSpec spec,
+    const ShBuiltInResources &resources,
+    const std::string &resourcesString)
+{
+    std::lock_guard<std::mutex> lock(GetBuiltInsMutex());
+
+    if (sBuiltIns == nullptr)
+    {
+        sBuiltIns = new BuiltInMap();
+    }
+
+    // The resources string covers every resource that the built-ins depend on.
+    BuiltInKey key(shaderType, spec, resourcesString);
+    auto iter = sBuiltIns->find(key);
+    if (iter != sBuiltIns->end())
+    {
+        return iter->second;
+    }
+
+    std::shared_ptr<const TBuiltInSymbolTable> builtIns(
+        new TBuiltInSymbolTable(shaderType, spec, resources));
+    (*sBuiltIns)[key] = builtIns;
+    return builtIns;
+}
+
+void TBuiltInSymbolTable::ReleaseAll()
+{
+    std::lock_guard<std::mutex> lock(GetBuiltInsMutex());
+
+    // Compilers that are still alive keep their own reference.
+    SafeDelete(sBuiltIns);
+}
+
+TBuiltInSymbolTable::TBuiltInSymbolTable(sh::GLenum shaderType,
+                                         ShShaderSpec spec,
+                                         const ShBuiltInResources &resources)
+{
+    TScopedAllocator scopedAllocator(&mAllocator);
+    mAllocator.push();
+
+    mSymbolTable.push();  // COMMON_BUILTINS
+    mSymbolTable.push();  // ESSL1_BUILTINS
+    mSymbolTable.push();  // ESSL3_BUILTINS
+
+    TPublicType integer;
+    integer.type          = EbtInt;
+    integer.primarySize   = 1;
+    integer.secondarySize = 1;
+    integer.array         = false;
+
+    TPublicType floatingPoint;
+    floatingPoint.type          = EbtFloat;
+    floatingPoint.primarySize   = 1;
+    floatingPoint.secondarySize = 1;
+    floatingPoint.array         = false;
+
+    switch (shaderType)
+    {
+      case GL_FRAGMENT_SHADER:
+        mSymbolTable.setDefaultPrecision(integer, EbpMedium);
+        break;
+      case GL_VERTEX_SHADER:
+        mSymbolTable.setDefaultPrecision(integer, EbpHigh);
+        mSymbolTable.setDefaultPrecision(floatingPoint, EbpHigh);
+        break;
+      default:
+        UNREACHABLE();
+    }
+    // Set defaults for sampler types that have default precision, even those that are
+    // only available if an extension exists.
+    // New sampler types in ESSL3 don't have default precision. ESSL1 types do.
+    initSamplerDefaultPrecision(EbtSampler2D);
+    initSamplerDefaultPrecision(EbtSamplerCube);
+    // SamplerExternalOES is specified in the extension to have default precision.
+    initSamplerDefaultPrecision(EbtSamplerExternalOES);
+    // It isn't specified whether Sampler2DRect has default precision.
+    initSamplerDefaultPrecision(EbtSampler2DRect);
+
+    InsertBuiltInFunctions(shaderType, spec, resources, mSymbolTable);
+
+    IdentifyBuiltIns(shaderType, spec, resources, mSymbolTable);
+
+    // Compilers on other threads only ever read the built-ins from now on.
+    mSymbolTable.realizeBuiltInLevels();
+}
+
+TBuiltInSymbolTable::~TBuiltInSymbolTable()
+{
+    while (!mSymbolTable.isEmpty())
+    {
+        mSymbolTable.pop();
+    }
+    mAllocator.popAll();
+}
+
+void TBuiltInSymbolTable::initSamplerDefaultPrecision(TBasicType samplerType)
+{
+    ASSERT(samplerType > EbtGuardSamplerBegin && samplerType < EbtGuardSamplerEnd);
+    TPublicType sampler;
+    sampler.primarySize   = 1;
+    sampler.secondarySize = 1;
+    sampler.array         = false;
+    sampler.type          = samplerType;
+    mSymbolTable.setDefaultPrecision(sampler, EbpLow);
+}
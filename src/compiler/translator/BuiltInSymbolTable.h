@@ -0,0 +1,52 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// BuiltInSymbolTable.h: The built-in levels of the symbol table for one shader type, spec and
+// set of resources. They are built once on first use, never modified afterwards, and shared by
+// the symbol tables of every compiler created with the same parameters.
+
+#ifndef COMPILER_TRANSLATOR_BUILTINSYMBOLTABLE_H_
+#define COMPILER_TRANSLATOR_BUILTINSYMBOLTABLE_H_
+
+#include <memory>
+#include <string>
+
+#include "common/angleutils.h"
+#include "compiler/translator/PoolAlloc.h"
+#include "compiler/translator/SymbolTable.h"
+
+class TBuiltInSymbolTable : angle::NonCopyable
+{
+  public:
+    // Returns the built-ins matching the parameters, building them if no compiler asked for
+    // them before. Safe to call from several threads at once.
+    static std::shared_ptr<const TBuiltInSymbolTable> Get(sh::GLenum shaderType,
+                                                          ShShaderSpec spec,
+                                                          const ShBuiltInResources &resources,
+                                                          const std::string &resourcesString);
+
+    // Drops all the built-ins that are not in use by a compiler anymore. Called at ShFinalize.
+    static void ReleaseAll();
+
+    ~TBuiltInSymbolTable();
+
+    // Only holds the built-in levels, from COMMON_BUILTINS to LAST_BUILTIN_LEVEL.
+    const TSymbolTable &getSymbolTable() const { return mSymbolTable; }
+
+  private:
+    TBuiltInSymbolTable(sh::GLenum shaderType,
+                        ShShaderSpec spec,
+                        const ShBuiltInResources &resources);
+
+    void initSamplerDefaultPrecision(TBasicType samplerType);
+
+    // The symbols live in their own pool so that they outlive any single compiler. The pool is
+    // declared first so that it is destroyed after the symbol table.
+    TPoolAllocator mAllocator;
+    TSymbolTable mSymbolTable;
+};
+
+#endif  // COMPILER_TRANSLATOR_BUILTINSYMBOLTABLE_H_
@@ -4,7 +4,8 @@
 // found in the LICENSE file.
 //
 
-// Cache.h: Implements a cache for various commonly created objects.
+// Cache.h: Implements a cache for various commonly created objects. The cached objects are never
+// modified once created, and the cache itself can be used from several threads.
 
 #ifndef COMPILER_TRANSLATOR_CACHE_H_
 #define COMPILER_TRANSLATOR_CACHE_H_
@@ -12,6 +13,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <map>
+#include <mutex>
 
 #include "compiler/translator/Types.h"
 #include "compiler/translator/PoolAlloc.h"
@@ -81,6 +83,9 @@ class TCache
     };
     typedef std::map<TypeKey, const TType*> TypeMap;
 
+    // Guards mTypes and mAllocator. Types are only looked up while building the built-in symbol
+    // tables, so the lock is not contended during compiles.
+    std::mutex mMutex;
     TypeMap mTypes;
     TPoolAllocator mAllocator;
 
@@ -0,0 +1,94 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "compiler/translator/CompileBudget.h"
+
+#include "compiler/translator/PoolAlloc.h"
+
+namespace
+{
+
+// Reading the clock costs about as much as lexing a token, so the inner loops only check the
+// budget once every this many calls.
+const unsigned int kCallsPerPeriodicCheck = 256;
+
+}  // anonymous namespace
+
+TCompileBudget::TCompileBudget()
+    : mEnabled(false),
+      mHasDeadline(false),
+      mMaxPreprocessedTokens(0),
+      mAllocator(nullptr),
+      mAllocationsAtStart(0),
+      mMaxAllocations(0),
+      mCallsSinceCheck(0),
+      mExceededBudget(nullptr)
+{
+}
+
+void TCompileBudget::start(const ShBuiltInResources &resources, int compileOptions)
+{
+    mEnabled         = (compileOptions & SH_LIMIT_COMPILE_BUDGET) != 0;
+    mAllocator       = nullptr;
+    mCallsSinceCheck = 0;
+    mExceededBudget  = nullptr;
+
+    if (!mEnabled)
+        return;
+
+    mHasDeadline = resources.MaxCompileTimeMilliseconds > 0;
+    if (mHasDeadline)
+    {
+        mDeadline = std::chrono::steady_clock::now() +
+                    std::chrono::milliseconds(resources.MaxCompileTimeMilliseconds);
+    }
+    mMaxPreprocessedTokens =
+        resources.MaxPreprocessedTokens > 0 ? static_cast<size_t>(resources.MaxPreprocessedTokens)
+                                            : 0;
+    mMaxAllocations =
+        resources.MaxCompileAllocations > 0 ? static_cast<size_t>(resources.MaxCompileAllocations)
+                                            : 0;
+}
+
+void TCompileBudget::setAllocator(const TPoolAllocator *allocator)
+{
+    mAllocator          = allocator;
+    mAllocationsAtStart = allocator ? allocator->getNumAllocations() : 0;
+}
+
+bool TCompileBudget::check()
+{
+    if (!mEnabled)
+        return true;
+    if (mExceededBudget)
+        return false;
+
+    mCallsSinceCheck = 0;
+    if (mHasDeadline && std::chrono::steady_clock::now() > mDeadline)
+    {
+        mExceededBudget = "time";
+    }
+    else if (mAllocator && mMaxAllocations > 0 &&
+             mAllocator->getNumAllocations() - mAllocationsAtStart > mMaxAllocations)
+    {
+        mExceededBudget = "allocation";
+    }
+    return mExceededBudget == nullptr;
+}
+
+bool TCompileBudget::checkPeriodically()
+{
+    if (!mEnabled)
+        return true;
+    if (++mCallsSinceCheck < kCallsPerPeriodicCheck)
+        return mExceededBudget == nullptr;
+    return check();
+}
+
+size_t TCompileBudget::getMaxPreprocessedTokens() const
+{
+    return mEnabled ? mMaxPreprocessedTokens : 0;
+}
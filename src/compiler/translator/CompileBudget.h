@@ -0,0 +1,61 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompileBudget.h: TCompileBudget bounds the wall time and the pool allocations of a compile, as
+// enabled by SH_LIMIT_COMPILE_BUDGET.
+
+#ifndef COMPILER_TRANSLATOR_COMPILEBUDGET_H_
+#define COMPILER_TRANSLATOR_COMPILEBUDGET_H_
+
+#include <chrono>
+
+#include "GLSLANG/ShaderLang.h"
+#include "common/angleutils.h"
+
+class TPoolAllocator;
+
+// The phases of the compile check the budget between their steps and stop early once it is
+// exceeded. Exceeding the budget is sticky until the next compile starts, so that the later phases
+// are skipped as well.
+class TCompileBudget : angle::NonCopyable
+{
+  public:
+    TCompileBudget();
+
+    // Starts the budget of a compile with the limits of the resources. The budget is unlimited
+    // unless the compile options contain SH_LIMIT_COMPILE_BUDGET.
+    void start(const ShBuiltInResources &resources, int compileOptions);
+    // Counts the allocations made from the allocator from now on against the budget.
+    void setAllocator(const TPoolAllocator *allocator);
+
+    // Returns false if the budget is exceeded.
+    bool check();
+    // Same as check(), but only reads the clock once every few calls, for use in the inner loops
+    // of a phase.
+    bool checkPeriodically();
+
+    bool isEnabled() const { return mEnabled; }
+    bool isExceeded() const { return mExceededBudget != nullptr; }
+    // The name of the exceeded part of the budget, "time" or "allocation", or null.
+    const char *getExceededBudget() const { return mExceededBudget; }
+
+    // The maximum number of tokens the preprocessor can produce, or 0 for no limit.
+    size_t getMaxPreprocessedTokens() const;
+
+  private:
+    bool mEnabled;
+    std::chrono::steady_clock::time_point mDeadline;
+    bool mHasDeadline;
+    size_t mMaxPreprocessedTokens;
+
+    const TPoolAllocator *mAllocator;
+    size_t mAllocationsAtStart;
+    size_t mMaxAllocations;
+
+    unsigned int mCallsSinceCheck;
+    const char *mExceededBudget;
+};
+
+#endif  // COMPILER_TRANSLATOR_COMPILEBUDGET_H_
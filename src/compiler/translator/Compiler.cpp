@@ -6,10 +6,16 @@
 
 #include "compiler/translator/Cache.h"
 #include "compiler/translator/Compiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "compiler/translator/BuiltInSymbolTable.h"
 #include "compiler/translator/CallDAG.h"
 #include "compiler/translator/ForLoopUnroll.h"
+#include "compiler/translator/FusedTraverser.h"
 #include "compiler/translator/Initialize.h"
-#include "compiler/translator/InitializeParseContext.h"
 #include "compiler/translator/InitializeVariables.h"
 #include "compiler/translator/ParseContext.h"
 #include "compiler/translator/PruneEmptyDeclarations.h"
@@ -18,6 +24,7 @@
 #include "compiler/translator/RenameFunction.h"
 #include "compiler/translator/RewriteDoWhile.h"
 #include "compiler/translator/ScalarizeVecAndMatConstructorArgs.h"
+#include "compiler/translator/TranslationCache.h"
 #include "compiler/translator/UnfoldShortCircuitAST.h"
 #include "compiler/translator/ValidateLimitations.h"
 #include "compiler/translator/ValidateOutputs.h"
@@ -103,6 +110,7 @@ class TScopedSymbolTableLevel
     TSymbolTable* mTable;
 };
 
+
 int MapSpecToShaderVersion(ShShaderSpec spec)
 {
     switch (spec)
@@ -145,7 +153,9 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       clampingStrategy(SH_CLAMP_WITH_CLAMP_INTRINSIC),
       builtInFunctionEmulator(),
       mSourcePath(NULL),
-      mTemporaryIndex(0)
+      mTemporaryIndex(0),
+      mCollectStatistics(false),
+      mStatistics()
 {
 }
 
@@ -190,14 +200,19 @@ bool TCompiler::Init(const ShBuiltInResources& resources)
 TIntermNode *TCompiler::compileTreeForTesting(const char* const shaderStrings[],
     size_t numStrings, int compileOptions)
 {
+    mBudget.start(compileResources, compileOptions);
+    mBudget.setAllocator(GetGlobalPoolAllocator());
     return compileTreeImpl(shaderStrings, numStrings, compileOptions);
 }
 
 TIntermNode *TCompiler::compileTreeImpl(const char *const shaderStrings[],
                                         size_t numStrings,
-                                        const int compileOptions)
+                                        const int compileOptions,
+                                        pp::PreprocessedShader *preprocessedShader,
+                                        double recordingTime)
 {
     clearResults();
+    mCollectStatistics = (compileOptions & SH_COLLECT_COMPILE_STATISTICS) != 0;
 
     ASSERT(numStrings > 0);
     ASSERT(GetGlobalPoolAllocator());
@@ -214,21 +229,47 @@ TIntermNode *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     }
 
     TIntermediate intermediate(infoSink);
+    intermediate.setCompileBudget(&mBudget);
     TParseContext parseContext(symbolTable, extensionBehavior, intermediate, shaderType, shaderSpec,
                                compileOptions, true, infoSink, getResources());
 
     parseContext.setFragmentPrecisionHighOnESSL1(fragmentPrecisionHigh);
-    SetGlobalParseContext(&parseContext);
+    parseContext.setPredefinedMacros(&mPredefinedMacros);
+    parseContext.setPreprocessedShader(preprocessedShader);
+    parseContext.setCompileBudget(&mBudget);
 
     // We preserve symbols at the built-in level from compile-to-compile.
     // Start pushing the user-defined symbols at global level.
     TScopedSymbolTableLevel scopedSymbolLevel(&symbolTable);
 
+    // The preprocessor runs on demand from the lexer, so its time is measured per token and
+    // subtracted from the time of the parse.
+    double preprocessingTime = 0.0;
+    std::chrono::steady_clock::time_point parseStart;
+    if (mCollectStatistics)
+    {
+        parseContext.setPreprocessingTime(&preprocessingTime);
+        parseStart = std::chrono::steady_clock::now();
+    }
+
     // Parse shader.
     bool success =
         (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr, &parseContext) == 0) &&
         (parseContext.getTreeRoot() != nullptr);
 
+    if (mCollectStatistics)
+    {
+        std::chrono::duration<double> parseTime = std::chrono::steady_clock::now() - parseStart;
+        ShPhaseTiming preprocessTiming = {"Preprocess", recordingTime + preprocessingTime};
+        ShPhaseTiming parseTiming      = {"Parse", parseTime.count() - preprocessingTime};
+        mStatistics.phaseTimings.push_back(preprocessTiming);
+        mStatistics.phaseTimings.push_back(parseTiming);
+    }
+
+    // The parse ends early once the budget is exceeded, so check it even if the parse succeeded.
+    if (!checkCompileBudget())
+        success = false;
+
     shaderVersion = parseContext.getShaderVersion();
     if (success && MapSpecToShaderVersion(shaderSpec) < shaderVersion)
     {
@@ -260,55 +301,139 @@ TIntermNode *TCompiler::compileTreeImpl(const char *const shaderStrings[],
 
         // Disallow expressions deemed too complex.
         if (success && (compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY))
+        {
+            TScopedPhaseTimer timer(getPhaseTimings(), "LimitExpressionComplexity");
             success = limitExpressionComplexity(root);
+        }
 
         // Create the function DAG and check there is no recursion
         if (success)
+        {
+            TScopedPhaseTimer timer(getPhaseTimings(), "CallDAG");
             success = initCallDag(root);
 
-        if (success && (compileOptions & SH_LIMIT_CALL_STACK_DEPTH))
-            success = checkCallDepth();
+            if (success && (compileOptions & SH_LIMIT_CALL_STACK_DEPTH))
+                success = checkCallDepth();
+        }
 
         // Checks which functions are used and if "main" exists
         if (success)
         {
+            TScopedPhaseTimer timer(getPhaseTimings(), "PruneUnusedFunctions");
             functionMetadata.clear();
             functionMetadata.resize(mCallDag.size());
             success = tagUsedFunctions();
-        }
 
-        if (success && !(compileOptions & SH_DONT_PRUNE_UNUSED_FUNCTIONS))
-            success = pruneUnusedFunctions(root);
+            if (success && !(compileOptions & SH_DONT_PRUNE_UNUSED_FUNCTIONS))
+                success = pruneUnusedFunctions(root);
+        }
 
         // Prune empty declarations to work around driver bugs and to keep declaration output simple.
         if (success)
+        {
+            TScopedPhaseTimer timer(getPhaseTimings(), "PruneEmptyDeclarations");
             PruneEmptyDeclarations(root);
+        }
 
-        if (success && shaderVersion == 300 && shaderType == GL_FRAGMENT_SHADER)
-            success = validateOutputs(root);
+        if (success)
+            success = checkCompileBudget();
 
-        if (success && shouldRunLoopAndIndexingValidation(compileOptions))
-            success = validateLimitations(root);
+        // The validation passes only read the tree, so they share a traversal. Loop and indexing
+        // validation is only reported if the outputs are valid, as when it ran after them.
+        if (success)
+        {
+            TScopedPhaseTimer timer(getPhaseTimings(), "Validation");
+            TFusedTraverser validation;
+            TInfoSinkBase limitationsSink;
+
+            std::unique_ptr<ValidateOutputs> validateOutputs;
+            if (shaderVersion == 300 && shaderType == GL_FRAGMENT_SHADER)
+            {
+                validateOutputs.reset(new ValidateOutputs(getExtensionBehavior(),
+                                                          compileResources.MaxDrawBuffers));
+                validation.addPass(validateOutputs.get());
+            }
+
+            std::unique_ptr<ValidateLimitations> validateLimitations;
+            if (shouldRunLoopAndIndexingValidation(compileOptions))
+            {
+                validateLimitations.reset(new ValidateLimitations(shaderType, symbolTable,
+                                                                  shaderVersion, &limitationsSink));
+                validation.addPass(validateLimitations.get());
+            }
+
+            if (!validation.empty())
+                root->traverse(&validation);
+
+            if (validateOutputs && validateOutputs->validateAndCountErrors(infoSink.info) != 0)
+            {
+                success = false;
+            }
+            else if (validateLimitations && validateLimitations->numErrors() != 0)
+            {
+                infoSink.info << limitationsSink;
+                success = false;
+            }
+        }
 
         if (success && (compileOptions & SH_TIMING_RESTRICTIONS))
+        {
+            TScopedPhaseTimer timer(getPhaseTimings(), "TimingRestrictions");
             success = enforceTimingRestrictions(root, (compileOptions & SH_DEPENDENCY_GRAPH) != 0);
+        }
 
         if (success && shaderSpec == SH_CSS_SHADERS_SPEC)
             rewriteCSSShader(root);
 
-        // Unroll for-loop markup needs to happen after validateLimitations pass.
-        if (success && (compileOptions & SH_UNROLL_FOR_LOOP_WITH_INTEGER_INDEX))
-        {
-            ForLoopUnrollMarker marker(ForLoopUnrollMarker::kIntegerIndex,
-                                       shouldRunLoopAndIndexingValidation(compileOptions));
-            root->traverse(&marker);
-        }
-        if (success && (compileOptions & SH_UNROLL_FOR_LOOP_WITH_SAMPLER_ARRAY_INDEX))
+        // The passes marking the loops to unroll, the built-in functions to emulate and the
+        // array indices to clamp also share a traversal. They need to happen after the
+        // validation passes, and don't change the structure of the tree.
+        if (success)
+            success = checkCompileBudget();
+
+        if (success)
         {
-            ForLoopUnrollMarker marker(ForLoopUnrollMarker::kSamplerArrayIndex,
-                                       shouldRunLoopAndIndexingValidation(compileOptions));
-            root->traverse(&marker);
-            if (marker.samplerArrayIndexIsFloatLoopIndex())
+            TScopedPhaseTimer timer(getPhaseTimings(), "Marking");
+            TFusedTraverser marking;
+
+            std::unique_ptr<ForLoopUnrollMarker> integerIndexMarker;
+            if (compileOptions & SH_UNROLL_FOR_LOOP_WITH_INTEGER_INDEX)
+            {
+                integerIndexMarker.reset(new ForLoopUnrollMarker(
+                    ForLoopUnrollMarker::kIntegerIndex,
+                    shouldRunLoopAndIndexingValidation(compileOptions), symbolTable,
+                    shaderVersion));
+                marking.addPass(integerIndexMarker.get());
+            }
+
+            std::unique_ptr<ForLoopUnrollMarker> samplerArrayIndexMarker;
+            if (compileOptions & SH_UNROLL_FOR_LOOP_WITH_SAMPLER_ARRAY_INDEX)
+            {
+                samplerArrayIndexMarker.reset(new ForLoopUnrollMarker(
+                    ForLoopUnrollMarker::kSamplerArrayIndex,
+                    shouldRunLoopAndIndexingValidation(compileOptions), symbolTable,
+                    shaderVersion));
+                marking.addPass(samplerArrayIndexMarker.get());
+            }
+
+            initBuiltInFunctionEmulator(&builtInFunctionEmulator, compileOptions);
+            std::unique_ptr<TIntermTraverser> emulationMarker =
+                builtInFunctionEmulator.CreateEmulationMarker();
+            if (emulationMarker)
+                marking.addPass(emulationMarker.get());
+
+            std::unique_ptr<TIntermTraverser> clampingMarker;
+            if (compileOptions & SH_CLAMP_INDIRECT_ARRAY_BOUNDS)
+            {
+                clampingMarker = arrayBoundsClamper.CreateIndirectArrayBoundsMarker();
+                marking.addPass(clampingMarker.get());
+            }
+
+            if (!marking.empty())
+                root->traverse(&marking);
+
+            if (samplerArrayIndexMarker &&
+                samplerArrayIndexMarker->samplerArrayIndexIsFloatLoopIndex())
             {
                 infoSink.info.prefix(EPrefixError);
                 infoSink.info << "sampler array index is float loop index";
@@ -316,29 +441,25 @@ TIntermNode *TCompiler::compileTreeImpl(const char *const shaderStrings[],
             }
         }
 
-        // Built-in function emulation needs to happen after validateLimitations pass.
-        if (success)
-        {
-            initBuiltInFunctionEmulator(&builtInFunctionEmulator, compileOptions);
-            builtInFunctionEmulator.MarkBuiltInFunctionsForEmulation(root);
-        }
-
-        // Clamping uniform array bounds needs to happen after validateLimitations pass.
-        if (success && (compileOptions & SH_CLAMP_INDIRECT_ARRAY_BOUNDS))
-            arrayBoundsClamper.MarkIndirectArrayBoundsForClamping(root);
-
         // gl_Position is always written in compatibility output mode
         if (success && shaderType == GL_VERTEX_SHADER &&
             ((compileOptions & SH_INIT_GL_POSITION) ||
              (outputType == SH_GLSL_COMPATIBILITY_OUTPUT)))
+        {
+            TScopedPhaseTimer timer(getPhaseTimings(), "InitializeGLPosition");
             initializeGLPosition(root);
+        }
 
         // This pass might emit short circuits so keep it before the short circuit unfolding
         if (success && (compileOptions & SH_REWRITE_DO_WHILE_LOOPS))
+        {
+            TScopedPhaseTimer timer(getPhaseTimings(), "RewriteDoWhile");
             RewriteDoWhile(root, getTemporaryIndex());
+        }
 
         if (success && (compileOptions & SH_UNFOLD_SHORT_CIRCUIT))
         {
+            TScopedPhaseTimer timer(getPhaseTimings(), "UnfoldShortCircuit");
             UnfoldShortCircuitAST unfoldShortCircuit;
             root->traverse(&unfoldShortCircuit);
             unfoldShortCircuit.updateTree();
@@ -346,11 +467,16 @@ TIntermNode *TCompiler::compileTreeImpl(const char *const shaderStrings[],
 
         if (success && (compileOptions & SH_REMOVE_POW_WITH_CONSTANT_EXPONENT))
         {
+            TScopedPhaseTimer timer(getPhaseTimings(), "RemovePow");
             RemovePow(root);
         }
 
+        if (success)
+            success = checkCompileBudget();
+
         if (success && shouldCollectVariables(compileOptions))
         {
+            TScopedPhaseTimer timer(getPhaseTimings(), "CollectVariables");
             collectVariables(root);
             if (compileOptions & SH_ENFORCE_PACKING_RESTRICTIONS)
             {
@@ -368,6 +494,7 @@ TIntermNode *TCompiler::compileTreeImpl(const char *const shaderStrings[],
 
         if (success && (compileOptions & SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS))
         {
+            TScopedPhaseTimer timer(getPhaseTimings(), "ScalarizeVecAndMatConstructorArgs");
             ScalarizeVecAndMatConstructorArgs scalarizer(
                 shaderType, fragmentPrecisionHigh);
             root->traverse(&scalarizer);
@@ -375,12 +502,12 @@ TIntermNode *TCompiler::compileTreeImpl(const char *const shaderStrings[],
 
         if (success && (compileOptions & SH_REGENERATE_STRUCT_NAMES))
         {
+            TScopedPhaseTimer timer(getPhaseTimings(), "RegenerateStructNames");
             RegenerateStructNames gen(symbolTable, shaderVersion);
             root->traverse(&gen);
         }
     }
 
-    SetGlobalParseContext(NULL);
     if (success)
         return root;
 
@@ -393,84 +520,254 @@ bool TCompiler::compile(const char* const shaderStrings[],
     if (numStrings == 0)
         return true;
 
+    mBudget.start(compileResources, compileOptions);
+
+    // Hashed names depend on the embedder's hash function, which can't be part of the key.
+    if (!(compileOptions & SH_CACHE_TRANSLATION) || hashFunction != nullptr)
+        return compileUncached(shaderStrings, numStrings, compileOptions);
+
+    TranslationCache *cache = TranslationCache::GetInstance();
+    std::string key =
+        TranslationCache::MakeKey(shaderType, shaderSpec, outputType, compileOptions,
+                                  builtInResourcesString, shaderStrings, numStrings);
+
+    TranslationCacheEntry entry;
+    if (cache->lookup(key, &entry))
+    {
+        loadFromCacheEntry(entry);
+        return entry.success;
+    }
+
+    // Variants of a shader made by prepending different defines often preprocess to the same
+    // tokens, so the results are also looked up by the preprocessed shader. The recording is then
+    // replayed by the parse instead of preprocessing the sources again.
+    std::chrono::steady_clock::time_point recordingStart = std::chrono::steady_clock::now();
+    pp::PreprocessedShader preprocessedShader;
+    if (!recordPreprocessedShader(shaderStrings, numStrings, compileOptions, &preprocessedShader))
+    {
+        bool success = compileUncached(shaderStrings, numStrings, compileOptions);
+        // A compile out of time could succeed another time, so it is not cached.
+        if (mBudget.isExceeded())
+            return success;
+        saveToCacheEntry(success, &entry);
+        cache->store(key, entry);
+        return success;
+    }
+    std::chrono::duration<double> recordingTime =
+        std::chrono::steady_clock::now() - recordingStart;
+
+    const char *sourcePath = (compileOptions & SH_SOURCE_PATH) ? shaderStrings[0] : nullptr;
+    std::string preprocessedKey = TranslationCache::MakePreprocessedKey(
+        shaderType, shaderSpec, outputType, compileOptions, builtInResourcesString, sourcePath,
+        preprocessedShader);
+    std::string lineDependentKey =
+        TranslationCache::MakeLineDependentKey(preprocessedKey, preprocessedShader);
+    if (cache->lookup(preprocessedKey, &entry) || cache->lookup(lineDependentKey, &entry))
+    {
+        loadFromCacheEntry(entry);
+        cache->store(key, entry);
+        return entry.success;
+    }
+
+    bool success = compileUncached(shaderStrings, numStrings, compileOptions, &preprocessedShader,
+                                   recordingTime.count());
+    if (mBudget.isExceeded())
+        return success;
+    saveToCacheEntry(success, &entry);
+    cache->store(TranslationCache::DependsOnLines(compileOptions, entry) ? lineDependentKey
+                                                                         : preprocessedKey,
+                 entry);
+    cache->store(key, entry);
+    return success;
+}
+
+bool TCompiler::compileUncached(const char *const shaderStrings[],
+                                size_t numStrings,
+                                int compileOptions,
+                                pp::PreprocessedShader *preprocessedShader,
+                                double recordingTime)
+{
     TScopedPoolAllocator scopedAlloc(&allocator);
-    TIntermNode *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
+    allocator.resetStatistics();
+    mBudget.setAllocator(&allocator);
+    size_t bytesInUseBefore = allocator.getBytesInUse();
+
+    TIntermNode *root = compileTreeImpl(shaderStrings, numStrings, compileOptions,
+                                        preprocessedShader, recordingTime);
 
     if (root)
     {
         if (compileOptions & SH_INTERMEDIATE_TREE)
+        {
+            TScopedPhaseTimer timer(getPhaseTimings(), "IntermediateTree");
             TIntermediate::outputTree(root, infoSink.info);
+        }
 
         if (compileOptions & SH_OBJECT_CODE)
+        {
             translate(root, compileOptions);
 
+            // The output is incomplete if the budget ran out while writing it.
+            if (!checkCompileBudget())
+            {
+                infoSink.obj.erase();
+                root = nullptr;
+            }
+        }
+
         // The IntermNode tree doesn't need to be deleted here, since the
         // memory will be freed in a big chunk by the PoolAllocator.
-        return true;
     }
+
+    mStatistics.poolPeakBytes      = allocator.getPeakBytesInUse() - bytesInUseBefore;
+    mStatistics.poolPagesAllocated = allocator.getNumPagesAllocated();
+    mStatistics.poolPagesReused    = allocator.getNumPagesReused();
+    mStatistics.poolAllocations    = allocator.getNumAllocations();
+    mStatistics.poolAllocatedBytes = allocator.getTotalAllocatedBytes();
+
+    return root != nullptr;
+}
+
+bool TCompiler::recordPreprocessedShader(const char *const shaderStrings[],
+                                         size_t numStrings,
+                                         int compileOptions,
+                                         pp::PreprocessedShader *preprocessedShader)
+{
+    size_t firstSource = (compileOptions & SH_SOURCE_PATH) ? 1 : 0;
+    if (numStrings <= firstSource)
+        return false;
+
+    pp::Preprocessor preprocessor(preprocessedShader, preprocessedShader);
+    if (mBudget.getMaxPreprocessedTokens() > 0)
+        preprocessor.setMaxTokens(mBudget.getMaxPreprocessedTokens());
+    if (!InitPreprocessor(&preprocessor, numStrings - firstSource, &shaderStrings[firstSource],
+                          nullptr, extensionBehavior, &mPredefinedMacros, fragmentPrecisionHigh,
+                          shaderSpec))
+    {
+        return false;
+    }
+
+    preprocessedShader->record(&preprocessor);
+    return true;
+}
+
+bool TCompiler::checkCompileBudget()
+{
+    if (mBudget.check())
+        return true;
+
+    infoSink.info.prefix(EPrefixError);
+    infoSink.info << "compile " << mBudget.getExceededBudget() << " budget exceeded";
     return false;
 }
 
-bool TCompiler::InitBuiltInSymbolTable(const ShBuiltInResources &resources)
+bool TCompiler::compileBatch(const ShBatchShader *shaders,
+                             size_t numShaders,
+                             size_t numThreads,
+                             ShBatchResult *results)
 {
-    compileResources = resources;
-    setResourceString();
+    if (numThreads == 0)
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    numThreads = std::min(numThreads, numShaders);
 
-    assert(symbolTable.isEmpty());
-    symbolTable.push();   // COMMON_BUILTINS
-    symbolTable.push();   // ESSL1_BUILTINS
-    symbolTable.push();   // ESSL3_BUILTINS
-
-    TPublicType integer;
-    integer.type = EbtInt;
-    integer.primarySize = 1;
-    integer.secondarySize = 1;
-    integer.array = false;
-
-    TPublicType floatingPoint;
-    floatingPoint.type = EbtFloat;
-    floatingPoint.primarySize = 1;
-    floatingPoint.secondarySize = 1;
-    floatingPoint.array = false;
-
-    switch(shaderType)
-    {
-      case GL_FRAGMENT_SHADER:
-        symbolTable.setDefaultPrecision(integer, EbpMedium);
-        break;
-      case GL_VERTEX_SHADER:
-        symbolTable.setDefaultPrecision(integer, EbpHigh);
-        symbolTable.setDefaultPrecision(floatingPoint, EbpHigh);
-        break;
-      default:
-        assert(false && "Language not supported");
+    // Initializing a compiler makes its pool the current one.
+    TPoolAllocator *previousAllocator = GetGlobalPoolAllocator();
+    while (mBatchCompilers.size() + 1 < numThreads)
+    {
+        std::unique_ptr<TCompiler> compiler(ConstructCompiler(shaderType, shaderSpec, outputType));
+        if (!compiler || !compiler->Init(compileResources))
+            break;
+        mBatchCompilers.push_back(std::move(compiler));
     }
-    // Set defaults for sampler types that have default precision, even those that are
-    // only available if an extension exists.
-    // New sampler types in ESSL3 don't have default precision. ESSL1 types do.
-    initSamplerDefaultPrecision(EbtSampler2D);
-    initSamplerDefaultPrecision(EbtSamplerCube);
-    // SamplerExternalOES is specified in the extension to have default precision.
-    initSamplerDefaultPrecision(EbtSamplerExternalOES);
-    // It isn't specified whether Sampler2DRect has default precision.
-    initSamplerDefaultPrecision(EbtSampler2DRect);
+    SetGlobalPoolAllocator(previousAllocator);
+    numThreads = std::min(numThreads, mBatchCompilers.size() + 1);
 
-    InsertBuiltInFunctions(shaderType, shaderSpec, resources, symbolTable);
+    std::atomic<size_t> nextShader(0);
+    std::atomic<bool> allCompiled(true);
+    auto compileShaders = [&](TCompiler *compiler)
+    {
+        for (size_t index = nextShader++; index < numShaders; index = nextShader++)
+        {
+            const ShBatchShader &shader = shaders[index];
+            bool success =
+                compiler->compile(shader.shaderStrings, shader.numStrings, shader.compileOptions);
+            compiler->saveToBatchResult(success, &results[index]);
+            if (!success)
+                allCompiled = false;
+        }
+    };
 
-    IdentifyBuiltIns(shaderType, shaderSpec, resources, symbolTable);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i + 1 < numThreads; ++i)
+    {
+        threads.push_back(std::thread(compileShaders, mBatchCompilers[i].get()));
+    }
+    compileShaders(this);
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
 
-    return true;
+    clearResults();
+    return allCompiled;
+}
+
+void TCompiler::saveToBatchResult(bool success, ShBatchResult *result) const
+{
+    result->success         = success;
+    result->shaderVersion   = shaderVersion;
+    result->infoLog         = infoSink.info.str();
+    result->objectCode      = infoSink.obj.str();
+    result->attributes      = attributes;
+    result->outputVariables = outputVariables;
+    result->uniforms        = uniforms;
+    result->varyings        = varyings;
+    result->interfaceBlocks = interfaceBlocks;
+    result->statistics      = mStatistics;
+}
+
+void TCompiler::saveToCacheEntry(bool success, TranslationCacheEntry *entry) const
+{
+    entry->success         = success;
+    entry->shaderVersion   = shaderVersion;
+    entry->infoLog         = infoSink.info.str();
+    entry->objectCode      = infoSink.obj.str();
+    entry->attributes      = attributes;
+    entry->outputVariables = outputVariables;
+    entry->uniforms        = uniforms;
+    entry->varyings        = varyings;
+    entry->interfaceBlocks = interfaceBlocks;
+    saveTranslationResults(entry);
+}
+
+void TCompiler::loadFromCacheEntry(const TranslationCacheEntry &entry)
+{
+    clearResults();
+
+    shaderVersion = entry.shaderVersion;
+    infoSink.info << entry.infoLog;
+    infoSink.obj << entry.objectCode;
+    attributes      = entry.attributes;
+    outputVariables = entry.outputVariables;
+    uniforms        = entry.uniforms;
+    varyings        = entry.varyings;
+    interfaceBlocks = entry.interfaceBlocks;
+    loadTranslationResults(entry);
 }
 
-void TCompiler::initSamplerDefaultPrecision(TBasicType samplerType)
+bool TCompiler::InitBuiltInSymbolTable(const ShBuiltInResources &resources)
 {
-    ASSERT(samplerType > EbtGuardSamplerBegin && samplerType < EbtGuardSamplerEnd);
-    TPublicType sampler;
-    sampler.primarySize   = 1;
-    sampler.secondarySize = 1;
-    sampler.array         = false;
-    sampler.type          = samplerType;
-    symbolTable.setDefaultPrecision(sampler, EbpLow);
+    compileResources = resources;
+    setResourceString();
+
+    // The built-ins only depend on the parameters that are part of the resource string, so they
+    // can be shared with every other compiler that has the same ones.
+    mBuiltIns = TBuiltInSymbolTable::Get(shaderType, shaderSpec, resources, builtInResourcesString);
+
+    assert(symbolTable.isEmpty());
+    symbolTable.shareBuiltInLevels(mBuiltIns->getSymbolTable());
+
+    return true;
 }
 
 void TCompiler::setResourceString()
@@ -491,6 +788,9 @@ void TCompiler::setResourceString()
               << ":FragmentPrecisionHigh:" << compileResources.FragmentPrecisionHigh
               << ":MaxExpressionComplexity:" << compileResources.MaxExpressionComplexity
               << ":MaxCallStackDepth:" << compileResources.MaxCallStackDepth
+              << ":MaxCompileTimeMilliseconds:" << compileResources.MaxCompileTimeMilliseconds
+              << ":MaxPreprocessedTokens:" << compileResources.MaxPreprocessedTokens
+              << ":MaxCompileAllocations:" << compileResources.MaxCompileAllocations
               << ":EXT_blend_func_extended:" << compileResources.EXT_blend_func_extended
               << ":EXT_frag_depth:" << compileResources.EXT_frag_depth
               << ":EXT_shader_texture_lod:" << compileResources.EXT_shader_texture_lod
@@ -503,7 +803,8 @@ void TCompiler::setResourceString()
               << ":MaxProgramTexelOffset:" << compileResources.MaxProgramTexelOffset
               << ":MaxDualSourceDrawBuffers:" << compileResources.MaxDualSourceDrawBuffers
               << ":NV_draw_buffers:" << compileResources.NV_draw_buffers
-              << ":WEBGL_debug_shader_precision:" << compileResources.WEBGL_debug_shader_precision;
+              << ":WEBGL_debug_shader_precision:" << compileResources.WEBGL_debug_shader_precision
+              << ":ArrayIndexClampingStrategy:" << compileResources.ArrayIndexClampingStrategy;
 
     builtInResourcesString = strstream.str();
 }
@@ -528,6 +829,14 @@ void TCompiler::clearResults()
 
     mSourcePath = NULL;
     mTemporaryIndex = 0;
+
+    mCollectStatistics = false;
+    mStatistics.phaseTimings.clear();
+    mStatistics.poolPeakBytes      = 0;
+    mStatistics.poolPagesAllocated = 0;
+    mStatistics.poolPagesReused    = 0;
+    mStatistics.poolAllocations    = 0;
+    mStatistics.poolAllocatedBytes = 0;
 }
 
 bool TCompiler::initCallDag(TIntermNode *root)
@@ -691,26 +1000,12 @@ bool TCompiler::pruneUnusedFunctions(TIntermNode *root)
     return true;
 }
 
-bool TCompiler::validateOutputs(TIntermNode* root)
-{
-    ValidateOutputs validateOutputs(getExtensionBehavior(), compileResources.MaxDrawBuffers);
-    root->traverse(&validateOutputs);
-    return (validateOutputs.validateAndCountErrors(infoSink.info) == 0);
-}
-
 void TCompiler::rewriteCSSShader(TIntermNode* root)
 {
     RenameFunction renamer("main(", "css_main(");
     root->traverse(&renamer);
 }
 
-bool TCompiler::validateLimitations(TIntermNode* root)
-{
-    ValidateLimitations validate(shaderType, &infoSink.info);
-    root->traverse(&validate);
-    return validate.numErrors() == 0;
-}
-
 bool TCompiler::enforceTimingRestrictions(TIntermNode* root, bool outputGraph)
 {
     if (shaderSpec != SH_WEBGL_SPEC)
@@ -14,8 +14,13 @@
 // This should not be included by driver code.
 //
 
+#include <chrono>
+#include <memory>
+
+#include "compiler/preprocessor/Macro.h"
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "compiler/translator/CallDAG.h"
+#include "compiler/translator/CompileBudget.h"
 #include "compiler/translator/ExtensionBehavior.h"
 #include "compiler/translator/HashNames.h"
 #include "compiler/translator/InfoSink.h"
@@ -24,8 +29,15 @@
 #include "compiler/translator/VariableInfo.h"
 #include "third_party/compiler/ArrayBoundsClamper.h"
 
+namespace pp
+{
+class PreprocessedShader;
+}
+
+class TBuiltInSymbolTable;
 class TCompiler;
 class TDependencyGraph;
+struct TranslationCacheEntry;
 #ifdef ANGLE_ENABLE_HLSL
 class TranslatorHLSL;
 #endif // ANGLE_ENABLE_HLSL
@@ -59,6 +71,33 @@ protected:
     TPoolAllocator allocator;
 };
 
+// Adds the wall time from its construction to its destruction to the phase timings, unless they
+// are null.
+class TScopedPhaseTimer : angle::NonCopyable
+{
+  public:
+    TScopedPhaseTimer(std::vector<ShPhaseTiming> *timings, const char *name)
+        : mTimings(timings), mName(name)
+    {
+        if (mTimings)
+            mStart = std::chrono::steady_clock::now();
+    }
+    ~TScopedPhaseTimer()
+    {
+        if (mTimings)
+        {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - mStart;
+            ShPhaseTiming timing = {mName, elapsed.count()};
+            mTimings->push_back(timing);
+        }
+    }
+
+  private:
+    std::vector<ShPhaseTiming> *mTimings;
+    const char *mName;
+    std::chrono::steady_clock::time_point mStart;
+};
+
 //
 // The base class for the machine dependent compiler to derive from
 // for managing object code from the compile.
@@ -81,6 +120,13 @@ class TCompiler : public TShHandleBase
     bool compile(const char* const shaderStrings[],
         size_t numStrings, int compileOptions);
 
+    // Compiles the shaders on up to numThreads threads, this compiler and the compilers kept in
+    // mBatchCompilers each compiling one shader at a time. Returns true if all of them compiled.
+    bool compileBatch(const ShBatchShader *shaders,
+                      size_t numShaders,
+                      size_t numThreads,
+                      ShBatchResult *results);
+
     // Get results of the last compilation.
     int getShaderVersion() const { return shaderVersion; }
     TInfoSink& getInfoSink() { return infoSink; }
@@ -93,6 +139,7 @@ class TCompiler : public TShHandleBase
     const std::vector<sh::Uniform> &getUniforms() const { return uniforms; }
     const std::vector<sh::Varying> &getVaryings() const { return varyings; }
     const std::vector<sh::InterfaceBlock> &getInterfaceBlocks() const { return interfaceBlocks; }
+    const ShCompileStatistics &getStatistics() const { return mStatistics; }
 
     ShHashFunction64 getHashFunction() const { return hashFunction; }
     NameMap& getNameMap() { return nameMap; }
@@ -114,13 +161,8 @@ class TCompiler : public TShHandleBase
     void setResourceString();
     // Return false if the call depth is exceeded.
     bool checkCallDepth();
-    // Returns true if a program has no conflicting or missing fragment outputs
-    bool validateOutputs(TIntermNode* root);
     // Rewrites a shader's intermediate tree according to the CSS Shaders spec.
     void rewriteCSSShader(TIntermNode* root);
-    // Returns true if the given shader does not exceed the minimum
-    // functionality mandated in GLSL 1.0 spec Appendix A.
-    bool validateLimitations(TIntermNode* root);
     // Collect info for all attribs, uniforms, varyings.
     void collectVariables(TIntermNode* root);
     // Add emulated functions to the built-in function emulator.
@@ -153,8 +195,17 @@ class TCompiler : public TShHandleBase
     const TExtensionBehavior& getExtensionBehavior() const;
     const char *getSourcePath() const;
     const TPragma& getPragma() const { return mPragma; }
+    // The budget of the current compile, for the backends to check while writing the output.
+    TCompileBudget *getCompileBudget() { return &mBudget; }
+    // Returns false and reports an error if the budget of the compile is exceeded.
+    bool checkCompileBudget();
     void writePragma();
     unsigned int *getTemporaryIndex() { return &mTemporaryIndex; }
+    // Timings of the phases of the current compile, or null if they are not collected.
+    std::vector<ShPhaseTiming> *getPhaseTimings()
+    {
+        return mCollectStatistics ? &mStatistics.phaseTimings : nullptr;
+    }
 
     const ArrayBoundsClamper& getArrayBoundsClamper() const;
     ShArrayIndexClampingStrategy getArrayIndexClampingStrategy() const;
@@ -172,6 +223,10 @@ class TCompiler : public TShHandleBase
         return (compileOptions & SH_VARIABLES) != 0;
     }
 
+    // Save and restore the backend-specific results of a compile for the translation cache.
+    virtual void saveTranslationResults(TranslationCacheEntry *entry) const {}
+    virtual void loadTranslationResults(const TranslationCacheEntry &entry) {}
+
   private:
     // Creates the function call DAG for further analysis, returning false if there is a recursion
     bool initCallDag(TIntermNode *root);
@@ -179,15 +234,32 @@ class TCompiler : public TShHandleBase
     bool tagUsedFunctions();
     void internalTagUsedFunction(size_t index);
 
-    void initSamplerDefaultPrecision(TBasicType samplerType);
-
     // Removes unused function declarations and prototypes from the AST
     class UnusedPredicate;
     bool pruneUnusedFunctions(TIntermNode *root);
 
+    // The parse replays the preprocessed shader instead of running the preprocessor if it is not
+    // null, in which case the time spent recording it is reported as the preprocessing time.
     TIntermNode *compileTreeImpl(const char *const shaderStrings[],
                                  size_t numStrings,
-                                 const int compileOptions);
+                                 const int compileOptions,
+                                 pp::PreprocessedShader *preprocessedShader = nullptr,
+                                 double recordingTime = 0.0);
+
+    bool compileUncached(const char *const shaderStrings[],
+                         size_t numStrings,
+                         int compileOptions,
+                         pp::PreprocessedShader *preprocessedShader = nullptr,
+                         double recordingTime = 0.0);
+    // Runs the preprocessor over the whole shader ahead of the parse. Returns false if the
+    // preprocessor can't be initialized for the sources.
+    bool recordPreprocessedShader(const char *const shaderStrings[],
+                                  size_t numStrings,
+                                  int compileOptions,
+                                  pp::PreprocessedShader *preprocessedShader);
+    void saveToCacheEntry(bool success, TranslationCacheEntry *entry) const;
+    void saveToBatchResult(bool success, ShBatchResult *result) const;
+    void loadFromCacheEntry(const TranslationCacheEntry &entry);
 
     sh::GLenum shaderType;
     ShShaderSpec shaderSpec;
@@ -212,12 +284,18 @@ class TCompiler : public TShHandleBase
     ShBuiltInResources compileResources;
     std::string builtInResourcesString;
 
+    // Built-in levels shared with other compilers that have the same language, spec, and
+    // resources. Declared before symbolTable so that they outlive it.
+    std::shared_ptr<const TBuiltInSymbolTable> mBuiltIns;
+
     // Built-in symbol table for the given language, spec, and resources.
     // It is preserved from compile-to-compile.
     TSymbolTable symbolTable;
     // Built-in extensions with default behavior.
     TExtensionBehavior extensionBehavior;
     bool fragmentPrecisionHigh;
+    // Standard and extension macros, predefined by the first compile.
+    pp::MacroSet mPredefinedMacros;
 
     ArrayBoundsClamper arrayBoundsClamper;
     ShArrayIndexClampingStrategy clampingStrategy;
@@ -235,6 +313,14 @@ class TCompiler : public TShHandleBase
     TPragma mPragma;
 
     unsigned int mTemporaryIndex;
+
+    bool mCollectStatistics;
+    ShCompileStatistics mStatistics;
+
+    TCompileBudget mBudget;
+
+    // Compilers with the same parameters as this one, created for the threads of compileBatch.
+    std::vector<std::unique_ptr<TCompiler>> mBatchCompilers;
 };
 
 //
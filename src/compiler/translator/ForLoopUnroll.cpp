@@ -44,7 +44,7 @@ bool ForLoopUnrollMarker::visitLoop(Visit, TIntermLoop *node)
     bool canBeUnrolled = mHasRunLoopValidation;
     if (!mHasRunLoopValidation)
     {
-        canBeUnrolled = ValidateLimitations::IsLimitedForLoop(node);
+        canBeUnrolled = ValidateLimitations::IsLimitedForLoop(node, mSymbolTable, mShaderVersion);
     }
     if (mUnrollCondition == kIntegerIndex && canBeUnrolled)
     {
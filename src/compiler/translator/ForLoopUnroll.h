@@ -9,6 +9,8 @@
 
 #include "compiler/translator/LoopInfo.h"
 
+class TSymbolTable;
+
 // This class detects for-loops that needs to be unrolled.
 // Currently we support two unroll conditions:
 //   1) kForLoopWithIntegerIndex: unroll if the index type is integer.
@@ -24,12 +26,17 @@ class ForLoopUnrollMarker : public TIntermTraverser
         kSamplerArrayIndex
     };
 
-    ForLoopUnrollMarker(UnrollCondition condition, bool hasRunLoopValidation)
+    ForLoopUnrollMarker(UnrollCondition condition,
+                        bool hasRunLoopValidation,
+                        const TSymbolTable &symbolTable,
+                        int shaderVersion)
         : TIntermTraverser(true, false, false),
           mUnrollCondition(condition),
           mSamplerArrayIndexIsFloatLoopIndex(false),
           mVisitSamplerArrayIndexNodeInsideLoop(false),
-          mHasRunLoopValidation(hasRunLoopValidation)
+          mHasRunLoopValidation(hasRunLoopValidation),
+          mSymbolTable(symbolTable),
+          mShaderVersion(shaderVersion)
     {
     }
 
@@ -48,6 +55,8 @@ class ForLoopUnrollMarker : public TIntermTraverser
     bool mSamplerArrayIndexIsFloatLoopIndex;
     bool mVisitSamplerArrayIndexNodeInsideLoop;
     bool mHasRunLoopValidation;
+    const TSymbolTable &mSymbolTable;
+    int mShaderVersion;
 };
 
 #endif // COMPILER_TRANSLATOR_FORLOOPUNROLL_H_
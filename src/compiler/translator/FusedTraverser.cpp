@@ -0,0 +1,115 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.cpp: Implements TFusedTraverser, which runs several read-only passes over the
+// AST in a single traversal.
+
+#include "compiler/translator/FusedTraverser.h"
+
+TFusedTraverser::TFusedTraverser() : TIntermTraverser(true, false, false)
+{
+}
+
+void TFusedTraverser::addPass(TIntermTraverser *pass)
+{
+    ASSERT(pass->preVisit && !pass->inVisit && !pass->postVisit);
+    mPasses.push_back(FusedPass(pass));
+}
+
+template <typename NodeType>
+bool TFusedTraverser::visitFused(bool (TIntermTraverser::*visitFunction)(Visit, NodeType *),
+                                 NodeType *node)
+{
+    // The node is a descendant of the nodes at a lower depth than its own, so passes that skip
+    // the children of a node at the same or a greater depth visit it again.
+    bool visitChildren = false;
+    for (FusedPass &pass : mPasses)
+    {
+        if (pass.skipDepth >= 0)
+        {
+            if (mDepth > pass.skipDepth)
+                continue;
+            pass.skipDepth = -1;
+        }
+
+        if ((pass.traverser->*visitFunction)(PreVisit, node))
+            visitChildren = true;
+        else
+            pass.skipDepth = mDepth;
+    }
+    return visitChildren;
+}
+
+template <typename NodeType>
+void TFusedTraverser::visitFusedLeaf(void (TIntermTraverser::*visitFunction)(NodeType *),
+                                     NodeType *node)
+{
+    for (FusedPass &pass : mPasses)
+    {
+        if (pass.skipDepth >= 0)
+        {
+            if (mDepth > pass.skipDepth)
+                continue;
+            pass.skipDepth = -1;
+        }
+
+        (pass.traverser->*visitFunction)(node);
+    }
+}
+
+void TFusedTraverser::visitSymbol(TIntermSymbol *node)
+{
+    visitFusedLeaf(&TIntermTraverser::visitSymbol, node);
+}
+
+void TFusedTraverser::visitRaw(TIntermRaw *node)
+{
+    visitFusedLeaf(&TIntermTraverser::visitRaw, node);
+}
+
+void TFusedTraverser::visitConstantUnion(TIntermConstantUnion *node)
+{
+    visitFusedLeaf(&TIntermTraverser::visitConstantUnion, node);
+}
+
+bool TFusedTraverser::visitBinary(Visit, TIntermBinary *node)
+{
+    return visitFused(&TIntermTraverser::visitBinary, node);
+}
+
+bool TFusedTraverser::visitUnary(Visit, TIntermUnary *node)
+{
+    return visitFused(&TIntermTraverser::visitUnary, node);
+}
+
+bool TFusedTraverser::visitSelection(Visit, TIntermSelection *node)
+{
+    return visitFused(&TIntermTraverser::visitSelection, node);
+}
+
+bool TFusedTraverser::visitSwitch(Visit, TIntermSwitch *node)
+{
+    return visitFused(&TIntermTraverser::visitSwitch, node);
+}
+
+bool TFusedTraverser::visitCase(Visit, TIntermCase *node)
+{
+    return visitFused(&TIntermTraverser::visitCase, node);
+}
+
+bool TFusedTraverser::visitAggregate(Visit, TIntermAggregate *node)
+{
+    return visitFused(&TIntermTraverser::visitAggregate, node);
+}
+
+bool TFusedTraverser::visitLoop(Visit, TIntermLoop *node)
+{
+    return visitFused(&TIntermTraverser::visitLoop, node);
+}
+
+bool TFusedTraverser::visitBranch(Visit, TIntermBranch *node)
+{
+    return visitFused(&TIntermTraverser::visitBranch, node);
+}
@@ -0,0 +1,66 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.h: TFusedTraverser runs several read-only passes over the AST in a single
+// traversal, instead of walking the whole tree once per pass.
+
+#ifndef COMPILER_TRANSLATOR_FUSEDTRAVERSER_H_
+#define COMPILER_TRANSLATOR_FUSEDTRAVERSER_H_
+
+#include "compiler/translator/IntermNode.h"
+
+// The fused passes are called in the order they were added for each node, so a pass sees the
+// nodes in the same order as when traversing the tree alone. A pass returning false from a visit
+// function only skips the children for that pass.
+//
+// The passes must only use pre visits, must not change the structure of the tree and must not
+// override the traverse functions or rely on the traversal context (depth, path and parent
+// blocks), which is only tracked by the fused traverser. They can still traverse subtrees
+// themselves from their visit functions, as loop validation does.
+//
+// TCompiler::compileTreeImpl picks which passes are fused, in the same fixed order it runs all the
+// other passes in.
+class TFusedTraverser : public TIntermTraverser
+{
+  public:
+    TFusedTraverser();
+
+    // The pass is not owned by the fused traverser.
+    void addPass(TIntermTraverser *pass);
+    bool empty() const { return mPasses.empty(); }
+
+    void visitSymbol(TIntermSymbol *node) override;
+    void visitRaw(TIntermRaw *node) override;
+    void visitConstantUnion(TIntermConstantUnion *node) override;
+    bool visitBinary(Visit visit, TIntermBinary *node) override;
+    bool visitUnary(Visit visit, TIntermUnary *node) override;
+    bool visitSelection(Visit visit, TIntermSelection *node) override;
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override;
+    bool visitCase(Visit visit, TIntermCase *node) override;
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override;
+    bool visitLoop(Visit visit, TIntermLoop *node) override;
+    bool visitBranch(Visit visit, TIntermBranch *node) override;
+
+  private:
+    struct FusedPass
+    {
+        FusedPass(TIntermTraverser *traverserIn) : traverser(traverserIn), skipDepth(-1) {}
+
+        TIntermTraverser *traverser;
+        // Depth of the node whose children the pass skips, or -1 if the pass visits the current
+        // node.
+        int skipDepth;
+    };
+
+    template <typename NodeType>
+    bool visitFused(bool (TIntermTraverser::*visitFunction)(Visit, NodeType *),
+                    NodeType *node);
+    template <typename NodeType>
+    void visitFusedLeaf(void (TIntermTraverser::*visitFunction)(NodeType *), NodeType *node);
+
+    std::vector<FusedPass> mPasses;
+};
+
+#endif  // COMPILER_TRANSLATOR_FUSEDTRAVERSER_H_
@@ -6,6 +6,32 @@
 
 #include "compiler/translator/InfoSink.h"
 
+TInfoSinkBase& TInfoSinkBase::operator<<(float f) {
+    // Make sure that at least one decimal point is written. If a number
+    // does not have a fractional part, the default precision format does
+    // not write the decimal portion which gets interpreted as integer by
+    // the compiler.
+    char buffer[64];
+    int length;
+    if (fractionalPart(f) == 0.0f)
+        length = snprintf(buffer, sizeof(buffer), "%.1f", f);
+    else
+        length = snprintf(buffer, sizeof(buffer), "%.8g", f);
+    if (length < 0)
+        return *this;
+    if (length >= static_cast<int>(sizeof(buffer)))
+        length = static_cast<int>(sizeof(buffer)) - 1;
+
+    // Unlike streams, printf uses the decimal point of the C locale, which
+    // the application may have changed.
+    for (int i = 0; i < length; ++i) {
+        if (buffer[i] == ',')
+            buffer[i] = '.';
+    }
+    sink.append(buffer, length);
+    return *this;
+}
+
 void TInfoSinkBase::prefix(TPrefixType p) {
     switch(p) {
         case EPrefixNone:
@@ -32,14 +58,11 @@ void TInfoSinkBase::prefix(TPrefixType p) {
 }
 
 void TInfoSinkBase::location(int file, int line) {
-    TPersistStringStream stream;
     if (line)
-        stream << file << ":" << line;
+        *this << file << ":" << line;
     else
-        stream << file << ":? ";
-    stream << ": ";
-
-    sink.append(stream.str());
+        *this << file << ":? ";
+    *this << ": ";
 }
 
 void TInfoSinkBase::location(const TSourceLoc& loc) {
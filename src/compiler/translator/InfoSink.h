@@ -62,28 +62,23 @@ public:
         return *this;
     }
     TInfoSinkBase& operator<<(const TString& str) {
-        sink.append(str.c_str());
+        sink.append(str.data(), str.size());
         return *this;
     }
-    // Make sure floats are written with correct precision.
-    TInfoSinkBase& operator<<(float f) {
-        // Make sure that at least one decimal point is written. If a number
-        // does not have a fractional part, the default precision format does
-        // not write the decimal portion which gets interpreted as integer by
-        // the compiler.
-        TPersistStringStream stream;
-        if (fractionalPart(f) == 0.0f) {
-            stream.precision(1);
-            stream << std::showpoint << std::fixed << f;
-        } else {
-            stream.unsetf(std::ios::fixed);
-            stream.unsetf(std::ios::scientific);
-            stream.precision(8);
-            stream << f;
-        }
-        sink.append(stream.str());
+    TInfoSinkBase& operator<<(const TInfoSinkBase& other) {
+        sink.append(other.sink);
         return *this;
     }
+    // Numbers are formatted without creating a string stream for each of
+    // them, as the generic operator does.
+    TInfoSinkBase& operator<<(int i) { return appendSigned(i); }
+    TInfoSinkBase& operator<<(long i) { return appendSigned(i); }
+    TInfoSinkBase& operator<<(long long i) { return appendSigned(i); }
+    TInfoSinkBase& operator<<(unsigned int i) { return appendUnsigned(i); }
+    TInfoSinkBase& operator<<(unsigned long i) { return appendUnsigned(i); }
+    TInfoSinkBase& operator<<(unsigned long long i) { return appendUnsigned(i); }
+    // Make sure floats are written with correct precision.
+    TInfoSinkBase& operator<<(float f);
     // Write boolean values as their names instead of integral value.
     TInfoSinkBase& operator<<(bool b) {
         const char* str = b ? "true" : "false";
@@ -93,6 +88,7 @@ public:
 
     void erase() { sink.clear(); }
     int size() { return static_cast<int>(sink.size()); }
+    void reserve(size_t capacity) { sink.reserve(capacity); }
 
     const TPersistString& str() const { return sink; }
     const char* c_str() const { return sink.c_str(); }
@@ -103,6 +99,26 @@ public:
     void message(TPrefixType p, const TSourceLoc& loc, const char* m);
 
 private:
+    TInfoSinkBase& appendSigned(long long i) {
+        if (i < 0) {
+            sink.append(1, '-');
+            // Negate in unsigned arithmetic, which is defined for the minimum value.
+            return appendUnsigned(0ull - static_cast<unsigned long long>(i));
+        }
+        return appendUnsigned(static_cast<unsigned long long>(i));
+    }
+    TInfoSinkBase& appendUnsigned(unsigned long long i) {
+        char buffer[24];
+        char* end = buffer + sizeof(buffer);
+        char* begin = end;
+        do {
+            *--begin = static_cast<char>('0' + i % 10);
+            i /= 10;
+        } while (i != 0);
+        sink.append(begin, end - begin);
+        return *this;
+    }
+
     TPersistString sink;
 };
 
@@ -4,10 +4,11 @@
 // found in the LICENSE file.
 //
 
+#include "compiler/translator/BuiltInSymbolTable.h"
 #include "compiler/translator/Cache.h"
 #include "compiler/translator/InitializeDll.h"
 #include "compiler/translator/InitializeGlobals.h"
-#include "compiler/translator/InitializeParseContext.h"
+#include "compiler/translator/PoolAlloc.h"
 
 #include "common/platform.h"
 
@@ -20,11 +21,6 @@ bool InitProcess()
         return false;
     }
 
-    if (!InitializeParseContextIndex()) {
-        assert(0 && "InitProcess(): Failed to initalize parse context");
-        return false;
-    }
-
     TCache::initialize();
 
     return true;
@@ -32,7 +28,8 @@ bool InitProcess()
 
 void DetachProcess()
 {
-    FreeParseContextIndex();
+    TBuiltInSymbolTable::ReleaseAll();
     FreePoolIndex();
     TCache::destroy();
+    TPoolAllocator::ReleaseCachedPages();
 }
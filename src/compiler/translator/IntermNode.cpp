@@ -17,6 +17,7 @@
 
 #include "common/mathutil.h"
 #include "common/matrix_utils.h"
+#include "compiler/translator/CompileBudget.h"
 #include "compiler/translator/HashNames.h"
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/SymbolTable.h"
@@ -66,6 +67,348 @@ bool ValidateMultiplication(TOperator op, const TType &left, const TType &right)
     }
 }
 
+// The folding loops below work on the plain values of the constants: the basic type is looked
+// at once per array rather than once per component, which leaves loops the compiler can
+// vectorize.
+float GetConst(const TConstantUnion &constant, float) { return constant.getFConst(); }
+int GetConst(const TConstantUnion &constant, int) { return constant.getIConst(); }
+unsigned int GetConst(const TConstantUnion &constant, unsigned int) { return constant.getUConst(); }
+bool GetConst(const TConstantUnion &constant, bool) { return constant.getBConst(); }
+
+void SetConst(TConstantUnion *constant, float value) { constant->setFConst(value); }
+void SetConst(TConstantUnion *constant, int value) { constant->setIConst(value); }
+void SetConst(TConstantUnion *constant, unsigned int value) { constant->setUConst(value); }
+void SetConst(TConstantUnion *constant, bool value) { constant->setBConst(value); }
+
+struct AddOp
+{
+    template <typename T>
+    T operator()(T x, T y) const { return x + y; }
+};
+
+struct SubOp
+{
+    template <typename T>
+    T operator()(T x, T y) const { return x - y; }
+};
+
+struct MulOp
+{
+    template <typename T>
+    T operator()(T x, T y) const { return x * y; }
+};
+
+struct BitwiseAndOp
+{
+    template <typename T>
+    T operator()(T x, T y) const { return x & y; }
+};
+
+struct BitwiseOrOp
+{
+    template <typename T>
+    T operator()(T x, T y) const { return x | y; }
+};
+
+struct BitwiseXorOp
+{
+    template <typename T>
+    T operator()(T x, T y) const { return x ^ y; }
+};
+
+struct BitShiftLeftOp
+{
+    template <typename T>
+    T operator()(T x, T y) const { return x << y; }
+};
+
+struct BitShiftRightOp
+{
+    template <typename T>
+    T operator()(T x, T y) const { return x >> y; }
+};
+
+struct LogicalAndOp
+{
+    bool operator()(bool x, bool y) const { return x && y; }
+};
+
+struct LogicalOrOp
+{
+    bool operator()(bool x, bool y) const { return x || y; }
+};
+
+struct LogicalXorOp
+{
+    bool operator()(bool x, bool y) const { return x != y; }
+};
+
+struct NegativeOp
+{
+    template <typename T>
+    T operator()(T x) const { return -x; }
+    unsigned int operator()(unsigned int x) const
+    {
+        return static_cast<unsigned int>(-static_cast<int>(x));
+    }
+};
+
+struct PositiveOp
+{
+    template <typename T>
+    T operator()(T x) const { return x; }
+};
+
+struct LogicalNotOp
+{
+    bool operator()(bool x) const { return !x; }
+};
+
+struct BitwiseNotOp
+{
+    template <typename T>
+    T operator()(T x) const { return ~x; }
+};
+
+struct FloatFunctionOp
+{
+    FloatFunctionOp(float (*functionIn)(float)) : function(functionIn) {}
+    float operator()(float x) const { return function(x); }
+    float (*function)(float);
+};
+
+struct ScaleOp
+{
+    ScaleOp(float factorIn) : factor(factorIn) {}
+    float operator()(float x) const { return factor * x; }
+    float factor;
+};
+
+// Applies the operation to each component. A scalar operand is read with a stride of 0, so that it
+// applies to every component of the other operand without being replicated first.
+template <typename T, typename Op>
+void FoldComponentWise(Op op,
+                       const TConstantUnion *left,
+                       size_t leftStride,
+                       const TConstantUnion *right,
+                       size_t rightStride,
+                       size_t size,
+                       TConstantUnion *result)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        SetConst(&result[i], op(GetConst(left[i * leftStride], T()),
+                                GetConst(right[i * rightStride], T())));
+    }
+}
+
+template <typename T, typename Op>
+void FoldComponentWise(Op op, const TConstantUnion *operand, size_t size, TConstantUnion *result)
+{
+    for (size_t i = 0; i < size; ++i)
+        SetConst(&result[i], op(GetConst(operand[i], T())));
+}
+
+// Fold an operation on floats, ints or uints. Return false for other basic types.
+template <typename Op>
+bool FoldArithmetic(TBasicType basicType,
+                    Op op,
+                    const TConstantUnion *left,
+                    size_t leftStride,
+                    const TConstantUnion *right,
+                    size_t rightStride,
+                    size_t size,
+                    TConstantUnion *result)
+{
+    switch (basicType)
+    {
+      case EbtFloat:
+        FoldComponentWise<float>(op, left, leftStride, right, rightStride, size, result);
+        return true;
+      case EbtInt:
+        FoldComponentWise<int>(op, left, leftStride, right, rightStride, size, result);
+        return true;
+      case EbtUInt:
+        FoldComponentWise<unsigned int>(op, left, leftStride, right, rightStride, size, result);
+        return true;
+      default:
+        return false;
+    }
+}
+
+template <typename Op>
+bool FoldArithmetic(TBasicType basicType,
+                    Op op,
+                    const TConstantUnion *operand,
+                    size_t size,
+                    TConstantUnion *result)
+{
+    switch (basicType)
+    {
+      case EbtFloat:
+        FoldComponentWise<float>(op, operand, size, result);
+        return true;
+      case EbtInt:
+        FoldComponentWise<int>(op, operand, size, result);
+        return true;
+      case EbtUInt:
+        FoldComponentWise<unsigned int>(op, operand, size, result);
+        return true;
+      default:
+        return false;
+    }
+}
+
+// Fold an operation on ints or uints. Return false for other basic types.
+template <typename Op>
+bool FoldInteger(TBasicType basicType,
+                 Op op,
+                 const TConstantUnion *left,
+                 size_t leftStride,
+                 const TConstantUnion *right,
+                 size_t rightStride,
+                 size_t size,
+                 TConstantUnion *result)
+{
+    switch (basicType)
+    {
+      case EbtInt:
+        FoldComponentWise<int>(op, left, leftStride, right, rightStride, size, result);
+        return true;
+      case EbtUInt:
+        FoldComponentWise<unsigned int>(op, left, leftStride, right, rightStride, size, result);
+        return true;
+      default:
+        return false;
+    }
+}
+
+template <typename Op>
+bool FoldInteger(TBasicType basicType,
+                 Op op,
+                 const TConstantUnion *operand,
+                 size_t size,
+                 TConstantUnion *result)
+{
+    switch (basicType)
+    {
+      case EbtInt:
+        FoldComponentWise<int>(op, operand, size, result);
+        return true;
+      case EbtUInt:
+        FoldComponentWise<unsigned int>(op, operand, size, result);
+        return true;
+      default:
+        return false;
+    }
+}
+
+// Fold the unary operations that apply to every value of the operand type over the whole array.
+// Return false for the other operations and operand types.
+bool FoldUnaryComponentWise(TOperator op,
+                            TBasicType basicType,
+                            const TConstantUnion *operand,
+                            size_t size,
+                            TConstantUnion *result)
+{
+    switch (op)
+    {
+      case EOpNegative:
+        return FoldArithmetic(basicType, NegativeOp(), operand, size, result);
+      case EOpPositive:
+        return FoldArithmetic(basicType, PositiveOp(), operand, size, result);
+      case EOpBitwiseNot:
+        return FoldInteger(basicType, BitwiseNotOp(), operand, size, result);
+      case EOpLogicalNot:
+      case EOpVectorLogicalNot:
+        if (basicType != EbtBool)
+            return false;
+        FoldComponentWise<bool>(LogicalNotOp(), operand, size, result);
+        return true;
+      default:
+        break;
+    }
+
+    if (basicType != EbtFloat)
+        return false;
+
+    switch (op)
+    {
+      case EOpRadians:
+        FoldComponentWise<float>(ScaleOp(kDegreesToRadiansMultiplier), operand, size, result);
+        return true;
+      case EOpDegrees:
+        FoldComponentWise<float>(ScaleOp(kRadiansToDegreesMultiplier), operand, size, result);
+        return true;
+      case EOpSin:
+        FoldComponentWise<float>(FloatFunctionOp(&sinf), operand, size, result);
+        return true;
+      case EOpCos:
+        FoldComponentWise<float>(FloatFunctionOp(&cosf), operand, size, result);
+        return true;
+      case EOpTan:
+        FoldComponentWise<float>(FloatFunctionOp(&tanf), operand, size, result);
+        return true;
+      case EOpAtan:
+        FoldComponentWise<float>(FloatFunctionOp(&atanf), operand, size, result);
+        return true;
+      case EOpFloor:
+        FoldComponentWise<float>(FloatFunctionOp(&floorf), operand, size, result);
+        return true;
+      case EOpCeil:
+        FoldComponentWise<float>(FloatFunctionOp(&ceilf), operand, size, result);
+        return true;
+      case EOpTrunc:
+        FoldComponentWise<float>(FloatFunctionOp(&truncf), operand, size, result);
+        return true;
+      case EOpExp:
+        FoldComponentWise<float>(FloatFunctionOp(&expf), operand, size, result);
+        return true;
+      case EOpExp2:
+        FoldComponentWise<float>(FloatFunctionOp(&exp2f), operand, size, result);
+        return true;
+      case EOpAbs:
+        FoldComponentWise<float>(FloatFunctionOp(&fabsf), operand, size, result);
+        return true;
+      default:
+        return false;
+    }
+}
+
+// Returns true once the budget of the compile is exceeded, after which folding stops.
+bool IsBudgetExceeded(TCompileBudget *budget)
+{
+    return budget != nullptr && !budget->checkPeriodically();
+}
+
+// Fold the product of a leftRows x leftCols matrix and a leftCols x rightCols matrix, both in
+// column-major order. Vectors are matrices with a single row or column. Return false if the
+// budget is exceeded.
+bool FoldMatrixProduct(const TConstantUnion *left,
+                       int leftRows,
+                       int leftCols,
+                       const TConstantUnion *right,
+                       int rightCols,
+                       TCompileBudget *budget,
+                       TConstantUnion *result)
+{
+    for (int column = 0; column < rightCols; ++column)
+    {
+        const TConstantUnion *rightColumn = &right[column * leftCols];
+        for (int row = 0; row < leftRows; ++row)
+        {
+            if (IsBudgetExceeded(budget))
+                return false;
+
+            float sum = 0.0f;
+            for (int i = 0; i < leftCols; ++i)
+                sum += left[i * leftRows + row].getFConst() * rightColumn[i].getFConst();
+            result[column * leftRows + row].setFConst(sum);
+        }
+    }
+    return true;
+}
+
 TConstantUnion *Vectorize(const TConstantUnion &constant, size_t size)
 {
     TConstantUnion *constUnion = new TConstantUnion[size];
@@ -818,7 +1161,7 @@ bool TIntermBinary::promote(TInfoSink &infoSink)
     return true;
 }
 
-TIntermTyped *TIntermBinary::fold(TInfoSink &infoSink)
+TIntermTyped *TIntermBinary::fold(TInfoSink &infoSink, TCompileBudget *budget)
 {
     TIntermConstantUnion *leftConstant = mLeft->getAsConstantUnion();
     TIntermConstantUnion *rightConstant = mRight->getAsConstantUnion();
@@ -826,7 +1169,7 @@ TIntermTyped *TIntermBinary::fold(TInfoSink &infoSink)
     {
         return nullptr;
     }
-    TConstantUnion *constArray = leftConstant->foldBinary(mOp, rightConstant, infoSink);
+    TConstantUnion *constArray = leftConstant->foldBinary(mOp, rightConstant, infoSink, budget);
 
     // Nodes may be constant folded without being qualified as constant.
     TQualifier resultQualifier = EvqConst;
@@ -837,7 +1180,7 @@ TIntermTyped *TIntermBinary::fold(TInfoSink &infoSink)
     return CreateFoldedNode(constArray, this, resultQualifier);
 }
 
-TIntermTyped *TIntermUnary::fold(TInfoSink &infoSink)
+TIntermTyped *TIntermUnary::fold(TInfoSink &infoSink, TCompileBudget *budget)
 {
     TIntermConstantUnion *operandConstant = mOperand->getAsConstantUnion();
     if (operandConstant == nullptr)
@@ -860,10 +1203,10 @@ TIntermTyped *TIntermUnary::fold(TInfoSink &infoSink)
       case EOpUnpackUnorm2x16:
       case EOpPackHalf2x16:
       case EOpUnpackHalf2x16:
-        constArray = operandConstant->foldUnaryWithDifferentReturnType(mOp, infoSink);
+        constArray = operandConstant->foldUnaryWithDifferentReturnType(mOp, infoSink, budget);
         break;
       default:
-        constArray = operandConstant->foldUnaryWithSameReturnType(mOp, infoSink);
+        constArray = operandConstant->foldUnaryWithSameReturnType(mOp, infoSink, budget);
         break;
     }
 
@@ -872,7 +1215,7 @@ TIntermTyped *TIntermUnary::fold(TInfoSink &infoSink)
     return CreateFoldedNode(constArray, this, resultQualifier);
 }
 
-TIntermTyped *TIntermAggregate::fold(TInfoSink &infoSink)
+TIntermTyped *TIntermAggregate::fold(TInfoSink &infoSink, TCompileBudget *budget)
 {
     // Make sure that all params are constant before actual constant folding.
     for (auto *param : *getSequence())
@@ -884,9 +1227,9 @@ TIntermTyped *TIntermAggregate::fold(TInfoSink &infoSink)
     }
     TConstantUnion *constArray = nullptr;
     if (isConstructor())
-        constArray = TIntermConstantUnion::FoldAggregateConstructor(this, infoSink);
+        constArray = TIntermConstantUnion::FoldAggregateConstructor(this, infoSink, budget);
     else
-        constArray = TIntermConstantUnion::FoldAggregateBuiltIn(this, infoSink);
+        constArray = TIntermConstantUnion::FoldAggregateBuiltIn(this, infoSink, budget);
 
     // Nodes may be constant folded without being qualified as constant.
     TQualifier resultQualifier = areChildrenConstQualified() ? EvqConst : EvqTemporary;
@@ -899,7 +1242,10 @@ TIntermTyped *TIntermAggregate::fold(TInfoSink &infoSink)
 //
 // Returns the constant value to keep using or nullptr.
 //
-TConstantUnion *TIntermConstantUnion::foldBinary(TOperator op, TIntermConstantUnion *rightNode, TInfoSink &infoSink)
+TConstantUnion *TIntermConstantUnion::foldBinary(TOperator op,
+                                                 TIntermConstantUnion *rightNode,
+                                                 TInfoSink &infoSink,
+                                                 TCompileBudget *budget)
 {
     const TConstantUnion *leftArray  = getUnionArrayPointer();
     const TConstantUnion *rightArray = rightNode->getUnionArrayPointer();
@@ -908,42 +1254,48 @@ TConstantUnion *TIntermConstantUnion::foldBinary(TOperator op, TIntermConstantUn
         return nullptr;
     if (!rightArray)
         return nullptr;
+    if (IsBudgetExceeded(budget))
+        return nullptr;
 
     size_t objectSize = getType().getObjectSize();
+    TBasicType basicType = getType().getBasicType();
 
-    // for a case like float f = vec4(2, 3, 4, 5) + 1.2;
+    // A scalar operand applies to each component of the other operand, like in
+    // float f = vec4(2, 3, 4, 5) + 1.2; or float f = 1.2 + vec4(2, 3, 4, 5);
+    size_t leftStride  = 1;
+    size_t rightStride = 1;
     if (rightNode->getType().getObjectSize() == 1 && objectSize > 1)
     {
-        rightArray = Vectorize(*rightNode->getUnionArrayPointer(), objectSize);
+        rightStride = 0;
     }
     else if (rightNode->getType().getObjectSize() > 1 && objectSize == 1)
     {
-        // for a case like float f = 1.2 + vec4(2, 3, 4, 5);
-        leftArray = Vectorize(*getUnionArrayPointer(), rightNode->getType().getObjectSize());
+        leftStride = 0;
         objectSize = rightNode->getType().getObjectSize();
     }
 
     TConstantUnion *resultArray = nullptr;
+    bool folded                 = true;
 
     switch(op)
     {
       case EOpAdd:
         resultArray = new TConstantUnion[objectSize];
-        for (size_t i = 0; i < objectSize; i++)
-            resultArray[i] = leftArray[i] + rightArray[i];
+        folded = FoldArithmetic(basicType, AddOp(), leftArray, leftStride, rightArray,
+                                rightStride, objectSize, resultArray);
         break;
       case EOpSub:
         resultArray = new TConstantUnion[objectSize];
-        for (size_t i = 0; i < objectSize; i++)
-            resultArray[i] = leftArray[i] - rightArray[i];
+        folded = FoldArithmetic(basicType, SubOp(), leftArray, leftStride, rightArray,
+                                rightStride, objectSize, resultArray);
         break;
 
       case EOpMul:
       case EOpVectorTimesScalar:
       case EOpMatrixTimesScalar:
         resultArray = new TConstantUnion[objectSize];
-        for (size_t i = 0; i < objectSize; i++)
-            resultArray[i] = leftArray[i] * rightArray[i];
+        folded = FoldArithmetic(basicType, MulOp(), leftArray, leftStride, rightArray,
+                                rightStride, objectSize, resultArray);
         break;
 
       case EOpMatrixTimesMatrix:
@@ -960,25 +1312,12 @@ TConstantUnion *TIntermConstantUnion::foldBinary(TOperator op, TIntermConstantUn
             const int leftCols = getCols();
             const int leftRows = getRows();
             const int rightCols = rightNode->getType().getCols();
-            const int rightRows = rightNode->getType().getRows();
-            const int resultCols = rightCols;
-            const int resultRows = leftRows;
+            ASSERT(rightNode->getType().getRows() == leftCols);
 
-            resultArray = new TConstantUnion[resultCols * resultRows];
-            for (int row = 0; row < resultRows; row++)
-            {
-                for (int column = 0; column < resultCols; column++)
-                {
-                    resultArray[resultRows * column + row].setFConst(0.0f);
-                    for (int i = 0; i < leftCols; i++)
-                    {
-                        resultArray[resultRows * column + row].setFConst(
-                            resultArray[resultRows * column + row].getFConst() +
-                            leftArray[i * leftRows + row].getFConst() *
-                            rightArray[column * rightRows + i].getFConst());
-                    }
-                }
-            }
+            resultArray = new TConstantUnion[rightCols * leftRows];
+            if (!FoldMatrixProduct(leftArray, leftRows, leftCols, rightArray, rightCols, budget,
+                                   resultArray))
+                return nullptr;
         }
         break;
 
@@ -988,24 +1327,26 @@ TConstantUnion *TIntermConstantUnion::foldBinary(TOperator op, TIntermConstantUn
             resultArray = new TConstantUnion[objectSize];
             for (size_t i = 0; i < objectSize; i++)
             {
-                switch (getType().getBasicType())
+                const TConstantUnion &left  = leftArray[i * leftStride];
+                const TConstantUnion &right = rightArray[i * rightStride];
+                switch (basicType)
                 {
                   case EbtFloat:
-                    if (rightArray[i] == 0.0f)
+                    if (right == 0.0f)
                     {
                         infoSink.info.message(EPrefixWarning, getLine(),
                                               "Divide by zero error during constant folding");
-                        resultArray[i].setFConst(leftArray[i].getFConst() < 0 ? -FLT_MAX : FLT_MAX);
+                        resultArray[i].setFConst(left.getFConst() < 0 ? -FLT_MAX : FLT_MAX);
                     }
                     else
                     {
                         ASSERT(op == EOpDiv);
-                        resultArray[i].setFConst(leftArray[i].getFConst() / rightArray[i].getFConst());
+                        resultArray[i].setFConst(left.getFConst() / right.getFConst());
                     }
                     break;
 
                   case EbtInt:
-                    if (rightArray[i] == 0)
+                    if (right == 0)
                     {
                         infoSink.info.message(EPrefixWarning, getLine(),
                                               "Divide by zero error during constant folding");
@@ -1015,18 +1356,18 @@ TConstantUnion *TIntermConstantUnion::foldBinary(TOperator op, TIntermConstantUn
                     {
                         if (op == EOpDiv)
                         {
-                            resultArray[i].setIConst(leftArray[i].getIConst() / rightArray[i].getIConst());
+                            resultArray[i].setIConst(left.getIConst() / right.getIConst());
                         }
                         else
                         {
                             ASSERT(op == EOpIMod);
-                            resultArray[i].setIConst(leftArray[i].getIConst() % rightArray[i].getIConst());
+                            resultArray[i].setIConst(left.getIConst() % right.getIConst());
                         }
                     }
                     break;
 
                   case EbtUInt:
-                    if (rightArray[i] == 0)
+                    if (right == 0)
                     {
                         infoSink.info.message(EPrefixWarning, getLine(),
                                               "Divide by zero error during constant folding");
@@ -1036,12 +1377,12 @@ TConstantUnion *TIntermConstantUnion::foldBinary(TOperator op, TIntermConstantUn
                     {
                         if (op == EOpDiv)
                         {
-                            resultArray[i].setUConst(leftArray[i].getUConst() / rightArray[i].getUConst());
+                            resultArray[i].setUConst(left.getUConst() / right.getUConst());
                         }
                         else
                         {
                             ASSERT(op == EOpIMod);
-                            resultArray[i].setUConst(leftArray[i].getUConst() % rightArray[i].getUConst());
+                            resultArray[i].setUConst(left.getUConst() % right.getUConst());
                         }
                     }
                     break;
@@ -1068,17 +1409,9 @@ TConstantUnion *TIntermConstantUnion::foldBinary(TOperator op, TIntermConstantUn
             const int matrixRows = getRows();
 
             resultArray = new TConstantUnion[matrixRows];
-
-            for (int matrixRow = 0; matrixRow < matrixRows; matrixRow++)
-            {
-                resultArray[matrixRow].setFConst(0.0f);
-                for (int col = 0; col < matrixCols; col++)
-                {
-                    resultArray[matrixRow].setFConst(resultArray[matrixRow].getFConst() +
-                                                     leftArray[col * matrixRows + matrixRow].getFConst() *
-                                                     rightArray[col].getFConst());
-                }
-            }
+            if (!FoldMatrixProduct(leftArray, matrixRows, matrixCols, rightArray, 1, budget,
+                                   resultArray))
+                return nullptr;
         }
         break;
 
@@ -1095,82 +1428,57 @@ TConstantUnion *TIntermConstantUnion::foldBinary(TOperator op, TIntermConstantUn
             const int matrixRows = rightNode->getType().getRows();
 
             resultArray = new TConstantUnion[matrixCols];
-
-            for (int matrixCol = 0; matrixCol < matrixCols; matrixCol++)
-            {
-                resultArray[matrixCol].setFConst(0.0f);
-                for (int matrixRow = 0; matrixRow < matrixRows; matrixRow++)
-                {
-                    resultArray[matrixCol].setFConst(resultArray[matrixCol].getFConst() +
-                                                     leftArray[matrixRow].getFConst() *
-                                                     rightArray[matrixCol * matrixRows + matrixRow].getFConst());
-                }
-            }
+            if (!FoldMatrixProduct(leftArray, 1, matrixRows, rightArray, matrixCols, budget,
+                                   resultArray))
+                return nullptr;
         }
         break;
 
       case EOpLogicalAnd:
-        {
-            resultArray = new TConstantUnion[objectSize];
-            for (size_t i = 0; i < objectSize; i++)
-            {
-                resultArray[i] = leftArray[i] && rightArray[i];
-            }
-        }
+        resultArray = new TConstantUnion[objectSize];
+        FoldComponentWise<bool>(LogicalAndOp(), leftArray, leftStride, rightArray, rightStride,
+                                objectSize, resultArray);
         break;
 
       case EOpLogicalOr:
-        {
-            resultArray = new TConstantUnion[objectSize];
-            for (size_t i = 0; i < objectSize; i++)
-            {
-                resultArray[i] = leftArray[i] || rightArray[i];
-            }
-        }
+        resultArray = new TConstantUnion[objectSize];
+        FoldComponentWise<bool>(LogicalOrOp(), leftArray, leftStride, rightArray, rightStride,
+                                objectSize, resultArray);
         break;
 
       case EOpLogicalXor:
-        {
-            resultArray = new TConstantUnion[objectSize];
-            for (size_t i = 0; i < objectSize; i++)
-            {
-                switch (getType().getBasicType())
-                {
-                  case EbtBool:
-                    resultArray[i].setBConst(leftArray[i] != rightArray[i]);
-                    break;
-                  default:
-                    UNREACHABLE();
-                    break;
-                }
-            }
-        }
+        ASSERT(basicType == EbtBool);
+        resultArray = new TConstantUnion[objectSize];
+        FoldComponentWise<bool>(LogicalXorOp(), leftArray, leftStride, rightArray, rightStride,
+                                objectSize, resultArray);
         break;
 
       case EOpBitwiseAnd:
         resultArray = new TConstantUnion[objectSize];
-        for (size_t i = 0; i < objectSize; i++)
-            resultArray[i] = leftArray[i] & rightArray[i];
+        folded = FoldInteger(basicType, BitwiseAndOp(), leftArray, leftStride, rightArray,
+                             rightStride, objectSize, resultArray);
         break;
       case EOpBitwiseXor:
         resultArray = new TConstantUnion[objectSize];
-        for (size_t i = 0; i < objectSize; i++)
-            resultArray[i] = leftArray[i] ^ rightArray[i];
+        folded = FoldInteger(basicType, BitwiseXorOp(), leftArray, leftStride, rightArray,
+                             rightStride, objectSize, resultArray);
         break;
       case EOpBitwiseOr:
         resultArray = new TConstantUnion[objectSize];
-        for (size_t i = 0; i < objectSize; i++)
-            resultArray[i] = leftArray[i] | rightArray[i];
+        folded = FoldInteger(basicType, BitwiseOrOp(), leftArray, leftStride, rightArray,
+                             rightStride, objectSize, resultArray);
         break;
       case EOpBitShiftLeft:
+        // The signedness of the second operand might be different, but the result is undefined
+        // if it is negative, so it is read with the type of the first one.
         resultArray = new TConstantUnion[objectSize];
-        for (size_t i = 0; i < objectSize; i++)
-            resultArray[i] = leftArray[i] << rightArray[i];
+        folded = FoldInteger(basicType, BitShiftLeftOp(), leftArray, leftStride, rightArray,
+                             rightStride, objectSize, resultArray);
         break;
       case EOpBitShiftRight:
         resultArray = new TConstantUnion[objectSize];
-        for (size_t i = 0; i < objectSize; i++)
-            resultArray[i] = leftArray[i] >> rightArray[i];
+        folded = FoldInteger(basicType, BitShiftRightOp(), leftArray, leftStride, rightArray,
+                             rightStride, objectSize, resultArray);
         break;
 
       case EOpLessThan:
@@ -1204,7 +1512,10 @@ TConstantUnion *TIntermConstantUnion::foldBinary(TOperator op, TIntermConstantUn
             bool equal = true;
             for (size_t i = 0; i < objectSize; i++)
             {
-                if (leftArray[i] != rightArray[i])
+                // Arrays are compared as a whole, so this loop can be long.
+                if (IsBudgetExceeded(budget))
+                    return nullptr;
+                if (leftArray[i * leftStride] != rightArray[i * rightStride])
                 {
                     equal = false;
                     break;  // break out of for loop
@@ -1227,6 +1538,13 @@ TConstantUnion *TIntermConstantUnion::foldBinary(TOperator op, TIntermConstantUn
             "Invalid operator for constant folding");
         return nullptr;
     }
+
+    if (!folded)
+    {
+        infoSink.info.message(EPrefixInternalError, getLine(),
+                              "Binary operation not folded into constant");
+        return nullptr;
+    }
     return resultArray;
 }
 
@@ -1236,7 +1554,9 @@ TConstantUnion *TIntermConstantUnion::foldBinary(TOperator op, TIntermConstantUn
 //
 // Returns the constant value to keep using or nullptr.
 //
-TConstantUnion *TIntermConstantUnion::foldUnaryWithDifferentReturnType(TOperator op, TInfoSink &infoSink)
+TConstantUnion *TIntermConstantUnion::foldUnaryWithDifferentReturnType(TOperator op,
+                                                                       TInfoSink &infoSink,
+                                                                       TCompileBudget *budget)
 {
     //
     // Do operations where the return type has a different number of components compared to the operand type.
@@ -1245,6 +1565,8 @@ TConstantUnion *TIntermConstantUnion::foldUnaryWithDifferentReturnType(TOperator
     const TConstantUnion *operandArray = getUnionArrayPointer();
     if (!operandArray)
         return nullptr;
+    if (IsBudgetExceeded(budget))
+        return nullptr;
 
     size_t objectSize = getType().getObjectSize();
     TConstantUnion *resultArray = nullptr;
@@ -1449,7 +1771,9 @@ TConstantUnion *TIntermConstantUnion::foldUnaryWithDifferentReturnType(TOperator
     return resultArray;
 }
 
-TConstantUnion *TIntermConstantUnion::foldUnaryWithSameReturnType(TOperator op, TInfoSink &infoSink)
+TConstantUnion *TIntermConstantUnion::foldUnaryWithSameReturnType(TOperator op,
+                                                                  TInfoSink &infoSink,
+                                                                  TCompileBudget *budget)
 {
     //
     // Do unary operations where the return type is the same as operand type.
@@ -1458,10 +1782,16 @@ TConstantUnion *TIntermConstantUnion::foldUnaryWithSameReturnType(TOperator op,
     const TConstantUnion *operandArray = getUnionArrayPointer();
     if (!operandArray)
         return nullptr;
+    if (IsBudgetExceeded(budget))
+        return nullptr;
 
     size_t objectSize = getType().getObjectSize();
 
     TConstantUnion *resultArray = new TConstantUnion[objectSize];
+    if (FoldUnaryComponentWise(op, getType().getBasicType(), operandArray, objectSize, resultArray))
+        return resultArray;
+
+    // The other operations check each component, and report operand types they don't apply to.
     for (size_t i = 0; i < objectSize; i++)
     {
         switch(op)
@@ -1903,9 +2233,13 @@ bool TIntermConstantUnion::foldFloatTypeUnary(const TConstantUnion &parameter, F
 
 // static
 TConstantUnion *TIntermConstantUnion::FoldAggregateConstructor(TIntermAggregate *aggregate,
-                                                               TInfoSink &infoSink)
+                                                               TInfoSink &infoSink,
+                                                               TCompileBudget *budget)
 {
     ASSERT(aggregate->getSequence()->size() > 0u);
+    if (IsBudgetExceeded(budget))
+        return nullptr;
+
     size_t resultSize           = aggregate->getType().getObjectSize();
     TConstantUnion *resultArray = new TConstantUnion[resultSize];
     TBasicType basicType        = aggregate->getBasicType();
@@ -1986,24 +2320,39 @@ TConstantUnion *TIntermConstantUnion::FoldAggregateConstructor(TIntermAggregate
 
     for (TIntermNode *&argument : *aggregate->getSequence())
     {
+        // Array constructors take an argument per element, so this loop can be long.
+        if (IsBudgetExceeded(budget))
+            return nullptr;
+
         TIntermConstantUnion *argumentConstant   = argument->getAsConstantUnion();
         size_t argumentSize                      = argumentConstant->getType().getObjectSize();
         const TConstantUnion *argumentUnionArray = argumentConstant->getUnionArrayPointer();
-        for (size_t i = 0u; i < argumentSize; ++i)
+        size_t copySize = std::min(argumentSize, resultSize - resultIndex);
+        if (argumentConstant->getBasicType() == basicType || basicType == EbtStruct)
         {
-            if (resultIndex >= resultSize)
-                break;
-            resultArray[resultIndex].cast(basicType, argumentUnionArray[i]);
-            ++resultIndex;
+            // Casting to the same type, or to a struct field, copies the components as they are.
+            std::copy(argumentUnionArray, argumentUnionArray + copySize,
+                      resultArray + resultIndex);
+        }
+        else
+        {
+            for (size_t i = 0u; i < copySize; ++i)
+                resultArray[resultIndex + i].cast(basicType, argumentUnionArray[i]);
         }
+        resultIndex += copySize;
     }
     ASSERT(resultIndex == resultSize);
     return resultArray;
 }
 
 // static
-TConstantUnion *TIntermConstantUnion::FoldAggregateBuiltIn(TIntermAggregate *aggregate, TInfoSink &infoSink)
+TConstantUnion *TIntermConstantUnion::FoldAggregateBuiltIn(TIntermAggregate *aggregate,
+                                                           TInfoSink &infoSink,
+                                                           TCompileBudget *budget)
 {
+    if (IsBudgetExceeded(budget))
+        return nullptr;
+
     TOperator op = aggregate->getOp();
     TIntermSequence *sequence = aggregate->getSequence();
     unsigned int paramsCount = static_cast<unsigned int>(sequence->size());
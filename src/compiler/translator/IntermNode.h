@@ -42,6 +42,7 @@ class TInfoSink;
 class TInfoSinkBase;
 class TIntermRaw;
 
+class TCompileBudget;
 class TSymbolTable;
 
 // Encapsulate an identifier string and track whether it is coming from the original shader code
@@ -340,13 +341,25 @@ class TIntermConstantUnion : public TIntermTyped
     void traverse(TIntermTraverser *it) override;
     bool replaceChildNode(TIntermNode *, TIntermNode *) override { return false; }
 
-    TConstantUnion *foldBinary(TOperator op, TIntermConstantUnion *rightNode, TInfoSink &infoSink);
-    TConstantUnion *foldUnaryWithDifferentReturnType(TOperator op, TInfoSink &infoSink);
-    TConstantUnion *foldUnaryWithSameReturnType(TOperator op, TInfoSink &infoSink);
+    // The fold functions return nullptr once the budget of the compile is exceeded. The budget
+    // may be null.
+    TConstantUnion *foldBinary(TOperator op,
+                               TIntermConstantUnion *rightNode,
+                               TInfoSink &infoSink,
+                               TCompileBudget *budget);
+    TConstantUnion *foldUnaryWithDifferentReturnType(TOperator op,
+                                                     TInfoSink &infoSink,
+                                                     TCompileBudget *budget);
+    TConstantUnion *foldUnaryWithSameReturnType(TOperator op,
+                                                TInfoSink &infoSink,
+                                                TCompileBudget *budget);
 
     static TConstantUnion *FoldAggregateConstructor(TIntermAggregate *aggregate,
-                                                    TInfoSink &infoSink);
-    static TConstantUnion *FoldAggregateBuiltIn(TIntermAggregate *aggregate, TInfoSink &infoSink);
+                                                    TInfoSink &infoSink,
+                                                    TCompileBudget *budget);
+    static TConstantUnion *FoldAggregateBuiltIn(TIntermAggregate *aggregate,
+                                                TInfoSink &infoSink,
+                                                TCompileBudget *budget);
 
   protected:
     // Same data may be shared between multiple constant unions, so it can't be modified.
@@ -413,7 +426,7 @@ class TIntermBinary : public TIntermOperator
     TIntermTyped *getLeft() const { return mLeft; }
     TIntermTyped *getRight() const { return mRight; }
     bool promote(TInfoSink &);
-    TIntermTyped *fold(TInfoSink &infoSink);
+    TIntermTyped *fold(TInfoSink &infoSink, TCompileBudget *budget);
 
     void setAddIndexClamp() { mAddIndexClamp = true; }
     bool getAddIndexClamp() { return mAddIndexClamp; }
@@ -455,7 +468,7 @@ class TIntermUnary : public TIntermOperator
     void setOperand(TIntermTyped *operand) { mOperand = operand; }
     TIntermTyped *getOperand() { return mOperand; }
     void promote(const TType *funcReturnType);
-    TIntermTyped *fold(TInfoSink &infoSink);
+    TIntermTyped *fold(TInfoSink &infoSink, TCompileBudget *budget);
 
     void setUseEmulatedFunction() { mUseEmulatedFunction = true; }
     bool getUseEmulatedFunction() { return mUseEmulatedFunction; }
@@ -505,7 +518,7 @@ class TIntermAggregate : public TIntermOperator
     bool insertChildNodes(TIntermSequence::size_type position, TIntermSequence insertions);
     // Conservatively assume function calls and other aggregate operators have side-effects
     bool hasSideEffects() const override { return true; }
-    TIntermTyped *fold(TInfoSink &infoSink);
+    TIntermTyped *fold(TInfoSink &infoSink, TCompileBudget *budget);
 
     TIntermSequence *getSequence() { return &mSequence; }
 
@@ -717,6 +730,9 @@ class TIntermTraverser : angle::NonCopyable
     void useTemporaryIndex(unsigned int *temporaryIndex);
 
   protected:
+    // Fused traversers check the visit flags of the passes they run.
+    friend class TFusedTraverser;
+
     void incrementDepth(TIntermNode *current)
     {
         mDepth++;
@@ -58,7 +58,7 @@ TIntermTyped *TIntermediate::addBinaryMath(
         return NULL;
 
     // See if we can fold constants.
-    TIntermTyped *foldedNode = node->fold(mInfoSink);
+    TIntermTyped *foldedNode = node->fold(mInfoSink, mCompileBudget);
     if (foldedNode)
         return foldedNode;
 
@@ -128,7 +128,7 @@ TIntermTyped *TIntermediate::addUnaryMath(
     node->setOperand(child);
     node->promote(funcReturnType);
 
-    TIntermTyped *foldedNode = node->fold(mInfoSink);
+    TIntermTyped *foldedNode = node->fold(mInfoSink, mCompileBudget);
     if (foldedNode)
         return foldedNode;
 
@@ -493,12 +493,12 @@ TIntermTyped *TIntermediate::foldAggregateBuiltIn(TIntermAggregate *aggregate)
         case EOpFaceForward:
         case EOpReflect:
         case EOpRefract:
-            return aggregate->fold(mInfoSink);
+            return aggregate->fold(mInfoSink, mCompileBudget);
         default:
             // TODO: Add support for folding array constructors
             if (aggregate->isConstructor() && !aggregate->isArray())
             {
-                return aggregate->fold(mInfoSink);
+                return aggregate->fold(mInfoSink, mCompileBudget);
             }
             // Constant folding not supported for the built-in.
             return nullptr;
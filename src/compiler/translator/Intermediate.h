@@ -24,7 +24,10 @@ class TIntermediate
   public:
     POOL_ALLOCATOR_NEW_DELETE();
     TIntermediate(TInfoSink &i)
-        : mInfoSink(i) { }
+        : mInfoSink(i), mCompileBudget(nullptr) { }
+
+    // Constant folding stops once the budget is exceeded.
+    void setCompileBudget(TCompileBudget *budget) { mCompileBudget = budget; }
 
     TIntermSymbol *addSymbol(
         int id, const TString &, const TType &, const TSourceLoc &);
@@ -70,6 +73,7 @@ class TIntermediate
     void operator=(TIntermediate &); // prevent assignments
 
     TInfoSink & mInfoSink;
+    TCompileBudget *mCompileBudget;
 };
 
 #endif  // COMPILER_TRANSLATOR_INTERMEDIATE_H_
@@ -65,7 +65,8 @@ TOutputGLSLBase::TOutputGLSLBase(TInfoSinkBase &objSink,
       mNameMap(nameMap),
       mSymbolTable(symbolTable),
       mShaderVersion(shaderVersion),
-      mOutput(output)
+      mOutput(output),
+      mCompileBudget(nullptr)
 {
 }
 
@@ -1130,6 +1131,8 @@ bool TOutputGLSLBase::visitLoop(Visit visit, TIntermLoop *node)
             mLoopUnrollStack.push(node);
             while (mLoopUnrollStack.satisfiesLoopCondition())
             {
+                if (mCompileBudget && !mCompileBudget->checkPeriodically())
+                    break;
                 visitCodeBlock(node->getBody());
                 mLoopUnrollStack.step();
             }
@@ -9,6 +9,7 @@
 
 #include <set>
 
+#include "compiler/translator/CompileBudget.h"
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/LoopInfo.h"
 #include "compiler/translator/ParseContext.h"
@@ -29,6 +30,9 @@ class TOutputGLSLBase : public TIntermTraverser
         return mOutput;
     }
 
+    // Stops unrolling loops once the budget is exceeded. The output is then incomplete.
+    void setCompileBudget(TCompileBudget *budget) { mCompileBudget = budget; }
+
   protected:
     TInfoSinkBase &objSink() { return mObjSink; }
     void writeTriplet(Visit visit, const char *preStr, const char *inStr, const char *postStr);
@@ -93,6 +97,8 @@ class TOutputGLSLBase : public TIntermTraverser
     const int mShaderVersion;
 
     ShShaderOutput mOutput;
+
+    TCompileBudget *mCompileBudget;
 };
 
 #endif  // COMPILER_TRANSLATOR_OUTPUTGLSLBASE_H_
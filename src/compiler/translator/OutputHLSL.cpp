@@ -233,9 +233,10 @@ void OutputHLSL::output(TIntermNode *treeRoot, TInfoSinkBase &objSink)
     header(mHeader, &builtInFunctionEmulator);
     mInfoSinkStack.pop();
 
-    objSink << mHeader.c_str();
-    objSink << mBody.c_str();
-    objSink << mFooter.c_str();
+    objSink.reserve(objSink.size() + mHeader.size() + mBody.size() + mFooter.size());
+    objSink << mHeader;
+    objSink << mBody;
+    objSink << mFooter;
 
     builtInFunctionEmulator.Cleanup();
 }
@@ -327,9 +328,9 @@ TString OutputHLSL::structInitializerString(int indent, const TStructure &struct
 
 void OutputHLSL::header(TInfoSinkBase &out, const BuiltInFunctionEmulator *builtInFunctionEmulator)
 {
-    TString varyings;
-    TString attributes;
-    TString flaggedStructs;
+    TInfoSinkBase varyings;
+    TInfoSinkBase attributes;
+    TInfoSinkBase flaggedStructs;
 
     for (std::map<TIntermTyped*, TString>::const_iterator flaggedStructIt = mFlaggedStructMappedNames.begin(); flaggedStructIt != mFlaggedStructMappedNames.end(); flaggedStructIt++)
     {
@@ -338,9 +339,9 @@ void OutputHLSL::header(TInfoSinkBase &out, const BuiltInFunctionEmulator *built
         const TStructure &structure = *structNode->getType().getStruct();
         const TString &originalName = mFlaggedStructOriginalNames[structNode];
 
-        flaggedStructs += "static " + Decorate(structure.name()) + " " + mappedName + " =\n";
-        flaggedStructs += structInitializerString(0, structure, originalName);
-        flaggedStructs += "\n";
+        flaggedStructs << "static " << Decorate(structure.name()) << " " << mappedName << " =\n";
+        flaggedStructs << structInitializerString(0, structure, originalName);
+        flaggedStructs << "\n";
     }
 
     for (ReferencedSymbols::const_iterator varying = mReferencedVaryings.begin(); varying != mReferencedVaryings.end(); varying++)
@@ -349,8 +350,8 @@ void OutputHLSL::header(TInfoSinkBase &out, const BuiltInFunctionEmulator *built
         const TString &name = varying->second->getSymbol();
 
         // Program linking depends on this exact format
-        varyings += "static " + InterpolationString(type.getQualifier()) + " " + TypeString(type) + " " +
-                    Decorate(name) + ArrayString(type) + " = " + initializer(type) + ";\n";
+        varyings << "static " << InterpolationString(type.getQualifier()) << " " << TypeString(type)
+                 << " " << Decorate(name) << ArrayString(type) << " = " << initializer(type) << ";\n";
     }
 
     for (ReferencedSymbols::const_iterator attribute = mReferencedAttributes.begin(); attribute != mReferencedAttributes.end(); attribute++)
@@ -358,7 +359,8 @@ void OutputHLSL::header(TInfoSinkBase &out, const BuiltInFunctionEmulator *built
         const TType &type = attribute->second->getType();
         const TString &name = attribute->second->getSymbol();
 
-        attributes += "static " + TypeString(type) + " " + Decorate(name) + ArrayString(type) + " = " + initializer(type) + ";\n";
+        attributes << "static " << TypeString(type) << " " << Decorate(name) << ArrayString(type)
+                   << " = " << initializer(type) << ";\n";
     }
 
     out << mStructureHLSL->structsHeader();
@@ -430,8 +432,8 @@ void OutputHLSL::header(TInfoSinkBase &out, const BuiltInFunctionEmulator *built
                 const TString &variableName = outputVariableIt->first;
                 const TType &variableType = outputVariableIt->second->getType();
 
-                out << "static " + TypeString(variableType) + " out_" + variableName + ArrayString(variableType) +
-                       " = " + initializer(variableType) + ";\n";
+                out << "static " << TypeString(variableType) << " out_" << variableName
+                    << ArrayString(variableType) << " = " << initializer(variableType) << ";\n";
             }
         }
         else
@@ -541,7 +543,7 @@ void OutputHLSL::header(TInfoSinkBase &out, const BuiltInFunctionEmulator *built
                    "\n";
         }
 
-        if (!flaggedStructs.empty())
+        if (flaggedStructs.size() > 0)
         {
             out << "// Std140 Structures accessed by value\n";
             out << "\n";
@@ -642,7 +644,7 @@ void OutputHLSL::header(TInfoSinkBase &out, const BuiltInFunctionEmulator *built
                    "\n";
         }
 
-        if (!flaggedStructs.empty())
+        if (flaggedStructs.size() > 0)
         {
             out << "// Std140 Structures accessed by value\n";
             out << "\n";
@@ -9,9 +9,12 @@
 #include <stdarg.h>
 #include <stdio.h>
 
+#include <chrono>
+
 #include "compiler/preprocessor/SourceLocation.h"
 #include "compiler/translator/Cache.h"
 #include "compiler/translator/glslang.h"
+#include "compiler/translator/length_limits.h"
 #include "compiler/translator/ValidateSwitch.h"
 #include "compiler/translator/ValidateGlobalInitializer.h"
 #include "compiler/translator/util.h"
@@ -139,6 +142,48 @@ void TParseContext::recover()
 {
 }
 
+bool TParseContext::initPreprocessor(size_t count,
+                                     const char *const string[],
+                                     const int length[])
+{
+    if (mPreprocessedShader)
+        return true;
+
+    if (mCompileBudget && mCompileBudget->getMaxPreprocessedTokens() > 0)
+        mPreprocessor.setMaxTokens(mCompileBudget->getMaxPreprocessedTokens());
+
+    return InitPreprocessor(&mPreprocessor, count, string, length, extensionBehavior(),
+                            mPredefinedMacros, getFragmentPrecisionHigh(), mShaderSpec);
+}
+
+void TParseContext::lexPreprocessedToken(pp::Token *token)
+{
+    if (mCompileBudget && !mCompileBudget->checkPeriodically())
+    {
+        token->reset();
+        token->type = pp::Token::LAST;
+        return;
+    }
+
+    // Replaying is counted as parsing: the preprocessor ran when the shader was recorded.
+    if (mPreprocessedShader)
+    {
+        mPreprocessedShader->replay(token, &mDiagnostics, &mDirectiveHandler);
+        return;
+    }
+
+    if (!mPreprocessingTime)
+    {
+        mPreprocessor.lex(token);
+        return;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    mPreprocessor.lex(token);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    *mPreprocessingTime += elapsed.count();
+}
+
 //
 // Used by flex/bison to output all syntax and parsing errors.
 //
@@ -147,6 +192,9 @@ void TParseContext::error(const TSourceLoc &loc,
                           const char *token,
                           const char *extraInfo)
 {
+    if (mCompileBudget && mCompileBudget->isExceeded())
+        return;
+
     pp::SourceLocation srcLoc;
     srcLoc.file = loc.first_file;
     srcLoc.line = loc.first_line;
@@ -158,6 +206,9 @@ void TParseContext::warning(const TSourceLoc &loc,
                             const char *token,
                             const char *extraInfo)
 {
+    if (mCompileBudget && mCompileBudget->isExceeded())
+        return;
+
     pp::SourceLocation srcLoc;
     srcLoc.file = loc.first_file;
     srcLoc.line = loc.first_line;
@@ -4142,3 +4193,40 @@ int PaParseStrings(size_t count,
 
     return (error == 0) && (context->numErrors() == 0) ? 0 : 1;
 }
+
+bool InitPreprocessor(pp::Preprocessor *preprocessor,
+                      size_t count,
+                      const char *const string[],
+                      const int length[],
+                      const TExtensionBehavior &extBehavior,
+                      pp::MacroSet *predefinedMacros,
+                      bool fragmentPrecisionHigh,
+                      ShShaderSpec spec)
+{
+    // The standard and extension macros are the same for all the shaders of a compiler, so
+    // they are only predefined by its first compile, and shared with the next ones.
+    bool reusePredefinedMacros = predefinedMacros != nullptr && !predefinedMacros->empty();
+    if (reusePredefinedMacros)
+        preprocessor->setPredefinedMacros(*predefinedMacros);
+
+    if (!preprocessor->init(count, string, length))
+        return false;
+
+    if (!reusePredefinedMacros)
+    {
+        // Define extension macros.
+        for (TExtensionBehavior::const_iterator iter = extBehavior.begin();
+             iter != extBehavior.end(); ++iter)
+        {
+            preprocessor->predefineMacro(iter->first.c_str(), 1);
+        }
+        if (predefinedMacros != nullptr)
+            *predefinedMacros = preprocessor->getMacroSet();
+    }
+    if (fragmentPrecisionHigh)
+        preprocessor->predefineMacro("GL_FRAGMENT_PRECISION_HIGH", 1);
+
+    preprocessor->setMaxTokenSize(GetGlobalMaxTokenSize(spec));
+
+    return true;
+}
@@ -6,11 +6,13 @@
 #ifndef COMPILER_TRANSLATOR_PARSECONTEXT_H_
 #define COMPILER_TRANSLATOR_PARSECONTEXT_H_
 
+#include "compiler/translator/CompileBudget.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/Diagnostics.h"
 #include "compiler/translator/DirectiveHandler.h"
 #include "compiler/translator/Intermediate.h"
 #include "compiler/translator/SymbolTable.h"
+#include "compiler/preprocessor/PreprocessedShader.h"
 #include "compiler/preprocessor/Preprocessor.h"
 
 struct TMatrixFields
@@ -51,6 +53,10 @@ class TParseContext : angle::NonCopyable
           mFunctionReturnsValue(false),
           mChecksPrecisionErrors(checksPrecErrors),
           mFragmentPrecisionHighOnESSL1(false),
+          mPredefinedMacros(nullptr),
+          mPreprocessingTime(nullptr),
+          mPreprocessedShader(nullptr),
+          mCompileBudget(nullptr),
           mDefaultMatrixPacking(EmpColumnMajor),
           mDefaultBlockStorage(EbsShared),
           mDiagnostics(is),
@@ -103,6 +109,28 @@ class TParseContext : angle::NonCopyable
         mFragmentPrecisionHighOnESSL1 = fragmentPrecisionHigh;
     }
 
+    // Macros predefined for all the shaders of the compiler, saved by its first compile and
+    // reused by the next ones.
+    pp::MacroSet *getPredefinedMacros() const { return mPredefinedMacros; }
+    void setPredefinedMacros(pp::MacroSet *predefinedMacros)
+    {
+        mPredefinedMacros = predefinedMacros;
+    }
+
+    // Initializes the preprocessor for the scanner, unless a recorded shader replaces it.
+    bool initPreprocessor(size_t count, const char *const string[], const int length[]);
+    // Lexes the next preprocessed token for the scanner. The time spent in the preprocessor is
+    // added to the preprocessing time, if it is set.
+    void lexPreprocessedToken(pp::Token *token);
+    void setPreprocessingTime(double *seconds) { mPreprocessingTime = seconds; }
+    // Replays the tokens, diagnostics and directives of a shader preprocessed beforehand instead
+    // of running the preprocessor.
+    void setPreprocessedShader(pp::PreprocessedShader *shader) { mPreprocessedShader = shader; }
+    // Ends the input once the budget is exceeded, and limits the tokens of the preprocessor.
+    // Errors and warnings are no longer reported after that, since they only come from the input
+    // being cut short.
+    void setCompileBudget(TCompileBudget *budget) { mCompileBudget = budget; }
+
     void setLoopNestingLevel(int loopNestintLevel)
     {
         mLoopNestingLevel = loopNestintLevel;
@@ -371,6 +399,10 @@ class TParseContext : angle::NonCopyable
     bool mChecksPrecisionErrors;  // true if an error will be generated when a variable is declared without precision, explicit or implicit.
     bool mFragmentPrecisionHighOnESSL1;  // true if highp precision is supported when compiling
                                          // ESSL1.
+    pp::MacroSet *mPredefinedMacros;
+    double *mPreprocessingTime;
+    pp::PreprocessedShader *mPreprocessedShader;
+    TCompileBudget *mCompileBudget;
     TLayoutMatrixPacking mDefaultMatrixPacking;
     TLayoutBlockStorage mDefaultBlockStorage;
     TString mHashErrMsg;
@@ -389,4 +421,16 @@ class TParseContext : angle::NonCopyable
 int PaParseStrings(
     size_t count, const char *const string[], const int length[], TParseContext *context);
 
+// Initializes a preprocessor for the shader strings, and predefines the standard and extension
+// macros. The macros are saved to predefinedMacros by the first compile of a compiler, and reused
+// from there by the next ones.
+bool InitPreprocessor(pp::Preprocessor *preprocessor,
+                      size_t count,
+                      const char *const string[],
+                      const int length[],
+                      const TExtensionBehavior &extBehavior,
+                      pp::MacroSet *predefinedMacros,
+                      bool fragmentPrecisionHigh,
+                      ShShaderSpec spec);
+
 #endif // COMPILER_TRANSLATOR_PARSECONTEXT_H_
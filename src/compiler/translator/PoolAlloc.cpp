@@ -16,8 +16,102 @@
 #include <stdio.h>
 #include <assert.h>
 
+#include <map>
+#include <mutex>
+
 TLSIndex PoolIndex = TLS_INVALID_INDEX;
 
+namespace
+{
+
+// Upper bound of the memory kept by the page cache, past which the pages
+// given back by the allocators are returned to the OS.
+const size_t kMaxCachedPageBytes = 16 * 1024 * 1024;
+
+// Free pages given back by the allocators, by size in bytes.  The pages of a
+// size are linked through their first bytes.
+class TPageCache
+{
+  public:
+    TPageCache() : mCachedBytes(0) {}
+    ~TPageCache()
+    {
+        for (auto &pages : mPages)
+        {
+            while (pages.second)
+            {
+                CachedPage* next = pages.second->next;
+                delete [] reinterpret_cast<char*>(pages.second);
+                pages.second = next;
+            }
+        }
+    }
+
+    void* acquire(size_t size)
+    {
+        auto iter = mPages.find(size);
+        if (iter == mPages.end() || iter->second == nullptr)
+            return nullptr;
+
+        CachedPage* page = iter->second;
+        iter->second = page->next;
+        mCachedBytes -= size;
+        return page;
+    }
+
+    bool release(void* memory, size_t size)
+    {
+        if (mCachedBytes + size > kMaxCachedPageBytes)
+            return false;
+
+        CachedPage* page = reinterpret_cast<CachedPage*>(memory);
+        page->next = mPages[size];
+        mPages[size] = page;
+        mCachedBytes += size;
+        return true;
+    }
+
+  private:
+    struct CachedPage
+    {
+        CachedPage* next;
+    };
+
+    std::map<size_t, CachedPage*> mPages;
+    size_t mCachedBytes;
+};
+
+// Allocated on first use to avoid a static initializer.
+std::mutex* sPageCacheMutex = nullptr;
+TPageCache* sPageCache = nullptr;
+
+std::mutex& GetPageCacheMutex()
+{
+    static std::once_flag initOnce;
+    std::call_once(initOnce, []() { sPageCacheMutex = new std::mutex(); });
+    return *sPageCacheMutex;
+}
+
+void* AcquireCachedPage(size_t size)
+{
+    std::lock_guard<std::mutex> lock(GetPageCacheMutex());
+    return sPageCache ? sPageCache->acquire(size) : nullptr;
+}
+
+void ReleasePage(void* page, size_t size)
+{
+    {
+        std::lock_guard<std::mutex> lock(GetPageCacheMutex());
+        if (sPageCache == nullptr)
+            sPageCache = new TPageCache();
+        if (sPageCache->release(page, size))
+            return;
+    }
+    delete [] reinterpret_cast<char*>(page);
+}
+
+}  // anonymous namespace
+
 bool InitializePoolIndex()
 {
     assert(PoolIndex == TLS_INVALID_INDEX);
@@ -56,7 +150,11 @@ TPoolAllocator::TPoolAllocator(int growthIncrement, int allocationAlignment) :
     freeList(0),
     inUseList(0),
     numCalls(0),
-    totalBytes(0)
+    totalBytes(0),
+    bytesInUse(0),
+    peakBytesInUse(0),
+    numPagesAllocated(0),
+    numPagesReused(0)
 {
     //
     // Don't allow page sizes we know are smaller than all common
@@ -98,8 +196,9 @@ TPoolAllocator::~TPoolAllocator()
 {
     while (inUseList) {
         tHeader* next = inUseList->nextPage;
+        size_t size = inUseList->pageCount * pageSize;
         inUseList->~tHeader();
-        delete [] reinterpret_cast<char*>(inUseList);
+        ReleasePage(inUseList, size);
         inUseList = next;
     }
 
@@ -107,11 +206,13 @@ TPoolAllocator::~TPoolAllocator()
     // here, because we did it already when the block was
     // placed into the free list.
     //
-    while (freeList) {
-        tHeader* next = freeList->nextPage;
-        delete [] reinterpret_cast<char*>(freeList);
-        freeList = next;
-    }
+    releaseFreeList();
+}
+
+void TPoolAllocator::ReleaseCachedPages()
+{
+    std::lock_guard<std::mutex> lock(GetPageCacheMutex());
+    SafeDelete(sPageCache);
 }
 
 // Support MSVC++ 6.0
@@ -167,7 +268,8 @@ void TPoolAllocator::push()
 // that have occurred since the last push(), or since the
 // last pop(), or since the object's creation.
 //
-// The deallocated pages are saved for future allocations.
+// The deallocated pages are saved for future allocations, and given to the
+// page cache once the last push() is popped.
 //
 void TPoolAllocator::pop()
 {
@@ -182,8 +284,9 @@ void TPoolAllocator::pop()
         inUseList->~tHeader();
         
         tHeader* nextInUse = inUseList->nextPage;
+        bytesInUse -= inUseList->pageCount * pageSize;
         if (inUseList->pageCount > 1)
-            delete [] reinterpret_cast<char*>(inUseList);
+            ReleasePage(inUseList, inUseList->pageCount * pageSize);
         else {
             inUseList->nextPage = freeList;
             freeList = inUseList;
@@ -192,6 +295,18 @@ void TPoolAllocator::pop()
     }
 
     stack.pop_back();
+
+    if (stack.empty())
+        releaseFreeList();
+}
+
+void TPoolAllocator::releaseFreeList()
+{
+    while (freeList) {
+        tHeader* next = freeList->nextPage;
+        ReleasePage(freeList, pageSize);
+        freeList = next;
+    }
 }
 
 //
@@ -204,14 +319,8 @@ void TPoolAllocator::popAll()
         pop();
 }
 
-void* TPoolAllocator::allocate(size_t numBytes)
+void* TPoolAllocator::allocateSlow(size_t numBytes)
 {
-    //
-    // Just keep some interesting statistics.
-    //
-    ++numCalls;
-    totalBytes += numBytes;
-
     // If we are using guard blocks, all allocations are bracketed by
     // them: [guardblock][allocation][guardblock].  numBytes is how
     // much memory the caller asked for.  allocationSize is the total
@@ -240,20 +349,29 @@ void* TPoolAllocator::allocate(size_t numBytes)
     if (allocationSize > pageSize - headerSkip) {
         //
         // Do a multi-page allocation.  Don't mix these with the others.
-        // The OS is efficient and allocating and free-ing multiple pages.
+        // Rounding the size up to a power of two number of pages lets the
+        // page cache reuse these for other multi-page allocations.
         //
         size_t numBytesToAlloc = allocationSize + headerSkip;
         // Detect integer overflow.
         if (numBytesToAlloc < allocationSize)
             return 0;
 
-        tHeader* memory = reinterpret_cast<tHeader*>(::new char[numBytesToAlloc]);
+        size_t blockSize = pageSize;
+        while (blockSize < numBytesToAlloc) {
+            blockSize <<= 1;
+            // Detect integer overflow.
+            if (blockSize == 0)
+                return 0;
+        }
+
+        tHeader* memory = acquirePages(blockSize);
         if (memory == 0)
             return 0;
 
         // Use placement-new to initialize header
-        new(memory) tHeader(inUseList, (numBytesToAlloc + pageSize - 1) / pageSize);
-        inUseList = memory;
+        new(memory) tHeader(inUseList, blockSize / pageSize);
+        addInUsePage(memory);
 
         currentPageOffset = pageSize;  // make next allocation come from a new page
 
@@ -268,15 +386,16 @@ void* TPoolAllocator::allocate(size_t numBytes)
     if (freeList) {
         memory = freeList;
         freeList = freeList->nextPage;
+        ++numPagesReused;
     } else {
-        memory = reinterpret_cast<tHeader*>(::new char[pageSize]);
+        memory = acquirePages(pageSize);
         if (memory == 0)
             return 0;
     }
 
     // Use placement-new to initialize header
     new(memory) tHeader(inUseList, 1);
-    inUseList = memory;
+    addInUsePage(memory);
     
     unsigned char* ret = reinterpret_cast<unsigned char *>(inUseList) + headerSkip;
     currentPageOffset = (headerSkip + allocationSize + alignmentMask) & ~alignmentMask;
@@ -284,6 +403,34 @@ void* TPoolAllocator::allocate(size_t numBytes)
     return initializeAllocation(inUseList, ret, numBytes);
 }
 
+TPoolAllocator::tHeader* TPoolAllocator::acquirePages(size_t numBytes)
+{
+    void* memory = AcquireCachedPage(numBytes);
+    if (memory) {
+        numPagesReused += numBytes / pageSize;
+    } else {
+        memory = ::new char[numBytes];
+        numPagesAllocated += numBytes / pageSize;
+    }
+    return reinterpret_cast<tHeader*>(memory);
+}
+
+void TPoolAllocator::addInUsePage(tHeader* page)
+{
+    inUseList = page;
+    bytesInUse += page->pageCount * pageSize;
+    if (bytesInUse > peakBytesInUse)
+        peakBytesInUse = bytesInUse;
+}
+
+void TPoolAllocator::resetStatistics()
+{
+    numCalls = 0;
+    totalBytes = 0;
+    peakBytesInUse = bytesInUse;
+    numPagesAllocated = 0;
+    numPagesReused = 0;
+}
 
 //
 // Check all allocations in a list for damage by calling check on each.
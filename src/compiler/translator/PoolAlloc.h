@@ -106,16 +106,18 @@ private:
 //
 // Page stacks are linked together with a simple header at the beginning
 // of each allocation obtained from the underlying OS.  Multi-page allocations
-// are returned to the OS.  Individual page allocations are kept for future
-// re-use.
+// are rounded up to a power of two number of pages.  Popped pages are kept
+// for re-use by the allocator until its last push() is popped, and then
+// given to a process-wide page cache shared by all the allocators, so that
+// a compile can reuse the pages of the previous compiles of any compiler.
 //
 // The "page size" used is not, nor must it match, the underlying OS
-// page size.  But, having it be about that size or equal to a set of 
-// pages is likely most optimal.
+// page size.  The default size, like the multi-page sizes, divides the
+// 2MB of a huge page, so that pages fill the huge pages of the heap.
 //
 class TPoolAllocator {
 public:
-    TPoolAllocator(int growthIncrement = 8*1024, int allocationAlignment = 16);
+    TPoolAllocator(int growthIncrement = 64*1024, int allocationAlignment = 16);
 
     //
     // Don't call the destructor just to free up the memory, call pop()
@@ -143,7 +145,51 @@ public:
     // Call allocate() to actually acquire memory.  Returns 0 if no memory
     // available, otherwise a properly aligned pointer to 'numBytes' of memory.
     //
-    void* allocate(size_t numBytes);
+    void* allocate(size_t numBytes)
+    {
+        //
+        // Just keep some interesting statistics.
+        //
+        ++numCalls;
+        totalBytes += numBytes;
+
+#ifndef GUARD_BLOCKS
+        //
+        // Without guard blocks, allocations are not tracked and have no
+        // overhead, so the most likely case is a bump of the offset in
+        // the current page.
+        //
+        if (numBytes <= pageSize - currentPageOffset) {
+            unsigned char* memory = reinterpret_cast<unsigned char *>(inUseList) + currentPageOffset;
+            currentPageOffset = (currentPageOffset + numBytes + alignmentMask) & ~alignmentMask;
+            return memory;
+        }
+#endif
+        return allocateSlow(numBytes);
+    }
+
+    //
+    // Call ReleaseCachedPages() to return the pages of the process-wide
+    // page cache to the OS.
+    //
+    static void ReleaseCachedPages();
+
+    //
+    // Call resetStatistics() to count the statistics below from now on.  The
+    // peak starts from the memory currently in use.
+    //
+    void resetStatistics();
+
+    // Current and peak size of the pages in use.
+    size_t getBytesInUse() const { return bytesInUse; }
+    size_t getPeakBytesInUse() const { return peakBytesInUse; }
+    // Number of pages obtained from the OS, and number of pages reused from
+    // the free list.  A multi-page allocation counts all its pages.
+    size_t getNumPagesAllocated() const { return numPagesAllocated; }
+    size_t getNumPagesReused() const { return numPagesReused; }
+    // Number and total size of the calls to allocate().
+    size_t getNumAllocations() const { return numCalls; }
+    size_t getTotalAllocatedBytes() const { return totalBytes; }
 
     //
     // There is no deallocate.  The point of this class is that
@@ -206,8 +252,17 @@ protected:
     tHeader* inUseList;     // list of all memory currently being used
     tAllocStack stack;      // stack of where to allocate from, to partition pool
 
-    int numCalls;           // just an interesting statistic
-    size_t totalBytes;      // just an interesting statistic
+    void* allocateSlow(size_t numBytes);
+    tHeader* acquirePages(size_t numBytes);
+    void addInUsePage(tHeader* page);
+    void releaseFreeList();
+
+    size_t numCalls;           // just an interesting statistic
+    size_t totalBytes;         // just an interesting statistic
+    size_t bytesInUse;         // size of the pages in inUseList
+    size_t peakBytesInUse;
+    size_t numPagesAllocated;
+    size_t numPagesReused;
 private:
     TPoolAllocator& operator=(const TPoolAllocator&);  // dont allow assignment operator
     TPoolAllocator(const TPoolAllocator&);  // dont allow default copy constructor
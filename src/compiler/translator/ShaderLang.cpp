@@ -11,9 +11,12 @@
 
 #include "GLSLANG/ShaderLang.h"
 
+#include <mutex>
+
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeDll.h"
 #include "compiler/translator/length_limits.h"
+#include "compiler/translator/TranslationCache.h"
 #ifdef ANGLE_ENABLE_HLSL
 #include "compiler/translator/TranslatorHLSL.h"
 #endif // ANGLE_ENABLE_HLSL
@@ -25,6 +28,14 @@ namespace
 
 bool isInitialized = false;
 
+// Compiles on different handles may run on different threads, so the process-wide state is set up
+// and torn down under a lock.
+std::mutex &GetInitializeMutex()
+{
+    static std::mutex *initializeMutex = new std::mutex();
+    return *initializeMutex;
+}
+
 //
 // This is the platform independent interface between an OGL driver
 // and the shading language compiler.
@@ -107,6 +118,7 @@ TranslatorHLSL *GetTranslatorHLSLFromHandle(ShHandle handle)
 //
 bool ShInitialize()
 {
+    std::lock_guard<std::mutex> lock(GetInitializeMutex());
     if (!isInitialized)
     {
         isInitialized = InitProcess();
@@ -119,6 +131,7 @@ bool ShInitialize()
 //
 bool ShFinalize()
 {
+    std::lock_guard<std::mutex> lock(GetInitializeMutex());
     if (isInitialized)
     {
         DetachProcess();
@@ -179,6 +192,20 @@ void ShInitBuiltInResources(ShBuiltInResources* resources)
 
     resources->MaxExpressionComplexity = 256;
     resources->MaxCallStackDepth = 256;
+
+    resources->MaxCompileTimeMilliseconds = 1000;
+    resources->MaxPreprocessedTokens      = 1 << 20;
+    resources->MaxCompileAllocations      = 1 << 22;
+}
+
+bool ShSetTranslationCacheOptions(size_t maxMemoryBytes, const char *cacheFilePath)
+{
+    return TranslationCache::GetInstance()->configure(maxMemoryBytes, cacheFilePath);
+}
+
+void ShClearTranslationCache()
+{
+    TranslationCache::GetInstance()->clear();
 }
 
 //
@@ -246,6 +273,18 @@ bool ShCompile(
     return compiler->compile(shaderStrings, numStrings, compileOptions);
 }
 
+bool ShCompileBatch(const ShHandle handle,
+                    const ShBatchShader *shaders,
+                    size_t numShaders,
+                    size_t numThreads,
+                    ShBatchResult *results)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    return compiler->compileBatch(shaders, numShaders, numThreads, results);
+}
+
 void ShClearResults(const ShHandle handle)
 {
     TCompiler *compiler = GetCompilerFromHandle(handle);
@@ -324,6 +363,14 @@ const std::vector<sh::InterfaceBlock> *ShGetInterfaceBlocks(const ShHandle handl
     return GetShaderVariables<sh::InterfaceBlock>(handle);
 }
 
+const ShCompileStatistics *ShGetCompileStatistics(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    if (!compiler)
+        return NULL;
+    return &compiler->getStatistics();
+}
+
 bool ShCheckVariablesWithinPackingLimits(
     int maxVectors, ShVariableInfo *varInfoArray, size_t varInfoArraySize)
 {
@@ -19,7 +19,7 @@
 #include <stdio.h>
 #include <algorithm>
 
-int TSymbolTable::uniqueIdCounter = 0;
+std::atomic<int> TSymbolTable::uniqueIdCounter(0);
 
 //
 // Functions have buried pointers to delete.
@@ -43,12 +43,24 @@ const TString *TFunction::buildMangledName() const
 }
 
 //
-// Symbol table levels are a map of pointers to symbols that have to be deleted.
+// Symbol table levels are a hash table of pointers to symbols that have to be deleted.
 //
 TSymbolTableLevel::~TSymbolTableLevel()
 {
-    for (tLevel::iterator it = level.begin(); it != level.end(); ++it)
-        delete (*it).second;
+    for (const Entry &entry : mEntries)
+        delete entry.symbol;
+}
+
+size_t TSymbolTableLevel::HashName(const TString &name)
+{
+    // FNV-1a, which is cheap for the short identifiers found in shaders.
+    size_t hash = static_cast<size_t>(2166136261u);
+    for (char c : name)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= static_cast<size_t>(16777619u);
+    }
+    return hash;
 }
 
 bool TSymbolTableLevel::insert(TSymbol *symbol)
@@ -56,9 +68,7 @@ bool TSymbolTableLevel::insert(TSymbol *symbol)
     symbol->setUniqueId(TSymbolTable::nextUniqueId());
 
     // returning true means symbol was added to the table
-    tInsertResult result = level.insert(tLevelPair(symbol->getMangledName(), symbol));
-
-    return result.second;
+    return insert(symbol->getMangledName(), symbol);
 }
 
 bool TSymbolTableLevel::insertUnmangled(TFunction *function)
@@ -66,24 +76,119 @@ bool TSymbolTableLevel::insertUnmangled(TFunction *function)
     function->setUniqueId(TSymbolTable::nextUniqueId());
 
     // returning true means symbol was added to the table
-    tInsertResult result = level.insert(tLevelPair(function->getName(), function));
+    return insert(function->getName(), function);
+}
+
+bool TSymbolTableLevel::insert(const TString &name, TSymbol *symbol)
+{
+    if ((mNumSymbols + 1) * 2 > mEntries.size())
+    {
+        grow();
+    }
+
+    size_t hash = HashName(name);
+    size_t mask = mEntries.size() - 1;
+    for (size_t index = hash & mask;; index = (index + 1) & mask)
+    {
+        Entry &entry = mEntries[index];
+        if (entry.symbol == nullptr)
+        {
+            // The key is owned by the symbol, which lives in the same pool as this level.
+            entry.hash   = hash;
+            entry.name   = &name;
+            entry.symbol = symbol;
+            ++mNumSymbols;
+            return true;
+        }
+        if (entry.hash == hash && *entry.name == name)
+        {
+            return false;
+        }
+    }
+}
+
+void TSymbolTableLevel::grow()
+{
+    // Most levels are function scopes with only a handful of symbols.
+    size_t newSize = mEntries.empty() ? 8 : mEntries.size() * 2;
+
+    TVector<Entry> oldEntries(newSize);
+    oldEntries.swap(mEntries);
+
+    size_t mask = newSize - 1;
+    for (const Entry &oldEntry : oldEntries)
+    {
+        if (oldEntry.symbol == nullptr)
+            continue;
+
+        size_t index = oldEntry.hash & mask;
+        while (mEntries[index].symbol != nullptr)
+        {
+            index = (index + 1) & mask;
+        }
+        mEntries[index] = oldEntry;
+    }
+}
 
-    return result.second;
+namespace
+{
+
+void RealizeType(const TType &type)
+{
+    type.getMangledName();
+    type.getObjectSize();
+    if (type.getStruct())
+    {
+        type.getStruct()->deepestNesting();
+    }
 }
 
-TSymbol *TSymbolTableLevel::find(const TString &name) const
+}  // anonymous namespace
+
+void TSymbolTableLevel::realizeTypes() const
 {
-    tLevel::const_iterator it = level.find(name);
-    if (it == level.end())
+    for (const Entry &entry : mEntries)
+    {
+        if (entry.symbol == nullptr)
+            continue;
+
+        if (entry.symbol->isVariable())
+        {
+            RealizeType(static_cast<const TVariable *>(entry.symbol)->getType());
+        }
+        else if (entry.symbol->isFunction())
+        {
+            const TFunction *function = static_cast<const TFunction *>(entry.symbol);
+            RealizeType(function->getReturnType());
+            for (size_t i = 0; i < function->getParamCount(); ++i)
+            {
+                RealizeType(*function->getParam(i).type);
+            }
+        }
+    }
+}
+
+TSymbol *TSymbolTableLevel::find(const TString &name, size_t hash) const
+{
+    if (mNumSymbols == 0)
         return 0;
-    else
-        return (*it).second;
+
+    size_t mask = mEntries.size() - 1;
+    for (size_t index = hash & mask;; index = (index + 1) & mask)
+    {
+        const Entry &entry = mEntries[index];
+        if (entry.symbol == nullptr)
+            return 0;
+        if (entry.hash == hash && *entry.name == name)
+            return entry.symbol;
+    }
 }
 
 TSymbol *TSymbolTable::find(const TString &name, int shaderVersion,
                             bool *builtIn, bool *sameScope) const
 {
-    int level = currentLevel();
+    int level   = currentLevel();
+    size_t hash = TSymbolTableLevel::HashName(name);
     TSymbol *symbol;
 
     do
@@ -93,7 +198,7 @@ TSymbol *TSymbolTable::find(const TString &name, int shaderVersion,
         if (level == ESSL1_BUILTINS && shaderVersion != 100)
             level--;
 
-        symbol = table[level]->find(name);
+        symbol = table[level]->find(name, hash);
     }
     while (symbol == 0 && --level >= 0);
 
@@ -108,6 +213,8 @@ TSymbol *TSymbolTable::find(const TString &name, int shaderVersion,
 TSymbol *TSymbolTable::findBuiltIn(
     const TString &name, int shaderVersion) const
 {
+    size_t hash = TSymbolTableLevel::HashName(name);
+
     for (int level = LAST_BUILTIN_LEVEL; level >= 0; level--)
     {
         if (level == ESSL3_BUILTINS && shaderVersion != 300)
@@ -115,7 +222,7 @@ TSymbol *TSymbolTable::findBuiltIn(
         if (level == ESSL1_BUILTINS && shaderVersion != 100)
             level--;
 
-        TSymbol *symbol = table[level]->find(name);
+        TSymbol *symbol = table[level]->find(name, hash);
 
         if (symbol)
             return symbol;
@@ -126,7 +233,7 @@ TSymbol *TSymbolTable::findBuiltIn(
 
 TSymbolTable::~TSymbolTable()
 {
-    while (table.size() > 0)
+    while (table.size() > mNumSharedLevels)
         pop();
 }
 
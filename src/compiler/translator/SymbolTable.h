@@ -31,6 +31,7 @@
 //
 
 #include <assert.h>
+#include <atomic>
 #include <set>
 
 #include "common/angleutils.h"
@@ -286,15 +287,14 @@ class TInterfaceBlockName : public TSymbol
     }
 };
 
+// A level of the symbol table. Symbols are kept in an open-addressing hash table keyed on their
+// mangled name, with the hash of each name stored next to it so that most mismatches are rejected
+// without comparing strings.
 class TSymbolTableLevel
 {
   public:
-    typedef TMap<TString, TSymbol *> tLevel;
-    typedef tLevel::const_iterator const_iterator;
-    typedef const tLevel::value_type tLevelPair;
-    typedef std::pair<tLevel::iterator, bool> tInsertResult;
-
     TSymbolTableLevel()
+        : mNumSymbols(0)
     {
     }
     ~TSymbolTableLevel();
@@ -304,10 +304,36 @@ class TSymbolTableLevel
     // Insert a function using its unmangled name as the key.
     bool insertUnmangled(TFunction *function);
 
-    TSymbol *find(const TString &name) const;
+    TSymbol *find(const TString &name) const
+    {
+        return find(name, HashName(name));
+    }
+
+    // Lookup with a hash computed by HashName, so that a name can be looked up in several levels
+    // while being hashed only once.
+    TSymbol *find(const TString &name, size_t hash) const;
+
+    static size_t HashName(const TString &name);
+
+    // Computes the data that the types of the symbols build lazily, so that the level is not
+    // written to anymore when it is shared between threads.
+    void realizeTypes() const;
+
+  private:
+    struct Entry
+    {
+        size_t hash;
+        const TString *name;
+        // Null if the entry is empty.
+        TSymbol *symbol;
+    };
 
-  protected:
-    tLevel level;
+    bool insert(const TString &name, TSymbol *symbol);
+    void grow();
+
+    // The number of entries is zero or a power of two, and is kept at least twice mNumSymbols.
+    TVector<Entry> mEntries;
+    size_t mNumSymbols;
 };
 
 // Define ESymbolLevel as int rather than an enum since level can go
@@ -324,7 +350,8 @@ class TSymbolTable : angle::NonCopyable
 {
   public:
     TSymbolTable()
-        : mGlobalInvariant(false)
+        : mNumSharedLevels(0),
+          mGlobalInvariant(false)
     {
         // The symbol table cannot be used until push() is called, but
         // the lack of an initial call to push() can be used to detect
@@ -356,6 +383,7 @@ class TSymbolTable : angle::NonCopyable
 
     void pop()
     {
+        assert(table.size() > mNumSharedLevels);
         delete table.back();
         table.pop_back();
 
@@ -469,6 +497,25 @@ class TSymbolTable : angle::NonCopyable
     void setGlobalInvariant() { mGlobalInvariant = true; }
     bool getGlobalInvariant() const { return mGlobalInvariant; }
 
+    // Called once the built-ins are complete, before the levels get shared.
+    void realizeBuiltInLevels() const
+    {
+        for (int level = 0; level <= LAST_BUILTIN_LEVEL; ++level)
+            table[level]->realizeTypes();
+    }
+
+    // Starts the table with the built-in levels of another table instead of pushing new ones.
+    // The levels stay owned by the other table, which must outlive this one and must not change
+    // anymore.
+    void shareBuiltInLevels(const TSymbolTable &builtIns)
+    {
+        assert(isEmpty());
+        assert(builtIns.table.size() == LAST_BUILTIN_LEVEL + 1);
+        table            = builtIns.table;
+        precisionStack   = builtIns.precisionStack;
+        mNumSharedLevels = table.size();
+    }
+
     static int nextUniqueId()
     {
         return ++uniqueIdCounter;
@@ -484,10 +531,14 @@ class TSymbolTable : angle::NonCopyable
     typedef TMap<TBasicType, TPrecision> PrecisionStackLevel;
     std::vector< PrecisionStackLevel *> precisionStack;
 
+    // Number of levels at the bottom of the stack that belong to another table.
+    size_t mNumSharedLevels;
+
     std::set<std::string> mInvariantVaryings;
     bool mGlobalInvariant;
 
-    static int uniqueIdCounter;
+    // Atomic so that compilers running on different threads can allocate ids.
+    static std::atomic<int> uniqueIdCounter;
 };
 
 #endif // COMPILER_TRANSLATOR_SYMBOLTABLE_H_
@@ -0,0 +1,737 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// TranslationCache.cpp: Implements the process-wide cache of translation results.
+
+#include "compiler/translator/TranslationCache.h"
+
+#include "common/debug.h"
+#include "common/string_utils.h"
+#include "compiler/preprocessor/PreprocessedShader.h"
+
+namespace
+{
+
+// Bumped whenever the layout of serialized entries changes. Files with a different format or
+// translator API version are discarded and rewritten from scratch.
+const uint32_t kFileMagic         = 0x43544E41;  // "ANTC"
+const uint32_t kFileFormatVersion = 2;
+
+const uint32_t kPreprocessedKeyMarker = 0xFFFFFFFF;
+
+// The file starts with the magic, the format version and the translator API version. Each record
+// is then the hash of its key, and the key and the serialized entry prefixed with their lengths.
+const size_t kFileHeaderSize   = 12;
+const size_t kRecordHeaderSize = 16;
+
+class BlobWriter : angle::NonCopyable
+{
+  public:
+    explicit BlobWriter(std::string *data) : mData(data) {}
+
+    void writeInt(uint32_t value)
+    {
+        for (int byte = 0; byte < 4; ++byte)
+        {
+            mData->push_back(static_cast<char>((value >> (byte * 8)) & 0xFF));
+        }
+    }
+
+    void writeInt64(uint64_t value)
+    {
+        writeInt(static_cast<uint32_t>(value));
+        writeInt(static_cast<uint32_t>(value >> 32));
+    }
+
+    void writeBool(bool value) { writeInt(value ? 1u : 0u); }
+
+    void writeString(const std::string &value)
+    {
+        writeInt(static_cast<uint32_t>(value.size()));
+        mData->append(value);
+    }
+
+    void writeShaderVariable(const sh::ShaderVariable &var)
+    {
+        writeInt(var.type);
+        writeInt(var.precision);
+        writeString(var.name);
+        writeString(var.mappedName);
+        writeInt(var.arraySize);
+        writeBool(var.staticUse);
+        writeString(var.structName);
+        writeInt(static_cast<uint32_t>(var.fields.size()));
+        for (const sh::ShaderVariable &field : var.fields)
+        {
+            writeShaderVariable(field);
+        }
+    }
+
+    void writeVariable(const sh::Attribute &var)
+    {
+        writeShaderVariable(var);
+        writeInt(static_cast<uint32_t>(var.location));
+    }
+
+    void writeVariable(const sh::OutputVariable &var)
+    {
+        writeShaderVariable(var);
+        writeInt(static_cast<uint32_t>(var.location));
+    }
+
+    void writeVariable(const sh::Uniform &var) { writeShaderVariable(var); }
+
+    void writeVariable(const sh::Varying &var)
+    {
+        writeShaderVariable(var);
+        writeInt(var.interpolation);
+        writeBool(var.isInvariant);
+    }
+
+    void writeVariable(const sh::InterfaceBlockField &var)
+    {
+        writeShaderVariable(var);
+        writeBool(var.isRowMajorLayout);
+    }
+
+    void writeVariable(const sh::InterfaceBlock &block)
+    {
+        writeString(block.name);
+        writeString(block.mappedName);
+        writeString(block.instanceName);
+        writeInt(block.arraySize);
+        writeInt(block.layout);
+        writeBool(block.isRowMajorLayout);
+        writeBool(block.staticUse);
+        writeVariableList(block.fields);
+    }
+
+    template <typename VarT>
+    void writeVariableList(const std::vector<VarT> &variables)
+    {
+        writeInt(static_cast<uint32_t>(variables.size()));
+        for (const VarT &var : variables)
+        {
+            writeVariable(var);
+        }
+    }
+
+    void writeRegisterMap(const std::map<std::string, unsigned int> &registers)
+    {
+        writeInt(static_cast<uint32_t>(registers.size()));
+        for (const auto &entry : registers)
+        {
+            writeString(entry.first);
+            writeInt(entry.second);
+        }
+    }
+
+  private:
+    std::string *mData;
+};
+
+class BlobReader : angle::NonCopyable
+{
+  public:
+    BlobReader(const char *data, size_t size) : mData(data), mSize(size), mOffset(0), mError(false)
+    {
+    }
+
+    bool error() const { return mError; }
+    bool endOfData() const { return mOffset == mSize; }
+
+    uint32_t readInt()
+    {
+        if (!canRead(4))
+        {
+            return 0;
+        }
+        uint32_t value = 0;
+        for (int byte = 0; byte < 4; ++byte)
+        {
+            value |= static_cast<uint32_t>(static_cast<unsigned char>(mData[mOffset++]))
+                     << (byte * 8);
+        }
+        return value;
+    }
+
+    uint64_t readInt64()
+    {
+        uint64_t low  = readInt();
+        uint64_t high = readInt();
+        return low | (high << 32);
+    }
+
+    bool readBool() { return readInt() != 0; }
+
+    void readString(std::string *value)
+    {
+        uint32_t length = readInt();
+        if (!canRead(length))
+        {
+            return;
+        }
+        value->assign(mData + mOffset, length);
+        mOffset += length;
+    }
+
+    void readShaderVariable(sh::ShaderVariable *var)
+    {
+        var->type      = readInt();
+        var->precision = readInt();
+        readString(&var->name);
+        readString(&var->mappedName);
+        var->arraySize = readInt();
+        var->staticUse = readBool();
+        readString(&var->structName);
+        uint32_t fieldCount = readInt();
+        for (uint32_t field = 0; field < fieldCount && !mError; ++field)
+        {
+            var->fields.push_back(sh::ShaderVariable());
+            readShaderVariable(&var->fields.back());
+        }
+    }
+
+    void readVariable(sh::Attribute *var)
+    {
+        readShaderVariable(var);
+        var->location = static_cast<int>(readInt());
+    }
+
+    void readVariable(sh::OutputVariable *var)
+    {
+        readShaderVariable(var);
+        var->location = static_cast<int>(readInt());
+    }
+
+    void readVariable(sh::Uniform *var) { readShaderVariable(var); }
+
+    void readVariable(sh::Varying *var)
+    {
+        readShaderVariable(var);
+        var->interpolation = static_cast<sh::InterpolationType>(readInt());
+        var->isInvariant   = readBool();
+    }
+
+    void readVariable(sh::InterfaceBlockField *var)
+    {
+        readShaderVariable(var);
+        var->isRowMajorLayout = readBool();
+    }
+
+    void readVariable(sh::InterfaceBlock *block)
+    {
+        readString(&block->name);
+        readString(&block->mappedName);
+        readString(&block->instanceName);
+        block->arraySize        = readInt();
+        block->layout           = static_cast<sh::BlockLayoutType>(readInt());
+        block->isRowMajorLayout = readBool();
+        block->staticUse        = readBool();
+        readVariableList(&block->fields);
+    }
+
+    template <typename VarT>
+    void readVariableList(std::vector<VarT> *variables)
+    {
+        uint32_t count = readInt();
+        for (uint32_t index = 0; index < count && !mError; ++index)
+        {
+            variables->push_back(VarT());
+            readVariable(&variables->back());
+        }
+    }
+
+    void readRegisterMap(std::map<std::string, unsigned int> *registers)
+    {
+        uint32_t count = readInt();
+        for (uint32_t index = 0; index < count && !mError; ++index)
+        {
+            std::string name;
+            readString(&name);
+            (*registers)[name] = readInt();
+        }
+    }
+
+  private:
+    bool canRead(size_t bytes)
+    {
+        if (mError || mSize - mOffset < bytes)
+        {
+            mError = true;
+            return false;
+        }
+        return true;
+    }
+
+    const char *mData;
+    size_t mSize;
+    size_t mOffset;
+    bool mError;
+};
+
+void SerializeEntry(const TranslationCacheEntry &entry, std::string *payload)
+{
+    BlobWriter writer(payload);
+    writer.writeBool(entry.success);
+    writer.writeInt(static_cast<uint32_t>(entry.shaderVersion));
+    writer.writeString(entry.infoLog);
+    writer.writeString(entry.objectCode);
+    writer.writeVariableList(entry.attributes);
+    writer.writeVariableList(entry.outputVariables);
+    writer.writeVariableList(entry.uniforms);
+    writer.writeVariableList(entry.varyings);
+    writer.writeVariableList(entry.interfaceBlocks);
+    writer.writeRegisterMap(entry.interfaceBlockRegisters);
+    writer.writeRegisterMap(entry.uniformRegisters);
+}
+
+bool DeserializeEntry(const std::string &payload, TranslationCacheEntry *entry)
+{
+    BlobReader reader(payload.data(), payload.size());
+    entry->success       = reader.readBool();
+    entry->shaderVersion = static_cast<int>(reader.readInt());
+    reader.readString(&entry->infoLog);
+    reader.readString(&entry->objectCode);
+    reader.readVariableList(&entry->attributes);
+    reader.readVariableList(&entry->outputVariables);
+    reader.readVariableList(&entry->uniforms);
+    reader.readVariableList(&entry->varyings);
+    reader.readVariableList(&entry->interfaceBlocks);
+    reader.readRegisterMap(&entry->interfaceBlockRegisters);
+    reader.readRegisterMap(&entry->uniformRegisters);
+    return !reader.error() && reader.endOfData();
+}
+
+// Two 64-bit FNV-1a hashes of the data from different offset bases, so that keys only collide if
+// both hashes do.
+void WriteDigest(const std::string &data, BlobWriter *writer)
+{
+    uint64_t hash0 = 14695981039346656037ull;
+    uint64_t hash1 = 0x84222325CBF29CE4ull;
+    for (char c : data)
+    {
+        hash0 = (hash0 ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+        hash1 = (hash1 ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+    }
+    writer->writeInt64(hash0);
+    writer->writeInt64(hash1);
+}
+
+void WriteKeyPrefix(sh::GLenum shaderType,
+                    ShShaderSpec spec,
+                    ShShaderOutput output,
+                    int compileOptions,
+                    const std::string &builtInResourcesString,
+                    BlobWriter *writer)
+{
+    writer->writeInt(shaderType);
+    writer->writeInt(spec);
+    writer->writeInt(output);
+    writer->writeInt(static_cast<uint32_t>(compileOptions));
+    writer->writeString(builtInResourcesString);
+}
+
+// Reads a record length at the given offset of the file.
+bool ReadLength(FILE *file, long offset, uint32_t *lengthOut)
+{
+    char bytes[4];
+    if (fseek(file, offset, SEEK_SET) != 0 || fread(bytes, 1, sizeof(bytes), file) != sizeof(bytes))
+    {
+        return false;
+    }
+    BlobReader reader(bytes, sizeof(bytes));
+    *lengthOut = reader.readInt();
+    return true;
+}
+
+void WriteRecord(const std::string &key, const std::string &payload, BlobWriter *writer)
+{
+    writer->writeInt64(angle::HashString(key));
+    writer->writeString(key);
+    writer->writeString(payload);
+}
+
+}  // anonymous namespace
+
+TranslationCacheEntry::TranslationCacheEntry() : success(false), shaderVersion(100)
+{
+}
+
+TranslationCache *TranslationCache::sInstance = nullptr;
+
+TranslationCache *TranslationCache::GetInstance()
+{
+    // The cache outlives ShFinalize on purpose: libANGLE finalizes the translator whenever its
+    // last compiler goes away, and the cache should survive that.
+    static std::once_flag createOnce;
+    std::call_once(createOnce, []() { sInstance = new TranslationCache(); });
+    return sInstance;
+}
+
+std::string TranslationCache::MakeKey(sh::GLenum shaderType,
+                                      ShShaderSpec spec,
+                                      ShShaderOutput output,
+                                      int compileOptions,
+                                      const std::string &builtInResourcesString,
+                                      const char *const shaderStrings[],
+                                      size_t numStrings)
+{
+    std::string data;
+    BlobWriter dataWriter(&data);
+    WriteKeyPrefix(shaderType, spec, output, compileOptions, builtInResourcesString, &dataWriter);
+
+    // Length-prefix every string so that different splits of the same source stay distinct;
+    // the split matters for SH_SOURCE_PATH and for the line numbers in the info log.
+    dataWriter.writeInt(static_cast<uint32_t>(numStrings));
+    for (size_t i = 0; i < numStrings; ++i)
+    {
+        dataWriter.writeString(shaderStrings[i]);
+    }
+
+    // The entries only keep the digest of the sources, so a collision would also need the lengths
+    // of the hashed data to match.
+    std::string key;
+    BlobWriter writer(&key);
+    writer.writeInt(static_cast<uint32_t>(numStrings));
+    writer.writeInt64(data.size());
+    WriteDigest(data, &writer);
+    return key;
+}
+
+std::string TranslationCache::MakePreprocessedKey(sh::GLenum shaderType,
+                                                  ShShaderSpec spec,
+                                                  ShShaderOutput output,
+                                                  int compileOptions,
+                                                  const std::string &builtInResourcesString,
+                                                  const char *sourcePath,
+                                                  const pp::PreprocessedShader &shader)
+{
+    const std::vector<pp::Token> &tokens = shader.getTokens();
+    const std::vector<pp::PreprocessedShader::Event> &events = shader.getEvents();
+    ASSERT(!tokens.empty());
+    int baseLine = tokens.front().location.line;
+
+    std::string data;
+    BlobWriter dataWriter(&data);
+    WriteKeyPrefix(shaderType, spec, output, compileOptions, builtInResourcesString, &dataWriter);
+    dataWriter.writeString(sourcePath ? sourcePath : "");
+
+    dataWriter.writeInt(static_cast<uint32_t>(tokens.size()));
+    for (const pp::Token &token : tokens)
+    {
+        dataWriter.writeInt(token.type);
+        dataWriter.writeInt(token.flags);
+        dataWriter.writeInt(token.location.file);
+        dataWriter.writeInt(token.location.line - baseLine);
+        dataWriter.writeString(token.text);
+    }
+    dataWriter.writeInt(static_cast<uint32_t>(events.size()));
+    for (const pp::PreprocessedShader::Event &event : events)
+    {
+        dataWriter.writeInt(event.type);
+        dataWriter.writeInt(static_cast<uint32_t>(event.tokenIndex));
+        dataWriter.writeInt(event.location.file);
+        dataWriter.writeInt(event.location.line - baseLine);
+        dataWriter.writeInt(event.value);
+        dataWriter.writeString(event.name);
+        dataWriter.writeString(event.argument);
+    }
+
+    std::string key;
+    BlobWriter writer(&key);
+    // Stands in for the number of source strings, which is never zero in the other keys.
+    writer.writeInt(kPreprocessedKeyMarker);
+    WriteDigest(data, &writer);
+    return key;
+}
+
+std::string TranslationCache::MakeLineDependentKey(const std::string &preprocessedKey,
+                                                   const pp::PreprocessedShader &shader)
+{
+    const pp::SourceLocation &location = shader.getTokens().front().location;
+
+    std::string key = preprocessedKey;
+    BlobWriter writer(&key);
+    writer.writeInt(location.file);
+    writer.writeInt(location.line);
+    return key;
+}
+
+bool TranslationCache::DependsOnLines(int compileOptions, const TranslationCacheEntry &entry)
+{
+    return (compileOptions & SH_LINE_DIRECTIVES) != 0 || !entry.infoLog.empty();
+}
+
+TranslationCache::TranslationCache()
+    : mBlobs(kDefaultMaxMemoryBytes),
+      mHitCount(0),
+      mMissCount(0),
+      mFile(nullptr),
+      mFileSize(0),
+      mMaxFileSize(kMaxFileSizeFactor * kDefaultMaxMemoryBytes)
+{
+}
+
+TranslationCache::~TranslationCache()
+{
+    closeFile();
+}
+
+bool TranslationCache::configure(size_t maxMemoryBytes, const char *filePath)
+{
+    std::lock_guard<std::mutex> fileLock(mFileMutex);
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    mBlobs.setMaxSize(maxMemoryBytes);
+    mMaxFileSize = kMaxFileSizeFactor * maxMemoryBytes;
+
+    closeFile();
+    mFilePath.clear();
+    if (filePath == nullptr)
+    {
+        return true;
+    }
+    mFilePath = filePath;
+
+    FILE *file = fopen(filePath, "rb");
+    if (file == nullptr || !loadFile(file))
+    {
+        // Missing, unknown, stale, damaged or oversized: write the file over with what is cached.
+        if (file != nullptr)
+        {
+            fclose(file);
+        }
+        std::string contents = serializeFile();
+        lock.unlock();
+        return writeFile(contents);
+    }
+    fclose(file);
+
+    mFile = fopen(filePath, "ab");
+    return mFile != nullptr;
+}
+
+bool TranslationCache::loadFile(FILE *file)
+{
+    fseek(file, 0, SEEK_END);
+    long fileSize = ftell(file);
+    if (fileSize < static_cast<long>(kFileHeaderSize))
+    {
+        return false;
+    }
+
+    std::string header(kFileHeaderSize, '\0');
+    fseek(file, 0, SEEK_SET);
+    if (fread(&header[0], 1, header.size(), file) != header.size())
+    {
+        return false;
+    }
+
+    BlobReader headerReader(header.data(), header.size());
+    if (headerReader.readInt() != kFileMagic || headerReader.readInt() != kFileFormatVersion ||
+        headerReader.readInt() != ANGLE_SH_VERSION)
+    {
+        return false;
+    }
+
+    // Walk the record lengths, skipping over the keys and entries, to find the most recent records
+    // that fit in the memory budget. The older ones would only be evicted again.
+    std::vector<long> recordOffsets;
+    std::vector<size_t> recordSizes;
+    long offset    = static_cast<long>(kFileHeaderSize);
+    bool truncated = false;
+    while (offset < fileSize)
+    {
+        size_t remaining       = static_cast<size_t>(fileSize - offset);
+        uint32_t keyLength     = 0;
+        uint32_t payloadLength = 0;
+        if (remaining < kRecordHeaderSize || !ReadLength(file, offset + 8, &keyLength) ||
+            keyLength > remaining - kRecordHeaderSize ||
+            !ReadLength(file, offset + 12 + keyLength, &payloadLength) ||
+            payloadLength > remaining - kRecordHeaderSize - keyLength)
+        {
+            // A truncated trailing record is left over by a process that died mid-append.
+            // Everything before it is intact.
+            truncated = true;
+            break;
+        }
+
+        recordOffsets.push_back(offset);
+        recordSizes.push_back(keyLength + payloadLength);
+        offset += static_cast<long>(kRecordHeaderSize + keyLength + payloadLength);
+    }
+
+    size_t firstRecord = recordOffsets.size();
+    size_t loadedSize  = 0;
+    while (firstRecord > 0 && loadedSize + recordSizes[firstRecord - 1] <= mBlobs.maxSize())
+    {
+        firstRecord--;
+        loadedSize += recordSizes[firstRecord];
+    }
+
+    if (firstRecord < recordOffsets.size())
+    {
+        // Read the records in one go; they are then parsed straight out of memory.
+        std::string contents(static_cast<size_t>(offset - recordOffsets[firstRecord]), '\0');
+        fseek(file, recordOffsets[firstRecord], SEEK_SET);
+        if (fread(&contents[0], 1, contents.size(), file) != contents.size())
+        {
+            return false;
+        }
+
+        BlobReader reader(contents.data(), contents.size());
+        while (!reader.endOfData() && !reader.error())
+        {
+            uint64_t hash = reader.readInt64();
+            std::string key;
+            std::string payload;
+            reader.readString(&key);
+            reader.readString(&payload);
+            if (angle::HashString(key) == hash)
+            {
+                mBlobs.insert(key, payload);
+            }
+        }
+    }
+
+    // Appending after a truncated record would misalign every record that follows.
+    mFileSize = static_cast<size_t>(offset);
+    return !truncated && mFileSize <= mMaxFileSize;
+}
+
+std::string TranslationCache::serializeFile() const
+{
+    std::string contents;
+    BlobWriter writer(&contents);
+    writer.writeInt(kFileMagic);
+    writer.writeInt(kFileFormatVersion);
+    writer.writeInt(ANGLE_SH_VERSION);
+    mBlobs.forEach([&writer](const std::string &key, const std::string &payload) {
+        WriteRecord(key, payload, &writer);
+    });
+    return contents;
+}
+
+bool TranslationCache::writeFile(const std::string &contents)
+{
+    closeFile();
+
+    FILE *file = fopen(mFilePath.c_str(), "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    bool written = fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+    fclose(file);
+    if (!written)
+    {
+        return false;
+    }
+
+    mFile     = fopen(mFilePath.c_str(), "ab");
+    mFileSize = contents.size();
+    return mFile != nullptr;
+}
+
+void TranslationCache::closeFile()
+{
+    if (mFile != nullptr)
+    {
+        fclose(mFile);
+        mFile = nullptr;
+    }
+    mFileSize = 0;
+}
+
+void TranslationCache::appendToFile(const std::string &key, const std::string &payload)
+{
+    std::lock_guard<std::mutex> fileLock(mFileMutex);
+    if (mFile == nullptr)
+    {
+        return;
+    }
+
+    std::string record;
+    BlobWriter writer(&record);
+    WriteRecord(key, payload, &writer);
+
+    if (mFileSize + record.size() > mMaxFileSize)
+    {
+        // The entry was cached before, so the rewritten file includes it unless it was evicted
+        // since.
+        std::string contents;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            contents = serializeFile();
+        }
+        writeFile(contents);
+        return;
+    }
+
+    // A single write per record keeps concurrent appenders from interleaving records.
+    fwrite(record.data(), 1, record.size(), mFile);
+    fflush(mFile);
+    mFileSize += record.size();
+}
+
+bool TranslationCache::lookup(const std::string &key, TranslationCacheEntry *entryOut)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const std::string *payload = mBlobs.find(key);
+    if (payload == nullptr || !DeserializeEntry(*payload, entryOut))
+    {
+        mMissCount++;
+        return false;
+    }
+
+    mHitCount++;
+    return true;
+}
+
+void TranslationCache::store(const std::string &key, const TranslationCacheEntry &entry)
+{
+    std::string payload;
+    SerializeEntry(entry, &payload);
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mBlobs.insert(key, payload))
+        {
+            return;
+        }
+    }
+
+    appendToFile(key, payload);
+}
+
+void TranslationCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mBlobs.clear();
+    mHitCount  = 0;
+    mMissCount = 0;
+}
+
+size_t TranslationCache::getHitCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mHitCount;
+}
+
+size_t TranslationCache::getMissCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mMissCount;
+}
+
+size_t TranslationCache::getMemorySize() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mBlobs.size();
+}
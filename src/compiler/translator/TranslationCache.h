@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// TranslationCache.h: A process-wide, content-addressed cache of translation results. Compiles
+// that pass SH_CACHE_TRANSLATION look up their results here before parsing the shader, and store
+// them here after a full compile. Entries are optionally persisted to a file, which new entries are
+// appended to and which is compacted when it outgrows the memory budget, so that later processes
+// can skip the translator entirely. All the methods can be called from several
+// threads at once.
+
+#ifndef COMPILER_TRANSLATOR_TRANSLATIONCACHE_H_
+#define COMPILER_TRANSLATOR_TRANSLATIONCACHE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/SizedLRUCache.h"
+#include "common/angleutils.h"
+#include "GLSLANG/ShaderLang.h"
+
+namespace pp
+{
+class PreprocessedShader;
+}
+
+// Everything a compile produces that ShGet* queries can observe.
+struct TranslationCacheEntry
+{
+    TranslationCacheEntry();
+
+    bool success;
+    int shaderVersion;
+    std::string infoLog;
+    std::string objectCode;
+
+    std::vector<sh::Attribute> attributes;
+    std::vector<sh::OutputVariable> outputVariables;
+    std::vector<sh::Uniform> uniforms;
+    std::vector<sh::Varying> varyings;
+    std::vector<sh::InterfaceBlock> interfaceBlocks;
+
+    // Register assignments reported by the HLSL backend.
+    std::map<std::string, unsigned int> interfaceBlockRegisters;
+    std::map<std::string, unsigned int> uniformRegisters;
+};
+
+class TranslationCache : angle::NonCopyable
+{
+  public:
+    // Default upper bound on the in-memory size of the cache.
+    static const size_t kDefaultMaxMemoryBytes = 16 * 1024 * 1024;
+
+    // The backing file is rewritten from the in-memory entries once its records add up to more
+    // than this many times the memory budget.
+    static const size_t kMaxFileSizeFactor = 2;
+
+    static TranslationCache *GetInstance();
+
+    // Builds the key identifying a compile, from a digest of the sources and of the shader stage,
+    // spec, output, options and built-in resources string. Hashed names also depend on the
+    // embedder's hash function, which can't be part of the key, so those compiles aren't cached.
+    static std::string MakeKey(sh::GLenum shaderType,
+                               ShShaderSpec spec,
+                               ShShaderOutput output,
+                               int compileOptions,
+                               const std::string &builtInResourcesString,
+                               const char *const shaderStrings[],
+                               size_t numStrings);
+
+    // Builds the key identifying a compile by its preprocessed shader instead of its sources, so
+    // that sources only differing in what the preprocessor removes, like unused defines or
+    // comments, share their results. The key is a digest of the tokens, with their lines relative
+    // to the first token so that sources shifted by added lines share it too. The source path is
+    // null without SH_SOURCE_PATH.
+    static std::string MakePreprocessedKey(sh::GLenum shaderType,
+                                           ShShaderSpec spec,
+                                           ShShaderOutput output,
+                                           int compileOptions,
+                                           const std::string &builtInResourcesString,
+                                           const char *sourcePath,
+                                           const pp::PreprocessedShader &shader);
+
+    // Results that report lines, in the info log or in #line directives, are only valid for the
+    // sources they were compiled from, and are stored under this key, which adds the location of
+    // the first token to the preprocessed key.
+    static std::string MakeLineDependentKey(const std::string &preprocessedKey,
+                                            const pp::PreprocessedShader &shader);
+    static bool DependsOnLines(int compileOptions, const TranslationCacheEntry &entry);
+
+    // Sets the memory budget and the backing file. Only the most recent entries of the file that
+    // fit in the budget are loaded. Passing a null path detaches the cache from its current file.
+    // Returns false if the file could not be opened.
+    bool configure(size_t maxMemoryBytes, const char *filePath);
+
+    bool lookup(const std::string &key, TranslationCacheEntry *entryOut);
+    // Entries that don't fit in the memory budget aren't stored. The others are appended to the
+    // file after releasing the lock of the in-memory entries, so that lookups don't wait on it.
+    void store(const std::string &key, const TranslationCacheEntry &entry);
+
+    // Drops the in-memory entries. The backing file, if any, is left untouched.
+    void clear();
+
+    size_t getHitCount() const;
+    size_t getMissCount() const;
+    size_t getMemorySize() const;
+
+  private:
+    TranslationCache();
+    ~TranslationCache();
+
+    void closeFile();
+    bool loadFile(FILE *file);
+    std::string serializeFile() const;
+    bool writeFile(const std::string &contents);
+    void appendToFile(const std::string &key, const std::string &payload);
+
+    // Guards the entries and the counts.
+    mutable std::mutex mMutex;
+
+    // The serialized entries.
+    angle::SizedLRUCache<std::string> mBlobs;
+    size_t mHitCount;
+    size_t mMissCount;
+
+    // Guards the backing file. Taken before mMutex when both are held.
+    std::mutex mFileMutex;
+
+    std::string mFilePath;
+    FILE *mFile;
+    size_t mFileSize;
+    size_t mMaxFileSize;
+
+    static TranslationCache *sInstance;
+};
+
+#endif  // COMPILER_TRANSLATOR_TRANSLATIONCACHE_H_
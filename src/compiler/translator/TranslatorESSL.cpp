@@ -43,13 +43,19 @@ void TranslatorESSL::translate(TIntermNode *root, int) {
 
     if (precisionEmulation)
     {
+        TScopedPhaseTimer timer(getPhaseTimings(), "EmulatePrecision");
         EmulatePrecision emulatePrecision(getSymbolTable(), shaderVer);
         root->traverse(&emulatePrecision);
         emulatePrecision.updateTree();
         emulatePrecision.writeEmulationHelpers(sink, SH_ESSL_OUTPUT);
     }
 
-    RecordConstantPrecision(root, getTemporaryIndex());
+    {
+        TScopedPhaseTimer timer(getPhaseTimings(), "RecordConstantPrecision");
+        RecordConstantPrecision(root, getTemporaryIndex());
+    }
+
+    TScopedPhaseTimer timer(getPhaseTimings(), "Output");
 
     // Write emulated built-in functions if needed.
     if (!getBuiltInFunctionEmulator().IsOutputEmpty())
@@ -78,6 +84,7 @@ void TranslatorESSL::translate(TIntermNode *root, int) {
     // Write translated shader.
     TOutputESSL outputESSL(sink, getArrayIndexClampingStrategy(), getHashFunction(), getNameMap(),
                            getSymbolTable(), shaderVer, precisionEmulation);
+    outputESSL.setCompileBudget(getCompileBudget());
     root->traverse(&outputESSL);
 }
 
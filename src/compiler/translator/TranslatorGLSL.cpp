@@ -34,24 +34,31 @@ void TranslatorGLSL::translate(TIntermNode *root, int compileOptions)
 {
     TInfoSinkBase& sink = getInfoSink().obj;
 
-    // Write GLSL version.
-    writeVersion(root);
+    {
+        TScopedPhaseTimer timer(getPhaseTimings(), "OutputHeader");
+
+        // Write GLSL version.
+        writeVersion(root);
 
-    writePragma();
+        writePragma();
 
-    // Write extension behaviour as needed
-    writeExtensionBehavior(root);
+        // Write extension behaviour as needed
+        writeExtensionBehavior(root);
+    }
 
     bool precisionEmulation = getResources().WEBGL_debug_shader_precision && getPragma().debugShaderPrecision;
 
     if (precisionEmulation)
     {
+        TScopedPhaseTimer timer(getPhaseTimings(), "EmulatePrecision");
         EmulatePrecision emulatePrecision(getSymbolTable(), getShaderVersion());
         root->traverse(&emulatePrecision);
         emulatePrecision.updateTree();
         emulatePrecision.writeEmulationHelpers(sink, getOutputType());
     }
 
+    TScopedPhaseTimer timer(getPhaseTimings(), "Output");
+
     // Write emulated built-in functions if needed.
     if (!getBuiltInFunctionEmulator().IsOutputEmpty())
     {
@@ -140,6 +147,7 @@ void TranslatorGLSL::translate(TIntermNode *root, int compileOptions)
                            getSymbolTable(),
                            getShaderVersion(),
                            getOutputType());
+    outputGLSL.setCompileBudget(getCompileBudget());
     root->traverse(&outputGLSL);
 }
 
@@ -13,6 +13,7 @@
 #include "compiler/translator/SeparateArrayInitialization.h"
 #include "compiler/translator/SeparateDeclarations.h"
 #include "compiler/translator/SeparateExpressionsReturningArrays.h"
+#include "compiler/translator/TranslationCache.h"
 #include "compiler/translator/UnfoldShortCircuitToIf.h"
 
 TranslatorHLSL::TranslatorHLSL(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
@@ -25,23 +26,39 @@ void TranslatorHLSL::translate(TIntermNode *root, int compileOptions)
     const ShBuiltInResources &resources = getResources();
     int numRenderTargets = resources.EXT_draw_buffers ? resources.MaxDrawBuffers : 1;
 
-    SeparateDeclarations(root);
+    {
+        TScopedPhaseTimer timer(getPhaseTimings(), "SeparateDeclarations");
+        SeparateDeclarations(root);
+    }
 
     // Note that SeparateDeclarations needs to be run before UnfoldShortCircuitToIf.
-    UnfoldShortCircuitToIf(root, getTemporaryIndex());
+    {
+        TScopedPhaseTimer timer(getPhaseTimings(), "UnfoldShortCircuitToIf");
+        UnfoldShortCircuitToIf(root, getTemporaryIndex());
+    }
 
-    SeparateExpressionsReturningArrays(root, getTemporaryIndex());
+    {
+        TScopedPhaseTimer timer(getPhaseTimings(), "SeparateExpressionsReturningArrays");
+        SeparateExpressionsReturningArrays(root, getTemporaryIndex());
+    }
 
     // Note that SeparateDeclarations needs to be run before SeparateArrayInitialization.
-    SeparateArrayInitialization(root);
+    {
+        TScopedPhaseTimer timer(getPhaseTimings(), "SeparateArrayInitialization");
+        SeparateArrayInitialization(root);
+    }
 
     // HLSL doesn't support arrays as return values, we'll need to make functions that have an array
     // as a return value to use an out parameter to transfer the array data instead.
-    ArrayReturnValueToOutParameter(root, getTemporaryIndex());
+    {
+        TScopedPhaseTimer timer(getPhaseTimings(), "ArrayReturnValueToOutParameter");
+        ArrayReturnValueToOutParameter(root, getTemporaryIndex());
+    }
 
     if (!shouldRunLoopAndIndexingValidation(compileOptions))
     {
         // HLSL doesn't support dynamic indexing of vectors and matrices.
+        TScopedPhaseTimer timer(getPhaseTimings(), "RemoveDynamicIndexing");
         RemoveDynamicIndexing(root, getTemporaryIndex(), getSymbolTable(), getShaderVersion());
     }
 
@@ -49,9 +66,12 @@ void TranslatorHLSL::translate(TIntermNode *root, int compileOptions)
     // use a vertex attribute as a condition, and some related computation in the else block.
     if (getOutputType() == SH_HLSL_3_0_OUTPUT && getShaderType() == GL_VERTEX_SHADER)
     {
+        TScopedPhaseTimer timer(getPhaseTimings(), "RewriteElseBlocks");
         sh::RewriteElseBlocks(root, getTemporaryIndex());
     }
 
+    TScopedPhaseTimer timer(getPhaseTimings(), "Output");
+
     sh::OutputHLSL outputHLSL(getShaderType(), getShaderVersion(), getExtensionBehavior(),
         getSourcePath(), getOutputType(), numRenderTargets, getUniforms(), compileOptions);
 
@@ -61,6 +81,18 @@ void TranslatorHLSL::translate(TIntermNode *root, int compileOptions)
     mUniformRegisterMap = outputHLSL.getUniformRegisterMap();
 }
 
+void TranslatorHLSL::saveTranslationResults(TranslationCacheEntry *entry) const
+{
+    entry->interfaceBlockRegisters = mInterfaceBlockRegisterMap;
+    entry->uniformRegisters        = mUniformRegisterMap;
+}
+
+void TranslatorHLSL::loadTranslationResults(const TranslationCacheEntry &entry)
+{
+    mInterfaceBlockRegisterMap = entry.interfaceBlockRegisters;
+    mUniformRegisterMap        = entry.uniformRegisters;
+}
+
 bool TranslatorHLSL::hasInterfaceBlock(const std::string &interfaceBlockName) const
 {
     return (mInterfaceBlockRegisterMap.count(interfaceBlockName) > 0);
@@ -27,6 +27,9 @@ class TranslatorHLSL : public TCompiler
     // collectVariables needs to be run always so registers can be assigned.
     bool shouldCollectVariables(int compileOptions) override { return true; }
 
+    void saveTranslationResults(TranslationCacheEntry *entry) const override;
+    void loadTranslationResults(const TranslationCacheEntry &entry) override;
+
     std::map<std::string, unsigned int> mInterfaceBlockRegisterMap;
     std::map<std::string, unsigned int> mUniformRegisterMap;
 };
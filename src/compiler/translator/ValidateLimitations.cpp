@@ -6,8 +6,7 @@
 
 #include "compiler/translator/ValidateLimitations.h"
 #include "compiler/translator/InfoSink.h"
-#include "compiler/translator/InitializeParseContext.h"
-#include "compiler/translator/ParseContext.h"
+#include "compiler/translator/SymbolTable.h"
 #include "angle_gl.h"
 
 namespace
@@ -53,9 +52,14 @@ class ValidateConstIndexExpr : public TIntermTraverser
 
 }  // namespace anonymous
 
-ValidateLimitations::ValidateLimitations(sh::GLenum shaderType, TInfoSinkBase *sink)
+ValidateLimitations::ValidateLimitations(sh::GLenum shaderType,
+                                         const TSymbolTable &symbolTable,
+                                         int shaderVersion,
+                                         TInfoSinkBase *sink)
     : TIntermTraverser(true, false, false),
       mShaderType(shaderType),
+      mSymbolTable(symbolTable),
+      mShaderVersion(shaderVersion),
       mSink(sink),
       mNumErrors(0),
       mValidateIndexing(true),
@@ -64,10 +68,12 @@ ValidateLimitations::ValidateLimitations(sh::GLenum shaderType, TInfoSinkBase *s
 }
 
 // static
-bool ValidateLimitations::IsLimitedForLoop(TIntermLoop *loop)
+bool ValidateLimitations::IsLimitedForLoop(TIntermLoop *loop,
+                                           const TSymbolTable &symbolTable,
+                                           int shaderVersion)
 {
     // The shader type doesn't matter in this case.
-    ValidateLimitations validate(GL_FRAGMENT_SHADER, nullptr);
+    ValidateLimitations validate(GL_FRAGMENT_SHADER, symbolTable, shaderVersion, nullptr);
     validate.mValidateIndexing   = false;
     validate.mValidateInnerLoops = false;
     if (!validate.validateLoopType(loop))
@@ -422,8 +428,7 @@ bool ValidateLimitations::validateFunctionCall(TIntermAggregate *node)
         return true;
 
     bool valid = true;
-    TSymbolTable& symbolTable = GetGlobalParseContext()->symbolTable;
-    TSymbol* symbol = symbolTable.find(node->getName(), GetGlobalParseContext()->getShaderVersion());
+    TSymbol *symbol = mSymbolTable.find(node->getName(), mShaderVersion);
     ASSERT(symbol && symbol->isFunction());
     TFunction *function = static_cast<TFunction *>(symbol);
     for (ParamIndex::const_iterator i = pIndex.begin();
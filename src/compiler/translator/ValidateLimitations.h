@@ -11,13 +11,17 @@
 #include "compiler/translator/LoopInfo.h"
 
 class TInfoSinkBase;
+class TSymbolTable;
 
 // Traverses intermediate tree to ensure that the shader does not exceed the
 // minimum functionality mandated in GLSL 1.0 spec, Appendix A.
 class ValidateLimitations : public TIntermTraverser
 {
   public:
-    ValidateLimitations(sh::GLenum shaderType, TInfoSinkBase *sink);
+    ValidateLimitations(sh::GLenum shaderType,
+                        const TSymbolTable &symbolTable,
+                        int shaderVersion,
+                        TInfoSinkBase *sink);
 
     int numErrors() const { return mNumErrors; }
 
@@ -26,7 +30,9 @@ class ValidateLimitations : public TIntermTraverser
     bool visitAggregate(Visit, TIntermAggregate *) override;
     bool visitLoop(Visit, TIntermLoop *) override;
 
-    static bool IsLimitedForLoop(TIntermLoop *node);
+    static bool IsLimitedForLoop(TIntermLoop *node,
+                                 const TSymbolTable &symbolTable,
+                                 int shaderVersion);
 
   private:
     void error(TSourceLoc loc, const char *reason, const char *token);
@@ -53,6 +59,9 @@ class ValidateLimitations : public TIntermTraverser
     bool validateIndexing(TIntermBinary *node);
 
     sh::GLenum mShaderType;
+    // Used to look up the functions called with loop indices as arguments.
+    const TSymbolTable &mSymbolTable;
+    int mShaderVersion;
     TInfoSinkBase *mSink;
     int mNumErrors;
     TLoopStack mLoopStack;
@@ -3234,7 +3234,7 @@ void yyfree (void * ptr , yyscan_t yyscanner)
 
 yy_size_t string_input(char* buf, yy_size_t max_size, yyscan_t yyscanner) {
     pp::Token token;
-    yyget_extra(yyscanner)->getPreprocessor().lex(&token);
+    yyget_extra(yyscanner)->lexPreprocessedToken(&token);
     yy_size_t len = token.type == pp::Token::LAST ? 0 : token.text.size();
     if (len < max_size)
         memcpy(buf, token.text.c_str(), len);
@@ -3399,23 +3399,9 @@ int glslang_scan(size_t count, const char* const string[], const int length[],
     yyset_column(0,context->getScanner());
     yyset_lineno(1,context->getScanner());
 
-    // Initialize preprocessor.
-    pp::Preprocessor *preprocessor = &context->getPreprocessor();
-
-    if (!preprocessor->init(count, string, length))
+    if (!context->initPreprocessor(count, string, length))
         return 1;
 
-    // Define extension macros.
-    const TExtensionBehavior& extBehavior = context->extensionBehavior();
-    for (TExtensionBehavior::const_iterator iter = extBehavior.begin();
-         iter != extBehavior.end(); ++iter) {
-        preprocessor->predefineMacro(iter->first.c_str(), 1);
-    }
-    if (context->getFragmentPrecisionHigh())
-        preprocessor->predefineMacro("GL_FRAGMENT_PRECISION_HIGH", 1);
-
-    preprocessor->setMaxTokenSize(GetGlobalMaxTokenSize(context->getShaderSpec()));
-
     return 0;
 }
 
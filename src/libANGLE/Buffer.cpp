@@ -182,12 +182,17 @@ Error Buffer::getIndexRange(GLenum type,
         return gl::Error(GL_NO_ERROR);
     }
 
-    Error error = mBuffer->getIndexRange(type, offset, count, primitiveRestartEnabled, outRange);
+    const uint8_t *data = nullptr;
+    Error error         = mBuffer->mapIndexData(&data);
     if (error.isError())
     {
         return error;
     }
 
+    *outRange = mIndexRangeCache.computeRange(type, offset, count, primitiveRestartEnabled, data,
+                                              static_cast<size_t>(mSize));
+    mBuffer->unmapIndexData();
+
     mIndexRangeCache.addRange(type, offset, count, primitiveRestartEnabled, *outRange);
 
     return Error(GL_NO_ERROR);
@@ -7,6 +7,7 @@
 #include "libANGLE/Caps.h"
 #include "common/debug.h"
 #include "common/angleutils.h"
+#include "libANGLE/formatutils.h"
 
 #include "angle_gl.h"
 
@@ -56,40 +57,102 @@ GLuint TextureCaps::getNearestSamples(GLuint requestedSamples) const
     return 0;
 }
 
+static bool FormatCapsLess(const TextureCapsMap::FormatCapsPair &entry, GLenum internalFormat)
+{
+    return entry.first < internalFormat;
+}
+
+TextureCapsMap::TextureCapsMap()
+    : mFormatPositions(GetInternalFormatCount(), kInvalidInternalFormatIndex),
+      mNumUnindexedFormats(0)
+{
+}
+
 void TextureCapsMap::insert(GLenum internalFormat, const TextureCaps &caps)
 {
-    mCapsMap[internalFormat] = caps;
+    auto iter =
+        std::lower_bound(mFormatCaps.begin(), mFormatCaps.end(), internalFormat, FormatCapsLess);
+    if (iter != mFormatCaps.end() && iter->first == internalFormat)
+    {
+        iter->second = caps;
+        return;
+    }
+
+    mFormatCaps.insert(iter, FormatCapsPair(internalFormat, caps));
+    updateFormatPositions();
 }
 
 void TextureCapsMap::remove(GLenum internalFormat)
 {
-    InternalFormatToCapsMap::iterator i = mCapsMap.find(internalFormat);
-    if (i != mCapsMap.end())
+    const_iterator iter = find(internalFormat);
+    if (iter != mFormatCaps.end())
     {
-        mCapsMap.erase(i);
+        mFormatCaps.erase(mFormatCaps.begin() + (iter - mFormatCaps.begin()));
+        updateFormatPositions();
     }
 }
 
 const TextureCaps &TextureCapsMap::get(GLenum internalFormat) const
 {
     static TextureCaps defaultUnsupportedTexture;
-    InternalFormatToCapsMap::const_iterator iter = mCapsMap.find(internalFormat);
-    return (iter != mCapsMap.end()) ? iter->second : defaultUnsupportedTexture;
+    const_iterator iter = find(internalFormat);
+    return (iter != mFormatCaps.end()) ? iter->second : defaultUnsupportedTexture;
 }
 
 TextureCapsMap::const_iterator TextureCapsMap::begin() const
 {
-    return mCapsMap.begin();
+    return mFormatCaps.begin();
 }
 
 TextureCapsMap::const_iterator TextureCapsMap::end() const
 {
-    return mCapsMap.end();
+    return mFormatCaps.end();
 }
 
 size_t TextureCapsMap::size() const
 {
-    return mCapsMap.size();
+    return mFormatCaps.size();
+}
+
+TextureCapsMap::const_iterator TextureCapsMap::find(GLenum internalFormat) const
+{
+    size_t index = GetInternalFormatIndex(internalFormat);
+    if (index != kInvalidInternalFormatIndex)
+    {
+        size_t position = mFormatPositions[index];
+        return (position != kInvalidInternalFormatIndex) ? mFormatCaps.begin() + position
+                                                         : mFormatCaps.end();
+    }
+
+    // Formats without a dense index are only found by searching, and only when there are some.
+    if (mNumUnindexedFormats == 0)
+    {
+        return mFormatCaps.end();
+    }
+
+    const_iterator iter =
+        std::lower_bound(mFormatCaps.begin(), mFormatCaps.end(), internalFormat, FormatCapsLess);
+    return (iter != mFormatCaps.end() && iter->first == internalFormat) ? iter
+                                                                        : mFormatCaps.end();
+}
+
+void TextureCapsMap::updateFormatPositions()
+{
+    // Formats are only added while the caps are generated, so this is not on any hot path.
+    std::fill(mFormatPositions.begin(), mFormatPositions.end(), kInvalidInternalFormatIndex);
+    mNumUnindexedFormats = 0;
+    for (size_t position = 0; position < mFormatCaps.size(); position++)
+    {
+        size_t index = GetInternalFormatIndex(mFormatCaps[position].first);
+        if (index != kInvalidInternalFormatIndex)
+        {
+            mFormatPositions[index] = position;
+        }
+        else
+        {
+            mNumUnindexedFormats++;
+        }
+    }
 }
 
 Extensions::Extensions()
@@ -157,6 +220,7 @@ Extensions::Extensions()
       maxLabelLength(0),
       noError(false),
       lossyETCDecode(false),
+      multiDraw(false),
       colorBufferFloat(false)
 {
 }
@@ -228,6 +292,7 @@ std::vector<std::string> Extensions::getStrings() const
     //InsertExtensionString("GL_KHR_no_error",                     noError,                   &extensionStrings);
 
     InsertExtensionString("GL_ANGLE_lossy_etc_decode",           lossyETCDecode,            &extensionStrings);
+    InsertExtensionString("GL_ANGLE_multi_draw",                 multiDraw,                 &extensionStrings);
     // clang-format on
 
     return extensionStrings;
@@ -44,10 +44,15 @@ struct TextureCaps
     GLuint getNearestSamples(GLuint requestedSamples) const;
 };
 
+// Iterates over the formats in increasing order. Lookups of the formats known to
+// GetInternalFormatInfo go through their dense index and take constant time.
 class TextureCapsMap
 {
   public:
-    typedef std::map<GLenum, TextureCaps>::const_iterator const_iterator;
+    typedef std::pair<GLenum, TextureCaps> FormatCapsPair;
+    typedef std::vector<FormatCapsPair>::const_iterator const_iterator;
+
+    TextureCapsMap();
 
     void insert(GLenum internalFormat, const TextureCaps &caps);
     void remove(GLenum internalFormat);
@@ -60,8 +65,15 @@ class TextureCapsMap
     size_t size() const;
 
   private:
-    typedef std::map<GLenum, TextureCaps> InternalFormatToCapsMap;
-    InternalFormatToCapsMap mCapsMap;
+    const_iterator find(GLenum internalFormat) const;
+    void updateFormatPositions();
+
+    // Sorted by format.
+    std::vector<FormatCapsPair> mFormatCaps;
+
+    // Position in mFormatCaps of each format, indexed by GetInternalFormatIndex.
+    std::vector<size_t> mFormatPositions;
+    size_t mNumUnindexedFormats;
 };
 
 struct Extensions
@@ -278,6 +290,9 @@ struct Extensions
     // GL_ANGLE_lossy_etc_decode
     bool lossyETCDecode;
 
+    // GL_ANGLE_multi_draw
+    bool multiDraw;
+
     // ES3 Extension support
 
     // GL_EXT_color_buffer_float
@@ -8,8 +8,12 @@
 
 #include "libANGLE/Compiler.h"
 
+#include <algorithm>
+
 #include "common/debug.h"
 #include "libANGLE/Data.h"
+#include "libANGLE/Shader.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/CompilerImpl.h"
 #include "libANGLE/renderer/ImplFactory.h"
 
@@ -23,6 +27,10 @@ namespace
 // ShFinalize.
 size_t activeCompilerHandles = 0;
 
+// Each pending compile holds a compiler handle and its translation until it is resolved, so an
+// application that compiles many shaders without querying them joins the oldest ones first.
+const size_t kMaxPendingCompiles = 16;
+
 }  // anonymous namespace
 
 Compiler::Compiler(rx::ImplFactory *implFactory, const gl::Data &data)
@@ -30,8 +38,7 @@ Compiler::Compiler(rx::ImplFactory *implFactory, const gl::Data &data)
       mSpec(data.clientVersion > 2 ? SH_GLES3_SPEC : SH_GLES2_SPEC),
       mOutputType(mImplementation->getTranslatorOutputType()),
       mResources(),
-      mFragmentCompiler(nullptr),
-      mVertexCompiler(nullptr)
+      mWorkerThreadPool(new angle::WorkerThreadPool(angle::WorkerThreadPool::GetDefaultThreadCount()))
 {
     ASSERT(data.clientVersion == 2 || data.clientVersion == 3);
 
@@ -71,22 +78,23 @@ Compiler::~Compiler()
 
 Error Compiler::release()
 {
-    if (mFragmentCompiler)
+    // Resolving a compile removes it from the list and returns its handle.
+    while (!mPendingCompiles.empty())
     {
-        ShDestruct(mFragmentCompiler);
-        mFragmentCompiler = nullptr;
-
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
+        mPendingCompiles.front()->resolveCompile();
     }
 
-    if (mVertexCompiler)
+    for (std::vector<ShHandle> *freeHandles :
+         {&mFreeFragmentCompilers, &mFreeVertexCompilers})
     {
-        ShDestruct(mVertexCompiler);
-        mVertexCompiler = nullptr;
+        for (ShHandle handle : *freeHandles)
+        {
+            ShDestruct(handle);
 
-        ASSERT(activeCompilerHandles > 0);
-        activeCompilerHandles--;
+            ASSERT(activeCompilerHandles > 0);
+            activeCompilerHandles--;
+        }
+        freeHandles->clear();
     }
 
     if (activeCompilerHandles == 0)
@@ -99,36 +107,75 @@ Error Compiler::release()
     return gl::Error(GL_NO_ERROR);
 }
 
-ShHandle Compiler::getCompilerHandle(GLenum type)
+ShHandle Compiler::acquireCompilerHandle(GLenum type)
+{
+    std::vector<ShHandle> *freeHandles = getFreeHandles(type);
+    if (!freeHandles)
+    {
+        return nullptr;
+    }
+
+    if (!freeHandles->empty())
+    {
+        ShHandle handle = freeHandles->back();
+        freeHandles->pop_back();
+        return handle;
+    }
+
+    if (activeCompilerHandles == 0)
+    {
+        ShInitialize();
+    }
+
+    ShHandle handle = ShConstructCompiler(type, mSpec, mOutputType, &mResources);
+    activeCompilerHandles++;
+
+    return handle;
+}
+
+void Compiler::releaseCompilerHandle(GLenum type, ShHandle handle)
+{
+    std::vector<ShHandle> *freeHandles = getFreeHandles(type);
+    ASSERT(freeHandles && handle);
+    freeHandles->push_back(handle);
+}
+
+std::shared_ptr<angle::WaitableEvent> Compiler::postCompileTask(Shader *shader,
+                                                                const std::function<void()> &task)
+{
+    ASSERT(std::find(mPendingCompiles.begin(), mPendingCompiles.end(), shader) ==
+           mPendingCompiles.end());
+
+    if (mPendingCompiles.size() >= kMaxPendingCompiles)
+    {
+        mPendingCompiles.front()->resolveCompile();
+    }
+
+    mPendingCompiles.push_back(shader);
+    return mWorkerThreadPool->postWorkerTask(task);
+}
+
+void Compiler::removePendingCompile(Shader *shader)
+{
+    auto iter = std::find(mPendingCompiles.begin(), mPendingCompiles.end(), shader);
+    ASSERT(iter != mPendingCompiles.end());
+    mPendingCompiles.erase(iter);
+}
+
+std::vector<ShHandle> *Compiler::getFreeHandles(GLenum type)
 {
-    ShHandle *compiler = nullptr;
     switch (type)
     {
         case GL_VERTEX_SHADER:
-            compiler = &mVertexCompiler;
-            break;
+            return &mFreeVertexCompilers;
 
         case GL_FRAGMENT_SHADER:
-            compiler = &mFragmentCompiler;
-            break;
+            return &mFreeFragmentCompilers;
 
         default:
             UNREACHABLE();
             return nullptr;
     }
-
-    if (!(*compiler))
-    {
-        if (activeCompilerHandles == 0)
-        {
-            ShInitialize();
-        }
-
-        *compiler = ShConstructCompiler(type, mSpec, mOutputType, &mResources);
-        activeCompilerHandles++;
-    }
-
-    return *compiler;
 }
 
 }  // namespace gl
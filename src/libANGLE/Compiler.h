@@ -10,9 +10,19 @@
 #ifndef LIBANGLE_COMPILER_H_
 #define LIBANGLE_COMPILER_H_
 
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include "libANGLE/Error.h"
 #include "GLSLANG/ShaderLang.h"
 
+namespace angle
+{
+class WaitableEvent;
+class WorkerThreadPool;
+}
+
 namespace rx
 {
 class CompilerImpl;
@@ -22,6 +32,7 @@ class ImplFactory;
 namespace gl
 {
 struct Data;
+class Shader;
 
 class Compiler final : angle::NonCopyable
 {
@@ -29,19 +40,35 @@ class Compiler final : angle::NonCopyable
     Compiler(rx::ImplFactory *implFactory, const Data &data);
     ~Compiler();
 
+    // Resolves the compiles that are still running before the handles are destroyed.
     Error release();
 
-    ShHandle getCompilerHandle(GLenum type);
+    // Each compile borrows a handle of its own, so that several shaders can be translated at the
+    // same time on the worker threads.
+    ShHandle acquireCompilerHandle(GLenum type);
+    void releaseCompilerHandle(GLenum type, ShHandle handle);
     ShShaderOutput getShaderOutputType() const { return mOutputType; }
 
+    // Runs the translation of a shader on a worker thread. The shader joins it through
+    // Shader::resolveCompile, which must call removePendingCompile.
+    std::shared_ptr<angle::WaitableEvent> postCompileTask(Shader *shader,
+                                                          const std::function<void()> &task);
+    void removePendingCompile(Shader *shader);
+
   private:
+    std::vector<ShHandle> *getFreeHandles(GLenum type);
+
     rx::CompilerImpl *mImplementation;
     ShShaderSpec mSpec;
     ShShaderOutput mOutputType;
     ShBuiltInResources mResources;
 
-    ShHandle mFragmentCompiler;
-    ShHandle mVertexCompiler;
+    std::vector<ShHandle> mFreeFragmentCompilers;
+    std::vector<ShHandle> mFreeVertexCompilers;
+
+    // Shaders whose compile has been posted but not resolved, oldest first.
+    std::vector<Shader *> mPendingCompiles;
+    std::unique_ptr<angle::WorkerThreadPool> mWorkerThreadPool;
 };
 
 }  // namespace gl
@@ -318,7 +318,7 @@ void Context::makeCurrent(egl::Surface *surface)
         {
             mState.setDrawFramebufferBinding(newDefault);
         }
-        mFramebufferMap[0] = newDefault;
+        mFramebufferMap.assign(0, newDefault);
     }
 }
 
@@ -337,7 +337,8 @@ void Context::releaseSurface()
         {
             mState.setDrawFramebufferBinding(nullptr);
         }
-        mFramebufferMap.erase(0);
+        Framebuffer *removedDefault = nullptr;
+        mFramebufferMap.erase(0, &removedDefault);
     }
 
     mCurrentSurface->setIsCurrent(false);
@@ -392,7 +393,7 @@ GLsync Context::createFenceSync()
 GLuint Context::createVertexArray()
 {
     GLuint vertexArray           = mVertexArrayHandleAllocator.allocate();
-    mVertexArrayMap[vertexArray] = nullptr;
+    mVertexArrayMap.assign(vertexArray, nullptr);
     return vertexArray;
 }
 
@@ -404,7 +405,7 @@ GLuint Context::createSampler()
 GLuint Context::createTransformFeedback()
 {
     GLuint transformFeedback                 = mTransformFeedbackAllocator.allocate();
-    mTransformFeedbackMap[transformFeedback] = nullptr;
+    mTransformFeedbackMap.assign(transformFeedback, nullptr);
     return transformFeedback;
 }
 
@@ -413,7 +414,7 @@ GLuint Context::createFramebuffer()
 {
     GLuint handle = mFramebufferHandleAllocator.allocate();
 
-    mFramebufferMap[handle] = NULL;
+    mFramebufferMap.assign(handle, nullptr);
 
     return handle;
 }
@@ -422,7 +423,7 @@ GLuint Context::createFenceNV()
 {
     GLuint handle = mFenceNVHandleAllocator.allocate();
 
-    mFenceNVMap[handle] = new FenceNV(mRenderer->createFenceNV());
+    mFenceNVMap.assign(handle, new FenceNV(mRenderer->createFenceNV()));
 
     return handle;
 }
@@ -432,7 +433,7 @@ GLuint Context::createQuery()
 {
     GLuint handle = mQueryHandleAllocator.allocate();
 
-    mQueryMap[handle] = NULL;
+    mQueryMap.assign(handle, nullptr);
 
     return handle;
 }
@@ -488,17 +489,15 @@ void Context::deleteFenceSync(GLsync fenceSync)
 
 void Context::deleteVertexArray(GLuint vertexArray)
 {
-    auto iter = mVertexArrayMap.find(vertexArray);
-    if (iter != mVertexArrayMap.end())
+    VertexArray *vertexArrayObject = nullptr;
+    if (mVertexArrayMap.erase(vertexArray, &vertexArrayObject))
     {
-        VertexArray *vertexArrayObject = iter->second;
         if (vertexArrayObject != nullptr)
         {
             detachVertexArray(vertexArray);
             delete vertexArrayObject;
         }
 
-        mVertexArrayMap.erase(iter);
         mVertexArrayHandleAllocator.release(vertexArray);
     }
 }
@@ -515,58 +514,52 @@ void Context::deleteSampler(GLuint sampler)
 
 void Context::deleteTransformFeedback(GLuint transformFeedback)
 {
-    auto iter = mTransformFeedbackMap.find(transformFeedback);
-    if (iter != mTransformFeedbackMap.end())
+    TransformFeedback *transformFeedbackObject = nullptr;
+    if (mTransformFeedbackMap.erase(transformFeedback, &transformFeedbackObject))
     {
-        TransformFeedback *transformFeedbackObject = iter->second;
         if (transformFeedbackObject != nullptr)
         {
             detachTransformFeedback(transformFeedback);
             transformFeedbackObject->release();
         }
 
-        mTransformFeedbackMap.erase(iter);
         mTransformFeedbackAllocator.release(transformFeedback);
     }
 }
 
 void Context::deleteFramebuffer(GLuint framebuffer)
 {
-    FramebufferMap::iterator framebufferObject = mFramebufferMap.find(framebuffer);
-
-    if (framebufferObject != mFramebufferMap.end())
+    if (mFramebufferMap.contains(framebuffer))
     {
         detachFramebuffer(framebuffer);
 
-        mFramebufferHandleAllocator.release(framebufferObject->first);
-        delete framebufferObject->second;
-        mFramebufferMap.erase(framebufferObject);
+        Framebuffer *framebufferObject = nullptr;
+        mFramebufferMap.erase(framebuffer, &framebufferObject);
+        mFramebufferHandleAllocator.release(framebuffer);
+        delete framebufferObject;
     }
 }
 
 void Context::deleteFenceNV(GLuint fence)
 {
-    FenceNVMap::iterator fenceObject = mFenceNVMap.find(fence);
-
-    if (fenceObject != mFenceNVMap.end())
+    FenceNV *fenceObject = nullptr;
+    if (mFenceNVMap.erase(fence, &fenceObject))
     {
-        mFenceNVHandleAllocator.release(fenceObject->first);
-        delete fenceObject->second;
-        mFenceNVMap.erase(fenceObject);
+        mFenceNVHandleAllocator.release(fence);
+        delete fenceObject;
     }
 }
 
 void Context::deleteQuery(GLuint query)
 {
-    QueryMap::iterator queryObject = mQueryMap.find(query);
-    if (queryObject != mQueryMap.end())
+    Query *queryObject = nullptr;
+    if (mQueryMap.erase(query, &queryObject))
     {
-        mQueryHandleAllocator.release(queryObject->first);
-        if (queryObject->second)
+        mQueryHandleAllocator.release(query);
+        if (queryObject)
         {
-            queryObject->second->release();
+            queryObject->release();
         }
-        mQueryMap.erase(queryObject);
     }
 }
 
@@ -602,8 +595,7 @@ FenceSync *Context::getFenceSync(GLsync handle) const
 
 VertexArray *Context::getVertexArray(GLuint handle) const
 {
-    auto vertexArray = mVertexArrayMap.find(handle);
-    return (vertexArray != mVertexArrayMap.end()) ? vertexArray->second : nullptr;
+    return mVertexArrayMap.query(handle);
 }
 
 Sampler *Context::getSampler(GLuint handle) const
@@ -613,8 +605,7 @@ Sampler *Context::getSampler(GLuint handle) const
 
 TransformFeedback *Context::getTransformFeedback(GLuint handle) const
 {
-    auto iter = mTransformFeedbackMap.find(handle);
-    return (iter != mTransformFeedbackMap.end()) ? iter->second : nullptr;
+    return mTransformFeedbackMap.query(handle);
 }
 
 LabeledObject *Context::getLabeledObject(GLenum identifier, GLuint name) const
@@ -883,47 +874,34 @@ Error Context::getQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
 
 Framebuffer *Context::getFramebuffer(unsigned int handle) const
 {
-    auto framebufferIt = mFramebufferMap.find(handle);
-    return ((framebufferIt == mFramebufferMap.end()) ? nullptr : framebufferIt->second);
+    return mFramebufferMap.query(handle);
 }
 
 FenceNV *Context::getFenceNV(unsigned int handle)
 {
-    FenceNVMap::iterator fence = mFenceNVMap.find(handle);
-
-    if (fence == mFenceNVMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return fence->second;
-    }
+    return mFenceNVMap.query(handle);
 }
 
 Query *Context::getQuery(unsigned int handle, bool create, GLenum type)
 {
-    QueryMap::iterator query = mQueryMap.find(handle);
-
-    if (query == mQueryMap.end())
+    if (!mQueryMap.contains(handle))
     {
         return NULL;
     }
-    else
+
+    Query *query = mQueryMap.query(handle);
+    if (!query && create)
     {
-        if (!query->second && create)
-        {
-            query->second = new Query(mRenderer->createQuery(type), handle);
-            query->second->addRef();
-        }
-        return query->second;
+        query = new Query(mRenderer->createQuery(type), handle);
+        query->addRef();
+        mQueryMap.assign(handle, query);
     }
+    return query;
 }
 
 Query *Context::getQuery(GLuint handle) const
 {
-    auto iter = mQueryMap.find(handle);
-    return (iter != mQueryMap.end()) ? iter->second : nullptr;
+    return mQueryMap.query(handle);
 }
 
 Texture *Context::getTargetTexture(GLenum target) const
@@ -1633,6 +1611,38 @@ Error Context::drawRangeElements(GLenum mode,
                                         indexRange);
 }
 
+Error Context::multiDrawArrays(GLenum mode,
+                               const GLint *firsts,
+                               const GLsizei *counts,
+                               const GLsizei *instanceCounts,
+                               GLsizei drawcount)
+{
+    syncRendererState();
+    Error error =
+        mRenderer->multiDrawArrays(getData(), mode, firsts, counts, instanceCounts, drawcount);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    MarkTransformFeedbackBufferUsage(mState.getCurrentTransformFeedback());
+
+    return Error(GL_NO_ERROR);
+}
+
+Error Context::multiDrawElements(GLenum mode,
+                                 const GLsizei *counts,
+                                 GLenum type,
+                                 const GLvoid *const *indices,
+                                 const GLsizei *instanceCounts,
+                                 GLsizei drawcount,
+                                 const IndexRange *indexRanges)
+{
+    syncRendererState();
+    return mRenderer->multiDrawElements(getData(), mode, counts, type, indices, instanceCounts,
+                                        drawcount, indexRanges);
+}
+
 Error Context::flush()
 {
     return mRenderer->flush();
@@ -1742,10 +1752,9 @@ EGLenum Context::getClientType() const
 
 EGLenum Context::getRenderBuffer() const
 {
-    auto framebufferIt = mFramebufferMap.find(0);
-    if (framebufferIt != mFramebufferMap.end())
+    const Framebuffer *framebuffer = mFramebufferMap.query(0);
+    if (framebuffer != nullptr)
     {
-        const Framebuffer *framebuffer              = framebufferIt->second;
         const FramebufferAttachment *backAttachment = framebuffer->getAttachment(GL_BACK);
 
         ASSERT(backAttachment != nullptr);
@@ -1764,7 +1773,7 @@ void Context::checkVertexArrayAllocation(GLuint vertexArray)
     {
         VertexArray *vertexArrayObject =
             new VertexArray(mRenderer, vertexArray, MAX_VERTEX_ATTRIBS);
-        mVertexArrayMap[vertexArray] = vertexArrayObject;
+        mVertexArrayMap.assign(vertexArray, vertexArrayObject);
     }
 }
 
@@ -1776,39 +1785,36 @@ void Context::checkTransformFeedbackAllocation(GLuint transformFeedback)
         TransformFeedback *transformFeedbackObject =
             new TransformFeedback(mRenderer->createTransformFeedback(), transformFeedback, mCaps);
         transformFeedbackObject->addRef();
-        mTransformFeedbackMap[transformFeedback] = transformFeedbackObject;
+        mTransformFeedbackMap.assign(transformFeedback, transformFeedbackObject);
     }
 }
 
 Framebuffer *Context::checkFramebufferAllocation(GLuint framebuffer)
 {
     // Can be called from Bind without a prior call to Gen.
-    auto framebufferIt = mFramebufferMap.find(framebuffer);
-    bool neverCreated = framebufferIt == mFramebufferMap.end();
-    if (neverCreated || framebufferIt->second == nullptr)
+    Framebuffer *framebufferObject = mFramebufferMap.query(framebuffer);
+    if (framebufferObject == nullptr)
     {
-        Framebuffer *newFBO = new Framebuffer(mCaps, mRenderer, framebuffer);
-        if (neverCreated)
+        if (!mFramebufferMap.contains(framebuffer))
         {
             mFramebufferHandleAllocator.reserve(framebuffer);
-            mFramebufferMap[framebuffer] = newFBO;
-            return newFBO;
         }
 
-        framebufferIt->second = newFBO;
+        framebufferObject = new Framebuffer(mCaps, mRenderer, framebuffer);
+        mFramebufferMap.assign(framebuffer, framebufferObject);
     }
 
-    return framebufferIt->second;
+    return framebufferObject;
 }
 
 bool Context::isVertexArrayGenerated(GLuint vertexArray)
 {
-    return mVertexArrayMap.find(vertexArray) != mVertexArrayMap.end();
+    return mVertexArrayMap.contains(vertexArray);
 }
 
 bool Context::isTransformFeedbackGenerated(GLuint transformFeedback)
 {
-    return mTransformFeedbackMap.find(transformFeedback) != mTransformFeedbackMap.end();
+    return mTransformFeedbackMap.contains(transformFeedback);
 }
 
 void Context::detachTexture(GLuint texture)
@@ -2055,6 +2061,10 @@ void Context::initCaps(GLuint clientVersion)
     mExtensions.maxDebugGroupStackDepth = 1024;
     mExtensions.maxLabelLength          = 1024;
 
+    // Explicitly enable GL_ANGLE_multi_draw, renderers without native support draw the ranges
+    // one at a time.
+    mExtensions.multiDraw = true;
+
     // Apply implementation limits
     mCaps.maxVertexAttributes = std::min<GLuint>(mCaps.maxVertexAttributes, MAX_VERTEX_ATTRIBS);
     mCaps.maxVertexUniformBlocks = std::min<GLuint>(mCaps.maxVertexUniformBlocks, IMPLEMENTATION_MAX_VERTEX_SHADER_UNIFORM_BUFFERS);
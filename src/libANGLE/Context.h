@@ -17,6 +17,7 @@
 #include "libANGLE/Data.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/HandleAllocator.h"
+#include "libANGLE/ResourceMap.h"
 #include "libANGLE/VertexAttribute.h"
 #include "libANGLE/angletypes.h"
 
@@ -209,6 +210,20 @@ class Context final : public ValidationContext
                             const GLvoid *indices,
                             const IndexRange &indexRange);
 
+    // GL_ANGLE_multi_draw. instanceCounts is nullptr for non-instanced draws.
+    Error multiDrawArrays(GLenum mode,
+                          const GLint *firsts,
+                          const GLsizei *counts,
+                          const GLsizei *instanceCounts,
+                          GLsizei drawcount);
+    Error multiDrawElements(GLenum mode,
+                            const GLsizei *counts,
+                            GLenum type,
+                            const GLvoid *const *indices,
+                            const GLsizei *instanceCounts,
+                            GLsizei drawcount,
+                            const IndexRange *indexRanges);
+
     void blitFramebuffer(GLint srcX0,
                          GLint srcY0,
                          GLint srcX1,
@@ -353,24 +368,19 @@ class Context final : public ValidationContext
 
     TextureMap mZeroTextures;
 
-    typedef std::map<GLuint, Framebuffer*> FramebufferMap;
-    FramebufferMap mFramebufferMap;
+    ResourceMap<Framebuffer> mFramebufferMap;
     HandleAllocator mFramebufferHandleAllocator;
 
-    typedef std::map<GLuint, FenceNV*> FenceNVMap;
-    FenceNVMap mFenceNVMap;
+    ResourceMap<FenceNV> mFenceNVMap;
     HandleAllocator mFenceNVHandleAllocator;
 
-    typedef std::map<GLuint, Query*> QueryMap;
-    QueryMap mQueryMap;
+    ResourceMap<Query> mQueryMap;
     HandleAllocator mQueryHandleAllocator;
 
-    typedef std::map<GLuint, VertexArray*> VertexArrayMap;
-    VertexArrayMap mVertexArrayMap;
+    ResourceMap<VertexArray> mVertexArrayMap;
     HandleAllocator mVertexArrayHandleAllocator;
 
-    typedef std::map<GLuint, TransformFeedback*> TransformFeedbackMap;
-    TransformFeedbackMap mTransformFeedbackMap;
+    ResourceMap<TransformFeedback> mTransformFeedbackMap;
     HandleAllocator mTransformFeedbackAllocator;
 
     std::string mRendererString;
@@ -26,19 +26,6 @@
 namespace gl
 {
 
-namespace
-{
-void DetachMatchingAttachment(FramebufferAttachment *attachment, GLenum matchType, GLuint matchId)
-{
-    if (attachment->isAttached() &&
-        attachment->type() == matchType &&
-        attachment->id() == matchId)
-    {
-        attachment->detach();
-    }
-}
-}
-
 Framebuffer::Data::Data()
     : mLabel(),
       mColorAttachments(1),
@@ -184,6 +171,15 @@ Framebuffer::Framebuffer(rx::SurfaceImpl *surface)
 
 Framebuffer::~Framebuffer()
 {
+    for (FramebufferAttachment &colorAttachment : mData.mColorAttachments)
+    {
+        updateAttachment(&colorAttachment, GL_NONE, GL_NONE, ImageIndex::MakeInvalid(), nullptr);
+    }
+    updateAttachment(&mData.mDepthAttachment, GL_NONE, GL_NONE, ImageIndex::MakeInvalid(),
+                     nullptr);
+    updateAttachment(&mData.mStencilAttachment, GL_NONE, GL_NONE, ImageIndex::MakeInvalid(),
+                     nullptr);
+
     SafeDelete(mImpl);
 }
 
@@ -211,11 +207,23 @@ void Framebuffer::detachResourceById(GLenum resourceType, GLuint resourceId)
 {
     for (auto &colorAttachment : mData.mColorAttachments)
     {
-        DetachMatchingAttachment(&colorAttachment, resourceType, resourceId);
+        detachMatchingAttachment(&colorAttachment, resourceType, resourceId);
     }
 
-    DetachMatchingAttachment(&mData.mDepthAttachment, resourceType, resourceId);
-    DetachMatchingAttachment(&mData.mStencilAttachment, resourceType, resourceId);
+    detachMatchingAttachment(&mData.mDepthAttachment, resourceType, resourceId);
+    detachMatchingAttachment(&mData.mStencilAttachment, resourceType, resourceId);
+}
+
+void Framebuffer::detachMatchingAttachment(FramebufferAttachment *attachment,
+                                           GLenum matchType,
+                                           GLuint matchId)
+{
+    if (attachment->isAttached() &&
+        attachment->type() == matchType &&
+        attachment->id() == matchId)
+    {
+        updateAttachment(attachment, GL_NONE, GL_NONE, ImageIndex::MakeInvalid(), nullptr);
+    }
 }
 
 const FramebufferAttachment *Framebuffer::getColorbuffer(size_t colorAttachment) const
@@ -307,6 +315,7 @@ void Framebuffer::setDrawBuffers(size_t count, const GLenum *buffers)
     std::copy(buffers, buffers + count, drawStates.begin());
     std::fill(drawStates.begin() + count, drawStates.end(), GL_NONE);
     mDirtyBits.set(DIRTY_BIT_DRAW_BUFFERS);
+    mCachedStatus.reset();
 }
 
 const FramebufferAttachment *Framebuffer::getDrawBuffer(size_t drawBuffer) const
@@ -351,6 +360,7 @@ void Framebuffer::setReadBuffer(GLenum buffer)
             (buffer - GL_COLOR_ATTACHMENT0) < mData.mColorAttachments.size()));
     mData.mReadBufferState = buffer;
     mDirtyBits.set(DIRTY_BIT_READ_BUFFER);
+    mCachedStatus.reset();
 }
 
 size_t Framebuffer::getNumColorBuffers() const
@@ -390,6 +400,21 @@ GLenum Framebuffer::checkStatus(const gl::Data &data) const
         return GL_FRAMEBUFFER_COMPLETE;
     }
 
+    if (!mCachedStatus.valid())
+    {
+        mCachedStatus = checkStatusImpl(data);
+    }
+
+    return mCachedStatus.value();
+}
+
+void Framebuffer::onAttachmentChanged()
+{
+    mCachedStatus.reset();
+}
+
+GLenum Framebuffer::checkStatusImpl(const gl::Data &data) const
+{
     unsigned int colorbufferSize = 0;
     int samples = -1;
     bool missingAttachment = true;
@@ -755,8 +780,8 @@ void Framebuffer::setAttachment(GLenum type,
             }
         }
 
-        mData.mDepthAttachment.attach(type, binding, textureIndex, attachmentObj);
-        mData.mStencilAttachment.attach(type, binding, textureIndex, attachmentObj);
+        updateAttachment(&mData.mDepthAttachment, type, binding, textureIndex, attachmentObj);
+        updateAttachment(&mData.mStencilAttachment, type, binding, textureIndex, attachmentObj);
         mDirtyBits.set(DIRTY_BIT_DEPTH_ATTACHMENT);
         mDirtyBits.set(DIRTY_BIT_STENCIL_ATTACHMENT);
     }
@@ -766,23 +791,25 @@ void Framebuffer::setAttachment(GLenum type,
         {
             case GL_DEPTH:
             case GL_DEPTH_ATTACHMENT:
-                mData.mDepthAttachment.attach(type, binding, textureIndex, resource);
+                updateAttachment(&mData.mDepthAttachment, type, binding, textureIndex, resource);
                 mDirtyBits.set(DIRTY_BIT_DEPTH_ATTACHMENT);
             break;
             case GL_STENCIL:
             case GL_STENCIL_ATTACHMENT:
-                mData.mStencilAttachment.attach(type, binding, textureIndex, resource);
+                updateAttachment(&mData.mStencilAttachment, type, binding, textureIndex, resource);
                 mDirtyBits.set(DIRTY_BIT_STENCIL_ATTACHMENT);
             break;
             case GL_BACK:
-                mData.mColorAttachments[0].attach(type, binding, textureIndex, resource);
+                updateAttachment(&mData.mColorAttachments[0], type, binding, textureIndex,
+                                 resource);
                 mDirtyBits.set(DIRTY_BIT_COLOR_ATTACHMENT_0);
             break;
             default:
             {
                 size_t colorIndex = binding - GL_COLOR_ATTACHMENT0;
                 ASSERT(colorIndex < mData.mColorAttachments.size());
-                mData.mColorAttachments[colorIndex].attach(type, binding, textureIndex, resource);
+                updateAttachment(&mData.mColorAttachments[colorIndex], type, binding, textureIndex,
+                                 resource);
                 mDirtyBits.set(DIRTY_BIT_COLOR_ATTACHMENT_0 + colorIndex);
             }
             break;
@@ -790,6 +817,26 @@ void Framebuffer::setAttachment(GLenum type,
     }
 }
 
+void Framebuffer::updateAttachment(FramebufferAttachment *attachment,
+                                   GLenum type,
+                                   GLenum binding,
+                                   const ImageIndex &textureIndex,
+                                   FramebufferAttachmentObject *resource)
+{
+    if (attachment->getResource() != nullptr)
+    {
+        attachment->getResource()->removeObservingFramebuffer(this);
+    }
+
+    attachment->attach(type, binding, textureIndex, resource);
+    if (resource != nullptr)
+    {
+        resource->addObservingFramebuffer(this);
+    }
+
+    mCachedStatus.reset();
+}
+
 void Framebuffer::resetAttachment(GLenum binding)
 {
     setAttachment(GL_NONE, binding, ImageIndex::MakeInvalid(), nullptr);
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "common/angleutils.h"
+#include "common/Optional.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Debug.h"
 #include "libANGLE/Error.h"
@@ -132,9 +133,14 @@ class Framebuffer final : public LabeledObject
     int getSamples(const gl::Data &data) const;
     bool usingExtendedDrawBuffers() const;
 
+    // The status is cached until an attachment, the draw or read buffers, or an attached image
+    // change.
     GLenum checkStatus(const gl::Data &data) const;
     bool hasValidDepthStencil() const;
 
+    // Called by the attached textures and renderbuffers when they are redefined.
+    void onAttachmentChanged();
+
     Error discard(size_t count, const GLenum *attachments);
     Error invalidate(size_t count, const GLenum *attachments);
     Error invalidateSub(size_t count, const GLenum *attachments, const gl::Rectangle &area);
@@ -190,6 +196,15 @@ class Framebuffer final : public LabeledObject
 
   protected:
     void detachResourceById(GLenum resourceType, GLuint resourceId);
+    void detachMatchingAttachment(FramebufferAttachment *attachment,
+                                  GLenum matchType,
+                                  GLuint matchId);
+    void updateAttachment(FramebufferAttachment *attachment,
+                          GLenum type,
+                          GLenum binding,
+                          const ImageIndex &textureIndex,
+                          FramebufferAttachmentObject *resource);
+    GLenum checkStatusImpl(const gl::Data &data) const;
 
     Data mData;
     rx::FramebufferImpl *mImpl;
@@ -197,6 +212,7 @@ class Framebuffer final : public LabeledObject
 
     // TODO(jmadill): See if we can make this non-mutable.
     mutable DirtyBits mDirtyBits;
+    mutable Optional<GLenum> mCachedStatus;
 };
 
 }
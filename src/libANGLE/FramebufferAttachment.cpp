@@ -9,8 +9,11 @@
 
 #include "libANGLE/FramebufferAttachment.h"
 
+#include <algorithm>
+
 #include "common/utilities.h"
 #include "libANGLE/Config.h"
+#include "libANGLE/Framebuffer.h"
 #include "libANGLE/Renderbuffer.h"
 #include "libANGLE/Surface.h"
 #include "libANGLE/Texture.h"
@@ -205,4 +208,27 @@ const egl::Surface *FramebufferAttachment::getSurface() const
     return rx::GetAs<egl::Surface>(mResource);
 }
 
+////// FramebufferAttachmentObject Implementation //////
+
+void FramebufferAttachmentObject::addObservingFramebuffer(Framebuffer *framebuffer)
+{
+    mObservingFramebuffers.push_back(framebuffer);
+}
+
+void FramebufferAttachmentObject::removeObservingFramebuffer(Framebuffer *framebuffer)
+{
+    auto iter =
+        std::find(mObservingFramebuffers.begin(), mObservingFramebuffers.end(), framebuffer);
+    ASSERT(iter != mObservingFramebuffers.end());
+    mObservingFramebuffers.erase(iter);
+}
+
+void FramebufferAttachmentObject::notifyObservingFramebuffers()
+{
+    for (Framebuffer *framebuffer : mObservingFramebuffers)
+    {
+        framebuffer->onAttachmentChanged();
+    }
+}
+
 }
@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_FRAMEBUFFERATTACHMENT_H_
 #define LIBANGLE_FRAMEBUFFERATTACHMENT_H_
 
+#include <vector>
+
 #include "angle_gl.h"
 #include "common/angleutils.h"
 #include "libANGLE/angletypes.h"
@@ -37,6 +39,7 @@ class FramebufferAttachmentObjectImpl;
 
 namespace gl
 {
+class Framebuffer;
 class FramebufferAttachmentObject;
 class Renderbuffer;
 class Texture;
@@ -124,6 +127,7 @@ class FramebufferAttachment final
     Renderbuffer *getRenderbuffer() const;
     Texture *getTexture() const;
     const egl::Surface *getSurface() const;
+    FramebufferAttachmentObject *getResource() const { return mResource; }
 
     // "T" must be static_castable from FramebufferAttachmentRenderTarget
     template <typename T>
@@ -162,8 +166,19 @@ class FramebufferAttachmentObject
     Error getAttachmentRenderTarget(const FramebufferAttachment::Target &target,
                                     rx::FramebufferAttachmentRenderTarget **rtOut) const;
 
+    // The framebuffers this object is attached to cache their completeness, which depends on the
+    // size and format of the object. A framebuffer is added once per attachment point.
+    void addObservingFramebuffer(Framebuffer *framebuffer);
+    void removeObservingFramebuffer(Framebuffer *framebuffer);
+
   protected:
     virtual rx::FramebufferAttachmentObjectImpl *getAttachmentImpl() const = 0;
+
+    // Called when the object is redefined.
+    void notifyObservingFramebuffers();
+
+  private:
+    std::vector<Framebuffer *> mObservingFramebuffers;
 };
 
 inline Extents FramebufferAttachment::getSize() const
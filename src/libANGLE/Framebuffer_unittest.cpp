@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Framebuffer unit tests:
+//   Unit tests for the cached completeness of framebuffers.
+//
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "libANGLE/Data.h"
+#include "libANGLE/Framebuffer.h"
+#include "libANGLE/Renderbuffer.h"
+#include "libANGLE/renderer/FramebufferImpl_mock.h"
+#include "libANGLE/renderer/RenderbufferImpl_mock.h"
+#include "tests/angle_unittests_utils.h"
+
+using namespace gl;
+using namespace rx;
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+
+namespace
+{
+
+class MockFactory : public NullFactory
+{
+  public:
+    MOCK_METHOD1(createFramebuffer, FramebufferImpl *(const gl::Framebuffer::Data &));
+};
+
+class FramebufferStatusTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        mCaps.maxDrawBuffers      = 1;
+        mCaps.maxColorAttachments = 1;
+
+        TextureCaps renderableCaps;
+        renderableCaps.renderable = true;
+        mTextureCaps.insert(GL_RGBA8, renderableCaps);
+
+        mFramebufferImpl = MakeFramebufferMock();
+        EXPECT_CALL(mFactory, createFramebuffer(_)).WillOnce(Return(mFramebufferImpl));
+        mFramebuffer = new Framebuffer(mCaps, &mFactory, 1);
+
+        mRenderbufferImpl = new NiceMock<MockRenderbufferImpl>();
+        ON_CALL(*mRenderbufferImpl, setStorage(_, _, _)).WillByDefault(Return(Error(GL_NO_ERROR)));
+        EXPECT_CALL(*mRenderbufferImpl, destructor()).Times(1).RetiresOnSaturation();
+        mRenderbuffer = new Renderbuffer(mRenderbufferImpl, 1);
+        mRenderbuffer->addRef();
+    }
+
+    void TearDown() override
+    {
+        SafeDelete(mFramebuffer);
+        mRenderbuffer->release();
+    }
+
+    GLenum checkStatus()
+    {
+        Data data(0, 2, mState, mCaps, mTextureCaps, mExtensions, nullptr, mLimitations);
+        return mFramebuffer->checkStatus(data);
+    }
+
+    NiceMock<MockFactory> mFactory;
+    State mState;
+    Caps mCaps;
+    TextureCapsMap mTextureCaps;
+    Extensions mExtensions;
+    Limitations mLimitations;
+
+    NiceMock<MockFramebufferImpl> *mFramebufferImpl;
+    Framebuffer *mFramebuffer;
+    NiceMock<MockRenderbufferImpl> *mRenderbufferImpl;
+    Renderbuffer *mRenderbuffer;
+};
+
+// Test that the status is computed once while nothing changes.
+TEST_F(FramebufferStatusTest, StatusIsCached)
+{
+    mRenderbuffer->setStorage(GL_RGBA8, 4, 4);
+    mFramebuffer->setAttachment(GL_RENDERBUFFER, GL_COLOR_ATTACHMENT0, ImageIndex::MakeInvalid(),
+                                mRenderbuffer);
+
+    EXPECT_CALL(*mFramebufferImpl, checkStatus()).Times(1).WillOnce(Return(true));
+    EXPECT_EQ(static_cast<GLenum>(GL_FRAMEBUFFER_COMPLETE), checkStatus());
+    EXPECT_EQ(static_cast<GLenum>(GL_FRAMEBUFFER_COMPLETE), checkStatus());
+}
+
+// Test that redefining an attached renderbuffer recomputes the status.
+TEST_F(FramebufferStatusTest, RedefinedAttachmentInvalidatesStatus)
+{
+    mRenderbuffer->setStorage(GL_RGBA8, 0, 0);
+    mFramebuffer->setAttachment(GL_RENDERBUFFER, GL_COLOR_ATTACHMENT0, ImageIndex::MakeInvalid(),
+                                mRenderbuffer);
+    EXPECT_EQ(static_cast<GLenum>(GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT), checkStatus());
+
+    mRenderbuffer->setStorage(GL_RGBA8, 4, 4);
+    EXPECT_EQ(static_cast<GLenum>(GL_FRAMEBUFFER_COMPLETE), checkStatus());
+}
+
+// Test that detaching the renderbuffer recomputes the status, and that the detached renderbuffer
+// no longer notifies the framebuffer.
+TEST_F(FramebufferStatusTest, DetachInvalidatesStatus)
+{
+    mRenderbuffer->setStorage(GL_RGBA8, 4, 4);
+    mFramebuffer->setAttachment(GL_RENDERBUFFER, GL_COLOR_ATTACHMENT0, ImageIndex::MakeInvalid(),
+                                mRenderbuffer);
+    EXPECT_EQ(static_cast<GLenum>(GL_FRAMEBUFFER_COMPLETE), checkStatus());
+
+    mFramebuffer->detachRenderbuffer(mRenderbuffer->id());
+    EXPECT_EQ(static_cast<GLenum>(GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT), checkStatus());
+
+    EXPECT_CALL(*mFramebufferImpl, checkStatus()).Times(0);
+    mRenderbuffer->setStorage(GL_RGBA8, 8, 8);
+    EXPECT_EQ(static_cast<GLenum>(GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT), checkStatus());
+}
+
+}  // anonymous namespace
@@ -10,11 +10,59 @@
 #include "libANGLE/IndexRangeCache.h"
 
 #include "common/debug.h"
+#include "common/utilities.h"
 #include "libANGLE/formatutils.h"
 
 namespace gl
 {
 
+namespace
+{
+
+// The size of the blocks of the buffer whose ranges are cached, a multiple of every index size.
+const size_t kBlockSize = 8192;
+
+size_t GetIndexTypeSlot(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return 0;
+        case GL_UNSIGNED_SHORT:
+            return 1;
+        case GL_UNSIGNED_INT:
+            return 2;
+        default:
+            UNREACHABLE();
+            return 0;
+    }
+}
+
+IndexRange CombineIndexRanges(const IndexRange &a, const IndexRange &b)
+{
+    if (a.vertexIndexCount == 0)
+    {
+        return b;
+    }
+    if (b.vertexIndexCount == 0)
+    {
+        return a;
+    }
+
+    return IndexRange(std::min(a.start, b.start), std::max(a.end, b.end),
+                      a.vertexIndexCount + b.vertexIndexCount);
+}
+
+}  // anonymous namespace
+
+IndexRangeCache::IndexRangeCache() : mMaxRangeBytes(0)
+{
+}
+
+IndexRangeCache::~IndexRangeCache()
+{
+}
+
 void IndexRangeCache::addRange(GLenum type,
                                size_t offset,
                                size_t count,
@@ -22,6 +70,7 @@ void IndexRangeCache::addRange(GLenum type,
                                const IndexRange &range)
 {
     mIndexRangeCache[IndexRangeKey(type, offset, count, primitiveRestartEnabled)] = range;
+    mMaxRangeBytes = std::max(mMaxRangeBytes, GetTypeInfo(type).bytes * count);
 }
 
 bool IndexRangeCache::findRange(GLenum type,
@@ -49,13 +98,80 @@ bool IndexRangeCache::findRange(GLenum type,
     }
 }
 
+IndexRange IndexRangeCache::computeRange(GLenum type,
+                                         size_t offset,
+                                         size_t count,
+                                         bool primitiveRestartEnabled,
+                                         const uint8_t *data,
+                                         size_t dataSize)
+{
+    const Type &typeInfo = GetTypeInfo(type);
+    size_t end           = offset + count * typeInfo.bytes;
+    ASSERT(end <= dataSize);
+
+    if (count == 0)
+    {
+        return IndexRange();
+    }
+
+    // Only indices aligned to their size line up with the blocks.
+    size_t firstBlock = (offset + kBlockSize - 1) / kBlockSize;
+    size_t endBlock   = end / kBlockSize;
+    if (offset % typeInfo.bytes != 0 || firstBlock >= endBlock)
+    {
+        return ComputeIndexRange(type, data + offset, count, primitiveRestartEnabled);
+    }
+
+    BlockRangeTree &tree =
+        mBlockRangeTrees[GetIndexTypeSlot(type)][primitiveRestartEnabled ? 1 : 0];
+    if (tree.getBlockCount() != dataSize / kBlockSize)
+    {
+        tree.reset(dataSize / kBlockSize);
+    }
+
+    size_t blocksBegin = firstBlock * kBlockSize;
+    size_t blocksEnd   = endBlock * kBlockSize;
+
+    IndexRange range = tree.query(type, primitiveRestartEnabled, data, firstBlock, endBlock);
+    if (offset < blocksBegin)
+    {
+        range = CombineIndexRanges(
+            range, ComputeIndexRange(type, data + offset, (blocksBegin - offset) / typeInfo.bytes,
+                                     primitiveRestartEnabled));
+    }
+    if (blocksEnd < end)
+    {
+        range = CombineIndexRanges(
+            range, ComputeIndexRange(type, data + blocksEnd, (end - blocksEnd) / typeInfo.bytes,
+                                     primitiveRestartEnabled));
+    }
+    return range;
+}
+
 void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 {
+    if (size > 0)
+    {
+        size_t firstBlock = offset / kBlockSize;
+        size_t endBlock   = (offset + size + kBlockSize - 1) / kBlockSize;
+        for (auto &typeTrees : mBlockRangeTrees)
+        {
+            for (BlockRangeTree &tree : typeTrees)
+            {
+                tree.invalidate(firstBlock, std::min(endBlock, tree.getBlockCount()));
+            }
+        }
+    }
+
     size_t invalidateStart = offset;
     size_t invalidateEnd   = offset + size;
 
-    auto i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+    // Keys are ordered by offset, and the smallest key with an offset compares below any other key
+    // with the same offset.
+    size_t windowStart = invalidateStart > mMaxRangeBytes ? invalidateStart - mMaxRangeBytes : 0;
+    auto i   = mIndexRangeCache.lower_bound(IndexRangeKey(0, windowStart, 0, false));
+    auto end = mIndexRangeCache.lower_bound(IndexRangeKey(0, invalidateEnd + 1, 0, false));
+    while (i != end)
     {
         size_t rangeStart = i->first.offset;
         size_t rangeEnd   = i->first.offset + (GetTypeInfo(i->first.type).bytes * i->first.count);
@@ -74,6 +190,15 @@ void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 void IndexRangeCache::clear()
 {
     mIndexRangeCache.clear();
+    mMaxRangeBytes = 0;
+
+    for (auto &typeTrees : mBlockRangeTrees)
+    {
+        for (BlockRangeTree &tree : typeTrees)
+        {
+            tree.reset(0);
+        }
+    }
 }
 
 IndexRangeCache::IndexRangeKey::IndexRangeKey()
@@ -91,14 +216,14 @@ IndexRangeCache::IndexRangeKey::IndexRangeKey(GLenum type_,
 
 bool IndexRangeCache::IndexRangeKey::operator<(const IndexRangeKey &rhs) const
 {
-    if (type != rhs.type)
-    {
-        return type < rhs.type;
-    }
     if (offset != rhs.offset)
     {
         return offset < rhs.offset;
     }
+    if (type != rhs.type)
+    {
+        return type < rhs.type;
+    }
     if (count != rhs.count)
     {
         return count < rhs.count;
@@ -110,4 +235,115 @@ bool IndexRangeCache::IndexRangeKey::operator<(const IndexRangeKey &rhs) const
     return false;
 }
 
+IndexRangeCache::BlockRangeTree::BlockRangeTree() : mBlockCount(0), mLeafCount(0)
+{
+}
+
+void IndexRangeCache::BlockRangeTree::reset(size_t blockCount)
+{
+    mBlockCount = blockCount;
+    mLeafCount  = 1;
+    while (mLeafCount < blockCount)
+    {
+        mLeafCount *= 2;
+    }
+
+    if (blockCount == 0)
+    {
+        mLeafCount = 0;
+    }
+
+    mRanges.assign(mLeafCount * 2, IndexRange());
+    mValid.assign(mLeafCount * 2, false);
+}
+
+size_t IndexRangeCache::BlockRangeTree::getBlockCount() const
+{
+    return mBlockCount;
+}
+
+IndexRange IndexRangeCache::BlockRangeTree::query(GLenum type,
+                                                  bool primitiveRestartEnabled,
+                                                  const uint8_t *data,
+                                                  size_t firstBlock,
+                                                  size_t endBlock)
+{
+    ASSERT(firstBlock < endBlock && endBlock <= mBlockCount);
+    return queryNode(1, 0, mLeafCount, type, primitiveRestartEnabled, data, firstBlock, endBlock);
+}
+
+void IndexRangeCache::BlockRangeTree::invalidate(size_t firstBlock, size_t endBlock)
+{
+    if (firstBlock < endBlock)
+    {
+        invalidateNode(1, 0, mLeafCount, firstBlock, endBlock);
+    }
+}
+
+IndexRange IndexRangeCache::BlockRangeTree::queryNode(size_t node,
+                                                      size_t nodeBegin,
+                                                      size_t nodeEnd,
+                                                      GLenum type,
+                                                      bool primitiveRestartEnabled,
+                                                      const uint8_t *data,
+                                                      size_t firstBlock,
+                                                      size_t endBlock)
+{
+    if (nodeEnd <= firstBlock || nodeBegin >= endBlock)
+    {
+        return IndexRange();
+    }
+
+    bool covered = firstBlock <= nodeBegin && nodeEnd <= endBlock;
+    if (covered && mValid[node])
+    {
+        return mRanges[node];
+    }
+
+    IndexRange range;
+    if (nodeEnd - nodeBegin == 1)
+    {
+        size_t indexSize = GetTypeInfo(type).bytes;
+        range = ComputeIndexRange(type, data + nodeBegin * kBlockSize, kBlockSize / indexSize,
+                                  primitiveRestartEnabled);
+    }
+    else
+    {
+        size_t nodeMiddle = nodeBegin + (nodeEnd - nodeBegin) / 2;
+        range = CombineIndexRanges(queryNode(node * 2, nodeBegin, nodeMiddle, type,
+                                             primitiveRestartEnabled, data, firstBlock, endBlock),
+                                   queryNode(node * 2 + 1, nodeMiddle, nodeEnd, type,
+                                             primitiveRestartEnabled, data, firstBlock, endBlock));
+    }
+
+    // Every block under a covered node was visited, so its range is complete.
+    if (covered)
+    {
+        mRanges[node] = range;
+        mValid[node]  = true;
+    }
+
+    return range;
+}
+
+void IndexRangeCache::BlockRangeTree::invalidateNode(size_t node,
+                                                     size_t nodeBegin,
+                                                     size_t nodeEnd,
+                                                     size_t firstBlock,
+                                                     size_t endBlock)
+{
+    if (nodeEnd <= firstBlock || nodeBegin >= endBlock)
+    {
+        return;
+    }
+
+    mValid[node] = false;
+    if (nodeEnd - nodeBegin > 1)
+    {
+        size_t nodeMiddle = nodeBegin + (nodeEnd - nodeBegin) / 2;
+        invalidateNode(node * 2, nodeBegin, nodeMiddle, firstBlock, endBlock);
+        invalidateNode(node * 2 + 1, nodeMiddle, nodeEnd, firstBlock, endBlock);
+    }
+}
+
 }
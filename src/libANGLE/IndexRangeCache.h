@@ -16,6 +16,7 @@
 #include "angle_gl.h"
 
 #include <map>
+#include <vector>
 
 namespace gl
 {
@@ -23,6 +24,9 @@ namespace gl
 class IndexRangeCache
 {
   public:
+    IndexRangeCache();
+    ~IndexRangeCache();
+
     void addRange(GLenum type,
                   size_t offset,
                   size_t count,
@@ -34,10 +38,22 @@ class IndexRangeCache
                    bool primitiveRestartEnabled,
                    IndexRange *outRange) const;
 
+    // Computes the range of count indices at offset in data, the contents of the buffer of
+    // dataSize bytes. The ranges of the fixed size blocks the indices cover are cached, so only the
+    // blocks invalidated since they were last computed and the indices outside of whole blocks are
+    // read again.
+    IndexRange computeRange(GLenum type,
+                            size_t offset,
+                            size_t count,
+                            bool primitiveRestartEnabled,
+                            const uint8_t *data,
+                            size_t dataSize);
+
     void invalidateRange(size_t offset, size_t size);
     void clear();
 
   private:
+    // Ordered by offset first, so that the ranges overlapping a write are found around it.
     struct IndexRangeKey
     {
         IndexRangeKey();
@@ -53,6 +69,55 @@ class IndexRangeCache
 
     typedef std::map<IndexRangeKey, IndexRange> IndexRangeMap;
     IndexRangeMap mIndexRangeCache;
+
+    // The size in bytes of the largest range in mIndexRangeCache. Only the ranges starting less
+    // than that far before an invalidated range can overlap it.
+    size_t mMaxRangeBytes;
+
+    // Segment tree of the ranges of the blocks of a buffer, for one index type with primitive
+    // restart enabled or disabled. An invalid node has an invalid block under it.
+    class BlockRangeTree
+    {
+      public:
+        BlockRangeTree();
+
+        void reset(size_t blockCount);
+        size_t getBlockCount() const;
+
+        // Returns the range of the blocks in [firstBlock, endBlock), computing the invalid ones
+        // from data.
+        IndexRange query(GLenum type,
+                         bool primitiveRestartEnabled,
+                         const uint8_t *data,
+                         size_t firstBlock,
+                         size_t endBlock);
+        void invalidate(size_t firstBlock, size_t endBlock);
+
+      private:
+        IndexRange queryNode(size_t node,
+                             size_t nodeBegin,
+                             size_t nodeEnd,
+                             GLenum type,
+                             bool primitiveRestartEnabled,
+                             const uint8_t *data,
+                             size_t firstBlock,
+                             size_t endBlock);
+        void invalidateNode(size_t node,
+                            size_t nodeBegin,
+                            size_t nodeEnd,
+                            size_t firstBlock,
+                            size_t endBlock);
+
+        size_t mBlockCount;
+        size_t mLeafCount;
+
+        // The nodes are stored like a binary heap, the children of node i are 2i and 2i + 1.
+        std::vector<IndexRange> mRanges;
+        std::vector<bool> mValid;
+    };
+
+    // Indexed by the index type and by whether primitive restart is enabled.
+    BlockRangeTree mBlockRangeTrees[3][2];
 };
 
 }
@@ -0,0 +1,179 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Unit tests for IndexRangeCache.
+//
+
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "common/utilities.h"
+#include "libANGLE/IndexRangeCache.h"
+
+namespace
+{
+
+const GLenum kIndexTypes[] = {GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT};
+
+size_t GetIndexSize(GLenum type)
+{
+    return type == GL_UNSIGNED_BYTE ? 1 : (type == GL_UNSIGNED_SHORT ? 2 : 4);
+}
+
+class IndexRangeCacheTest : public testing::Test
+{
+  protected:
+    IndexRangeCacheTest() : mSeed(1) {}
+
+    unsigned int random()
+    {
+        mSeed = mSeed * 1103515245u + 12345u;
+        return mSeed >> 8;
+    }
+
+    // Fills the data with random bytes, with runs of 0xFF making primitive restart indices.
+    void fill(size_t offset, size_t size)
+    {
+        for (size_t i = offset; i < offset + size; i++)
+        {
+            mData[i] = (random() % 8 == 0) ? 0xFF : static_cast<uint8_t>(random());
+        }
+    }
+
+    void expectRange(GLenum type, size_t offset, size_t count, bool primitiveRestartEnabled)
+    {
+        SCOPED_TRACE(testing::Message() << "type " << type << " offset " << offset << " count "
+                                        << count << " restart " << primitiveRestartEnabled);
+
+        gl::IndexRange expected;
+        if (count > 0)
+        {
+            expected =
+                gl::ComputeIndexRange(type, mData.data() + offset, count, primitiveRestartEnabled);
+        }
+        gl::IndexRange actual = mCache.computeRange(type, offset, count, primitiveRestartEnabled,
+                                                    mData.data(), mData.size());
+        EXPECT_EQ(expected.start, actual.start);
+        EXPECT_EQ(expected.end, actual.end);
+        EXPECT_EQ(expected.vertexIndexCount, actual.vertexIndexCount);
+    }
+
+    void expectRandomRanges(size_t queryCount)
+    {
+        for (size_t query = 0; query < queryCount; query++)
+        {
+            GLenum type      = kIndexTypes[random() % 3];
+            size_t indexSize = GetIndexSize(type);
+            size_t offset    = (random() % mData.size()) & ~(indexSize - 1);
+            size_t count     = random() % ((mData.size() - offset) / indexSize + 1);
+            expectRange(type, offset, count, random() % 2 == 0);
+        }
+    }
+
+    unsigned int mSeed;
+    std::vector<uint8_t> mData;
+    gl::IndexRangeCache mCache;
+};
+
+// Test that the ranges composed from the cached blocks match the ranges of the indices.
+TEST_F(IndexRangeCacheTest, ComputeRange)
+{
+    mData.resize(100003);
+    fill(0, mData.size());
+
+    expectRandomRanges(500);
+
+    // Whole buffer, unaligned and empty ranges.
+    for (GLenum type : kIndexTypes)
+    {
+        for (bool restart : {false, true})
+        {
+            expectRange(type, 0, mData.size() / GetIndexSize(type), restart);
+            expectRange(type, 1, (mData.size() - 1) / GetIndexSize(type), restart);
+            expectRange(type, 8192, 0, restart);
+        }
+    }
+}
+
+// Test that writes to part of the buffer only need the touched blocks to be invalidated.
+TEST_F(IndexRangeCacheTest, InvalidateRange)
+{
+    mData.assign(65536, 0x10);
+    size_t count = mData.size() / 2;
+
+    gl::IndexRange range =
+        mCache.computeRange(GL_UNSIGNED_SHORT, 0, count, false, mData.data(), mData.size());
+    EXPECT_EQ(0x1010u, range.end);
+
+    // The blocks aren't read again until they are invalidated.
+    mData[30000] = 0x20;
+    range = mCache.computeRange(GL_UNSIGNED_SHORT, 0, count, false, mData.data(), mData.size());
+    EXPECT_EQ(0x1010u, range.end);
+
+    mCache.invalidateRange(30000, 1);
+    range = mCache.computeRange(GL_UNSIGNED_SHORT, 0, count, false, mData.data(), mData.size());
+    EXPECT_EQ(0x1020u, range.end);
+
+    // Sub data updates of small slices of the buffer.
+    for (size_t update = 0; update < 200; update++)
+    {
+        size_t offset = random() % mData.size();
+        size_t size   = std::min<size_t>(random() % 64 + 1, mData.size() - offset);
+        fill(offset, size);
+        mCache.invalidateRange(offset, size);
+        expectRandomRanges(5);
+        for (GLenum type : kIndexTypes)
+        {
+            expectRange(type, 0, mData.size() / GetIndexSize(type), true);
+        }
+    }
+}
+
+// Test that invalidating a range only drops the cached draw ranges that overlap it.
+TEST_F(IndexRangeCacheTest, InvalidateDrawRanges)
+{
+    gl::IndexRange range(0, 10, 5);
+    mCache.addRange(GL_UNSIGNED_INT, 0, 1000, false, range);
+    mCache.addRange(GL_UNSIGNED_SHORT, 6000, 10, true, range);
+    mCache.addRange(GL_UNSIGNED_BYTE, 8000, 100, false, range);
+
+    // Overlaps the end of the first range only, which starts well before it.
+    mCache.invalidateRange(3990, 20);
+    EXPECT_FALSE(mCache.findRange(GL_UNSIGNED_INT, 0, 1000, false, nullptr));
+    EXPECT_TRUE(mCache.findRange(GL_UNSIGNED_SHORT, 6000, 10, true, nullptr));
+    EXPECT_TRUE(mCache.findRange(GL_UNSIGNED_BYTE, 8000, 100, false, nullptr));
+
+    // Between the ranges.
+    mCache.invalidateRange(6030, 100);
+    EXPECT_TRUE(mCache.findRange(GL_UNSIGNED_SHORT, 6000, 10, true, nullptr));
+    EXPECT_TRUE(mCache.findRange(GL_UNSIGNED_BYTE, 8000, 100, false, nullptr));
+
+    // Touching the end of a range and the start of the next one.
+    mCache.invalidateRange(6020, 7980);
+    EXPECT_FALSE(mCache.findRange(GL_UNSIGNED_SHORT, 6000, 10, true, nullptr));
+    EXPECT_FALSE(mCache.findRange(GL_UNSIGNED_BYTE, 8000, 100, false, nullptr));
+}
+
+// Test that clearing the cache handles the buffer being resized.
+TEST_F(IndexRangeCacheTest, Clear)
+{
+    mData.resize(40000);
+    fill(0, mData.size());
+    expectRandomRanges(50);
+
+    mData.resize(90000);
+    fill(0, mData.size());
+    mCache.clear();
+    expectRandomRanges(50);
+
+    mData.resize(20000);
+    fill(0, mData.size());
+    mCache.clear();
+    expectRandomRanges(50);
+}
+
+}  // anonymous namespace
@@ -18,6 +18,7 @@
 #include "common/version.h"
 #include "compiler/translator/blocklayout.h"
 #include "libANGLE/Data.h"
+#include "libANGLE/ProgramCache.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/features.h"
 #include "libANGLE/renderer/Renderer.h"
@@ -431,6 +432,7 @@ Error Program::link(const gl::Data &data)
     mInfoLog.reset();
     resetUniformBlockBindings();
 
+    // Checking the compile status joins the translations that are still running.
     if (!mData.mAttachedFragmentShader || !mData.mAttachedFragmentShader->isCompiled())
     {
         return Error(GL_NO_ERROR);
@@ -443,6 +445,35 @@ Error Program::link(const gl::Data &data)
     }
     ASSERT(mData.mAttachedVertexShader->getType() == GL_VERTEX_SHADER);
 
+#if ANGLE_PROGRAM_CACHE == ANGLE_ENABLED && ANGLE_PROGRAM_BINARY_LOAD == ANGLE_ENABLED
+    // Only renderers that can save and load binaries take part in the cache.
+    ProgramCache *programCache =
+        data.extensions->getProgramBinary ? ProgramCache::GetInstance() : nullptr;
+#else
+    ProgramCache *programCache = nullptr;
+#endif
+
+    std::string programCacheKey;
+    if (programCache)
+    {
+        programCacheKey = makeProgramCacheKey(data);
+
+        std::vector<uint8_t> binary;
+        if (programCache->get(programCacheKey, &binary))
+        {
+            Error error = loadBinary(GL_PROGRAM_BINARY_ANGLE, binary.data(),
+                                     static_cast<GLsizei>(binary.size()));
+            if (error.isError() || mLinked)
+            {
+                return error;
+            }
+
+            // The binary was made by another build or device; link again and replace it.
+            mInfoLog.reset();
+            resetUniformBlockBindings();
+        }
+    }
+
     if (!linkAttributes(data, mInfoLog, mAttributeBindings, mData.mAttachedVertexShader))
     {
         return Error(GL_NO_ERROR);
@@ -482,9 +513,76 @@ Error Program::link(const gl::Data &data)
     gatherInterfaceBlockInfo();
 
     mLinked = true;
+
+    if (programCache)
+    {
+        BinaryOutputStream stream;
+        if (!saveBinaryToStream(&stream).isError())
+        {
+            const uint8_t *streamData = static_cast<const uint8_t *>(stream.data());
+            programCache->put(programCacheKey,
+                              std::vector<uint8_t>(streamData, streamData + stream.length()));
+        }
+    }
+
     return gl::Error(GL_NO_ERROR);
 }
 
+std::string Program::makeProgramCacheKey(const gl::Data &data) const
+{
+    BinaryOutputStream stream;
+
+    stream.writeInt(data.clientVersion);
+    const Caps &caps = *data.caps;
+    stream.writeInt(caps.maxVertexAttributes);
+    stream.writeInt(caps.maxVertexUniformVectors);
+    stream.writeInt(caps.maxFragmentUniformVectors);
+    stream.writeInt(caps.maxVaryingVectors);
+    stream.writeInt(caps.maxVertexTextureImageUnits);
+    stream.writeInt(caps.maxTextureImageUnits);
+    stream.writeInt(caps.maxCombinedTextureImageUnits);
+    stream.writeInt(caps.maxVertexUniformBlocks);
+    stream.writeInt(caps.maxFragmentUniformBlocks);
+    stream.writeInt(caps.maxCombinedUniformBlocks);
+    stream.writeInt(caps.maxUniformBufferBindings);
+    stream.writeInt(caps.maxTransformFeedbackInterleavedComponents);
+    stream.writeInt(caps.maxTransformFeedbackSeparateAttributes);
+    stream.writeInt(caps.maxTransformFeedbackSeparateComponents);
+    stream.writeInt(caps.maxDrawBuffers);
+
+    for (const Shader *shader : {mData.mAttachedVertexShader, mData.mAttachedFragmentShader})
+    {
+        ASSERT(shader);
+        stream.writeInt(shader->getShaderVersion());
+        stream.writeString(shader->getTranslatedSource());
+    }
+
+    for (GLuint location = 0; location < MAX_VERTEX_ATTRIBS; ++location)
+    {
+        const std::set<std::string> &names = mAttributeBindings.getBoundNames(location);
+        stream.writeInt(names.size());
+        for (const std::string &name : names)
+        {
+            stream.writeString(name);
+        }
+    }
+
+    stream.writeInt(mData.mTransformFeedbackVaryingNames.size());
+    for (const std::string &name : mData.mTransformFeedbackVaryingNames)
+    {
+        stream.writeString(name);
+    }
+    stream.writeInt(mData.mTransformFeedbackBufferMode);
+
+    return std::string(static_cast<const char *>(stream.data()), stream.length());
+}
+
+const std::set<std::string> &AttributeBindings::getBoundNames(GLuint index) const
+{
+    ASSERT(index < MAX_VERTEX_ATTRIBS);
+    return mAttributeBinding[index];
+}
+
 int AttributeBindings::getAttributeBinding(const std::string &name) const
 {
     for (int location = 0; location < MAX_VERTEX_ATTRIBS; location++)
@@ -680,83 +778,7 @@ Error Program::saveBinary(GLenum *binaryFormat, void *binary, GLsizei bufSize, G
     }
 
     BinaryOutputStream stream;
-
-    stream.writeInt(ANGLE_MAJOR_VERSION);
-    stream.writeInt(ANGLE_MINOR_VERSION);
-    stream.writeBytes(reinterpret_cast<const unsigned char*>(ANGLE_COMMIT_HASH), ANGLE_COMMIT_HASH_SIZE);
-
-    stream.writeInt(mData.mActiveAttribLocationsMask.to_ulong());
-
-    stream.writeInt(mData.mAttributes.size());
-    for (const sh::Attribute &attrib : mData.mAttributes)
-    {
-        WriteShaderVar(&stream, attrib);
-        stream.writeInt(attrib.location);
-    }
-
-    stream.writeInt(mData.mUniforms.size());
-    for (const gl::LinkedUniform &uniform : mData.mUniforms)
-    {
-        WriteShaderVar(&stream, uniform);
-
-        // FIXME: referenced
-
-        stream.writeInt(uniform.blockIndex);
-        stream.writeInt(uniform.blockInfo.offset);
-        stream.writeInt(uniform.blockInfo.arrayStride);
-        stream.writeInt(uniform.blockInfo.matrixStride);
-        stream.writeInt(uniform.blockInfo.isRowMajorMatrix);
-    }
-
-    stream.writeInt(mData.mUniformLocations.size());
-    for (const auto &variable : mData.mUniformLocations)
-    {
-        stream.writeString(variable.name);
-        stream.writeInt(variable.element);
-        stream.writeInt(variable.index);
-    }
-
-    stream.writeInt(mData.mUniformBlocks.size());
-    for (const UniformBlock &uniformBlock : mData.mUniformBlocks)
-    {
-        stream.writeString(uniformBlock.name);
-        stream.writeInt(uniformBlock.isArray);
-        stream.writeInt(uniformBlock.arrayElement);
-        stream.writeInt(uniformBlock.dataSize);
-
-        stream.writeInt(uniformBlock.vertexStaticUse);
-        stream.writeInt(uniformBlock.fragmentStaticUse);
-
-        stream.writeInt(uniformBlock.memberUniformIndexes.size());
-        for (unsigned int memberUniformIndex : uniformBlock.memberUniformIndexes)
-        {
-            stream.writeInt(memberUniformIndex);
-        }
-    }
-
-    stream.writeInt(mData.mTransformFeedbackVaryingVars.size());
-    for (const sh::Varying &varying : mData.mTransformFeedbackVaryingVars)
-    {
-        stream.writeInt(varying.arraySize);
-        stream.writeInt(varying.type);
-        stream.writeString(varying.name);
-    }
-
-    stream.writeInt(mData.mTransformFeedbackBufferMode);
-
-    stream.writeInt(mData.mOutputVariables.size());
-    for (const auto &outputPair : mData.mOutputVariables)
-    {
-        stream.writeInt(outputPair.first);
-        stream.writeInt(outputPair.second.element);
-        stream.writeInt(outputPair.second.index);
-        stream.writeString(outputPair.second.name);
-    }
-
-    stream.writeInt(mSamplerUniformRange.start);
-    stream.writeInt(mSamplerUniformRange.end);
-
-    gl::Error error = mProgram->save(&stream);
+    Error error = saveBinaryToStream(&stream);
     if (error.isError())
     {
         return error;
@@ -796,6 +818,86 @@ Error Program::saveBinary(GLenum *binaryFormat, void *binary, GLsizei bufSize, G
     return Error(GL_NO_ERROR);
 }
 
+Error Program::saveBinaryToStream(BinaryOutputStream *stream) const
+{
+    stream->writeInt(ANGLE_MAJOR_VERSION);
+    stream->writeInt(ANGLE_MINOR_VERSION);
+    stream->writeBytes(reinterpret_cast<const unsigned char*>(ANGLE_COMMIT_HASH), ANGLE_COMMIT_HASH_SIZE);
+
+    stream->writeInt(mData.mActiveAttribLocationsMask.to_ulong());
+
+    stream->writeInt(mData.mAttributes.size());
+    for (const sh::Attribute &attrib : mData.mAttributes)
+    {
+        WriteShaderVar(stream, attrib);
+        stream->writeInt(attrib.location);
+    }
+
+    stream->writeInt(mData.mUniforms.size());
+    for (const gl::LinkedUniform &uniform : mData.mUniforms)
+    {
+        WriteShaderVar(stream, uniform);
+
+        // FIXME: referenced
+
+        stream->writeInt(uniform.blockIndex);
+        stream->writeInt(uniform.blockInfo.offset);
+        stream->writeInt(uniform.blockInfo.arrayStride);
+        stream->writeInt(uniform.blockInfo.matrixStride);
+        stream->writeInt(uniform.blockInfo.isRowMajorMatrix);
+    }
+
+    stream->writeInt(mData.mUniformLocations.size());
+    for (const auto &variable : mData.mUniformLocations)
+    {
+        stream->writeString(variable.name);
+        stream->writeInt(variable.element);
+        stream->writeInt(variable.index);
+    }
+
+    stream->writeInt(mData.mUniformBlocks.size());
+    for (const UniformBlock &uniformBlock : mData.mUniformBlocks)
+    {
+        stream->writeString(uniformBlock.name);
+        stream->writeInt(uniformBlock.isArray);
+        stream->writeInt(uniformBlock.arrayElement);
+        stream->writeInt(uniformBlock.dataSize);
+
+        stream->writeInt(uniformBlock.vertexStaticUse);
+        stream->writeInt(uniformBlock.fragmentStaticUse);
+
+        stream->writeInt(uniformBlock.memberUniformIndexes.size());
+        for (unsigned int memberUniformIndex : uniformBlock.memberUniformIndexes)
+        {
+            stream->writeInt(memberUniformIndex);
+        }
+    }
+
+    stream->writeInt(mData.mTransformFeedbackVaryingVars.size());
+    for (const sh::Varying &varying : mData.mTransformFeedbackVaryingVars)
+    {
+        stream->writeInt(varying.arraySize);
+        stream->writeInt(varying.type);
+        stream->writeString(varying.name);
+    }
+
+    stream->writeInt(mData.mTransformFeedbackBufferMode);
+
+    stream->writeInt(mData.mOutputVariables.size());
+    for (const auto &outputPair : mData.mOutputVariables)
+    {
+        stream->writeInt(outputPair.first);
+        stream->writeInt(outputPair.second.element);
+        stream->writeInt(outputPair.second.index);
+        stream->writeString(outputPair.second.name);
+    }
+
+    stream->writeInt(mSamplerUniformRange.start);
+    stream->writeInt(mSamplerUniformRange.end);
+
+    return mProgram->save(stream);
+}
+
 GLint Program::getBinaryLength() const
 {
     GLint length;
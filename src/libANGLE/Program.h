@@ -43,6 +43,7 @@ class ResourceManager;
 class Shader;
 class InfoLog;
 class AttributeBindings;
+class BinaryOutputStream;
 class Buffer;
 class Framebuffer;
 struct UniformBlock;
@@ -58,6 +59,7 @@ class AttributeBindings
 
     void bindAttributeLocation(GLuint index, const char *name);
     int getAttributeBinding(const std::string &name) const;
+    const std::set<std::string> &getBoundNames(GLuint index) const;
 
   private:
     std::set<std::string> mAttributeBinding[MAX_VERTEX_ATTRIBS];
@@ -344,6 +346,12 @@ class Program final : angle::NonCopyable, public LabeledObject
     void unlink(bool destroy = false);
     void resetUniformBlockBindings();
 
+    Error saveBinaryToStream(BinaryOutputStream *stream) const;
+
+    // Identifies the inputs of Program::link: the attached shaders, the attribute bindings, the
+    // transform feedback varyings and the limits the link is validated against.
+    std::string makeProgramCacheKey(const gl::Data &data) const;
+
     bool linkAttributes(const gl::Data &data,
                         InfoLog &infoLog,
                         const AttributeBindings &attributeBindings,
@@ -0,0 +1,230 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ProgramCache.cpp: Implements the gl::ProgramCache class and its file storage.
+
+#include "libANGLE/ProgramCache.h"
+
+#include <stdio.h>
+
+#include <platform/Platform.h>
+
+#include "common/debug.h"
+#include "common/string_utils.h"
+#include "libANGLE/BinaryStream.h"
+
+namespace gl
+{
+
+namespace
+{
+
+// Bumped whenever the layout of the cache files changes. The program binary inside carries its
+// own version checks.
+const int kFileMagic         = 0x43504E41;  // "ANPC"
+const int kFileFormatVersion = 1;
+
+ProgramCache *sInstance = nullptr;
+
+bool ReadFile(const std::string &path, std::vector<uint8_t> *contentsOut)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long fileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    bool success = false;
+    if (fileSize > 0)
+    {
+        contentsOut->resize(static_cast<size_t>(fileSize));
+        success = fread(contentsOut->data(), 1, contentsOut->size(), file) == contentsOut->size();
+    }
+
+    fclose(file);
+    return success;
+}
+
+}  // anonymous namespace
+
+FileProgramCacheStorage::FileProgramCacheStorage(const std::string &directory)
+    : mDirectory(directory)
+{
+}
+
+FileProgramCacheStorage::~FileProgramCacheStorage()
+{
+}
+
+std::string FileProgramCacheStorage::getFilePath(const std::string &key) const
+{
+    return mDirectory + "/" + FormatString("%016llx.bin", static_cast<unsigned long long>(
+                                                            angle::HashString(key)));
+}
+
+bool FileProgramCacheStorage::load(const std::string &key, std::vector<uint8_t> *binaryOut)
+{
+    std::vector<uint8_t> contents;
+    if (!ReadFile(getFilePath(key), &contents))
+    {
+        return false;
+    }
+
+    BinaryInputStream stream(contents.data(), contents.size());
+    if (stream.readInt<int>() != kFileMagic || stream.readInt<int>() != kFileFormatVersion)
+    {
+        return false;
+    }
+
+    // Files are named after the hash of the key only, so the key itself has to match too.
+    std::string fileKey;
+    stream.readString(&fileKey);
+    if (stream.error() || fileKey != key)
+    {
+        return false;
+    }
+
+    size_t binaryLength = stream.readInt<size_t>();
+    if (stream.error() || binaryLength != contents.size() - stream.offset())
+    {
+        // Truncated by a process that died while writing it.
+        return false;
+    }
+
+    binaryOut->assign(contents.begin() + stream.offset(), contents.end());
+    return true;
+}
+
+void FileProgramCacheStorage::store(const std::string &key, const std::vector<uint8_t> &binary)
+{
+    BinaryOutputStream stream;
+    stream.writeInt(kFileMagic);
+    stream.writeInt(kFileFormatVersion);
+    stream.writeString(key);
+    stream.writeInt(binary.size());
+    stream.writeBytes(binary.data(), binary.size());
+
+    FILE *file = fopen(getFilePath(key).c_str(), "wb");
+    if (file == nullptr)
+    {
+        return;
+    }
+
+    fwrite(stream.data(), 1, stream.length(), file);
+    fclose(file);
+}
+
+ProgramCache *ProgramCache::GetInstance()
+{
+    static std::once_flag createOnce;
+    std::call_once(createOnce, []() {
+        sInstance = new ProgramCache();
+
+        angle::Platform *platform = ANGLEPlatformCurrent();
+        const char *directory = platform ? platform->getProgramCacheDirectory() : nullptr;
+        if (directory != nullptr)
+        {
+            sInstance->configure(kDefaultMaxMemoryBytes, std::unique_ptr<ProgramCacheStorage>(
+                                                             new FileProgramCacheStorage(directory)));
+        }
+    });
+    return sInstance;
+}
+
+ProgramCache::ProgramCache() : mEntries(kDefaultMaxMemoryBytes), mHitCount(0), mMissCount(0)
+{
+}
+
+ProgramCache::~ProgramCache()
+{
+}
+
+void ProgramCache::configure(size_t maxMemoryBytes, std::unique_ptr<ProgramCacheStorage> storage)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mEntries.setMaxSize(maxMemoryBytes);
+    mStorage = std::move(storage);
+}
+
+bool ProgramCache::get(const std::string &key, std::vector<uint8_t> *binaryOut)
+{
+    std::shared_ptr<ProgramCacheStorage> storage;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        const std::vector<uint8_t> *binary = mEntries.find(key);
+        if (binary != nullptr)
+        {
+            *binaryOut = *binary;
+            mHitCount++;
+            return true;
+        }
+        storage = mStorage;
+    }
+
+    // Other links go on while this one waits for the storage.
+    bool loaded = storage && storage->load(key, binaryOut);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!loaded)
+    {
+        mMissCount++;
+        return false;
+    }
+
+    mEntries.insert(key, *binaryOut);
+    mHitCount++;
+    return true;
+}
+
+void ProgramCache::put(const std::string &key, const std::vector<uint8_t> &binary)
+{
+    std::shared_ptr<ProgramCacheStorage> storage;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.insert(key, binary);
+        storage = mStorage;
+    }
+
+    if (storage)
+    {
+        storage->store(key, binary);
+    }
+}
+
+void ProgramCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mEntries.clear();
+    mHitCount   = 0;
+    mMissCount  = 0;
+}
+
+size_t ProgramCache::getHitCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mHitCount;
+}
+
+size_t ProgramCache::getMissCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mMissCount;
+}
+
+size_t ProgramCache::getMemorySize() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mEntries.size();
+}
+
+}  // namespace gl
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ProgramCache.h: Defines the gl::ProgramCache class, a process-wide cache of linked program
+// binaries. Program::link looks up the binary of a program with the same inputs before linking,
+// and stores the binary after a successful link. The cache keeps the most recently used binaries
+// in memory and can be backed by a persistent storage, so that later processes skip linking too.
+// The methods are thread safe, and only hold the lock of the cache around the in-memory entries,
+// not while the storage loads or stores binaries.
+
+#ifndef LIBANGLE_PROGRAMCACHE_H_
+#define LIBANGLE_PROGRAMCACHE_H_
+
+#include <stdint.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/SizedLRUCache.h"
+#include "common/angleutils.h"
+
+namespace gl
+{
+
+// Keeps program binaries across processes. Implementations must be callable from several threads
+// at once.
+class ProgramCacheStorage : angle::NonCopyable
+{
+  public:
+    virtual ~ProgramCacheStorage() {}
+
+    // Returns false if there is no binary for the key.
+    virtual bool load(const std::string &key, std::vector<uint8_t> *binaryOut) = 0;
+    virtual void store(const std::string &key, const std::vector<uint8_t> &binary) = 0;
+};
+
+// Stores each binary in its own file, named after the hash of its key, in an existing directory.
+class FileProgramCacheStorage final : public ProgramCacheStorage
+{
+  public:
+    explicit FileProgramCacheStorage(const std::string &directory);
+    ~FileProgramCacheStorage() override;
+
+    bool load(const std::string &key, std::vector<uint8_t> *binaryOut) override;
+    void store(const std::string &key, const std::vector<uint8_t> &binary) override;
+
+  private:
+    std::string getFilePath(const std::string &key) const;
+
+    std::string mDirectory;
+};
+
+class ProgramCache final : angle::NonCopyable
+{
+  public:
+    // Default upper bound on the in-memory size of the cache.
+    static const size_t kDefaultMaxMemoryBytes = 8 * 1024 * 1024;
+
+    // The instance is created on first use. Its storage is a FileProgramCacheStorage if the
+    // platform gives a program cache directory.
+    static ProgramCache *GetInstance();
+
+    ProgramCache();
+    ~ProgramCache();
+
+    // Sets the memory budget and the persistent storage. A null storage keeps the cache in
+    // memory only.
+    void configure(size_t maxMemoryBytes, std::unique_ptr<ProgramCacheStorage> storage);
+
+    // Binaries found in the storage are brought into memory.
+    bool get(const std::string &key, std::vector<uint8_t> *binaryOut);
+    void put(const std::string &key, const std::vector<uint8_t> &binary);
+
+    // Drops the in-memory binaries. The storage is left untouched.
+    void clear();
+
+    size_t getHitCount() const;
+    size_t getMissCount() const;
+    size_t getMemorySize() const;
+
+  private:
+    // Guards all the members below.
+    mutable std::mutex mMutex;
+
+    angle::SizedLRUCache<std::vector<uint8_t>> mEntries;
+    size_t mHitCount;
+    size_t mMissCount;
+
+    // Shared with the calls that are using it outside the lock, should the cache be reconfigured
+    // meanwhile.
+    std::shared_ptr<ProgramCacheStorage> mStorage;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_PROGRAMCACHE_H_
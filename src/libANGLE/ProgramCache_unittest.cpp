@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Unit tests for ProgramCache and its storage.
+//
+
+#include <stdio.h>
+
+#include <map>
+
+#include "gtest/gtest.h"
+
+#include "common/string_utils.h"
+
+#include "libANGLE/ProgramCache.h"
+
+using namespace gl;
+
+namespace
+{
+
+std::vector<uint8_t> MakeBinary(size_t size, uint8_t value)
+{
+    return std::vector<uint8_t>(size, value);
+}
+
+// Keeps the binaries in a map, and counts how often it is used.
+class MockStorage : public ProgramCacheStorage
+{
+  public:
+    MockStorage(std::map<std::string, std::vector<uint8_t>> *binaries, size_t *numLoads)
+        : mBinaries(binaries), mNumLoads(numLoads)
+    {
+    }
+
+    bool load(const std::string &key, std::vector<uint8_t> *binaryOut) override
+    {
+        (*mNumLoads)++;
+        auto iter = mBinaries->find(key);
+        if (iter == mBinaries->end())
+        {
+            return false;
+        }
+        *binaryOut = iter->second;
+        return true;
+    }
+
+    void store(const std::string &key, const std::vector<uint8_t> &binary) override
+    {
+        (*mBinaries)[key] = binary;
+    }
+
+  private:
+    std::map<std::string, std::vector<uint8_t>> *mBinaries;
+    size_t *mNumLoads;
+};
+
+// Test that stored binaries are found under their key only.
+TEST(ProgramCacheTest, PutAndGet)
+{
+    ProgramCache cache;
+
+    cache.put("first", MakeBinary(16, 1));
+    cache.put("second", MakeBinary(32, 2));
+
+    std::vector<uint8_t> binary;
+    EXPECT_TRUE(cache.get("first", &binary));
+    EXPECT_EQ(MakeBinary(16, 1), binary);
+    EXPECT_TRUE(cache.get("second", &binary));
+    EXPECT_EQ(MakeBinary(32, 2), binary);
+    EXPECT_FALSE(cache.get("third", &binary));
+
+    EXPECT_EQ(2u, cache.getHitCount());
+    EXPECT_EQ(1u, cache.getMissCount());
+}
+
+// Test that the least recently used binaries are evicted to stay within the memory budget.
+TEST(ProgramCacheTest, EvictsLeastRecentlyUsed)
+{
+    ProgramCache cache;
+    cache.configure(3 * 101, nullptr);
+
+    cache.put("a", MakeBinary(100, 1));
+    cache.put("b", MakeBinary(100, 2));
+    cache.put("c", MakeBinary(100, 3));
+
+    // Touch "a" so that "b" is the least recently used.
+    std::vector<uint8_t> binary;
+    EXPECT_TRUE(cache.get("a", &binary));
+
+    cache.put("d", MakeBinary(100, 4));
+    EXPECT_LE(cache.getMemorySize(), 3u * 101u);
+
+    EXPECT_TRUE(cache.get("a", &binary));
+    EXPECT_FALSE(cache.get("b", &binary));
+    EXPECT_TRUE(cache.get("c", &binary));
+    EXPECT_TRUE(cache.get("d", &binary));
+}
+
+// Test that binaries evicted from memory, or stored by an earlier cache, come back from the
+// storage.
+TEST(ProgramCacheTest, FallsBackToStorage)
+{
+    std::map<std::string, std::vector<uint8_t>> storedBinaries;
+    size_t numLoads = 0;
+
+    {
+        ProgramCache firstCache;
+        firstCache.configure(ProgramCache::kDefaultMaxMemoryBytes,
+                             std::unique_ptr<ProgramCacheStorage>(
+                                 new MockStorage(&storedBinaries, &numLoads)));
+        firstCache.put("program", MakeBinary(64, 7));
+    }
+    EXPECT_EQ(1u, storedBinaries.size());
+
+    ProgramCache secondCache;
+    secondCache.configure(ProgramCache::kDefaultMaxMemoryBytes,
+                          std::unique_ptr<ProgramCacheStorage>(
+                              new MockStorage(&storedBinaries, &numLoads)));
+
+    std::vector<uint8_t> binary;
+    EXPECT_TRUE(secondCache.get("program", &binary));
+    EXPECT_EQ(MakeBinary(64, 7), binary);
+    EXPECT_EQ(1u, numLoads);
+
+    // The second lookup is served from memory.
+    EXPECT_TRUE(secondCache.get("program", &binary));
+    EXPECT_EQ(1u, numLoads);
+}
+
+// Test that the file storage reads back what it wrote, for the same key only.
+TEST(ProgramCacheTest, FileStorageRoundTrip)
+{
+    FileProgramCacheStorage storage(".");
+
+    const std::string key = "ProgramCacheTest.FileStorageRoundTrip";
+    storage.store(key, MakeBinary(128, 9));
+
+    std::vector<uint8_t> binary;
+    EXPECT_TRUE(storage.load(key, &binary));
+    EXPECT_EQ(MakeBinary(128, 9), binary);
+    EXPECT_FALSE(storage.load(key + " other", &binary));
+
+    std::string path = FormatString("./%016llx.bin",
+                                    static_cast<unsigned long long>(angle::HashString(key)));
+    remove(path.c_str());
+}
+
+}  // anonymous namespace
@@ -59,6 +59,7 @@ Error Renderbuffer::setStorage(GLenum internalformat, size_t width, size_t heigh
     mHeight         = static_cast<GLsizei>(height);
     mInternalFormat = internalformat;
     mSamples = 0;
+    notifyObservingFramebuffers();
 
     return Error(GL_NO_ERROR);
 }
@@ -77,6 +78,7 @@ Error Renderbuffer::setStorageMultisample(size_t samples, GLenum internalformat,
     mHeight         = static_cast<GLsizei>(height);
     mInternalFormat = internalformat;
     mSamples        = static_cast<GLsizei>(samples);
+    notifyObservingFramebuffers();
 
     return Error(GL_NO_ERROR);
 }
@@ -97,6 +99,7 @@ Error Renderbuffer::setStorageEGLImageTarget(egl::Image *image)
     mHeight         = static_cast<GLsizei>(image->getHeight());
     mInternalFormat = image->getInternalFormat();
     mSamples        = 0;
+    notifyObservingFramebuffers();
 
     return Error(GL_NO_ERROR);
 }
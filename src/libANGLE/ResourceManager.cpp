@@ -28,40 +28,66 @@ ResourceManager::ResourceManager(rx::ImplFactory *factory)
 
 ResourceManager::~ResourceManager()
 {
-    while (!mBufferMap.empty())
+    for (auto buffer : mBufferMap)
     {
-        deleteBuffer(mBufferMap.begin()->first);
+        if (buffer.second != nullptr)
+        {
+            buffer.second->release();
+        }
     }
+    mBufferMap.clear();
 
-    while (!mProgramMap.empty())
+    // Deleting the programs releases their attached shaders, which deletes the shaders already
+    // flagged for deletion.
+    for (auto program : mProgramMap)
     {
-        deleteProgram(mProgramMap.begin()->first);
+        ASSERT(program.second->getRefCount() == 0);
+        delete program.second;
     }
+    mProgramMap.clear();
 
-    while (!mShaderMap.empty())
+    for (auto shader : mShaderMap)
     {
-        deleteShader(mShaderMap.begin()->first);
+        ASSERT(shader.second->getRefCount() == 0);
+        delete shader.second;
     }
+    mShaderMap.clear();
 
-    while (!mRenderbufferMap.empty())
+    for (auto renderbuffer : mRenderbufferMap)
     {
-        deleteRenderbuffer(mRenderbufferMap.begin()->first);
+        if (renderbuffer.second != nullptr)
+        {
+            renderbuffer.second->release();
+        }
     }
+    mRenderbufferMap.clear();
 
-    while (!mTextureMap.empty())
+    for (auto texture : mTextureMap)
     {
-        deleteTexture(mTextureMap.begin()->first);
+        if (texture.second != nullptr)
+        {
+            texture.second->release();
+        }
     }
+    mTextureMap.clear();
 
-    while (!mSamplerMap.empty())
+    for (auto sampler : mSamplerMap)
     {
-        deleteSampler(mSamplerMap.begin()->first);
+        if (sampler.second != nullptr)
+        {
+            sampler.second->release();
+        }
     }
+    mSamplerMap.clear();
 
-    while (!mFenceSyncMap.empty())
+    for (auto fenceSync : mFenceSyncMap)
     {
-        deleteFenceSync(mFenceSyncMap.begin()->first);
+        if (fenceSync.second != nullptr)
+        {
+            fenceSync.second->release();
+        }
     }
+    mFenceSyncMap.clear();
 }
 
 void ResourceManager::addRef()
@@ -82,7 +108,7 @@ GLuint ResourceManager::createBuffer()
 {
     GLuint handle = mBufferHandleAllocator.allocate();
 
-    mBufferMap[handle] = NULL;
+    mBufferMap.assign(handle, nullptr);
 
     return handle;
 }
@@ -94,7 +120,7 @@ GLuint ResourceManager::createShader(const gl::Limitations &rendererLimitations,
 
     if (type == GL_VERTEX_SHADER || type == GL_FRAGMENT_SHADER)
     {
-        mShaderMap[handle] = new Shader(this, mFactory, rendererLimitations, type, handle);
+        mShaderMap.assign(handle, new Shader(this, mFactory, rendererLimitations, type, handle));
     }
     else UNREACHABLE();
 
@@ -106,7 +132,7 @@ GLuint ResourceManager::createProgram()
 {
     GLuint handle = mProgramShaderHandleAllocator.allocate();
 
-    mProgramMap[handle] = new Program(mFactory, this, handle);
+    mProgramMap.assign(handle, new Program(mFactory, this, handle));
 
     return handle;
 }
@@ -116,7 +142,7 @@ GLuint ResourceManager::createTexture()
 {
     GLuint handle = mTextureHandleAllocator.allocate();
 
-    mTextureMap[handle] = NULL;
+    mTextureMap.assign(handle, nullptr);
 
     return handle;
 }
@@ -126,7 +152,7 @@ GLuint ResourceManager::createRenderbuffer()
 {
     GLuint handle = mRenderbufferHandleAllocator.allocate();
 
-    mRenderbufferMap[handle] = NULL;
+    mRenderbufferMap.assign(handle, nullptr);
 
     return handle;
 }
@@ -136,7 +162,7 @@ GLuint ResourceManager::createSampler()
 {
     GLuint handle = mSamplerHandleAllocator.allocate();
 
-    mSamplerMap[handle] = NULL;
+    mSamplerMap.assign(handle, nullptr);
 
     return handle;
 }
@@ -148,292 +174,183 @@ GLuint ResourceManager::createFenceSync()
 
     FenceSync *fenceSync = new FenceSync(mFactory->createFenceSync(), handle);
     fenceSync->addRef();
-    mFenceSyncMap[handle] = fenceSync;
+    mFenceSyncMap.assign(handle, fenceSync);
 
     return handle;
 }
 
 void ResourceManager::deleteBuffer(GLuint buffer)
 {
-    BufferMap::iterator bufferObject = mBufferMap.find(buffer);
-
-    if (bufferObject != mBufferMap.end())
+    Buffer *bufferObject = nullptr;
+    if (mBufferMap.erase(buffer, &bufferObject))
     {
-        mBufferHandleAllocator.release(bufferObject->first);
-        if (bufferObject->second) bufferObject->second->release();
-        mBufferMap.erase(bufferObject);
+        mBufferHandleAllocator.release(buffer);
+        if (bufferObject) bufferObject->release();
     }
 }
 
 void ResourceManager::deleteShader(GLuint shader)
 {
-    ShaderMap::iterator shaderObject = mShaderMap.find(shader);
+    Shader *shaderObject = mShaderMap.query(shader);
 
-    if (shaderObject != mShaderMap.end())
+    if (shaderObject != nullptr)
     {
-        if (shaderObject->second->getRefCount() == 0)
+        if (shaderObject->getRefCount() == 0)
         {
-            mProgramShaderHandleAllocator.release(shaderObject->first);
-            delete shaderObject->second;
-            mShaderMap.erase(shaderObject);
+            mProgramShaderHandleAllocator.release(shader);
+            mShaderMap.erase(shader, &shaderObject);
+            delete shaderObject;
         }
         else
         {
-            shaderObject->second->flagForDeletion();
+            shaderObject->flagForDeletion();
         }
     }
 }
 
 void ResourceManager::deleteProgram(GLuint program)
 {
-    ProgramMap::iterator programObject = mProgramMap.find(program);
+    Program *programObject = mProgramMap.query(program);
 
-    if (programObject != mProgramMap.end())
+    if (programObject != nullptr)
     {
-        if (programObject->second->getRefCount() == 0)
+        if (programObject->getRefCount() == 0)
         {
-            mProgramShaderHandleAllocator.release(programObject->first);
-            delete programObject->second;
-            mProgramMap.erase(programObject);
+            mProgramShaderHandleAllocator.release(program);
+            mProgramMap.erase(program, &programObject);
+            delete programObject;
         }
         else
         { 
-            programObject->second->flagForDeletion();
+            programObject->flagForDeletion();
         }
     }
 }
 
 void ResourceManager::deleteTexture(GLuint texture)
 {
-    TextureMap::iterator textureObject = mTextureMap.find(texture);
-
-    if (textureObject != mTextureMap.end())
+    Texture *textureObject = nullptr;
+    if (mTextureMap.erase(texture, &textureObject))
     {
-        mTextureHandleAllocator.release(textureObject->first);
-        if (textureObject->second) textureObject->second->release();
-        mTextureMap.erase(textureObject);
+        mTextureHandleAllocator.release(texture);
+        if (textureObject) textureObject->release();
     }
 }
 
 void ResourceManager::deleteRenderbuffer(GLuint renderbuffer)
 {
-    RenderbufferMap::iterator renderbufferObject = mRenderbufferMap.find(renderbuffer);
-
-    if (renderbufferObject != mRenderbufferMap.end())
+    Renderbuffer *renderbufferObject = nullptr;
+    if (mRenderbufferMap.erase(renderbuffer, &renderbufferObject))
     {
-        mRenderbufferHandleAllocator.release(renderbufferObject->first);
-        if (renderbufferObject->second) renderbufferObject->second->release();
-        mRenderbufferMap.erase(renderbufferObject);
+        mRenderbufferHandleAllocator.release(renderbuffer);
+        if (renderbufferObject) renderbufferObject->release();
     }
 }
 
 void ResourceManager::deleteSampler(GLuint sampler)
 {
-    auto samplerObject = mSamplerMap.find(sampler);
-
-    if (samplerObject != mSamplerMap.end())
+    Sampler *samplerObject = nullptr;
+    if (mSamplerMap.erase(sampler, &samplerObject))
     {
-        mSamplerHandleAllocator.release(samplerObject->first);
-        if (samplerObject->second) samplerObject->second->release();
-        mSamplerMap.erase(samplerObject);
+        mSamplerHandleAllocator.release(sampler);
+        if (samplerObject) samplerObject->release();
     }
 }
 
 void ResourceManager::deleteFenceSync(GLuint fenceSync)
 {
-    auto fenceObjectIt = mFenceSyncMap.find(fenceSync);
-
-    if (fenceObjectIt != mFenceSyncMap.end())
+    FenceSync *fenceSyncObject = nullptr;
+    if (mFenceSyncMap.erase(fenceSync, &fenceSyncObject))
     {
-        mFenceSyncHandleAllocator.release(fenceObjectIt->first);
-        if (fenceObjectIt->second) fenceObjectIt->second->release();
-        mFenceSyncMap.erase(fenceObjectIt);
+        mFenceSyncHandleAllocator.release(fenceSync);
+        if (fenceSyncObject) fenceSyncObject->release();
     }
 }
 
 Buffer *ResourceManager::getBuffer(unsigned int handle)
 {
-    BufferMap::iterator buffer = mBufferMap.find(handle);
-
-    if (buffer == mBufferMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return buffer->second;
-    }
+    return mBufferMap.query(handle);
 }
 
 Shader *ResourceManager::getShader(unsigned int handle)
 {
-    ShaderMap::iterator shader = mShaderMap.find(handle);
-
-    if (shader == mShaderMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return shader->second;
-    }
+    return mShaderMap.query(handle);
 }
 
 Texture *ResourceManager::getTexture(unsigned int handle)
 {
     if (handle == 0) return NULL;
 
-    TextureMap::iterator texture = mTextureMap.find(handle);
-
-    if (texture == mTextureMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return texture->second;
-    }
+    return mTextureMap.query(handle);
 }
 
 Program *ResourceManager::getProgram(unsigned int handle) const
 {
-    ProgramMap::const_iterator program = mProgramMap.find(handle);
-
-    if (program == mProgramMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return program->second;
-    }
+    return mProgramMap.query(handle);
 }
 
 Renderbuffer *ResourceManager::getRenderbuffer(unsigned int handle)
 {
-    RenderbufferMap::iterator renderbuffer = mRenderbufferMap.find(handle);
-
-    if (renderbuffer == mRenderbufferMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return renderbuffer->second;
-    }
+    return mRenderbufferMap.query(handle);
 }
 
 Sampler *ResourceManager::getSampler(unsigned int handle)
 {
-    auto sampler = mSamplerMap.find(handle);
-
-    if (sampler == mSamplerMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return sampler->second;
-    }
+    return mSamplerMap.query(handle);
 }
 
 FenceSync *ResourceManager::getFenceSync(unsigned int handle)
 {
-    auto fenceObjectIt = mFenceSyncMap.find(handle);
-
-    if (fenceObjectIt == mFenceSyncMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return fenceObjectIt->second;
-    }
+    return mFenceSyncMap.query(handle);
 }
 
 void ResourceManager::setRenderbuffer(GLuint handle, Renderbuffer *buffer)
 {
-    mRenderbufferMap[handle] = buffer;
+    mRenderbufferMap.assign(handle, buffer);
 }
 
 void ResourceManager::checkBufferAllocation(GLuint handle)
 {
-    if (handle != 0)
+    if (handle != 0 && mBufferMap.query(handle) == nullptr)
     {
-        auto bufferMapIt = mBufferMap.find(handle);
-        bool handleAllocated = (bufferMapIt != mBufferMap.end());
-
-        if (handleAllocated && bufferMapIt->second != nullptr)
+        if (!mBufferMap.contains(handle))
         {
-            return;
+            mBufferHandleAllocator.reserve(handle);
         }
 
         Buffer *buffer = new Buffer(mFactory->createBuffer(), handle);
         buffer->addRef();
-
-        if (handleAllocated)
-        {
-            bufferMapIt->second = buffer;
-        }
-        else
-        {
-            mBufferHandleAllocator.reserve(handle);
-            mBufferMap[handle] = buffer;
-        }
+        mBufferMap.assign(handle, buffer);
     }
 }
 
 void ResourceManager::checkTextureAllocation(GLuint handle, GLenum type)
 {
-    if (handle != 0)
+    if (handle != 0 && mTextureMap.query(handle) == nullptr)
     {
-        auto textureMapIt = mTextureMap.find(handle);
-        bool handleAllocated = (textureMapIt != mTextureMap.end());
-
-        if (handleAllocated && textureMapIt->second != nullptr)
+        if (!mTextureMap.contains(handle))
         {
-            return;
+            mTextureHandleAllocator.reserve(handle);
         }
 
         Texture *texture = new Texture(mFactory->createTexture(type), handle, type);
         texture->addRef();
-
-        if (handleAllocated)
-        {
-            textureMapIt->second = texture;
-        }
-        else
-        {
-            mTextureHandleAllocator.reserve(handle);
-            mTextureMap[handle] = texture;
-        }
+        mTextureMap.assign(handle, texture);
     }
 }
 
 void ResourceManager::checkRenderbufferAllocation(GLuint handle)
 {
-    if (handle != 0)
+    if (handle != 0 && mRenderbufferMap.query(handle) == nullptr)
     {
-        auto renderbufferMapIt = mRenderbufferMap.find(handle);
-        bool handleAllocated = (renderbufferMapIt != mRenderbufferMap.end());
-
-        if (handleAllocated && renderbufferMapIt->second != nullptr)
+        if (!mRenderbufferMap.contains(handle))
         {
-            return;
+            mRenderbufferHandleAllocator.reserve(handle);
         }
 
         Renderbuffer *renderbuffer = new Renderbuffer(mFactory->createRenderbuffer(), handle);
         renderbuffer->addRef();
-
-        if (handleAllocated)
-        {
-            renderbufferMapIt->second = renderbuffer;
-        }
-        else
-        {
-            mRenderbufferHandleAllocator.reserve(handle);
-            mRenderbufferMap[handle] = renderbuffer;
-        }
+        mRenderbufferMap.assign(handle, renderbuffer);
     }
 }
 
@@ -442,7 +359,7 @@ void ResourceManager::checkSamplerAllocation(GLuint sampler)
     if (sampler != 0 && !getSampler(sampler))
     {
         Sampler *samplerObject = new Sampler(mFactory, sampler);
-        mSamplerMap[sampler] = samplerObject;
+        mSamplerMap.assign(sampler, samplerObject);
         samplerObject->addRef();
         // Samplers cannot be created via Bind
     }
@@ -450,7 +367,7 @@ void ResourceManager::checkSamplerAllocation(GLuint sampler)
 
 bool ResourceManager::isSampler(GLuint sampler)
 {
-    return mSamplerMap.find(sampler) != mSamplerMap.end();
+    return mSamplerMap.contains(sampler);
 }
 
 }
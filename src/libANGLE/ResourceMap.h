@@ -0,0 +1,215 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ResourceMap.h:
+//   Defines the gl::ResourceMap class, which maps GL handles to the objects they name. The
+//   HandleAllocators hand out small dense handles, which index a flat array; the larger handles
+//   that applications may pick themselves go to a hash map.
+//
+
+#ifndef LIBANGLE_RESOURCEMAP_H_
+#define LIBANGLE_RESOURCEMAP_H_
+
+#include "angle_gl.h"
+#include "common/angleutils.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace gl
+{
+
+template <typename ResourceType>
+class ResourceMap final : angle::NonCopyable
+{
+  public:
+    typedef std::unordered_map<GLuint, ResourceType *> HashMap;
+    typedef std::pair<GLuint, ResourceType *> value_type;
+
+    ResourceMap() : mFlatResourcesSize(0) {}
+
+    // Returns the object of a handle, or nullptr if the handle is unknown or has no object yet.
+    ResourceType *query(GLuint handle) const
+    {
+        if (handle < mFlatResources.size())
+        {
+            ResourceType *resource = mFlatResources[handle];
+            return (resource == InvalidPointer()) ? nullptr : resource;
+        }
+
+        auto it = mHashedResources.find(handle);
+        return (it != mHashedResources.end()) ? it->second : nullptr;
+    }
+
+    // Returns true if the handle is in the map, which it can be without an object.
+    bool contains(GLuint handle) const
+    {
+        if (handle < mFlatResources.size())
+        {
+            return mFlatResources[handle] != InvalidPointer();
+        }
+
+        return mHashedResources.find(handle) != mHashedResources.end();
+    }
+
+    // Adds the handle, or replaces its object. The object may be nullptr.
+    void assign(GLuint handle, ResourceType *resource)
+    {
+        if (handle < kFlatResourcesLimit)
+        {
+            if (handle >= mFlatResources.size())
+            {
+                size_t newSize = std::max<size_t>(mFlatResources.size() * 2, handle + 1);
+                mFlatResources.resize(std::min(newSize, static_cast<size_t>(kFlatResourcesLimit)),
+                                      InvalidPointer());
+            }
+
+            if (mFlatResources[handle] == InvalidPointer())
+            {
+                mFlatResourcesSize++;
+            }
+            mFlatResources[handle] = resource;
+        }
+        else
+        {
+            mHashedResources[handle] = resource;
+        }
+    }
+
+    // Removes the handle and returns its object in resourceOut. Returns false if the handle was
+    // not in the map.
+    bool erase(GLuint handle, ResourceType **resourceOut)
+    {
+        if (handle < mFlatResources.size())
+        {
+            ResourceType *resource = mFlatResources[handle];
+            if (resource == InvalidPointer())
+            {
+                return false;
+            }
+
+            mFlatResources[handle] = InvalidPointer();
+            mFlatResourcesSize--;
+            *resourceOut = resource;
+            return true;
+        }
+
+        auto it = mHashedResources.find(handle);
+        if (it == mHashedResources.end())
+        {
+            return false;
+        }
+
+        *resourceOut = it->second;
+        mHashedResources.erase(it);
+        return true;
+    }
+
+    bool empty() const { return mFlatResourcesSize == 0 && mHashedResources.empty(); }
+
+    void clear()
+    {
+        mFlatResources.clear();
+        mFlatResourcesSize = 0;
+        mHashedResources.clear();
+    }
+
+    // Visits the handles of the flat array in increasing order, then the hashed handles.
+    class Iterator final
+    {
+      public:
+        bool operator==(const Iterator &other) const
+        {
+            return mFlatIndex == other.mFlatIndex && mHashIt == other.mHashIt;
+        }
+        bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+        Iterator &operator++()
+        {
+            if (mFlatIndex < mOrigin->mFlatResources.size())
+            {
+                mFlatIndex++;
+                skipInvalidFlatResources();
+            }
+            else
+            {
+                ++mHashIt;
+            }
+            updateValue();
+            return *this;
+        }
+
+        const value_type &operator*() const { return mValue; }
+        const value_type *operator->() const { return &mValue; }
+
+      private:
+        friend class ResourceMap;
+
+        Iterator(const ResourceMap *origin,
+                 size_t flatIndex,
+                 typename HashMap::const_iterator hashIt)
+            : mOrigin(origin), mFlatIndex(flatIndex), mHashIt(hashIt), mValue(0, nullptr)
+        {
+            skipInvalidFlatResources();
+            updateValue();
+        }
+
+        void skipInvalidFlatResources()
+        {
+            const std::vector<ResourceType *> &flatResources = mOrigin->mFlatResources;
+            while (mFlatIndex < flatResources.size() &&
+                   flatResources[mFlatIndex] == InvalidPointer())
+            {
+                mFlatIndex++;
+            }
+        }
+
+        void updateValue()
+        {
+            if (mFlatIndex < mOrigin->mFlatResources.size())
+            {
+                mValue.first  = static_cast<GLuint>(mFlatIndex);
+                mValue.second = mOrigin->mFlatResources[mFlatIndex];
+            }
+            else if (mHashIt != mOrigin->mHashedResources.end())
+            {
+                mValue.first  = mHashIt->first;
+                mValue.second = mHashIt->second;
+            }
+        }
+
+        const ResourceMap *mOrigin;
+        size_t mFlatIndex;
+        typename HashMap::const_iterator mHashIt;
+        value_type mValue;
+    };
+
+    Iterator begin() const { return Iterator(this, 0, mHashedResources.begin()); }
+    Iterator end() const
+    {
+        return Iterator(this, mFlatResources.size(), mHashedResources.end());
+    }
+
+  private:
+    // Handles below this limit are stored in the flat array, which grows up to the largest of
+    // them.
+    static const GLuint kFlatResourcesLimit = 0x3000;
+
+    // Marks the flat array slots of unknown handles, since handles can be mapped to nullptr.
+    static ResourceType *InvalidPointer()
+    {
+        return reinterpret_cast<ResourceType *>(static_cast<uintptr_t>(-1));
+    }
+
+    std::vector<ResourceType *> mFlatResources;
+    size_t mFlatResourcesSize;
+    HashMap mHashedResources;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_RESOURCEMAP_H_
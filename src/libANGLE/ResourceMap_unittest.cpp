@@ -0,0 +1,88 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ResourceMap unit tests:
+//   Checks the handle lookups of the flat array and of the hash map fallback.
+//
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/ResourceMap.h"
+
+#include <map>
+
+using namespace gl;
+
+namespace
+{
+
+// Test that handles mapped to nullptr are distinct from unknown handles.
+TEST(ResourceMapTest, ReservedHandles)
+{
+    ResourceMap<int> resourceMap;
+    EXPECT_TRUE(resourceMap.empty());
+    EXPECT_FALSE(resourceMap.contains(1));
+
+    int object = 0;
+    resourceMap.assign(1, nullptr);
+    resourceMap.assign(2, &object);
+    EXPECT_FALSE(resourceMap.empty());
+    EXPECT_TRUE(resourceMap.contains(1));
+    EXPECT_EQ(nullptr, resourceMap.query(1));
+    EXPECT_EQ(&object, resourceMap.query(2));
+    EXPECT_EQ(nullptr, resourceMap.query(3));
+    EXPECT_EQ(nullptr, resourceMap.query(0xFFFFFFFFu));
+
+    int *erased = &object;
+    EXPECT_TRUE(resourceMap.erase(1, &erased));
+    EXPECT_EQ(nullptr, erased);
+    EXPECT_FALSE(resourceMap.erase(1, &erased));
+    EXPECT_TRUE(resourceMap.erase(2, &erased));
+    EXPECT_EQ(&object, erased);
+    EXPECT_TRUE(resourceMap.empty());
+}
+
+// Test small and large handles together, and that iteration visits each handle once.
+TEST(ResourceMapTest, SmallAndLargeHandles)
+{
+    ResourceMap<int> resourceMap;
+    std::vector<int> objects(8);
+    std::map<GLuint, int *> expected;
+
+    const GLuint handles[] = {1, 2, 100, 0x2FFF, 0x3000, 0x10000, 0x7FFFFFFF, 0xFFFFFFFFu};
+    for (size_t index = 0; index < ArraySize(handles); ++index)
+    {
+        resourceMap.assign(handles[index], &objects[index]);
+        expected[handles[index]] = &objects[index];
+    }
+
+    for (const auto &handleAndObject : expected)
+    {
+        EXPECT_TRUE(resourceMap.contains(handleAndObject.first));
+        EXPECT_EQ(handleAndObject.second, resourceMap.query(handleAndObject.first));
+    }
+
+    std::map<GLuint, int *> visited;
+    for (auto handleAndObject : resourceMap)
+    {
+        EXPECT_EQ(0u, visited.count(handleAndObject.first));
+        visited[handleAndObject.first] = handleAndObject.second;
+    }
+    EXPECT_EQ(expected, visited);
+
+    int *erased = nullptr;
+    EXPECT_TRUE(resourceMap.erase(0x2FFF, &erased));
+    EXPECT_TRUE(resourceMap.erase(0x3000, &erased));
+    EXPECT_FALSE(resourceMap.contains(0x2FFF));
+    EXPECT_FALSE(resourceMap.contains(0x3000));
+    EXPECT_TRUE(resourceMap.contains(100));
+    EXPECT_TRUE(resourceMap.contains(0x10000));
+
+    resourceMap.clear();
+    EXPECT_TRUE(resourceMap.empty());
+    EXPECT_TRUE(resourceMap.begin() == resourceMap.end());
+}
+
+}  // anonymous namespace
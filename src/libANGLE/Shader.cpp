@@ -19,11 +19,25 @@
 #include "libANGLE/renderer/Renderer.h"
 #include "libANGLE/renderer/ShaderImpl.h"
 #include "libANGLE/ResourceManager.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/d3d/d3d11/winrt/HolographicNativeWindow.h"
 
 namespace gl
 {
 
+// Everything the translation on the worker thread reads or writes, so that the shader can be
+// changed while the translation runs.
+struct Shader::CompilingState
+{
+    Compiler *compiler;
+    ShHandle compilerHandle;
+    std::string source;
+    std::vector<std::string> sourceStrings;
+    int compileOptions;
+    bool result;
+    std::shared_ptr<angle::WaitableEvent> compileEvent;
+};
+
 namespace
 {
 template <typename VarT>
@@ -101,6 +115,7 @@ Shader::Shader(ResourceManager *manager,
 
 Shader::~Shader()
 {
+    endCompile();
     SafeDelete(mImplementation);
 }
 
@@ -138,8 +153,10 @@ void Shader::setSource(GLsizei count, const char *const *string, const GLint *le
     mData.mSource = stream.str();
 }
 
-int Shader::getInfoLogLength() const
+int Shader::getInfoLogLength()
 {
+    resolveCompile();
+
     if (mInfoLog.empty())
     {
         return 0;
@@ -148,8 +165,10 @@ int Shader::getInfoLogLength() const
     return (static_cast<int>(mInfoLog.length()) + 1);
 }
 
-void Shader::getInfoLog(GLsizei bufSize, GLsizei *length, char *infoLog) const
+void Shader::getInfoLog(GLsizei bufSize, GLsizei *length, char *infoLog)
 {
+    resolveCompile();
+
     int index = 0;
 
     if (bufSize > 0)
@@ -171,8 +190,10 @@ int Shader::getSourceLength() const
     return mData.mSource.empty() ? 0 : (static_cast<int>(mData.mSource.length()) + 1);
 }
 
-int Shader::getTranslatedSourceLength() const
+int Shader::getTranslatedSourceLength()
 {
+    resolveCompile();
+
     if (mData.mTranslatedSource.empty())
     {
         return 0;
@@ -181,8 +202,10 @@ int Shader::getTranslatedSourceLength() const
     return (static_cast<int>(mData.mTranslatedSource.length()) + 1);
 }
 
-int Shader::getTranslatedSourceWithDebugInfoLength() const
+int Shader::getTranslatedSourceWithDebugInfoLength()
 {
+    resolveCompile();
+
     const std::string &debugInfo = mImplementation->getDebugInfo();
     if (debugInfo.empty())
     {
@@ -215,19 +238,25 @@ void Shader::getSource(GLsizei bufSize, GLsizei *length, char *buffer) const
     getSourceImpl(mData.mSource, bufSize, length, buffer);
 }
 
-void Shader::getTranslatedSource(GLsizei bufSize, GLsizei *length, char *buffer) const
+void Shader::getTranslatedSource(GLsizei bufSize, GLsizei *length, char *buffer)
 {
+    resolveCompile();
     getSourceImpl(mData.mTranslatedSource, bufSize, length, buffer);
 }
 
-void Shader::getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length, char *buffer) const
+void Shader::getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length, char *buffer)
 {
+    resolveCompile();
+
     const std::string &debugInfo = mImplementation->getDebugInfo();
     getSourceImpl(debugInfo, bufSize, length, buffer);
 }
 
 void Shader::compile(Compiler *compiler)
 {
+    // The results of a compile that is still running are replaced by this one.
+    endCompile();
+
     mData.mTranslatedSource.clear();
     mInfoLog.clear();
     mData.mShaderVersion = 100;
@@ -237,8 +266,6 @@ void Shader::compile(Compiler *compiler)
     mData.mActiveAttributes.clear();
     mData.mActiveOutputVariables.clear();
 
-    ShHandle compilerHandle = compiler->getCompilerHandle(mData.mShaderType);
-
     std::stringstream sourceStream;
 
     std::string sourcePath;
@@ -255,11 +282,11 @@ void Shader::compile(Compiler *compiler)
     }
 
     std::string sourceString  = sourceStream.str();
-    std::vector<const char *> sourceCStrings;
+    std::vector<std::string> sourceStrings;
 
     if (!sourcePath.empty())
     {
-        sourceCStrings.push_back(sourcePath.c_str());
+        sourceStrings.push_back(sourcePath);
     }
 
 #ifdef ANGLE_ENABLE_WINDOWS_HOLOGRAPHIC
@@ -357,16 +384,48 @@ void Shader::compile(Compiler *compiler)
     }
 #endif
 
-    sourceCStrings.push_back(sourceString.c_str());
+    sourceStrings.push_back(sourceString);
+
+    mCompilingState.reset(new CompilingState());
+    mCompilingState->compiler       = compiler;
+    mCompilingState->compilerHandle = compiler->acquireCompilerHandle(mData.mShaderType);
+    mCompilingState->source         = mData.mSource;
+    mCompilingState->sourceStrings  = std::move(sourceStrings);
+    mCompilingState->compileOptions = compileOptions;
+    mCompilingState->result         = false;
+
+    CompilingState *compilingState = mCompilingState.get();
+    mCompilingState->compileEvent  = compiler->postCompileTask(this, [compilingState]() {
+        std::vector<const char *> sourceCStrings;
+        for (const std::string &sourceString : compilingState->sourceStrings)
+        {
+            sourceCStrings.push_back(sourceString.c_str());
+        }
+
+        compilingState->result =
+            ShCompile(compilingState->compilerHandle, &sourceCStrings[0], sourceCStrings.size(),
+                      compilingState->compileOptions);
+    });
+}
+
+void Shader::resolveCompile()
+{
+    if (!mCompilingState)
+    {
+        return;
+    }
 
-    bool result =
-        ShCompile(compilerHandle, &sourceCStrings[0], sourceCStrings.size(), compileOptions);
+    mCompilingState->compileEvent->wait();
 
-    if (!result)
+    Compiler *compiler      = mCompilingState->compiler;
+    ShHandle compilerHandle = mCompilingState->compilerHandle;
+
+    if (!mCompilingState->result)
     {
         mInfoLog = ShGetInfoLog(compilerHandle);
         TRACE("\n%s", mInfoLog.c_str());
         mCompiled = false;
+        endCompile();
         return;
     }
 
@@ -375,6 +434,7 @@ void Shader::compile(Compiler *compiler)
 #ifndef NDEBUG
     // Prefix translated shader with commented out un-translated shader.
     // Useful in diagnostics tools which capture the shader source.
+    const std::string &source = mCompilingState->source;
     std::ostringstream shaderStream;
     shaderStream << "// GLSL\n";
     shaderStream << "//\n";
@@ -382,10 +442,10 @@ void Shader::compile(Compiler *compiler)
     size_t curPos = 0;
     while (curPos != std::string::npos)
     {
-        size_t nextLine = mData.mSource.find("\n", curPos);
+        size_t nextLine = source.find("\n", curPos);
         size_t len      = (nextLine == std::string::npos) ? std::string::npos : (nextLine - curPos + 1);
 
-        shaderStream << "// " << mData.mSource.substr(curPos, len);
+        shaderStream << "// " << source.substr(curPos, len);
 
         curPos = (nextLine == std::string::npos) ? std::string::npos : (nextLine + 1);
     }
@@ -417,7 +477,29 @@ void Shader::compile(Compiler *compiler)
 
     ASSERT(!mData.mTranslatedSource.empty());
 
-    mCompiled = mImplementation->postTranslateCompile(compiler, &mInfoLog);
+    mCompiled = mImplementation->postTranslateCompile(compiler, compilerHandle, &mInfoLog);
+    endCompile();
+}
+
+void Shader::endCompile()
+{
+    if (!mCompilingState)
+    {
+        return;
+    }
+
+    mCompilingState->compileEvent->wait();
+
+    Compiler *compiler = mCompilingState->compiler;
+    compiler->releaseCompilerHandle(mData.mShaderType, mCompilingState->compilerHandle);
+    compiler->removePendingCompile(this);
+    mCompilingState.reset();
+}
+
+bool Shader::isCompiled()
+{
+    resolveCompile();
+    return mCompiled;
 }
 
 void Shader::addRef()
@@ -14,6 +14,7 @@
 
 #include <string>
 #include <list>
+#include <memory>
 #include <vector>
 
 #include "angle_gl.h"
@@ -101,18 +102,22 @@ class Shader final : angle::NonCopyable, public LabeledObject
 
     void deleteSource();
     void setSource(GLsizei count, const char *const *string, const GLint *length);
-    int getInfoLogLength() const;
-    void getInfoLog(GLsizei bufSize, GLsizei *length, char *infoLog) const;
+    int getInfoLogLength();
+    void getInfoLog(GLsizei bufSize, GLsizei *length, char *infoLog);
     int getSourceLength() const;
     void getSource(GLsizei bufSize, GLsizei *length, char *buffer) const;
-    int getTranslatedSourceLength() const;
-    int getTranslatedSourceWithDebugInfoLength() const;
+    int getTranslatedSourceLength();
+    int getTranslatedSourceWithDebugInfoLength();
     const std::string &getTranslatedSource() const { return mData.getTranslatedSource(); }
-    void getTranslatedSource(GLsizei bufSize, GLsizei *length, char *buffer) const;
-    void getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length, char *buffer) const;
+    void getTranslatedSource(GLsizei bufSize, GLsizei *length, char *buffer);
+    void getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length, char *buffer);
 
+    // The translation runs on a worker thread of the compiler. It is joined by resolveCompile,
+    // which the queries of the compile results call, and which Program::link calls for the
+    // attached shaders. The const getters below expect the compile to be resolved.
     void compile(Compiler *compiler);
-    bool isCompiled() const { return mCompiled; }
+    void resolveCompile();
+    bool isCompiled();
 
     void addRef();
     void release();
@@ -131,6 +136,11 @@ class Shader final : angle::NonCopyable, public LabeledObject
     int getSemanticIndex(const std::string &attributeName) const;
 
   private:
+    struct CompilingState;
+
+    // Waits for the translation and returns the compiler handle without gathering the results.
+    void endCompile();
+
     static void getSourceImpl(const std::string &source, GLsizei bufSize, GLsizei *length, char *buffer);
 
     Data mData;
@@ -143,6 +153,9 @@ class Shader final : angle::NonCopyable, public LabeledObject
     bool mCompiled;             // Indicates if this shader has been successfully compiled
     std::string mInfoLog;
 
+    // Set from compile until the compile is resolved.
+    std::unique_ptr<CompilingState> mCompilingState;
+
     ResourceManager *mResourceManager;
 };
 
@@ -591,6 +591,7 @@ void Texture::setImageDesc(GLenum target, size_t level, const ImageDesc &desc)
     ASSERT(descIndex < mImageDescs.size());
     mImageDescs[descIndex] = desc;
     mCompletenessCache.cacheValid = false;
+    notifyObservingFramebuffers();
 }
 
 void Texture::clearImageDesc(GLenum target, size_t level)
@@ -605,6 +606,7 @@ void Texture::clearImageDescs()
         mImageDescs[descIndex] = ImageDesc();
     }
     mCompletenessCache.cacheValid = false;
+    notifyObservingFramebuffers();
 }
 
 void Texture::bindTexImageFromSurface(egl::Surface *surface)
@@ -0,0 +1,179 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// WorkerThread.cpp: Implements the angle::WorkerThreadPool class.
+
+#include "libANGLE/WorkerThread.h"
+
+#include <algorithm>
+
+#include "common/debug.h"
+
+namespace angle
+{
+
+namespace
+{
+
+// Translations are short and each one holds a compiler handle while it runs, so a handful of
+// threads is enough to overlap the compiles an application issues before it links.
+const size_t kMaxDefaultThreads = 4;
+
+}  // anonymous namespace
+
+WaitableEvent::WaitableEvent() : mReady(false)
+{
+}
+
+WaitableEvent::~WaitableEvent()
+{
+}
+
+void WaitableEvent::wait()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.wait(lock, [this]() { return mReady; });
+}
+
+bool WaitableEvent::isReady()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mReady;
+}
+
+void WaitableEvent::signal()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mReady = true;
+    }
+    mCondition.notify_all();
+}
+
+WorkerThreadPool::WorkerThreadPool(size_t maxThreads)
+    : mMaxThreads(maxThreads), mNumIdleThreads(0), mTerminate(false)
+{
+}
+
+WorkerThreadPool::~WorkerThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTerminate = true;
+    }
+    mCondition.notify_all();
+
+    // The threads drain the queue before they exit, so every posted task gets signaled.
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+    ASSERT(mTasks.empty());
+}
+
+size_t WorkerThreadPool::GetDefaultThreadCount()
+{
+    size_t numCores = static_cast<size_t>(std::thread::hardware_concurrency());
+    if (numCores <= 1)
+    {
+        return 0;
+    }
+    return std::min(numCores - 1, kMaxDefaultThreads);
+}
+
+std::shared_ptr<WaitableEvent> WorkerThreadPool::postWorkerTask(const std::function<void()> &task)
+{
+    std::shared_ptr<WaitableEvent> event(new WaitableEvent());
+
+    if (mMaxThreads == 0)
+    {
+        task();
+        event->signal();
+        return event;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        ASSERT(!mTerminate);
+
+        Task newTask;
+        newTask.function = task;
+        newTask.event    = event;
+        mTasks.push_back(newTask);
+
+        if (mNumIdleThreads < mTasks.size() && mThreads.size() < mMaxThreads)
+        {
+            mThreads.push_back(std::thread(&WorkerThreadPool::threadLoop, this));
+        }
+    }
+    mCondition.notify_one();
+
+    return event;
+}
+
+void WorkerThreadPool::threadLoop()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        if (mTasks.empty())
+        {
+            if (mTerminate)
+            {
+                return;
+            }
+
+            mNumIdleThreads++;
+            mCondition.wait(lock, [this]() { return mTerminate || !mTasks.empty(); });
+            mNumIdleThreads--;
+            continue;
+        }
+
+        Task task = mTasks.front();
+        mTasks.pop_front();
+
+        lock.unlock();
+        task.function();
+        task.event->signal();
+        lock.lock();
+    }
+}
+
+size_t GetParallelTaskCount(WorkerThreadPool *pool, size_t unitCount, size_t bytes)
+{
+    if (pool == nullptr || bytes < kMinParallelTaskBytes)
+    {
+        return 1;
+    }
+
+    size_t taskCount = std::min(pool->getMaxThreads() + 1, bytes / kMinParallelTaskBytes);
+    return std::max<size_t>(1, std::min(taskCount, unitCount));
+}
+
+void RunParallelTasks(WorkerThreadPool *pool,
+                      size_t taskCount,
+                      const std::function<void(size_t task)> &function)
+{
+    ASSERT(pool != nullptr || taskCount <= 1);
+
+    std::vector<std::shared_ptr<WaitableEvent>> events;
+    for (size_t task = 1; task < taskCount; task++)
+    {
+        events.push_back(pool->postWorkerTask([&function, task]() { function(task); }));
+    }
+
+    if (taskCount > 0)
+    {
+        function(0);
+    }
+
+    for (const auto &event : events)
+    {
+        event->wait();
+    }
+}
+
+}  // namespace angle
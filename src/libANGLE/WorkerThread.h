@@ -0,0 +1,94 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// WorkerThread.h: Defines the angle::WorkerThreadPool class, a small fixed-size pool of threads
+// that runs tasks posted from the thread that owns the pool.
+
+#ifndef LIBANGLE_WORKERTHREAD_H_
+#define LIBANGLE_WORKERTHREAD_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/angleutils.h"
+
+namespace angle
+{
+
+// Signaled once the task it was returned for has run.
+class WaitableEvent final : angle::NonCopyable
+{
+  public:
+    WaitableEvent();
+    ~WaitableEvent();
+
+    void wait();
+    bool isReady();
+    void signal();
+
+  private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mReady;
+};
+
+class WorkerThreadPool final : angle::NonCopyable
+{
+  public:
+    // A pool without threads runs each task inside postWorkerTask.
+    explicit WorkerThreadPool(size_t maxThreads);
+    ~WorkerThreadPool();
+
+    // Picks a thread count that leaves a core for the thread that posts the tasks.
+    static size_t GetDefaultThreadCount();
+
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::function<void()> &task);
+
+    size_t getMaxThreads() const { return mMaxThreads; }
+
+  private:
+    struct Task
+    {
+        std::function<void()> function;
+        std::shared_ptr<WaitableEvent> event;
+    };
+
+    void threadLoop();
+
+    const size_t mMaxThreads;
+
+    // Threads are started as tasks come in, up to mMaxThreads.
+    std::vector<std::thread> mThreads;
+    size_t mNumIdleThreads;
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::deque<Task> mTasks;
+    bool mTerminate;
+};
+
+// Work smaller than this many bytes is only done on the calling thread, as waking the threads of
+// the pool would cost more than it saves.
+const size_t kMinParallelTaskBytes = 256 * 1024;
+
+// Picks how many tasks to split work of a given size and number of units into: at most one per
+// thread of the pool plus the calling thread, and at most one per unit. Returns 1 without a pool.
+size_t GetParallelTaskCount(WorkerThreadPool *pool, size_t unitCount, size_t bytes);
+
+// Runs the function for each task, on the threads of the pool and the calling thread, and returns
+// once all of them have run.
+void RunParallelTasks(WorkerThreadPool *pool,
+                      size_t taskCount,
+                      const std::function<void(size_t task)> &function);
+
+}  // namespace angle
+
+#endif  // LIBANGLE_WORKERTHREAD_H_
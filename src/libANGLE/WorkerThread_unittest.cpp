@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Unit tests for WorkerThreadPool.
+//
+
+#include <atomic>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/WorkerThread.h"
+
+namespace
+{
+
+// Test that a pool without threads runs each task before returning its event.
+TEST(WorkerThreadPoolTest, RunsInlineWithoutThreads)
+{
+    angle::WorkerThreadPool pool(0);
+
+    int value = 0;
+    std::shared_ptr<angle::WaitableEvent> event = pool.postWorkerTask([&value]() { value = 1; });
+
+    EXPECT_TRUE(event->isReady());
+    EXPECT_EQ(1, value);
+}
+
+// Test that every task posted to a pool with threads runs, and that its event is signaled after
+// its results are written.
+TEST(WorkerThreadPoolTest, RunsAllTasks)
+{
+    const size_t kNumTasks = 100;
+
+    angle::WorkerThreadPool pool(4);
+
+    std::vector<int> results(kNumTasks, 0);
+    std::vector<std::shared_ptr<angle::WaitableEvent>> events;
+    for (size_t taskIndex = 0; taskIndex < kNumTasks; ++taskIndex)
+    {
+        events.push_back(pool.postWorkerTask(
+            [&results, taskIndex]() { results[taskIndex] = static_cast<int>(taskIndex) + 1; }));
+    }
+
+    for (size_t taskIndex = 0; taskIndex < kNumTasks; ++taskIndex)
+    {
+        events[taskIndex]->wait();
+        EXPECT_EQ(static_cast<int>(taskIndex) + 1, results[taskIndex]);
+    }
+}
+
+// Test that destroying the pool runs the tasks that are still queued.
+TEST(WorkerThreadPoolTest, DestructionRunsQueuedTasks)
+{
+    const int kNumTasks = 50;
+
+    std::atomic<int> numRun(0);
+    std::vector<std::shared_ptr<angle::WaitableEvent>> events;
+    {
+        angle::WorkerThreadPool pool(2);
+        for (int taskIndex = 0; taskIndex < kNumTasks; ++taskIndex)
+        {
+            events.push_back(pool.postWorkerTask([&numRun]() { numRun++; }));
+        }
+    }
+
+    EXPECT_EQ(kNumTasks, numRun.load());
+    for (const auto &event : events)
+    {
+        EXPECT_TRUE(event->isReady());
+    }
+}
+
+}  // anonymous namespace
@@ -32,6 +32,13 @@
 #define ANGLE_PROGRAM_BINARY_LOAD ANGLE_ENABLED
 #endif
 
+// Program cache
+// ENABLED restores programs that were linked before with the same inputs from the program cache
+// DISABLED always links programs
+#if !defined(ANGLE_PROGRAM_CACHE)
+#define ANGLE_PROGRAM_CACHE ANGLE_ENABLED
+#endif
+
 // Append HLSL assembly to shader debug info. Defaults to enabled in Debug and off in Release.
 #if !defined(ANGLE_APPEND_ASSEMBLY_TO_SHADER_DEBUG_INFO)
 #if !defined(NDEBUG)
@@ -83,6 +83,18 @@ const InternalFormat &GetInternalFormatInfo(GLenum internalFormat);
 
 GLenum GetSizedInternalFormat(GLenum internalFormat, GLenum type);
 
+// The internal formats known to GetInternalFormatInfo have dense indices, in increasing order of
+// their enum values, for tables indexed by format. The lookups are generated by gen_format_map.py
+// from format_map_data.json into format_map_autogen.cpp. Tables built from them skip a format
+// without an index rather than write out of bounds.
+const size_t kInvalidInternalFormatIndex = static_cast<size_t>(-1);
+size_t GetInternalFormatCount();
+size_t GetInternalFormatIndex(GLenum internalFormat);
+GLenum GetInternalFormatFromIndex(size_t index);
+
+// Sized internal format of an unsized format and type pair, GL_NONE if the pair is invalid.
+GLenum GetSizedFormatInternal(GLenum format, GLenum type);
+
 typedef std::set<GLenum> FormatSet;
 const FormatSet &GetAllSizedInternalFormats();
 
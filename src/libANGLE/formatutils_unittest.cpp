@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// formatutils unit tests:
+//   Checks the generated format tables against the format info.
+//
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/formatutils.h"
+
+using namespace gl;
+
+namespace
+{
+
+// Test that the dense indices of the internal formats round-trip and follow the enum order.
+TEST(FormatUtilsTest, InternalFormatIndices)
+{
+    GLenum previousFormat = 0;
+    for (size_t index = 0; index < GetInternalFormatCount(); ++index)
+    {
+        GLenum internalFormat = GetInternalFormatFromIndex(index);
+        EXPECT_EQ(index, GetInternalFormatIndex(internalFormat));
+        if (index > 0)
+        {
+            EXPECT_LT(previousFormat, internalFormat);
+        }
+        previousFormat = internalFormat;
+    }
+
+    for (GLenum sizedFormat : GetAllSizedInternalFormats())
+    {
+        EXPECT_NE(kInvalidInternalFormatIndex, GetInternalFormatIndex(sizedFormat));
+    }
+
+    EXPECT_EQ(kInvalidInternalFormatIndex, GetInternalFormatIndex(GL_TEXTURE_2D));
+    EXPECT_EQ(kInvalidInternalFormatIndex, GetInternalFormatIndex(0x12345678));
+}
+
+// Test that every sized format looked up from a format and type pair matches them.
+TEST(FormatUtilsTest, SizedFormatsMatchFormatAndType)
+{
+    EXPECT_EQ(static_cast<GLenum>(GL_RGBA8), GetSizedInternalFormat(GL_RGBA, GL_UNSIGNED_BYTE));
+    EXPECT_EQ(static_cast<GLenum>(GL_RGB565),
+              GetSizedInternalFormat(GL_RGB, GL_UNSIGNED_SHORT_5_6_5));
+    EXPECT_EQ(static_cast<GLenum>(GL_NONE), GetSizedInternalFormat(GL_RGB, GL_TEXTURE_2D));
+    EXPECT_EQ(static_cast<GLenum>(GL_NONE), GetSizedInternalFormat(GL_TEXTURE_2D, GL_FLOAT));
+
+    for (size_t index = 0; index < GetInternalFormatCount(); ++index)
+    {
+        const InternalFormat &formatInfo = GetInternalFormatInfo(GetInternalFormatFromIndex(index));
+        if (formatInfo.pixelBytes == 0)
+        {
+            continue;
+        }
+
+        GLenum sizedFormat = GetSizedFormatInternal(formatInfo.format, formatInfo.type);
+        if (sizedFormat != GL_NONE)
+        {
+            const InternalFormat &sizedInfo = GetInternalFormatInfo(sizedFormat);
+            EXPECT_EQ(formatInfo.format, sizedInfo.format);
+            EXPECT_EQ(formatInfo.componentType, sizedInfo.componentType);
+        }
+    }
+}
+
+}  // anonymous namespace
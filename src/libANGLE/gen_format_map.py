@@ -0,0 +1,214 @@
+#!/usr/bin/python
+# Copyright 2016 The ANGLE Project Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+#
+# gen_format_map.py:
+#  Code generation for the dense-index format tables. Each enum set is looked
+#  up through a page table: the high byte of the enum selects a page, and the
+#  low byte an entry in that page holding the dense index plus one. Pages with
+#  no known enum share the empty page 0.
+
+import json
+import os
+import re
+
+template = """// GENERATED FILE - DO NOT EDIT.
+// Generated by gen_format_map.py using data from format_map_data.json.
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// format_map_autogen.cpp:
+//   Dense-index tables for the internal formats and for the format and type pairs of the
+//   TexImage calls. A lookup is two reads from constant tables, which need no initialization
+//   at run time.
+//
+
+#include "libANGLE/formatutils.h"
+
+#include "common/debug.h"
+
+namespace gl
+{{
+
+namespace
+{{
+
+const size_t kNumInternalFormats = {num_internal_formats};
+
+{internal_format_tables}
+
+const size_t kNumUnsizedFormats = {num_unsized_formats};
+
+{unsized_format_tables}
+
+const size_t kNumFormatTypes = {num_format_types};
+
+{format_type_tables}
+
+// Sized internal format of each format and type pair, GL_NONE for invalid pairs.
+const GLenum kSizedInternalFormats[kNumUnsizedFormats][kNumFormatTypes] = {{
+{sized_internal_formats}
+}};
+
+size_t LookupDenseIndex(const uint8_t *pages, const uint8_t (*pageEntries)[256], GLenum value)
+{{
+    if (value > 0xFFFF)
+    {{
+        return kInvalidInternalFormatIndex;
+    }}
+
+    uint8_t entry = pageEntries[pages[value >> 8]][value & 0xFF];
+    return (entry != 0) ? static_cast<size_t>(entry - 1) : kInvalidInternalFormatIndex;
+}}
+
+}}  // anonymous namespace
+
+size_t GetInternalFormatCount()
+{{
+    return kNumInternalFormats;
+}}
+
+size_t GetInternalFormatIndex(GLenum internalFormat)
+{{
+    return LookupDenseIndex(kInternalFormatPages, kInternalFormatPageEntries, internalFormat);
+}}
+
+GLenum GetInternalFormatFromIndex(size_t index)
+{{
+    ASSERT(index < kNumInternalFormats);
+    return kInternalFormats[index];
+}}
+
+GLenum GetSizedFormatInternal(GLenum format, GLenum type)
+{{
+    size_t formatIndex = LookupDenseIndex(kUnsizedFormatPages, kUnsizedFormatPageEntries, format);
+    size_t typeIndex   = LookupDenseIndex(kFormatTypePages, kFormatTypePageEntries, type);
+    if (formatIndex == kInvalidInternalFormatIndex || typeIndex == kInvalidInternalFormatIndex)
+    {{
+        return GL_NONE;
+    }}
+
+    return kSizedInternalFormats[formatIndex][typeIndex];
+}}
+
+}}  // namespace gl
+"""
+
+headers = [
+    '../../include/GLES2/gl2.h',
+    '../../include/GLES2/gl2ext.h',
+    '../../include/GLES3/gl3.h',
+    '../common/angleutils.h',
+]
+
+
+def parse_enum_values():
+    values = {}
+    define = re.compile(r'^#define\s+(GL_\w+)\s+(0x[0-9A-Fa-f]+|\d+)\s*$')
+    for header in headers:
+        with open(header) as header_file:
+            for line in header_file:
+                match = define.match(line)
+                if match:
+                    values[match.group(1)] = int(match.group(2), 0)
+    return values
+
+
+def format_rows(values, per_row, indent):
+    rows = []
+    for start in range(0, len(values), per_row):
+        rows.append(indent + ', '.join(values[start:start + per_row]) + ',')
+    return '\n'.join(rows)
+
+
+def gen_enum_tables(prefix, description, names, enum_values, emit_names):
+    # Dense indices follow the enum values, so that iterating over them visits the enums in
+    # increasing order.
+    names = sorted(set(names), key=lambda name: enum_values[name])
+    values = [enum_values[name] for name in names]
+
+    assert len(values) == len(set(values)), 'Enum aliases in the ' + description + ' set'
+    assert len(values) < 255, 'Too many enums for 8-bit page entries'
+    assert max(values) <= 0xFFFF, 'Enums must fit in two page levels'
+
+    page_of_block = [0] * 256
+    pages = [[0] * 256]
+    for index, value in enumerate(values):
+        block = value >> 8
+        if page_of_block[block] == 0:
+            page_of_block[block] = len(pages)
+            pages.append([0] * 256)
+        pages[page_of_block[block]][value & 0xFF] = index + 1
+
+    assert len(pages) <= 256
+
+    tables = ''
+    if emit_names:
+        tables += '// ' + description + ', sorted by enum value.\n'
+        tables += 'const GLenum k' + prefix + 's[kNum' + prefix + 's] = {\n'
+        tables += '\n'.join('    ' + name + ',' for name in names) + '\n};\n\n'
+
+    tables += '// Page of each block of 256 enum values. Page 0 is empty.\n'
+    tables += 'const uint8_t k' + prefix + 'Pages[256] = {\n'
+    tables += format_rows([str(page) for page in page_of_block], 16, '    ') + '\n};\n\n'
+
+    tables += '// Dense index plus one of each enum value in a page, 0 for unknown values.\n'
+    tables += 'const uint8_t k' + prefix + 'PageEntries[' + str(len(pages)) + '][256] = {\n'
+    for page in pages:
+        tables += '    {\n' + format_rows([str(entry) for entry in page], 16, '        ')
+        tables += '\n    },\n'
+    tables += '};'
+
+    return names, tables
+
+
+def main():
+    os.chdir(os.path.dirname(os.path.abspath(__file__)))
+
+    with open('format_map_data.json') as map_file:
+        map_data = json.loads(map_file.read())
+
+    enum_values = parse_enum_values()
+
+    internal_formats, internal_format_tables = gen_enum_tables(
+        'InternalFormat', 'Internal formats known to GetInternalFormatInfo',
+        map_data['internal_formats'], enum_values, True)
+
+    format_type_map = map_data['format_type_to_internal_format']
+
+    unsized_formats, unsized_format_tables = gen_enum_tables(
+        'UnsizedFormat', 'Formats of the format and type pairs', format_type_map.keys(),
+        enum_values, False)
+
+    all_types = []
+    for types in format_type_map.values():
+        all_types += types.keys()
+
+    format_types, format_type_tables = gen_enum_tables(
+        'FormatType', 'Types of the format and type pairs', all_types, enum_values, False)
+
+    sized_rows = []
+    for format_name in unsized_formats:
+        types = format_type_map[format_name]
+        row = [types.get(type_name, 'GL_NONE') for type_name in format_types]
+        sized_rows.append('    {\n' + '\n'.join('        ' + sized + ',' for sized in row) +
+                          '\n    },')
+
+    output = template.format(
+        num_internal_formats=len(internal_formats),
+        internal_format_tables=internal_format_tables,
+        num_unsized_formats=len(unsized_formats),
+        unsized_format_tables=unsized_format_tables,
+        num_format_types=len(format_types),
+        format_type_tables=format_type_tables,
+        sized_internal_formats='\n'.join(sized_rows))
+
+    with open('format_map_autogen.cpp', 'wt') as out_file:
+        out_file.write(output)
+
+
+if __name__ == '__main__':
+    main()
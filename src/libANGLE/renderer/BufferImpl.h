@@ -30,11 +30,10 @@ class BufferImpl : angle::NonCopyable
     virtual gl::Error mapRange(size_t offset, size_t length, GLbitfield access, GLvoid **mapPtr) = 0;
     virtual gl::Error unmap(GLboolean *result) = 0;
 
-    virtual gl::Error getIndexRange(GLenum type,
-                                    size_t offset,
-                                    size_t count,
-                                    bool primitiveRestartEnabled,
-                                    gl::IndexRange *outRange) = 0;
+    // Gives read access to the buffer data to compute index ranges from, until unmapIndexData
+    // is called.
+    virtual gl::Error mapIndexData(const uint8_t **outData) = 0;
+    virtual void unmapIndexData() = 0;
 };
 
 }
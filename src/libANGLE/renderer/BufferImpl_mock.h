@@ -28,7 +28,8 @@ class MockBufferImpl : public BufferImpl
     MOCK_METHOD4(mapRange, gl::Error(size_t, size_t, GLbitfield, GLvoid **));
     MOCK_METHOD1(unmap, gl::Error(GLboolean *result));
 
-    MOCK_METHOD5(getIndexRange, gl::Error(GLenum, size_t, size_t, bool, gl::IndexRange *));
+    MOCK_METHOD1(mapIndexData, gl::Error(const uint8_t **));
+    MOCK_METHOD0(unmapIndexData, void());
 
     MOCK_METHOD0(destructor, void());
 };
@@ -22,6 +22,78 @@ Renderer::~Renderer()
 {
 }
 
+gl::Error Renderer::multiDrawArrays(const gl::Data &data,
+                                    GLenum mode,
+                                    const GLint *firsts,
+                                    const GLsizei *counts,
+                                    const GLsizei *instanceCounts,
+                                    GLsizei drawCount)
+{
+    for (GLsizei drawIndex = 0; drawIndex < drawCount; ++drawIndex)
+    {
+        if (counts[drawIndex] == 0)
+        {
+            continue;
+        }
+
+        gl::Error error(GL_NO_ERROR);
+        if (instanceCounts == nullptr)
+        {
+            error = drawArrays(data, mode, firsts[drawIndex], counts[drawIndex]);
+        }
+        else if (instanceCounts[drawIndex] > 0)
+        {
+            error = drawArraysInstanced(data, mode, firsts[drawIndex], counts[drawIndex],
+                                        instanceCounts[drawIndex]);
+        }
+
+        if (error.isError())
+        {
+            return error;
+        }
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error Renderer::multiDrawElements(const gl::Data &data,
+                                      GLenum mode,
+                                      const GLsizei *counts,
+                                      GLenum type,
+                                      const GLvoid *const *indices,
+                                      const GLsizei *instanceCounts,
+                                      GLsizei drawCount,
+                                      const gl::IndexRange *indexRanges)
+{
+    for (GLsizei drawIndex = 0; drawIndex < drawCount; ++drawIndex)
+    {
+        // Skip the empty draws and the draws of only primitive restart indices
+        if (counts[drawIndex] == 0 || indexRanges[drawIndex].vertexIndexCount == 0)
+        {
+            continue;
+        }
+
+        gl::Error error(GL_NO_ERROR);
+        if (instanceCounts == nullptr)
+        {
+            error = drawElements(data, mode, counts[drawIndex], type, indices[drawIndex],
+                                 indexRanges[drawIndex]);
+        }
+        else if (instanceCounts[drawIndex] > 0)
+        {
+            error = drawElementsInstanced(data, mode, counts[drawIndex], type, indices[drawIndex],
+                                          instanceCounts[drawIndex], indexRanges[drawIndex]);
+        }
+
+        if (error.isError())
+        {
+            return error;
+        }
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
 void Renderer::ensureCapsInitialized() const
 {
     if (!mCapsInitialized)
@@ -75,6 +75,24 @@ class Renderer : public ImplFactory
                                         const GLvoid *indices,
                                         const gl::IndexRange &indexRange) = 0;
 
+    // Draws a batch of ranges validated together as one GL_ANGLE_multi_draw call. instanceCounts
+    // is nullptr for non-instanced draws. The default implementations draw the ranges one at a
+    // time; renderers with a native multi-draw submit the whole batch.
+    virtual gl::Error multiDrawArrays(const gl::Data &data,
+                                      GLenum mode,
+                                      const GLint *firsts,
+                                      const GLsizei *counts,
+                                      const GLsizei *instanceCounts,
+                                      GLsizei drawCount);
+    virtual gl::Error multiDrawElements(const gl::Data &data,
+                                        GLenum mode,
+                                        const GLsizei *counts,
+                                        GLenum type,
+                                        const GLvoid *const *indices,
+                                        const GLsizei *instanceCounts,
+                                        GLsizei drawCount,
+                                        const gl::IndexRange *indexRanges);
+
     // lost device
     //TODO(jmadill): investigate if this stuff is necessary in GL
     virtual void notifyDeviceLost() = 0;
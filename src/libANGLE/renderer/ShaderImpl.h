@@ -24,8 +24,11 @@ class ShaderImpl : angle::NonCopyable
     // Returns additional ShCompile options.
     virtual int prepareSourceAndReturnOptions(std::stringstream *sourceStream,
                                               std::string *sourcePath) = 0;
-    // Returns success for compiling on the driver. Returns success.
-    virtual bool postTranslateCompile(gl::Compiler *compiler, std::string *infoLog) = 0;
+    // Returns success for compiling on the driver. Returns success. Called on the context's
+    // thread once the translation on compilerHandle is done.
+    virtual bool postTranslateCompile(gl::Compiler *compiler,
+                                      ShHandle compilerHandle,
+                                      std::string *infoLog) = 0;
 
     virtual std::string getDebugInfo() const = 0;
 
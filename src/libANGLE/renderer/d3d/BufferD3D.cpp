@@ -244,21 +244,13 @@ void BufferD3D::promoteStaticUsage(int dataSize)
     }
 }
 
-gl::Error BufferD3D::getIndexRange(GLenum type,
-                                   size_t offset,
-                                   size_t count,
-                                   bool primitiveRestartEnabled,
-                                   gl::IndexRange *outRange)
+gl::Error BufferD3D::mapIndexData(const uint8_t **outData)
 {
-    const uint8_t *data = nullptr;
-    gl::Error error = getData(&data);
-    if (error.isError())
-    {
-        return error;
-    }
+    return getData(outData);
+}
 
-    *outRange = gl::ComputeIndexRange(type, data + offset, count, primitiveRestartEnabled);
-    return gl::Error(GL_NO_ERROR);
+void BufferD3D::unmapIndexData()
+{
 }
 
 }
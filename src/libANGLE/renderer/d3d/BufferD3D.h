@@ -62,11 +62,8 @@ class BufferD3D : public BufferImpl
 
     void promoteStaticUsage(int dataSize);
 
-    gl::Error getIndexRange(GLenum type,
-                            size_t offset,
-                            size_t count,
-                            bool primitiveRestartEnabled,
-                            gl::IndexRange *outRange) override;
+    gl::Error mapIndexData(const uint8_t **outData) override;
+    void unmapIndexData() override;
 
   protected:
     void updateSerial();
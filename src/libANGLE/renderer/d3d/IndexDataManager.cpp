@@ -9,6 +9,7 @@
 
 #include "libANGLE/renderer/d3d/IndexDataManager.h"
 
+#include "common/index_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/renderer/d3d/BufferD3D.h"
 #include "libANGLE/renderer/d3d/IndexBuffer.h"
@@ -21,64 +22,6 @@ namespace rx
 namespace
 {
 
-template <typename InputT, typename DestT>
-void ConvertIndexArray(const void *input,
-                       GLenum sourceType,
-                       void *output,
-                       GLenum destinationType,
-                       GLsizei count,
-                       bool usePrimitiveRestartFixedIndex)
-{
-    const InputT *in = static_cast<const InputT *>(input);
-    DestT *out       = static_cast<DestT *>(output);
-
-    if (usePrimitiveRestartFixedIndex)
-    {
-        InputT srcRestartIndex = static_cast<InputT>(gl::GetPrimitiveRestartIndex(sourceType));
-        DestT destRestartIndex = static_cast<DestT>(gl::GetPrimitiveRestartIndex(destinationType));
-        for (GLsizei i = 0; i < count; i++)
-        {
-            out[i] = (in[i] == srcRestartIndex ? destRestartIndex : static_cast<DestT>(in[i]));
-        }
-    }
-    else
-    {
-        for (GLsizei i = 0; i < count; i++)
-        {
-            out[i] = static_cast<DestT>(in[i]);
-        }
-    }
-}
-
-void ConvertIndices(GLenum sourceType,
-                    GLenum destinationType,
-                    const void *input,
-                    GLsizei count,
-                    void *output,
-                    bool usePrimitiveRestartFixedIndex)
-{
-    if (sourceType == destinationType)
-    {
-        const gl::Type &typeInfo = gl::GetTypeInfo(destinationType);
-        memcpy(output, input, count * typeInfo.bytes);
-        return;
-    }
-
-    if (sourceType == GL_UNSIGNED_BYTE)
-    {
-        ASSERT(destinationType == GL_UNSIGNED_SHORT);
-        ConvertIndexArray<GLubyte, GLushort>(input, sourceType, output, destinationType, count,
-                                             usePrimitiveRestartFixedIndex);
-    }
-    else if (sourceType == GL_UNSIGNED_SHORT)
-    {
-        ASSERT(destinationType == GL_UNSIGNED_INT);
-        ConvertIndexArray<GLushort, GLuint>(input, sourceType, output, destinationType, count,
-                                            usePrimitiveRestartFixedIndex);
-    }
-    else UNREACHABLE();
-}
-
 gl::Error StreamInIndexBuffer(IndexBufferInterface *buffer,
                               const GLvoid *data,
                               unsigned int count,
@@ -110,7 +53,8 @@ gl::Error StreamInIndexBuffer(IndexBufferInterface *buffer,
         return error;
     }
 
-    ConvertIndices(srcType, dstType, data, count, output, usePrimitiveRestartFixedIndex);
+    gl::ConvertIndices(srcType, dstType, data, count, usePrimitiveRestartFixedIndex, output,
+                       nullptr);
 
     error = buffer->unmapBuffer();
     if (error.isError())
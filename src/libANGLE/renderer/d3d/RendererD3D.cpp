@@ -24,6 +24,7 @@
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/State.h"
 #include "libANGLE/VertexArray.h"
+#include "libANGLE/WorkerThread.h"
 
 namespace rx
 {
@@ -689,4 +690,29 @@ gl::DebugAnnotator *RendererD3D::getAnnotator()
     ASSERT(mAnnotator);
     return mAnnotator;
 }
+
+gl::Error RendererD3D::generateMipmapChain(ImageD3D *const *images, size_t imageCount)
+{
+    for (size_t image = 1; image < imageCount; image++)
+    {
+        gl::Error error = generateMipmap(images[image], images[image - 1]);
+        if (error.isError())
+        {
+            return error;
+        }
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+angle::WorkerThreadPool *RendererD3D::getWorkerThreadPool()
+{
+    // The threads are only started once the renderer has work for them.
+    if (!mWorkerThreadPool)
+    {
+        mWorkerThreadPool.reset(
+            new angle::WorkerThreadPool(angle::WorkerThreadPool::GetDefaultThreadCount()));
+    }
+    return mWorkerThreadPool.get();
+}
 }
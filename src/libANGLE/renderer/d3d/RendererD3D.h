@@ -22,6 +22,12 @@
 
 //FIXME(jmadill): std::array is currently prohibited by Chromium style guide
 #include <array>
+#include <memory>
+
+namespace angle
+{
+class WorkerThreadPool;
+}
 
 namespace egl
 {
@@ -216,6 +222,9 @@ class RendererD3D : public Renderer, public BufferFactoryD3D
     // Image operations
     virtual ImageD3D *createImage() = 0;
     virtual gl::Error generateMipmap(ImageD3D *dest, ImageD3D *source) = 0;
+    // Generates images 1 to imageCount - 1 of a mip chain from image 0. The default implementation
+    // generates each image from the previous one with generateMipmap.
+    virtual gl::Error generateMipmapChain(ImageD3D *const *images, size_t imageCount);
     virtual gl::Error generateMipmapsUsingD3D(TextureStorage *storage,
                                               const gl::TextureState &textureState) = 0;
     virtual TextureStorage *createTextureStorage2D(SwapChainD3D *swapChain) = 0;
@@ -238,6 +247,9 @@ class RendererD3D : public Renderer, public BufferFactoryD3D
 
     gl::Error getScratchMemoryBuffer(size_t requestedSize, MemoryBuffer **bufferOut);
 
+    // Runs CPU-side work of the renderer, like mipmap generation, on several threads.
+    angle::WorkerThreadPool *getWorkerThreadPool();
+
     // EXT_debug_marker
     void insertEventMarker(GLsizei length, const char *marker) override;
     void pushGroupMarker(GLsizei length, const char *marker) override;
@@ -330,6 +342,8 @@ class RendererD3D : public Renderer, public BufferFactoryD3D
 
     mutable bool mWorkaroundsInitialized;
     mutable WorkaroundsD3D mWorkarounds;
+
+    std::unique_ptr<angle::WorkerThreadPool> mWorkerThreadPool;
 };
 
 }
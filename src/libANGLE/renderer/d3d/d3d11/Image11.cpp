@@ -19,6 +19,8 @@
 #include "libANGLE/renderer/d3d/d3d11/RenderTarget11.h"
 #include "libANGLE/renderer/d3d/d3d11/texture_format_table.h"
 #include "libANGLE/renderer/d3d/d3d11/TextureStorage11.h"
+#include "libANGLE/renderer/d3d/generatemip.h"
+#include "libANGLE/renderer/d3d/loadimage.h"
 
 namespace rx
 {
@@ -68,9 +70,10 @@ gl::Error Image11::generateMipmap(Image11 *dest, Image11 *src)
     const uint8_t *sourceData = reinterpret_cast<const uint8_t*>(srcMapped.pData);
     uint8_t *destData = reinterpret_cast<uint8_t*>(destMapped.pData);
 
-    dxgiFormatInfo.mipGenerationFunction(src->getWidth(), src->getHeight(), src->getDepth(),
-                                         sourceData, srcMapped.RowPitch, srcMapped.DepthPitch,
-                                         destData, destMapped.RowPitch, destMapped.DepthPitch);
+    GenerateMipInParallel(dest->mRenderer->getWorkerThreadPool(),
+                          dxgiFormatInfo.mipGenerationFunction, src->getWidth(), src->getHeight(),
+                          src->getDepth(), sourceData, srcMapped.RowPitch, srcMapped.DepthPitch,
+                          destData, destMapped.RowPitch, destMapped.DepthPitch);
 
     dest->unmap();
     src->unmap();
@@ -80,6 +83,68 @@ gl::Error Image11::generateMipmap(Image11 *dest, Image11 *src)
     return gl::Error(GL_NO_ERROR);
 }
 
+gl::Error Image11::generateMipmapChain(Image11 *const *images, size_t imageCount)
+{
+    ASSERT(imageCount > 0);
+    Image11 *baseImage = images[0];
+
+    const d3d11::DXGIFormat &dxgiFormatInfo = d3d11::GetDXGIFormatInfo(baseImage->getDXGIFormat());
+    ASSERT(dxgiFormatInfo.mipGenerationFunction != NULL);
+
+    // Every image is mapped at once, so that the levels can be generated a band at a time. The
+    // images in the middle of the chain are both read and written.
+    std::vector<MipLevelData> levels(imageCount);
+    for (size_t imageIndex = 0; imageIndex < imageCount; imageIndex++)
+    {
+        Image11 *image = images[imageIndex];
+        ASSERT(image->getDXGIFormat() == baseImage->getDXGIFormat());
+
+        D3D11_MAP mapType = D3D11_MAP_READ_WRITE;
+        if (imageIndex == 0)
+        {
+            mapType = D3D11_MAP_READ;
+        }
+        else if (imageIndex == imageCount - 1)
+        {
+            mapType = D3D11_MAP_WRITE;
+        }
+
+        D3D11_MAPPED_SUBRESOURCE mapped;
+        gl::Error error = image->map(mapType, &mapped);
+        if (error.isError())
+        {
+            for (size_t mappedIndex = 0; mappedIndex < imageIndex; mappedIndex++)
+            {
+                images[mappedIndex]->unmap();
+            }
+            return error;
+        }
+
+        MipLevelData &level = levels[imageIndex];
+        level.data          = reinterpret_cast<uint8_t *>(mapped.pData);
+        level.width         = image->getWidth();
+        level.height        = image->getHeight();
+        level.depth         = image->getDepth();
+        level.rowPitch      = mapped.RowPitch;
+        level.depthPitch    = mapped.DepthPitch;
+    }
+
+    GenerateMipChain(baseImage->mRenderer->getWorkerThreadPool(),
+                     dxgiFormatInfo.mipGenerationFunction, dxgiFormatInfo.pixelBytes,
+                     levels.data(), imageCount);
+
+    for (size_t imageIndex = 0; imageIndex < imageCount; imageIndex++)
+    {
+        images[imageIndex]->unmap();
+        if (imageIndex > 0)
+        {
+            images[imageIndex]->markDirty();
+        }
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
 bool Image11::isDirty() const
 {
     // If mDirty is true
@@ -304,9 +369,24 @@ gl::Error Image11::loadCompressedData(const gl::Box &area, const void *input)
                                                                            (area.x / outputBlockWidth) * outputPixelSize +
                                                                            area.z * mappedImage.DepthPitch);
 
-    loadFunction(area.width, area.height, area.depth,
-                 reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch,
-                 offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+    if (outputBlockHeight > 1)
+    {
+        // The texture has the same block compressed format, and the blocks are only copied.
+        loadFunction(area.width, area.height, area.depth, reinterpret_cast<const uint8_t *>(input),
+                     inputRowPitch, inputDepthPitch, offsetMappedData, mappedImage.RowPitch,
+                     mappedImage.DepthPitch);
+    }
+    else
+    {
+        // Formats without a compressed DXGI format, like ETC, are decoded on the CPU, which is
+        // worth spreading over the threads of the pool.
+        LoadCompressedImageInParallel(mRenderer->getWorkerThreadPool(), loadFunction,
+                                      formatInfo.compressedBlockHeight, outputBlockHeight,
+                                      area.width, area.height, area.depth,
+                                      reinterpret_cast<const uint8_t *>(input), inputRowPitch,
+                                      inputDepthPitch, offsetMappedData, mappedImage.RowPitch,
+                                      mappedImage.DepthPitch);
+    }
 
     unmap();
 
@@ -33,6 +33,7 @@ class Image11 : public ImageD3D
     virtual ~Image11();
 
     static gl::Error generateMipmap(Image11 *dest, Image11 *src);
+    static gl::Error generateMipmapChain(Image11 *const *images, size_t imageCount);
 
     virtual bool isDirty() const;
 
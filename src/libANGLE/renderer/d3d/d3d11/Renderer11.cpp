@@ -3834,6 +3834,16 @@ gl::Error Renderer11::generateMipmap(ImageD3D *dest, ImageD3D *src)
     return Image11::generateMipmap(dest11, src11);
 }
 
+gl::Error Renderer11::generateMipmapChain(ImageD3D *const *images, size_t imageCount)
+{
+    std::vector<Image11 *> images11(imageCount);
+    for (size_t image = 0; image < imageCount; image++)
+    {
+        images11[image] = GetAs<Image11>(images[image]);
+    }
+    return Image11::generateMipmapChain(images11.data(), imageCount);
+}
+
 gl::Error Renderer11::generateMipmapsUsingD3D(TextureStorage *storage,
                                               const gl::TextureState &textureState)
 {
@@ -213,6 +213,7 @@ class Renderer11 : public RendererD3D
     // Image operations
     virtual ImageD3D *createImage();
     gl::Error generateMipmap(ImageD3D *dest, ImageD3D *source) override;
+    gl::Error generateMipmapChain(ImageD3D *const *images, size_t imageCount) override;
     gl::Error generateMipmapsUsingD3D(TextureStorage *storage,
                                       const gl::TextureState &textureState) override;
     virtual TextureStorage *createTextureStorage2D(SwapChainD3D *swapChain);
@@ -0,0 +1,575 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemip.cpp: Implements the row kernels of GenerateMip, and the functions running mip
+// generation functions over several threads and over whole mip chains.
+
+#include "libANGLE/renderer/d3d/generatemip.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "common/platform.h"
+#include "libANGLE/WorkerThread.h"
+
+#if defined(ANGLE_USE_SSE)
+#include <emmintrin.h>
+#endif
+
+namespace rx
+{
+
+namespace
+{
+
+// The bands of level 0 rows that GenerateMipChain generates levels from are this many levels deep.
+const size_t kChainBandLevels = 5;
+const size_t kChainBandRows   = 1 << kChainBandLevels;
+
+size_t GetComponentBytes(priv::MipRowKernel kernel)
+{
+    switch (kernel)
+    {
+        case priv::MIP_ROW_KERNEL_UNSIGNED8:
+            return 1;
+        case priv::MIP_ROW_KERNEL_UNSIGNED16:
+        case priv::MIP_ROW_KERNEL_FLOAT16:
+            return 2;
+        case priv::MIP_ROW_KERNEL_UNSIGNED32:
+        case priv::MIP_ROW_KERNEL_FLOAT32:
+            return 4;
+        default:
+            UNREACHABLE();
+            return 1;
+    }
+}
+
+// Averages the components of the same type one at a time, like the average functions of the
+// formats.
+void AverageComponents(priv::MipRowKernel kernel,
+                       uint8_t *dest,
+                       const uint8_t *source0,
+                       const uint8_t *source1,
+                       size_t size)
+{
+    switch (kernel)
+    {
+        case priv::MIP_ROW_KERNEL_UNSIGNED8:
+            for (size_t i = 0; i < size; i++)
+            {
+                dest[i] = gl::average(source0[i], source1[i]);
+            }
+            break;
+        case priv::MIP_ROW_KERNEL_UNSIGNED16:
+            for (size_t i = 0; i < size / 2; i++)
+            {
+                reinterpret_cast<unsigned short *>(dest)[i] =
+                    gl::average(reinterpret_cast<const unsigned short *>(source0)[i],
+                                reinterpret_cast<const unsigned short *>(source1)[i]);
+            }
+            break;
+        case priv::MIP_ROW_KERNEL_UNSIGNED32:
+            for (size_t i = 0; i < size / 4; i++)
+            {
+                reinterpret_cast<unsigned int *>(dest)[i] =
+                    gl::average(reinterpret_cast<const unsigned int *>(source0)[i],
+                                reinterpret_cast<const unsigned int *>(source1)[i]);
+            }
+            break;
+        case priv::MIP_ROW_KERNEL_FLOAT16:
+            for (size_t i = 0; i < size / 2; i++)
+            {
+                reinterpret_cast<unsigned short *>(dest)[i] =
+                    gl::averageHalfFloat(reinterpret_cast<const unsigned short *>(source0)[i],
+                                         reinterpret_cast<const unsigned short *>(source1)[i]);
+            }
+            break;
+        case priv::MIP_ROW_KERNEL_FLOAT32:
+            for (size_t i = 0; i < size / 4; i++)
+            {
+                reinterpret_cast<float *>(dest)[i] =
+                    gl::average(reinterpret_cast<const float *>(source0)[i],
+                                reinterpret_cast<const float *>(source1)[i]);
+            }
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
+// Averages the pixel pairs of the destination bytes [begin, end) one pixel at a time, the way
+// AveragePixelPairs does.
+void AveragePixelPairsScalar(priv::MipRowKernel kernel,
+                             size_t pixelBytes,
+                             uint8_t *dest,
+                             const uint8_t *source0,
+                             const uint8_t *source1,
+                             size_t begin,
+                             size_t end)
+{
+    ASSERT(pixelBytes % GetComponentBytes(kernel) == 0);
+    ASSERT(pixelBytes <= 16);
+    for (size_t i = begin; i < end; i += pixelBytes)
+    {
+        const uint8_t *pixels = source0 + i * 2;
+        uint8_t rowAverage[32];
+        if (source1 != nullptr)
+        {
+            AverageComponents(kernel, rowAverage, pixels, source1 + i * 2, pixelBytes * 2);
+            pixels = rowAverage;
+        }
+        AverageComponents(kernel, dest + i, pixels, pixels + pixelBytes, pixelBytes);
+    }
+}
+
+#if defined(ANGLE_USE_SSE)
+
+// Converts the half floats in the low 16 bits of each lane to floats. Every half float, including
+// the denormals, is exactly representable so this matches gl::float16ToFloat32.
+ANGLE_SSE2_FUNCTION __m128 HalfToFloatSSE2(__m128i halves)
+{
+    const __m128i noSignMask   = _mm_set1_epi32(0x7FFF);
+    const __m128 magic         = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+    const __m128i maxFinite    = _mm_set1_epi32(0x7BFF);
+    const __m128 infNaNExponent = _mm_castsi128_ps(_mm_set1_epi32(255 << 23));
+
+    __m128i exponentMantissa = _mm_and_si128(halves, noSignMask);
+    __m128i sign             = _mm_slli_epi32(_mm_xor_si128(halves, exponentMantissa), 16);
+
+    // Scaling by 2^112 rebiases the exponent and normalizes the denormals.
+    __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponentMantissa, 13)), magic);
+    __m128 infNaN = _mm_and_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(exponentMantissa, maxFinite)),
+                               infNaNExponent);
+    return _mm_or_ps(_mm_or_ps(scaled, infNaN), _mm_castsi128_ps(sign));
+}
+
+// Converts floats to half floats in the low 16 bits of each lane, rounding like
+// gl::float32ToFloat16. Returns false if a lane needs the denormal conversion, which is left to
+// the scalar code.
+ANGLE_SSE2_FUNCTION bool FloatToHalfSSE2(__m128 floats, __m128i *outHalves)
+{
+    __m128i bits = _mm_castps_si128(floats);
+    __m128i abs  = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+    __m128i sign = _mm_srli_epi32(_mm_andnot_si128(_mm_set1_epi32(0x7FFFFFFF), bits), 16);
+
+    // Lanes below 2^-37 convert to zero, the ones above it and below 2^-14 are denormals.
+    __m128i zero      = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x2D000000));
+    __m128i denormal  = _mm_andnot_si128(zero, _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000)));
+    if (_mm_movemask_epi8(denormal) != 0)
+    {
+        return false;
+    }
+
+    __m128i infinity = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x47FFEFFF));
+    __m128i rounding = _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(1));
+    __m128i normal   = _mm_add_epi32(_mm_add_epi32(abs, _mm_set1_epi32(0xC8000FFF)), rounding);
+    normal           = _mm_srli_epi32(normal, 13);
+
+    __m128i halves = _mm_or_si128(_mm_and_si128(infinity, _mm_set1_epi32(0x7FFF)),
+                                  _mm_andnot_si128(infinity, normal));
+    halves     = _mm_andnot_si128(zero, halves);
+    *outHalves = _mm_or_si128(halves, sign);
+    return true;
+}
+
+// Packs the low 16 bits of the 32-bit lanes of two vectors, without the signed saturation of
+// _mm_packs_epi32.
+ANGLE_SSE2_FUNCTION __m128i PackLow16SSE2(__m128i low, __m128i high)
+{
+    const __m128i bias = _mm_set1_epi32(0x8000);
+    __m128i packed     = _mm_packs_epi32(_mm_sub_epi32(low, bias), _mm_sub_epi32(high, bias));
+    return _mm_xor_si128(packed, _mm_set1_epi16(static_cast<short>(0x8000)));
+}
+
+// Averages 16 bytes of components, returning false if the scalar code has to do it. Kernel is a
+// template parameter so that the loops below dispatch on it once per row.
+template <priv::MipRowKernel Kernel>
+ANGLE_SSE2_FUNCTION inline bool AverageSSE2(__m128i a, __m128i b, __m128i *outAverage)
+{
+    switch (Kernel)
+    {
+        case priv::MIP_ROW_KERNEL_UNSIGNED8:
+            // _mm_avg_epu8 rounds up, the formats round down.
+            *outAverage = _mm_sub_epi8(_mm_avg_epu8(a, b),
+                                       _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1)));
+            return true;
+        case priv::MIP_ROW_KERNEL_UNSIGNED16:
+            *outAverage = _mm_sub_epi16(_mm_avg_epu16(a, b),
+                                        _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi16(1)));
+            return true;
+        case priv::MIP_ROW_KERNEL_UNSIGNED32:
+            *outAverage =
+                _mm_add_epi32(_mm_srli_epi32(_mm_xor_si128(a, b), 1), _mm_and_si128(a, b));
+            return true;
+        case priv::MIP_ROW_KERNEL_FLOAT16:
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128 half  = _mm_set1_ps(0.5f);
+            __m128 low  = _mm_mul_ps(_mm_add_ps(HalfToFloatSSE2(_mm_unpacklo_epi16(a, zero)),
+                                                HalfToFloatSSE2(_mm_unpacklo_epi16(b, zero))),
+                                     half);
+            __m128 high = _mm_mul_ps(_mm_add_ps(HalfToFloatSSE2(_mm_unpackhi_epi16(a, zero)),
+                                                HalfToFloatSSE2(_mm_unpackhi_epi16(b, zero))),
+                                     half);
+            __m128i lowHalves;
+            __m128i highHalves;
+            if (!FloatToHalfSSE2(low, &lowHalves) || !FloatToHalfSSE2(high, &highHalves))
+            {
+                return false;
+            }
+            *outAverage = PackLow16SSE2(lowHalves, highHalves);
+            return true;
+        }
+        case priv::MIP_ROW_KERNEL_FLOAT32:
+            *outAverage = _mm_castps_si128(_mm_mul_ps(
+                _mm_add_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)), _mm_set1_ps(0.5f)));
+            return true;
+        default:
+            UNREACHABLE();
+            return false;
+    }
+}
+
+// Splits 32 bytes of pixels into the vectors of the even and the odd pixels.
+template <size_t PixelBytes>
+ANGLE_SSE2_FUNCTION inline void DeinterleavePixelsSSE2(__m128i pixels0,
+                                                       __m128i pixels1,
+                                                       __m128i *outEven,
+                                                       __m128i *outOdd)
+{
+    switch (PixelBytes)
+    {
+        case 1:
+        {
+            const __m128i mask = _mm_set1_epi16(0x00FF);
+            *outEven = _mm_packus_epi16(_mm_and_si128(pixels0, mask), _mm_and_si128(pixels1, mask));
+            *outOdd  = _mm_packus_epi16(_mm_srli_epi16(pixels0, 8), _mm_srli_epi16(pixels1, 8));
+            break;
+        }
+        case 2:
+        {
+            const __m128i mask = _mm_set1_epi32(0xFFFF);
+            *outEven = PackLow16SSE2(_mm_and_si128(pixels0, mask), _mm_and_si128(pixels1, mask));
+            *outOdd  = PackLow16SSE2(_mm_srli_epi32(pixels0, 16), _mm_srli_epi32(pixels1, 16));
+            break;
+        }
+        case 4:
+        {
+            __m128 pixels0f = _mm_castsi128_ps(pixels0);
+            __m128 pixels1f = _mm_castsi128_ps(pixels1);
+            *outEven =
+                _mm_castps_si128(_mm_shuffle_ps(pixels0f, pixels1f, _MM_SHUFFLE(2, 0, 2, 0)));
+            *outOdd =
+                _mm_castps_si128(_mm_shuffle_ps(pixels0f, pixels1f, _MM_SHUFFLE(3, 1, 3, 1)));
+            break;
+        }
+        case 8:
+            *outEven = _mm_unpacklo_epi64(pixels0, pixels1);
+            *outOdd  = _mm_unpackhi_epi64(pixels0, pixels1);
+            break;
+        case 16:
+            *outEven = pixels0;
+            *outOdd  = pixels1;
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
+// Return the number of bytes of the destination row that were averaged.
+template <priv::MipRowKernel Kernel>
+ANGLE_SSE2_FUNCTION size_t AverageRowsSSE2(uint8_t *dest,
+                                           const uint8_t *source0,
+                                           const uint8_t *source1,
+                                           size_t size)
+{
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source0 + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source1 + i));
+        __m128i average;
+        if (!AverageSSE2<Kernel>(a, b, &average))
+        {
+            AverageComponents(Kernel, dest + i, source0 + i, source1 + i, 16);
+            continue;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), average);
+    }
+    return i;
+}
+
+template <priv::MipRowKernel Kernel, size_t PixelBytes>
+ANGLE_SSE2_FUNCTION size_t AveragePixelPairsSSE2(uint8_t *dest,
+                                                 const uint8_t *source0,
+                                                 const uint8_t *source1,
+                                                 size_t destSize)
+{
+    size_t i = 0;
+    for (; i + 16 <= destSize; i += 16)
+    {
+        __m128i pixels0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source0 + i * 2));
+        __m128i pixels1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source0 + i * 2 + 16));
+        if (source1 != nullptr)
+        {
+            __m128i rowPixels0 =
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(source1 + i * 2));
+            __m128i rowPixels1 =
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(source1 + i * 2 + 16));
+            if (!AverageSSE2<Kernel>(pixels0, rowPixels0, &pixels0) ||
+                !AverageSSE2<Kernel>(pixels1, rowPixels1, &pixels1))
+            {
+                AveragePixelPairsScalar(Kernel, PixelBytes, dest, source0, source1, i, i + 16);
+                continue;
+            }
+        }
+
+        __m128i even;
+        __m128i odd;
+        DeinterleavePixelsSSE2<PixelBytes>(pixels0, pixels1, &even, &odd);
+
+        __m128i average;
+        if (!AverageSSE2<Kernel>(even, odd, &average))
+        {
+            uint8_t evenBytes[16];
+            uint8_t oddBytes[16];
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(evenBytes), even);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(oddBytes), odd);
+            AverageComponents(Kernel, dest + i, evenBytes, oddBytes, 16);
+            continue;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), average);
+    }
+    return i;
+}
+
+ANGLE_SSE2_FUNCTION size_t AverageRowsSSE2(priv::MipRowKernel kernel,
+                                           uint8_t *dest,
+                                           const uint8_t *source0,
+                                           const uint8_t *source1,
+                                           size_t size)
+{
+    switch (kernel)
+    {
+        case priv::MIP_ROW_KERNEL_UNSIGNED8:
+            return AverageRowsSSE2<priv::MIP_ROW_KERNEL_UNSIGNED8>(dest, source0, source1, size);
+        case priv::MIP_ROW_KERNEL_UNSIGNED16:
+            return AverageRowsSSE2<priv::MIP_ROW_KERNEL_UNSIGNED16>(dest, source0, source1, size);
+        case priv::MIP_ROW_KERNEL_UNSIGNED32:
+            return AverageRowsSSE2<priv::MIP_ROW_KERNEL_UNSIGNED32>(dest, source0, source1, size);
+        case priv::MIP_ROW_KERNEL_FLOAT16:
+            return AverageRowsSSE2<priv::MIP_ROW_KERNEL_FLOAT16>(dest, source0, source1, size);
+        case priv::MIP_ROW_KERNEL_FLOAT32:
+            return AverageRowsSSE2<priv::MIP_ROW_KERNEL_FLOAT32>(dest, source0, source1, size);
+        default:
+            UNREACHABLE();
+            return 0;
+    }
+}
+
+// Dispatches on the pixel sizes of the formats of each kernel. Other sizes are left to the scalar
+// code.
+template <priv::MipRowKernel Kernel>
+ANGLE_SSE2_FUNCTION size_t AveragePixelPairsSSE2(size_t pixelBytes,
+                                                 uint8_t *dest,
+                                                 const uint8_t *source0,
+                                                 const uint8_t *source1,
+                                                 size_t destSize)
+{
+    switch (pixelBytes)
+    {
+        case 1:
+            return AveragePixelPairsSSE2<Kernel, 1>(dest, source0, source1, destSize);
+        case 2:
+            return AveragePixelPairsSSE2<Kernel, 2>(dest, source0, source1, destSize);
+        case 4:
+            return AveragePixelPairsSSE2<Kernel, 4>(dest, source0, source1, destSize);
+        case 8:
+            return AveragePixelPairsSSE2<Kernel, 8>(dest, source0, source1, destSize);
+        case 16:
+            return AveragePixelPairsSSE2<Kernel, 16>(dest, source0, source1, destSize);
+        default:
+            return 0;
+    }
+}
+
+ANGLE_SSE2_FUNCTION size_t AveragePixelPairsSSE2(priv::MipRowKernel kernel,
+                                                 size_t pixelBytes,
+                                                 uint8_t *dest,
+                                                 const uint8_t *source0,
+                                                 const uint8_t *source1,
+                                                 size_t destSize)
+{
+    switch (kernel)
+    {
+        case priv::MIP_ROW_KERNEL_UNSIGNED8:
+            return AveragePixelPairsSSE2<priv::MIP_ROW_KERNEL_UNSIGNED8>(
+                pixelBytes, dest, source0, source1, destSize);
+        case priv::MIP_ROW_KERNEL_UNSIGNED16:
+            return AveragePixelPairsSSE2<priv::MIP_ROW_KERNEL_UNSIGNED16>(
+                pixelBytes, dest, source0, source1, destSize);
+        case priv::MIP_ROW_KERNEL_UNSIGNED32:
+            return AveragePixelPairsSSE2<priv::MIP_ROW_KERNEL_UNSIGNED32>(
+                pixelBytes, dest, source0, source1, destSize);
+        case priv::MIP_ROW_KERNEL_FLOAT16:
+            return AveragePixelPairsSSE2<priv::MIP_ROW_KERNEL_FLOAT16>(
+                pixelBytes, dest, source0, source1, destSize);
+        case priv::MIP_ROW_KERNEL_FLOAT32:
+            return AveragePixelPairsSSE2<priv::MIP_ROW_KERNEL_FLOAT32>(
+                pixelBytes, dest, source0, source1, destSize);
+        default:
+            UNREACHABLE();
+            return 0;
+    }
+}
+
+#endif  // defined(ANGLE_USE_SSE)
+
+}  // anonymous namespace
+
+namespace priv
+{
+
+void AverageRows(MipRowKernel kernel, uint8_t *dest, const uint8_t *source0,
+                 const uint8_t *source1, size_t size)
+{
+    size_t averaged = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        averaged = AverageRowsSSE2(kernel, dest, source0, source1, size);
+    }
+#endif
+
+    AverageComponents(kernel, dest + averaged, source0 + averaged, source1 + averaged,
+                      size - averaged);
+}
+
+void AveragePixelPairs(MipRowKernel kernel, size_t pixelBytes, uint8_t *dest,
+                       const uint8_t *source0, const uint8_t *source1, size_t destWidth)
+{
+    size_t destSize = destWidth * pixelBytes;
+    size_t averaged = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        averaged = AveragePixelPairsSSE2(kernel, pixelBytes, dest, source0, source1, destSize);
+    }
+#endif
+
+    AveragePixelPairsScalar(kernel, pixelBytes, dest, source0, source1, averaged, destSize);
+}
+
+}  // namespace priv
+
+void GenerateMipInParallel(angle::WorkerThreadPool *pool, MipGenerationFunction function,
+                           size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                           const uint8_t *sourceData, size_t sourceRowPitch,
+                           size_t sourceDepthPitch, uint8_t *destData, size_t destRowPitch,
+                           size_t destDepthPitch)
+{
+    size_t destHeight = std::max<size_t>(1, sourceHeight >> 1);
+    size_t destDepth  = std::max<size_t>(1, sourceDepth >> 1);
+
+    // Split 3D images into bands of slices and 2D images into bands of rows. Each band has at least
+    // two source slices or rows, so it is averaged along the same dimensions as the whole image.
+    bool splitSlices = sourceDepth > 1;
+    bool splitRows   = !splitSlices && sourceHeight > 1;
+    size_t unitCount = splitSlices ? destDepth : (splitRows ? destHeight : 1);
+    size_t taskCount = angle::GetParallelTaskCount(pool, unitCount, destRowPitch * destHeight * destDepth);
+
+    if (taskCount == 1)
+    {
+        function(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                 sourceDepthPitch, destData, destRowPitch, destDepthPitch);
+        return;
+    }
+
+    size_t sourceUnitPitch = splitSlices ? sourceDepthPitch : sourceRowPitch;
+    size_t destUnitPitch   = splitSlices ? destDepthPitch : destRowPitch;
+
+    angle::RunParallelTasks(pool, taskCount, [&](size_t task) {
+        size_t firstUnit = unitCount * task / taskCount;
+        size_t endUnit   = unitCount * (task + 1) / taskCount;
+        size_t bandSize  = (endUnit - firstUnit) * 2;
+
+        function(sourceWidth, splitRows ? bandSize : sourceHeight,
+                 splitSlices ? bandSize : sourceDepth,
+                 sourceData + firstUnit * 2 * sourceUnitPitch, sourceRowPitch, sourceDepthPitch,
+                 destData + firstUnit * destUnitPitch, destRowPitch, destDepthPitch);
+    });
+}
+
+void GenerateMipChain(angle::WorkerThreadPool *pool, MipGenerationFunction function,
+                      size_t pixelBytes, const MipLevelData *levels, size_t levelCount)
+{
+    // Bands are only used while each level is averaged along both dimensions, the same as in the
+    // whole image.
+    size_t bandLevelCount = 1;
+    while (bandLevelCount < levelCount && bandLevelCount <= kChainBandLevels &&
+           levels[0].depth == 1 && levels[bandLevelCount - 1].width > 1 &&
+           levels[bandLevelCount - 1].height > 1)
+    {
+        bandLevelCount++;
+    }
+
+    size_t firstUnbandedLevel = 1;
+    if (bandLevelCount > 2)
+    {
+        // Each band covers a power of two number of rows at each level, clipped to the level.
+        size_t bandCount = (levels[1].height + kChainBandRows / 2 - 1) / (kChainBandRows / 2);
+        size_t taskCount = angle::GetParallelTaskCount(pool, bandCount, levels[0].rowPitch * levels[0].height);
+
+        angle::RunParallelTasks(pool, taskCount, [&](size_t task) {
+            size_t firstBand = bandCount * task / taskCount;
+            size_t endBand   = bandCount * (task + 1) / taskCount;
+            for (size_t band = firstBand; band < endBand; band++)
+            {
+                size_t bandY = band * kChainBandRows;
+                for (size_t level = 1; level < bandLevelCount; level++)
+                {
+                    const MipLevelData &source = levels[level - 1];
+                    const MipLevelData &dest   = levels[level];
+
+                    size_t destY      = bandY >> level;
+                    size_t destHeight = std::min(dest.height, (bandY + kChainBandRows) >> level);
+                    if (destY >= destHeight)
+                    {
+                        break;
+                    }
+                    destHeight -= destY;
+
+                    function(dest.width * 2, destHeight * 2, 1,
+                             source.data + destY * 2 * source.rowPitch, source.rowPitch,
+                             source.depthPitch, dest.data + destY * dest.rowPitch, dest.rowPitch,
+                             dest.depthPitch);
+                }
+            }
+        });
+
+        firstUnbandedLevel = bandLevelCount;
+    }
+
+    for (size_t level = firstUnbandedLevel; level < levelCount; level++)
+    {
+        const MipLevelData &source = levels[level - 1];
+        const MipLevelData &dest   = levels[level];
+        ASSERT(dest.width == std::max<size_t>(1, source.width >> 1));
+        ASSERT(dest.height == std::max<size_t>(1, source.height >> 1));
+        ASSERT(dest.depth == std::max<size_t>(1, source.depth >> 1));
+
+        GenerateMipInParallel(pool, function, source.width, source.height, source.depth,
+                              source.data, source.rowPitch, source.depthPitch, dest.data,
+                              dest.rowPitch, dest.depthPitch);
+    }
+}
+
+}
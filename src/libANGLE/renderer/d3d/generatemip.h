@@ -10,9 +10,15 @@
 #ifndef LIBANGLE_RENDERER_D3D_GENERATEMIP_H_
 #define LIBANGLE_RENDERER_D3D_GENERATEMIP_H_
 
+#include "libANGLE/renderer/d3d/formatutilsD3D.h"
 #include "libANGLE/renderer/d3d/imageformats.h"
 #include "libANGLE/angletypes.h"
 
+namespace angle
+{
+class WorkerThreadPool;
+}
+
 namespace rx
 {
 
@@ -21,6 +27,57 @@ inline void GenerateMip(size_t sourceWidth, size_t sourceHeight, size_t sourceDe
                         const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
                         uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
 
+// Runs a mip generation function over bands of the destination slices, or rows for 2D images, on
+// the threads of the pool and the calling thread. Small images and a null pool run it at once.
+void GenerateMipInParallel(angle::WorkerThreadPool *pool, MipGenerationFunction function,
+                           size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                           const uint8_t *sourceData, size_t sourceRowPitch,
+                           size_t sourceDepthPitch, uint8_t *destData, size_t destRowPitch,
+                           size_t destDepthPitch);
+
+struct MipLevelData
+{
+    uint8_t *data;
+    size_t width;
+    size_t height;
+    size_t depth;
+    size_t rowPitch;
+    size_t depthPitch;
+};
+
+// Generates levels 1 to levelCount - 1 of a mip chain from level 0. The first levels of 2D images
+// are generated a band of level 0 rows at a time, down to a single row per band, so that each
+// level is read from the cache right after it is written. The remaining levels are generated one
+// at a time with GenerateMipInParallel.
+void GenerateMipChain(angle::WorkerThreadPool *pool, MipGenerationFunction function,
+                      size_t pixelBytes, const MipLevelData *levels, size_t levelCount);
+
+namespace priv
+{
+
+// The component types of the formats whose mips are generated a row at a time with vectorized
+// kernels, which give the same results as T::average.
+enum MipRowKernel
+{
+    MIP_ROW_KERNEL_NONE,
+    MIP_ROW_KERNEL_UNSIGNED8,
+    MIP_ROW_KERNEL_UNSIGNED16,
+    MIP_ROW_KERNEL_UNSIGNED32,
+    MIP_ROW_KERNEL_FLOAT16,
+    MIP_ROW_KERNEL_FLOAT32,
+};
+
+// Averages the components of two rows of size bytes.
+void AverageRows(MipRowKernel kernel, uint8_t *dest, const uint8_t *source0,
+                 const uint8_t *source1, size_t size);
+
+// Averages each pair of adjacent pixels of source0 into a pixel of the destination row. If source1
+// isn't null, the pixels of source0 are first averaged with those of source1, the next row.
+void AveragePixelPairs(MipRowKernel kernel, size_t pixelBytes, uint8_t *dest,
+                       const uint8_t *source0, const uint8_t *source1, size_t destWidth);
+
+}
+
 }
 
 #include "generatemip.inl"
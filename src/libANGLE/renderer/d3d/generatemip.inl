@@ -217,6 +217,118 @@ static void GenerateMip_XYZ(size_t sourceWidth, size_t sourceHeight, size_t sour
 }
 
 
+template <typename T>
+struct MipRowKernelOf
+{
+    static const MipRowKernel kernel = MIP_ROW_KERNEL_NONE;
+};
+
+#define ANGLE_MIP_ROW_KERNEL(format, rowKernel)           \
+    template <>                                           \
+    struct MipRowKernelOf<format>                         \
+    {                                                     \
+        static const MipRowKernel kernel = rowKernel;     \
+    }
+
+ANGLE_MIP_ROW_KERNEL(L8, MIP_ROW_KERNEL_UNSIGNED8);
+ANGLE_MIP_ROW_KERNEL(R8, MIP_ROW_KERNEL_UNSIGNED8);
+ANGLE_MIP_ROW_KERNEL(A8, MIP_ROW_KERNEL_UNSIGNED8);
+ANGLE_MIP_ROW_KERNEL(L8A8, MIP_ROW_KERNEL_UNSIGNED8);
+ANGLE_MIP_ROW_KERNEL(A8L8, MIP_ROW_KERNEL_UNSIGNED8);
+ANGLE_MIP_ROW_KERNEL(R8G8, MIP_ROW_KERNEL_UNSIGNED8);
+ANGLE_MIP_ROW_KERNEL(A8R8G8B8, MIP_ROW_KERNEL_UNSIGNED8);
+ANGLE_MIP_ROW_KERNEL(R8G8B8A8, MIP_ROW_KERNEL_UNSIGNED8);
+ANGLE_MIP_ROW_KERNEL(B8G8R8A8, MIP_ROW_KERNEL_UNSIGNED8);
+ANGLE_MIP_ROW_KERNEL(R16, MIP_ROW_KERNEL_UNSIGNED16);
+ANGLE_MIP_ROW_KERNEL(R16G16, MIP_ROW_KERNEL_UNSIGNED16);
+ANGLE_MIP_ROW_KERNEL(R16G16B16A16, MIP_ROW_KERNEL_UNSIGNED16);
+ANGLE_MIP_ROW_KERNEL(R32, MIP_ROW_KERNEL_UNSIGNED32);
+ANGLE_MIP_ROW_KERNEL(R32G32, MIP_ROW_KERNEL_UNSIGNED32);
+ANGLE_MIP_ROW_KERNEL(R32G32B32A32, MIP_ROW_KERNEL_UNSIGNED32);
+ANGLE_MIP_ROW_KERNEL(R16F, MIP_ROW_KERNEL_FLOAT16);
+ANGLE_MIP_ROW_KERNEL(A16F, MIP_ROW_KERNEL_FLOAT16);
+ANGLE_MIP_ROW_KERNEL(L16F, MIP_ROW_KERNEL_FLOAT16);
+ANGLE_MIP_ROW_KERNEL(L16A16F, MIP_ROW_KERNEL_FLOAT16);
+ANGLE_MIP_ROW_KERNEL(R16G16F, MIP_ROW_KERNEL_FLOAT16);
+ANGLE_MIP_ROW_KERNEL(R16G16B16A16F, MIP_ROW_KERNEL_FLOAT16);
+ANGLE_MIP_ROW_KERNEL(A16B16G16R16F, MIP_ROW_KERNEL_FLOAT16);
+ANGLE_MIP_ROW_KERNEL(R32F, MIP_ROW_KERNEL_FLOAT32);
+ANGLE_MIP_ROW_KERNEL(A32F, MIP_ROW_KERNEL_FLOAT32);
+ANGLE_MIP_ROW_KERNEL(L32F, MIP_ROW_KERNEL_FLOAT32);
+ANGLE_MIP_ROW_KERNEL(L32A32F, MIP_ROW_KERNEL_FLOAT32);
+ANGLE_MIP_ROW_KERNEL(R32G32F, MIP_ROW_KERNEL_FLOAT32);
+ANGLE_MIP_ROW_KERNEL(R32G32B32A32F, MIP_ROW_KERNEL_FLOAT32);
+ANGLE_MIP_ROW_KERNEL(A32B32G32R32F, MIP_ROW_KERNEL_FLOAT32);
+
+#undef ANGLE_MIP_ROW_KERNEL
+
+// Generates the mip a row at a time for the formats with row kernels. The source rows of each
+// destination row are averaged in the same order as the functions above average the pixels:
+// across slices first, then across rows, then across the pixels of the row.
+template <typename T>
+static void GenerateMipRows(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                            const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                            size_t destWidth, size_t destHeight, size_t destDepth,
+                            uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+    const MipRowKernel kernel = MipRowKernelOf<T>::kernel;
+
+    // Long rows are processed in chunks that fit in the scratch rows.
+    const size_t kChunkWidth = 256;
+    uint8_t scratch[2][kChunkWidth * 2 * sizeof(T)];
+
+    for (size_t z = 0; z < destDepth; z++)
+    {
+        for (size_t y = 0; y < destHeight; y++)
+        {
+            const uint8_t *sourceRow = sourceData + (y * 2) * sourceRowPitch + (z * 2) * sourceDepthPitch;
+            uint8_t *destRow = destData + y * destRowPitch + z * destDepthPitch;
+
+            for (size_t x = 0; x < destWidth; x += kChunkWidth)
+            {
+                size_t chunkWidth = std::min(kChunkWidth, destWidth - x);
+                const uint8_t *source = sourceRow;
+                size_t sourceSize = sizeof(T);
+                if (sourceWidth > 1)
+                {
+                    source += x * 2 * sizeof(T);
+                    sourceSize = chunkWidth * 2 * sizeof(T);
+                }
+
+                uint8_t *destPixels = destRow + x * sizeof(T);
+                if (sourceWidth == 1 && sourceHeight == 1)
+                {
+                    AverageRows(kernel, destPixels, source, source + sourceDepthPitch, sourceSize);
+                    continue;
+                }
+
+                // Slices are averaged into the scratch rows first.
+                const uint8_t *row0 = source;
+                const uint8_t *row1 = (sourceHeight > 1) ? source + sourceRowPitch : nullptr;
+                if (sourceDepth > 1)
+                {
+                    AverageRows(kernel, scratch[0], row0, row0 + sourceDepthPitch, sourceSize);
+                    row0 = scratch[0];
+                    if (row1 != nullptr)
+                    {
+                        AverageRows(kernel, scratch[1], row1, row1 + sourceDepthPitch, sourceSize);
+                        row1 = scratch[1];
+                    }
+                }
+
+                if (sourceWidth > 1)
+                {
+                    AveragePixelPairs(kernel, sizeof(T), destPixels, row0, row1, chunkWidth);
+                }
+                else
+                {
+                    AverageRows(kernel, destPixels, row0, row1, sourceSize);
+                }
+            }
+        }
+    }
+}
+
 typedef void (*MipGenerationFunction)(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
                                       const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
                                       size_t destWidth, size_t destHeight, size_t destDepth,
@@ -256,6 +368,14 @@ inline void GenerateMip(size_t sourceWidth, size_t sourceHeight, size_t sourceDe
     size_t mipHeight = std::max<size_t>(1, sourceHeight >> 1);
     size_t mipDepth = std::max<size_t>(1, sourceDepth >> 1);
 
+    if (priv::MipRowKernelOf<T>::kernel != priv::MIP_ROW_KERNEL_NONE)
+    {
+        ASSERT(sourceWidth > 1 || sourceHeight > 1 || sourceDepth > 1);
+        priv::GenerateMipRows<T>(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch, sourceDepthPitch,
+                                 mipWidth, mipHeight, mipDepth, destData, destRowPitch, destDepthPitch);
+        return;
+    }
+
     priv::MipGenerationFunction generationFunction = priv::GetMipGenerationFunction<T>(sourceWidth, sourceHeight, sourceDepth);
     ASSERT(generationFunction != NULL);
 
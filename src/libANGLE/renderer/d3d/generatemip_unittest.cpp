@@ -0,0 +1,240 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Unit tests for GenerateMip, comparing the row kernels, GenerateMipInParallel and
+// GenerateMipChain with the per-pixel mip generation functions.
+//
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/WorkerThread.h"
+#include "libANGLE/renderer/d3d/generatemip.h"
+
+using namespace rx;
+
+namespace
+{
+
+struct Image
+{
+    Image(size_t width, size_t height, size_t depth, size_t pixelBytes)
+        : width(width),
+          height(height),
+          depth(depth),
+          // Pad the rows so that the pitches are not tight.
+          rowPitch(width * pixelBytes + 8),
+          depthPitch(rowPitch * height + 16),
+          data(depthPitch * depth)
+    {
+    }
+
+    size_t width;
+    size_t height;
+    size_t depth;
+    size_t rowPitch;
+    size_t depthPitch;
+    std::vector<uint8_t> data;
+};
+
+template <typename T>
+void FillRandom(Image *image, std::mt19937 *random)
+{
+    for (uint8_t &byte : image->data)
+    {
+        byte = static_cast<uint8_t>((*random)());
+    }
+}
+
+// Half floats and floats are kept finite and away from the NaNs, whose payloads the per-pixel
+// functions and the kernels may not preserve the same way.
+template <>
+void FillRandom<R16G16B16A16F>(Image *image, std::mt19937 *random)
+{
+    std::uniform_real_distribution<float> distribution(-1000.0f, 1000.0f);
+    uint16_t *halves = reinterpret_cast<uint16_t *>(image->data.data());
+    for (size_t i = 0; i < image->data.size() / 2; i++)
+    {
+        float value = distribution(*random);
+        // Include tiny values to cover the denormal results.
+        if (i % 7 == 0)
+        {
+            value *= 1e-8f;
+        }
+        halves[i] = gl::float32ToFloat16(value);
+    }
+}
+
+template <>
+void FillRandom<R32G32B32A32F>(Image *image, std::mt19937 *random)
+{
+    std::uniform_real_distribution<float> distribution(-1000.0f, 1000.0f);
+    float *floats = reinterpret_cast<float *>(image->data.data());
+    for (size_t i = 0; i < image->data.size() / 4; i++)
+    {
+        floats[i] = distribution(*random);
+    }
+}
+
+// Generates the mip with the per-pixel functions that GenerateMip used for every format.
+template <typename T>
+void GenerateMipPerPixel(const Image &source, Image *dest)
+{
+    priv::MipGenerationFunction function =
+        priv::GetMipGenerationFunction<T>(source.width, source.height, source.depth);
+    function(source.width, source.height, source.depth, source.data.data(), source.rowPitch,
+             source.depthPitch, dest->width, dest->height, dest->depth, dest->data.data(),
+             dest->rowPitch, dest->depthPitch);
+}
+
+template <typename T>
+void ExpectImagesEqual(const Image &expected, const Image &actual)
+{
+    for (size_t z = 0; z < expected.depth; z++)
+    {
+        for (size_t y = 0; y < expected.height; y++)
+        {
+            size_t offset = z * expected.depthPitch + y * expected.rowPitch;
+            ASSERT_EQ(0, memcmp(expected.data.data() + offset, actual.data.data() + offset,
+                                expected.width * sizeof(T)))
+                << "size " << expected.width << "x" << expected.height << "x" << expected.depth
+                << ", row " << y << ", slice " << z;
+        }
+    }
+}
+
+Image GetMip(const Image &source, size_t pixelBytes)
+{
+    return Image(std::max<size_t>(1, source.width >> 1), std::max<size_t>(1, source.height >> 1),
+                 std::max<size_t>(1, source.depth >> 1), pixelBytes);
+}
+
+template <typename T>
+class GenerateMipTest : public testing::Test
+{
+};
+
+typedef testing::Types<A8,
+                       L8A8,
+                       R8G8B8A8,
+                       B8G8R8X8,
+                       R16G16,
+                       R16G16B16A16,
+                       R32,
+                       R32G32B32A32,
+                       R16G16B16A16F,
+                       R32G32B32A32F,
+                       R10G10B10A2>
+    MipFormats;
+TYPED_TEST_CASE(GenerateMipTest, MipFormats);
+
+// Test that GenerateMip gives the results of the per-pixel functions for sizes that cover every
+// combination of averaged dimensions, and widths with and without vector tails.
+TYPED_TEST(GenerateMipTest, MatchesPerPixel)
+{
+    std::mt19937 random(1);
+    const size_t kWidths[]  = {1, 2, 3, 17, 64, 129, 600};
+    const size_t kHeights[] = {1, 2, 5};
+    const size_t kDepths[]  = {1, 2, 3};
+
+    for (size_t width : kWidths)
+    {
+        for (size_t height : kHeights)
+        {
+            for (size_t depth : kDepths)
+            {
+                if (width == 1 && height == 1 && depth == 1)
+                {
+                    continue;
+                }
+
+                Image source(width, height, depth, sizeof(TypeParam));
+                FillRandom<TypeParam>(&source, &random);
+
+                Image expected = GetMip(source, sizeof(TypeParam));
+                Image actual   = GetMip(source, sizeof(TypeParam));
+                GenerateMipPerPixel<TypeParam>(source, &expected);
+                GenerateMip<TypeParam>(width, height, depth, source.data.data(), source.rowPitch,
+                                       source.depthPitch, actual.data.data(), actual.rowPitch,
+                                       actual.depthPitch);
+
+                ExpectImagesEqual<TypeParam>(expected, actual);
+            }
+        }
+    }
+}
+
+// Test that splitting the mip generation over threads gives the same results as generating it at
+// once.
+TYPED_TEST(GenerateMipTest, ParallelMatchesPerPixel)
+{
+    std::mt19937 random(2);
+    angle::WorkerThreadPool pool(3);
+
+    const size_t kSizes[][3] = {{1024, 301, 1}, {1, 4096, 1}, {130, 40, 9}, {4096, 1, 1}};
+    for (const auto &size : kSizes)
+    {
+        Image source(size[0], size[1], size[2], sizeof(TypeParam));
+        FillRandom<TypeParam>(&source, &random);
+
+        Image expected = GetMip(source, sizeof(TypeParam));
+        Image actual   = GetMip(source, sizeof(TypeParam));
+        GenerateMipPerPixel<TypeParam>(source, &expected);
+        GenerateMipInParallel(&pool, GenerateMip<TypeParam>, source.width, source.height,
+                              source.depth, source.data.data(), source.rowPitch, source.depthPitch,
+                              actual.data.data(), actual.rowPitch, actual.depthPitch);
+
+        ExpectImagesEqual<TypeParam>(expected, actual);
+    }
+}
+
+// Test that generating whole chains a band at a time gives the same levels as generating each level
+// from the previous one, for sizes that are not multiples of the bands or powers of two.
+TYPED_TEST(GenerateMipTest, ChainMatchesPerPixel)
+{
+    std::mt19937 random(3);
+    angle::WorkerThreadPool pool(2);
+
+    const size_t kSizes[][3] = {{512, 512, 1}, {300, 77, 1}, {1000, 3, 1}, {65, 200, 1},
+                                {40, 24, 6}};
+    for (const auto &size : kSizes)
+    {
+        std::vector<Image> expected;
+        expected.push_back(Image(size[0], size[1], size[2], sizeof(TypeParam)));
+        FillRandom<TypeParam>(&expected[0], &random);
+        while (expected.back().width > 1 || expected.back().height > 1 ||
+               expected.back().depth > 1)
+        {
+            expected.push_back(GetMip(expected.back(), sizeof(TypeParam)));
+            GenerateMipPerPixel<TypeParam>(expected[expected.size() - 2], &expected.back());
+        }
+
+        std::vector<Image> actual;
+        std::vector<MipLevelData> levels;
+        for (const Image &level : expected)
+        {
+            actual.push_back(Image(level.width, level.height, level.depth, sizeof(TypeParam)));
+        }
+        actual[0].data = expected[0].data;
+        for (Image &level : actual)
+        {
+            MipLevelData data = {level.data.data(), level.width,    level.height,
+                                 level.depth,       level.rowPitch, level.depthPitch};
+            levels.push_back(data);
+        }
+
+        GenerateMipChain(&pool, GenerateMip<TypeParam>, sizeof(TypeParam), levels.data(),
+                         levels.size());
+
+        for (size_t level = 1; level < expected.size(); level++)
+        {
+            ExpectImagesEqual<TypeParam>(expected[level], actual[level]);
+        }
+    }
+}
+
+}  // anonymous namespace
@@ -8,6 +8,12 @@
 
 #include "libANGLE/renderer/d3d/loadimage.h"
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "libANGLE/WorkerThread.h"
+
 namespace rx
 {
 
@@ -694,4 +700,44 @@ void LoadR32ToR24G8(size_t width, size_t height, size_t depth,
     }
 }
 
+void LoadCompressedImageInParallel(angle::WorkerThreadPool *pool, LoadImageFunction function,
+                                   size_t inputBlockHeight, size_t outputBlockHeight,
+                                   size_t width, size_t height, size_t depth,
+                                   const uint8_t *input, size_t inputRowPitch,
+                                   size_t inputDepthPitch, uint8_t *output, size_t outputRowPitch,
+                                   size_t outputDepthPitch)
+{
+    ASSERT(inputBlockHeight % outputBlockHeight == 0);
+    bool splitSlices      = depth > 1;
+    size_t unitCount      = splitSlices ? depth : (height + inputBlockHeight - 1) / inputBlockHeight;
+    size_t outputRowCount = (height + outputBlockHeight - 1) / outputBlockHeight;
+    size_t outputBytes    = outputRowPitch * outputRowCount * depth;
+
+    size_t taskCount = angle::GetParallelTaskCount(pool, unitCount, outputBytes);
+    if (taskCount <= 1)
+    {
+        function(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                 outputRowPitch, outputDepthPitch);
+        return;
+    }
+
+    angle::RunParallelTasks(pool, taskCount, [&](size_t task) {
+        size_t firstUnit = unitCount * task / taskCount;
+        size_t endUnit   = unitCount * (task + 1) / taskCount;
+        if (splitSlices)
+        {
+            function(width, height, endUnit - firstUnit, input + firstUnit * inputDepthPitch,
+                     inputRowPitch, inputDepthPitch, output + firstUnit * outputDepthPitch,
+                     outputRowPitch, outputDepthPitch);
+            return;
+        }
+
+        size_t firstRow = firstUnit * inputBlockHeight;
+        size_t endRow   = std::min(endUnit * inputBlockHeight, height);
+        function(width, endRow - firstRow, 1, input + firstUnit * inputRowPitch, inputRowPitch,
+                 inputDepthPitch, output + (firstRow / outputBlockHeight) * outputRowPitch,
+                 outputRowPitch, outputDepthPitch);
+    });
+}
+
 }
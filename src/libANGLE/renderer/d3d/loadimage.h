@@ -10,9 +10,15 @@
 #define LIBANGLE_RENDERER_D3D_LOADIMAGE_H_
 
 #include "libANGLE/angletypes.h"
+#include "libANGLE/renderer/d3d/formatutilsD3D.h"
 
 #include <stdint.h>
 
+namespace angle
+{
+class WorkerThreadPool;
+}
+
 namespace rx
 {
 
@@ -188,6 +194,17 @@ void LoadR32ToR24G8(size_t width, size_t height, size_t depth,
                     const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
                     uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch);
 
+// Runs a load function of block compressed data over bands of block rows, or of slices for 3D
+// images, on the threads of the pool and the calling thread. The output blocks are
+// outputBlockHeight rows high, 1 unless the data is transcoded to another compressed format.
+// Small images and a null pool run it at once.
+void LoadCompressedImageInParallel(angle::WorkerThreadPool *pool, LoadImageFunction function,
+                                   size_t inputBlockHeight, size_t outputBlockHeight,
+                                   size_t width, size_t height, size_t depth,
+                                   const uint8_t *input, size_t inputRowPitch,
+                                   size_t inputDepthPitch, uint8_t *output, size_t outputRowPitch,
+                                   size_t outputDepthPitch);
+
 template <typename T>
 inline T *OffsetDataPointer(uint8_t *data, size_t y, size_t z, size_t rowPitch, size_t depthPitch);
 
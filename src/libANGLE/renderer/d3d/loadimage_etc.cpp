@@ -8,9 +8,15 @@
 
 #include "libANGLE/renderer/d3d/loadimage_etc.h"
 
+#include "common/mathutil.h"
+#include "common/platform.h"
 #include "libANGLE/renderer/d3d/loadimage.h"
 #include "libANGLE/renderer/d3d/imageformats.h"
 
+#if defined(ANGLE_USE_SSE)
+#include <immintrin.h>
+#endif
+
 namespace rx
 {
 namespace
@@ -53,6 +59,120 @@ static const int valueMappingTable[] =
 };
 // clang-format on
 
+// Intensity modifiers of the single channel blocks
+// clang-format off
+static const int singleChannelModifierTable[16][8] =
+{
+    { -3, -6,  -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5,  -8, -13, 1, 4, 7, 12 },
+    { -2, -4,  -6, -13, 1, 3, 5, 12 },
+    { -3, -6,  -8, -12, 2, 5, 7, 11 },
+    { -3, -7,  -9, -11, 2, 6, 8, 10 },
+    { -4, -7,  -8, -11, 3, 6, 7, 10 },
+    { -3, -5,  -8, -11, 2, 4, 7, 10 },
+    { -2, -6,  -8, -10, 1, 5, 7,  9 },
+    { -2, -5,  -8, -10, 1, 4, 7,  9 },
+    { -2, -4,  -8, -10, 1, 3, 7,  9 },
+    { -2, -5,  -7, -10, 1, 4, 6,  9 },
+    { -3, -4,  -7, -10, 2, 3, 6,  9 },
+    { -1, -2,  -3, -10, 0, 1, 2,  9 },
+    { -4, -6,  -8,  -9, 3, 5, 7,  8 },
+    { -3, -5,  -7,  -9, 2, 4, 6,  8 }
+};
+// clang-format on
+
+// clang-format off
+static const uint8_t DefaultETCAlphaValues[4][4] =
+{
+    { 255, 255, 255, 255 },
+    { 255, 255, 255, 255 },
+    { 255, 255, 255, 255 },
+    { 255, 255, 255, 255 },
+};
+// clang-format on
+
+// The index of pixel (x, y) of a whole block into the colors of its subblocks. Bit x * 4 + y of
+// indexBits holds the least significant bit of the pixel index and bit x * 4 + y + 16 the most
+// significant one, as getIndex reads them. The pixels whose bit is set in subblockBits pick from
+// the colors of the second subblock, stored after those of the first.
+size_t GetBlockColorIndex(uint32_t indexBits, uint32_t subblockBits, size_t x, size_t y)
+{
+    size_t bitIndex = x * 4 + y;
+    return ((indexBits >> bitIndex) & 1) | ((indexBits >> (bitIndex + 15)) & 2) |
+           (((subblockBits >> bitIndex) & 1) << 2);
+}
+
+void WriteBlockColors(uint8_t *dest,
+                      size_t destRowPitch,
+                      const R8G8B8A8 colors[8],
+                      uint32_t indexBits,
+                      uint32_t subblockBits,
+                      const uint8_t alphaValues[4][4])
+{
+    for (size_t y = 0; y < 4; y++)
+    {
+        R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(dest + y * destRowPitch);
+        for (size_t x = 0; x < 4; x++)
+        {
+            row[x] = colors[GetBlockColorIndex(indexBits, subblockBits, x, y)];
+            if (alphaValues != nullptr)
+            {
+                row[x].A = alphaValues[y][x];
+            }
+        }
+    }
+}
+
+#if defined(ANGLE_USE_SSE)
+
+// Writes two rows of the block at a time, with each 32 bit lane picking its pixel from the
+// 8 colors with a single permute.
+ANGLE_AVX2_FUNCTION void WriteBlockColorsAVX2(uint8_t *dest,
+                                              size_t destRowPitch,
+                                              const R8G8B8A8 colors[8],
+                                              uint32_t indexBits,
+                                              uint32_t subblockBits,
+                                              const uint8_t alphaValues[4][4])
+{
+    const __m256i colorTable = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(colors));
+    const __m256i indexBitsVec    = _mm256_set1_epi32(static_cast<int>(indexBits));
+    const __m256i subblockBitsVec = _mm256_set1_epi32(static_cast<int>(subblockBits));
+    const __m256i lsbMask         = _mm256_set1_epi32(1);
+    const __m256i msbMask         = _mm256_set1_epi32(2);
+    const __m256i rgbMask         = _mm256_set1_epi32(0x00FFFFFF);
+
+    // The bit indices x * 4 + y of the pixels of rows 0 and 1.
+    __m256i bitIndices = _mm256_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13);
+    for (size_t y = 0; y < 4; y += 2)
+    {
+        __m256i bits    = _mm256_srlv_epi32(indexBitsVec, bitIndices);
+        __m256i indices = _mm256_or_si256(_mm256_and_si256(bits, lsbMask),
+                                          _mm256_and_si256(_mm256_srli_epi32(bits, 15), msbMask));
+        __m256i subblocks =
+            _mm256_and_si256(_mm256_srlv_epi32(subblockBitsVec, bitIndices), lsbMask);
+        indices = _mm256_or_si256(indices, _mm256_slli_epi32(subblocks, 2));
+
+        __m256i pixels = _mm256_permutevar8x32_epi32(colorTable, indices);
+        if (alphaValues != nullptr)
+        {
+            __m256i alpha = _mm256_cvtepu8_epi32(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i *>(alphaValues[y])));
+            pixels = _mm256_or_si256(_mm256_and_si256(pixels, rgbMask),
+                                     _mm256_slli_epi32(alpha, 24));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + y * destRowPitch),
+                         _mm256_castsi256_si128(pixels));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + (y + 1) * destRowPitch),
+                         _mm256_extracti128_si256(pixels, 1));
+
+        bitIndices = _mm256_add_epi32(bitIndices, _mm256_set1_epi32(2));
+    }
+}
+
+#endif  // defined(ANGLE_USE_SSE)
+
 struct ETC2Block
 {
     // Decodes unsigned single or dual channel block to bytes
@@ -129,6 +249,116 @@ struct ETC2Block
         }
     }
 
+    // Decodes an unsigned or signed single or dual channel block that lies entirely inside the
+    // image to bytes, computing the 8 values that its pixel indices pick from once
+    void decodeAsSingleChannelBlock(uint8_t *dest,
+                                    size_t destPixelStride,
+                                    size_t destRowPitch,
+                                    bool isSigned) const
+    {
+        int codeword = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
+        const int *modifiers = singleChannelModifierTable[u.scblk.table_index];
+
+        uint8_t values[8];
+        for (size_t modifierIdx = 0; modifierIdx < 8; modifierIdx++)
+        {
+            int value = codeword + modifiers[modifierIdx] * u.scblk.multiplier;
+            values[modifierIdx] =
+                isSigned ? static_cast<uint8_t>(clampSByte(value)) : clampByte(value);
+        }
+
+        // The 3 bit indices of the pixels are stored column after column in bytes 2 to 7, from
+        // the most significant bits.
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(this);
+        uint64_t indices     = 0;
+        for (size_t byteIdx = 2; byteIdx < 8; byteIdx++)
+        {
+            indices = (indices << 8) | bytes[byteIdx];
+        }
+
+        for (size_t j = 0; j < 4; j++)
+        {
+            uint8_t *row = dest + (j * destRowPitch);
+            for (size_t i = 0; i < 4; i++)
+            {
+                row[i * destPixelStride] = values[(indices >> (45 - 3 * (i * 4 + j))) & 7];
+            }
+        }
+    }
+
+    // Decodes an RGB block that lies entirely inside the image to rgba8, writing the colors that
+    // its pixel indices pick a block at a time. The alpha values replace the alpha of the colors
+    // unless they are the default ones.
+    void decodeAsRGBBlock(uint8_t *dest,
+                          size_t destRowPitch,
+                          const uint8_t alphaValues[4][4],
+                          bool punchThroughAlpha,
+                          bool useAVX2) const
+    {
+        bool opaqueBit                  = u.idht.mode.idm.diffbit;
+        bool nonOpaquePunchThroughAlpha = punchThroughAlpha && !opaqueBit;
+
+        // The T and H modes only have the colors of the first subblock.
+        R8G8B8A8 colors[8] = {};
+        uint32_t subblockBits = 0;
+        if (u.idht.mode.idm.diffbit || punchThroughAlpha)
+        {
+            const auto &block = u.idht.mode.idm.colors.diff;
+            int r             = (block.R + block.dR);
+            int g             = (block.G + block.dG);
+            int b = (block.B + block.dB);
+            if (r < 0 || r > 31)
+            {
+                getTBlockColors(colors);
+            }
+            else if (g < 0 || g > 31)
+            {
+                getHBlockColors(colors);
+            }
+            else if (b < 0 || b > 31)
+            {
+                decodePlanarBlock(dest, 0, 0, 4, 4, destRowPitch, alphaValues);
+                return;
+            }
+            else
+            {
+                getDifferentialBlockColors(nonOpaquePunchThroughAlpha, colors);
+                subblockBits = getSubblockBits();
+            }
+        }
+        else
+        {
+            getIndividualBlockColors(nonOpaquePunchThroughAlpha, colors);
+            subblockBits = getSubblockBits();
+        }
+
+        // The pixels with index 2 of non opaque blocks are transparent black.
+        if (nonOpaquePunchThroughAlpha)
+        {
+            ASSERT(alphaValues == DefaultETCAlphaValues);
+            colors[2] = createRGBA(0, 0, 0, 0);
+            colors[6] = createRGBA(0, 0, 0, 0);
+        }
+
+        uint32_t indexBits = (static_cast<uint32_t>(u.idht.pixelIndexMSB[0]) << 24) |
+                             (static_cast<uint32_t>(u.idht.pixelIndexMSB[1]) << 16) |
+                             (static_cast<uint32_t>(u.idht.pixelIndexLSB[0]) << 8) |
+                             static_cast<uint32_t>(u.idht.pixelIndexLSB[1]);
+        const uint8_t(*blockAlphaValues)[4] =
+            (alphaValues != DefaultETCAlphaValues) ? alphaValues : nullptr;
+
+#if defined(ANGLE_USE_SSE)
+        if (useAVX2)
+        {
+            WriteBlockColorsAVX2(dest, destRowPitch, colors, indexBits, subblockBits,
+                                 blockAlphaValues);
+            return;
+        }
+#endif
+
+        WriteBlockColors(dest, destRowPitch, colors, indexBits, subblockBits, blockAlphaValues);
+    }
+
     // Transcodes RGB block to BC1
     void transcodeAsBC1(uint8_t *dest,
                         size_t x,
@@ -363,14 +593,9 @@ struct ETC2Block
                                const uint8_t alphaValues[4][4],
                                bool nonOpaquePunchThroughAlpha) const
     {
-        const auto &block = u.idht.mode.idm.colors.indiv;
-        int r1            = extend_4to8bits(block.R1);
-        int g1            = extend_4to8bits(block.G1);
-        int b1            = extend_4to8bits(block.B1);
-        int r2            = extend_4to8bits(block.R2);
-        int g2            = extend_4to8bits(block.G2);
-        int b2 = extend_4to8bits(block.B2);
-        decodeIndividualOrDifferentialBlock(dest, x, y, w, h, destRowPitch, r1, g1, b1, r2, g2, b2,
+        R8G8B8A8 subblockColors[8];
+        getIndividualBlockColors(nonOpaquePunchThroughAlpha, subblockColors);
+        decodeIndividualOrDifferentialBlock(dest, x, y, w, h, destRowPitch, subblockColors,
                                             alphaValues, nonOpaquePunchThroughAlpha);
     }
 
@@ -382,6 +607,28 @@ struct ETC2Block
                                  size_t destRowPitch,
                                  const uint8_t alphaValues[4][4],
                                  bool nonOpaquePunchThroughAlpha) const
+    {
+        R8G8B8A8 subblockColors[8];
+        getDifferentialBlockColors(nonOpaquePunchThroughAlpha, subblockColors);
+        decodeIndividualOrDifferentialBlock(dest, x, y, w, h, destRowPitch, subblockColors,
+                                            alphaValues, nonOpaquePunchThroughAlpha);
+    }
+
+    void getIndividualBlockColors(bool nonOpaquePunchThroughAlpha,
+                                  R8G8B8A8 subblockColors[8]) const
+    {
+        const auto &block = u.idht.mode.idm.colors.indiv;
+        int r1            = extend_4to8bits(block.R1);
+        int g1            = extend_4to8bits(block.G1);
+        int b1            = extend_4to8bits(block.B1);
+        int r2            = extend_4to8bits(block.R2);
+        int g2            = extend_4to8bits(block.G2);
+        int b2 = extend_4to8bits(block.B2);
+        getSubblockColors(r1, g1, b1, r2, g2, b2, nonOpaquePunchThroughAlpha, subblockColors);
+    }
+
+    void getDifferentialBlockColors(bool nonOpaquePunchThroughAlpha,
+                                    R8G8B8A8 subblockColors[8]) const
     {
         const auto &block = u.idht.mode.idm.colors.diff;
         int b1            = extend_5to8bits(block.B);
@@ -390,8 +637,30 @@ struct ETC2Block
         int r2            = extend_5to8bits(block.R + block.dR);
         int g2            = extend_5to8bits(block.G + block.dG);
         int b2 = extend_5to8bits(block.B + block.dB);
-        decodeIndividualOrDifferentialBlock(dest, x, y, w, h, destRowPitch, r1, g1, b1, r2, g2, b2,
-                                            alphaValues, nonOpaquePunchThroughAlpha);
+        getSubblockColors(r1, g1, b1, r2, g2, b2, nonOpaquePunchThroughAlpha, subblockColors);
+    }
+
+    // The colors of the first subblock are followed by those of the second one.
+    void getSubblockColors(int r1,
+                           int g1,
+                           int b1,
+                           int r2,
+                           int g2,
+                           int b2,
+                           bool nonOpaquePunchThroughAlpha,
+                           R8G8B8A8 subblockColors[8]) const
+    {
+        const auto intensityModifier =
+            nonOpaquePunchThroughAlpha ? intensityModifierNonOpaque : intensityModifierDefault;
+
+        for (size_t modifierIdx = 0; modifierIdx < 4; modifierIdx++)
+        {
+            const int i1                = intensityModifier[u.idht.mode.idm.cw1][modifierIdx];
+            subblockColors[modifierIdx] = createRGBA(r1 + i1, g1 + i1, b1 + i1);
+
+            const int i2                    = intensityModifier[u.idht.mode.idm.cw2][modifierIdx];
+            subblockColors[4 + modifierIdx] = createRGBA(r2 + i2, g2 + i2, b2 + i2);
+        }
     }
 
     void decodeIndividualOrDifferentialBlock(uint8_t *dest,
@@ -400,28 +669,12 @@ struct ETC2Block
                                              size_t w,
                                              size_t h,
                                              size_t destRowPitch,
-                                             int r1,
-                                             int g1,
-                                             int b1,
-                                             int r2,
-                                             int g2,
-                                             int b2,
+                                             const R8G8B8A8 subblockColors[8],
                                              const uint8_t alphaValues[4][4],
                                              bool nonOpaquePunchThroughAlpha) const
     {
-        const auto intensityModifier =
-            nonOpaquePunchThroughAlpha ? intensityModifierNonOpaque : intensityModifierDefault;
-
-        R8G8B8A8 subblockColors0[4];
-        R8G8B8A8 subblockColors1[4];
-        for (size_t modifierIdx = 0; modifierIdx < 4; modifierIdx++)
-        {
-            const int i1                 = intensityModifier[u.idht.mode.idm.cw1][modifierIdx];
-            subblockColors0[modifierIdx] = createRGBA(r1 + i1, g1 + i1, b1 + i1);
-
-            const int i2                 = intensityModifier[u.idht.mode.idm.cw2][modifierIdx];
-            subblockColors1[modifierIdx] = createRGBA(r2 + i2, g2 + i2, b2 + i2);
-        }
+        const R8G8B8A8 *subblockColors0 = subblockColors;
+        const R8G8B8A8 *subblockColors1 = subblockColors + 4;
 
         if (u.idht.mode.idm.flipbit)
         {
@@ -481,23 +734,8 @@ struct ETC2Block
                       const uint8_t alphaValues[4][4],
                       bool nonOpaquePunchThroughAlpha) const
     {
-        // Table C.8, distance index for T and H modes
-        const auto &block = u.idht.mode.tm;
-
-        int r1 = extend_4to8bits(block.TR1a << 2 | block.TR1b);
-        int g1 = extend_4to8bits(block.TG1);
-        int b1 = extend_4to8bits(block.TB1);
-        int r2 = extend_4to8bits(block.TR2);
-        int g2 = extend_4to8bits(block.TG2);
-        int b2 = extend_4to8bits(block.TB2);
-
-        static int distance[8] = {3, 6, 11, 16, 23, 32, 41, 64};
-        const int d            = distance[block.Tda << 1 | block.Tdb];
-
-        const R8G8B8A8 paintColors[4] = {
-            createRGBA(r1, g1, b1), createRGBA(r2 + d, g2 + d, b2 + d), createRGBA(r2, g2, b2),
-            createRGBA(r2 - d, g2 - d, b2 - d),
-        };
+        R8G8B8A8 paintColors[4];
+        getTBlockColors(paintColors);
 
         uint8_t *curPixel = dest;
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
@@ -526,24 +764,8 @@ struct ETC2Block
                       const uint8_t alphaValues[4][4],
                       bool nonOpaquePunchThroughAlpha) const
     {
-        // Table C.8, distance index for T and H modes
-        const auto &block = u.idht.mode.hm;
-
-        int r1 = extend_4to8bits(block.HR1);
-        int g1 = extend_4to8bits(block.HG1a << 1 | block.HG1b);
-        int b1 = extend_4to8bits(block.HB1a << 3 | block.HB1b << 1 | block.HB1c);
-        int r2 = extend_4to8bits(block.HR2);
-        int g2 = extend_4to8bits(block.HG2a << 1 | block.HG2b);
-        int b2 = extend_4to8bits(block.HB2);
-
-        static const int distance[8] = {3, 6, 11, 16, 23, 32, 41, 64};
-        const int d = distance[(block.Hda << 2) | (block.Hdb << 1) |
-                               ((r1 << 16 | g1 << 8 | b1) >= (r2 << 16 | g2 << 8 | b2) ? 1 : 0)];
-
-        const R8G8B8A8 paintColors[4] = {
-            createRGBA(r1 + d, g1 + d, b1 + d), createRGBA(r1 - d, g1 - d, b1 - d),
-            createRGBA(r2 + d, g2 + d, b2 + d), createRGBA(r2 - d, g2 - d, b2 - d),
-        };
+        R8G8B8A8 paintColors[4];
+        getHBlockColors(paintColors);
 
         uint8_t *curPixel = dest;
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
@@ -563,6 +785,49 @@ struct ETC2Block
         }
     }
 
+    void getTBlockColors(R8G8B8A8 paintColors[4]) const
+    {
+        // Table C.8, distance index for T and H modes
+        const auto &block = u.idht.mode.tm;
+
+        int r1 = extend_4to8bits(block.TR1a << 2 | block.TR1b);
+        int g1 = extend_4to8bits(block.TG1);
+        int b1 = extend_4to8bits(block.TB1);
+        int r2 = extend_4to8bits(block.TR2);
+        int g2 = extend_4to8bits(block.TG2);
+        int b2 = extend_4to8bits(block.TB2);
+
+        static const int distance[8] = {3, 6, 11, 16, 23, 32, 41, 64};
+        const int d                  = distance[block.Tda << 1 | block.Tdb];
+
+        paintColors[0] = createRGBA(r1, g1, b1);
+        paintColors[1] = createRGBA(r2 + d, g2 + d, b2 + d);
+        paintColors[2] = createRGBA(r2, g2, b2);
+        paintColors[3] = createRGBA(r2 - d, g2 - d, b2 - d);
+    }
+
+    void getHBlockColors(R8G8B8A8 paintColors[4]) const
+    {
+        // Table C.8, distance index for T and H modes
+        const auto &block = u.idht.mode.hm;
+
+        int r1 = extend_4to8bits(block.HR1);
+        int g1 = extend_4to8bits(block.HG1a << 1 | block.HG1b);
+        int b1 = extend_4to8bits(block.HB1a << 3 | block.HB1b << 1 | block.HB1c);
+        int r2 = extend_4to8bits(block.HR2);
+        int g2 = extend_4to8bits(block.HG2a << 1 | block.HG2b);
+        int b2 = extend_4to8bits(block.HB2);
+
+        static const int distance[8] = {3, 6, 11, 16, 23, 32, 41, 64};
+        const int d = distance[(block.Hda << 2) | (block.Hdb << 1) |
+                               ((r1 << 16 | g1 << 8 | b1) >= (r2 << 16 | g2 << 8 | b2) ? 1 : 0)];
+
+        paintColors[0] = createRGBA(r1 + d, g1 + d, b1 + d);
+        paintColors[1] = createRGBA(r1 - d, g1 - d, b1 - d);
+        paintColors[2] = createRGBA(r2 + d, g2 + d, b2 + d);
+        paintColors[3] = createRGBA(r2 - d, g2 - d, b2 - d);
+    }
+
     void decodePlanarBlock(uint8_t *dest,
                            size_t x,
                            size_t y,
@@ -601,6 +866,11 @@ struct ETC2Block
         }
     }
 
+    // The pixels of the second subblock of individual and differential blocks, as the bits
+    // x * 4 + y that getIndex reads: the bottom two rows of flipped blocks and the right two
+    // columns of the others.
+    uint32_t getSubblockBits() const { return u.idht.mode.idm.flipbit ? 0xCCCC : 0xFF00; }
+
     // Index for individual, differential, H and T modes
     size_t getIndex(size_t x, size_t y) const
     {
@@ -1056,41 +1326,25 @@ struct ETC2Block
 
     int getSingleChannelModifier(size_t x, size_t y) const
     {
-        // clang-format off
-        static const int modifierTable[16][8] =
-        {
-            { -3, -6,  -9, -15, 2, 5, 8, 14 },
-            { -3, -7, -10, -13, 2, 6, 9, 12 },
-            { -2, -5,  -8, -13, 1, 4, 7, 12 },
-            { -2, -4,  -6, -13, 1, 3, 5, 12 },
-            { -3, -6,  -8, -12, 2, 5, 7, 11 },
-            { -3, -7,  -9, -11, 2, 6, 8, 10 },
-            { -4, -7,  -8, -11, 3, 6, 7, 10 },
-            { -3, -5,  -8, -11, 2, 4, 7, 10 },
-            { -2, -6,  -8, -10, 1, 5, 7,  9 },
-            { -2, -5,  -8, -10, 1, 4, 7,  9 },
-            { -2, -4,  -8, -10, 1, 3, 7,  9 },
-            { -2, -5,  -7, -10, 1, 4, 6,  9 },
-            { -3, -4,  -7, -10, 2, 3, 6,  9 },
-            { -1, -2,  -3, -10, 0, 1, 2,  9 },
-            { -4, -6,  -8,  -9, 3, 5, 7,  8 },
-            { -3, -5,  -7,  -9, 2, 4, 6,  8 }
-        };
-        // clang-format on
-
-        return modifierTable[u.scblk.table_index][getSingleChannelIndex(x, y)];
+        return singleChannelModifierTable[u.scblk.table_index][getSingleChannelIndex(x, y)];
     }
 };
 
-// clang-format off
-static const uint8_t DefaultETCAlphaValues[4][4] =
+}  // anonymous namespace
+
+namespace priv
 {
-    { 255, 255, 255, 255 },
-    { 255, 255, 255, 255 },
-    { 255, 255, 255, 255 },
-    { 255, 255, 255, 255 },
-};
-// clang-format on
+
+ETCKernelSet GetSupportedETCKernelSet()
+{
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsAVX2())
+    {
+        return ETC_KERNELS_AVX2;
+    }
+#endif
+    return ETC_KERNELS_SCALAR;
+}
 
 void LoadR11EACToR8(size_t width,
                     size_t height,
@@ -1101,7 +1355,8 @@ void LoadR11EACToR8(size_t width,
                     uint8_t *output,
                     size_t outputRowPitch,
                     size_t outputDepthPitch,
-                    bool isSigned)
+                    bool isSigned,
+                    bool perPixel)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -1117,6 +1372,13 @@ void LoadR11EACToR8(size_t width,
                 const ETC2Block *sourceBlock = sourceRow + (x / 4);
                 uint8_t *destPixels          = destRow + x;
 
+                if (!perPixel && x + 4 <= width && y + 4 <= height)
+                {
+                    sourceBlock->decodeAsSingleChannelBlock(destPixels, 1, outputRowPitch,
+                                                            isSigned);
+                    continue;
+                }
+
                 sourceBlock->decodeAsSingleChannel(destPixels, x, y, width, height, 1,
                                                    outputRowPitch, isSigned);
             }
@@ -1133,7 +1395,8 @@ void LoadRG11EACToRG8(size_t width,
                       uint8_t *output,
                       size_t outputRowPitch,
                       size_t outputDepthPitch,
-                      bool isSigned)
+                      bool isSigned,
+                      bool perPixel)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -1146,13 +1409,22 @@ void LoadRG11EACToRG8(size_t width,
 
             for (size_t x = 0; x < width; x += 4)
             {
-                uint8_t *destPixelsRed          = destRow + (x * 2);
-                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
-                sourceBlockRed->decodeAsSingleChannel(destPixelsRed, x, y, width, height, 2,
-                                                      outputRowPitch, isSigned);
-
+                uint8_t *destPixelsRed            = destRow + (x * 2);
+                const ETC2Block *sourceBlockRed   = sourceRow + (x / 2);
                 uint8_t *destPixelsGreen          = destPixelsRed + 1;
                 const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+
+                if (!perPixel && x + 4 <= width && y + 4 <= height)
+                {
+                    sourceBlockRed->decodeAsSingleChannelBlock(destPixelsRed, 2, outputRowPitch,
+                                                               isSigned);
+                    sourceBlockGreen->decodeAsSingleChannelBlock(destPixelsGreen, 2,
+                                                                 outputRowPitch, isSigned);
+                    continue;
+                }
+
+                sourceBlockRed->decodeAsSingleChannel(destPixelsRed, x, y, width, height, 2,
+                                                      outputRowPitch, isSigned);
                 sourceBlockGreen->decodeAsSingleChannel(destPixelsGreen, x, y, width, height, 2,
                                                         outputRowPitch, isSigned);
             }
@@ -1169,8 +1441,13 @@ void LoadETC2RGB8ToRGBA8(size_t width,
                          uint8_t *output,
                          size_t outputRowPitch,
                          size_t outputDepthPitch,
-                         bool punchthroughAlpha)
+                         bool punchthroughAlpha,
+                         bool perPixel,
+                         ETCKernelSet kernels)
 {
+    ASSERT(kernels <= GetSupportedETCKernelSet());
+    const bool useAVX2 = kernels == ETC_KERNELS_AVX2;
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y += 4)
@@ -1185,6 +1462,14 @@ void LoadETC2RGB8ToRGBA8(size_t width,
                 const ETC2Block *sourceBlock = sourceRow + (x / 4);
                 uint8_t *destPixels          = destRow + (x * 4);
 
+                if (!perPixel && x + 4 <= width && y + 4 <= height)
+                {
+                    sourceBlock->decodeAsRGBBlock(destPixels, outputRowPitch,
+                                                  DefaultETCAlphaValues, punchthroughAlpha,
+                                                  useAVX2);
+                    continue;
+                }
+
                 sourceBlock->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
                                          DefaultETCAlphaValues, punchthroughAlpha);
             }
@@ -1192,17 +1477,23 @@ void LoadETC2RGB8ToRGBA8(size_t width,
     }
 }
 
-void LoadETC2RGB8ToBC1(size_t width,
-                       size_t height,
-                       size_t depth,
-                       const uint8_t *input,
-                       size_t inputRowPitch,
-                       size_t inputDepthPitch,
-                       uint8_t *output,
-                       size_t outputRowPitch,
-                       size_t outputDepthPitch,
-                       bool punchthroughAlpha)
+void LoadETC2RGBA8ToRGBA8(size_t width,
+                          size_t height,
+                          size_t depth,
+                          const uint8_t *input,
+                          size_t inputRowPitch,
+                          size_t inputDepthPitch,
+                          uint8_t *output,
+                          size_t outputRowPitch,
+                          size_t outputDepthPitch,
+                          bool srgb,
+                          bool perPixel,
+                          ETCKernelSet kernels)
 {
+    ASSERT(kernels <= GetSupportedETCKernelSet());
+    const bool useAVX2 = kernels == ETC_KERNELS_AVX2;
+    uint8_t decodedAlphaValues[4][4];
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y += 4)
@@ -1210,33 +1501,49 @@ void LoadETC2RGB8ToBC1(size_t width,
             const ETC2Block *sourceRow =
                 OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
             uint8_t *destRow =
-                OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch, outputDepthPitch);
+                OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
             for (size_t x = 0; x < width; x += 4)
             {
-                const ETC2Block *sourceBlock = sourceRow + (x / 4);
-                uint8_t *destPixels          = destRow + (x * 2);
+                const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
+                uint8_t *destPixels               = destRow + (x * 4);
+                const ETC2Block *sourceBlockRGB   = sourceBlockAlpha + 1;
 
-                sourceBlock->transcodeAsBC1(destPixels, x, y, width, height, DefaultETCAlphaValues,
-                                            punchthroughAlpha);
+                if (!perPixel && x + 4 <= width && y + 4 <= height)
+                {
+                    sourceBlockAlpha->decodeAsSingleChannelBlock(
+                        reinterpret_cast<uint8_t *>(decodedAlphaValues), 1, 4, false);
+                    sourceBlockRGB->decodeAsRGBBlock(destPixels, outputRowPitch,
+                                                     decodedAlphaValues, false, useAVX2);
+                    continue;
+                }
+
+                sourceBlockAlpha->decodeAsSingleChannel(
+                    reinterpret_cast<uint8_t *>(decodedAlphaValues), x, y, width, height, 1, 4,
+                    false);
+                sourceBlockRGB->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
+                                            decodedAlphaValues, false);
             }
         }
     }
 }
 
-void LoadETC2RGBA8ToRGBA8(size_t width,
-                          size_t height,
-                          size_t depth,
-                          const uint8_t *input,
-                          size_t inputRowPitch,
-                          size_t inputDepthPitch,
-                          uint8_t *output,
-                          size_t outputRowPitch,
-                          size_t outputDepthPitch,
-                          bool srgb)
+}  // namespace priv
+
+namespace
 {
-    uint8_t decodedAlphaValues[4][4];
 
+void LoadETC2RGB8ToBC1(size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch,
+                       bool punchthroughAlpha)
+{
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y += 4)
@@ -1244,19 +1551,15 @@ void LoadETC2RGBA8ToRGBA8(size_t width,
             const ETC2Block *sourceRow =
                 OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
             uint8_t *destRow =
-                OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+                OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch, outputDepthPitch);
 
             for (size_t x = 0; x < width; x += 4)
             {
-                const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
-                sourceBlockAlpha->decodeAsSingleChannel(
-                    reinterpret_cast<uint8_t *>(decodedAlphaValues), x, y, width, height, 1, 4,
-                    false);
+                const ETC2Block *sourceBlock = sourceRow + (x / 4);
+                uint8_t *destPixels          = destRow + (x * 2);
 
-                uint8_t *destPixels             = destRow + (x * 4);
-                const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
-                sourceBlockRGB->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
-                                            decodedAlphaValues, false);
+                sourceBlock->transcodeAsBC1(destPixels, x, y, width, height, DefaultETCAlphaValues,
+                                            punchthroughAlpha);
             }
         }
     }
@@ -1274,8 +1577,9 @@ void LoadETC1RGB8ToRGBA8(size_t width,
                          size_t outputRowPitch,
                          size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                        outputRowPitch, outputDepthPitch, false);
+    priv::LoadETC2RGB8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                              output, outputRowPitch, outputDepthPitch, false, false,
+                              priv::GetSupportedETCKernelSet());
 }
 
 void LoadETC1RGB8ToBC1(size_t width,
@@ -1302,8 +1606,8 @@ void LoadEACR11ToR8(size_t width,
                     size_t outputRowPitch,
                     size_t outputDepthPitch)
 {
-    LoadR11EACToR8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                   outputRowPitch, outputDepthPitch, false);
+    priv::LoadR11EACToR8(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                         output, outputRowPitch, outputDepthPitch, false, false);
 }
 
 void LoadEACR11SToR8(size_t width,
@@ -1316,8 +1620,8 @@ void LoadEACR11SToR8(size_t width,
                      size_t outputRowPitch,
                      size_t outputDepthPitch)
 {
-    LoadR11EACToR8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                   outputRowPitch, outputDepthPitch, true);
+    priv::LoadR11EACToR8(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                         output, outputRowPitch, outputDepthPitch, true, false);
 }
 
 void LoadEACRG11ToRG8(size_t width,
@@ -1330,8 +1634,8 @@ void LoadEACRG11ToRG8(size_t width,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-    LoadRG11EACToRG8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                     outputRowPitch, outputDepthPitch, false);
+    priv::LoadRG11EACToRG8(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                           output, outputRowPitch, outputDepthPitch, false, false);
 }
 
 void LoadEACRG11SToRG8(size_t width,
@@ -1344,8 +1648,8 @@ void LoadEACRG11SToRG8(size_t width,
                        size_t outputRowPitch,
                        size_t outputDepthPitch)
 {
-    LoadRG11EACToRG8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                     outputRowPitch, outputDepthPitch, true);
+    priv::LoadRG11EACToRG8(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                           output, outputRowPitch, outputDepthPitch, true, false);
 }
 
 void LoadETC2RGB8ToRGBA8(size_t width,
@@ -1358,8 +1662,9 @@ void LoadETC2RGB8ToRGBA8(size_t width,
                          size_t outputRowPitch,
                          size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                        outputRowPitch, outputDepthPitch, false);
+    priv::LoadETC2RGB8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                              output, outputRowPitch, outputDepthPitch, false, false,
+                              priv::GetSupportedETCKernelSet());
 }
 
 void LoadETC2SRGB8ToRGBA8(size_t width,
@@ -1372,8 +1677,9 @@ void LoadETC2SRGB8ToRGBA8(size_t width,
                           size_t outputRowPitch,
                           size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                        outputRowPitch, outputDepthPitch, false);
+    priv::LoadETC2RGB8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                              output, outputRowPitch, outputDepthPitch, false, false,
+                              priv::GetSupportedETCKernelSet());
 }
 
 void LoadETC2RGB8A1ToRGBA8(size_t width,
@@ -1386,8 +1692,9 @@ void LoadETC2RGB8A1ToRGBA8(size_t width,
                            size_t outputRowPitch,
                            size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                        outputRowPitch, outputDepthPitch, true);
+    priv::LoadETC2RGB8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                              output, outputRowPitch, outputDepthPitch, true, false,
+                              priv::GetSupportedETCKernelSet());
 }
 
 void LoadETC2SRGB8A1ToRGBA8(size_t width,
@@ -1400,8 +1707,9 @@ void LoadETC2SRGB8A1ToRGBA8(size_t width,
                             size_t outputRowPitch,
                             size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                        outputRowPitch, outputDepthPitch, true);
+    priv::LoadETC2RGB8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                              output, outputRowPitch, outputDepthPitch, true, false,
+                              priv::GetSupportedETCKernelSet());
 }
 
 void LoadETC2RGBA8ToRGBA8(size_t width,
@@ -1414,8 +1722,9 @@ void LoadETC2RGBA8ToRGBA8(size_t width,
                           size_t outputRowPitch,
                           size_t outputDepthPitch)
 {
-    LoadETC2RGBA8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                         outputRowPitch, outputDepthPitch, false);
+    priv::LoadETC2RGBA8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                               output, outputRowPitch, outputDepthPitch, false, false,
+                               priv::GetSupportedETCKernelSet());
 }
 
 void LoadETC2SRGBA8ToSRGBA8(size_t width,
@@ -1428,8 +1737,9 @@ void LoadETC2SRGBA8ToSRGBA8(size_t width,
                             size_t outputRowPitch,
                             size_t outputDepthPitch)
 {
-    LoadETC2RGBA8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                         outputRowPitch, outputDepthPitch, true);
+    priv::LoadETC2RGBA8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                               output, outputRowPitch, outputDepthPitch, true, false,
+                               priv::GetSupportedETCKernelSet());
 }
 
 }  // namespace rx
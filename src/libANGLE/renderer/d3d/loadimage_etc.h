@@ -135,6 +135,75 @@ void LoadETC2SRGBA8ToSRGBA8(size_t width,
                             uint8_t *output,
                             size_t outputRowPitch,
                             size_t outputDepthPitch);
+
+namespace priv
+{
+
+// The instruction sets the RGB block colors can be computed with, from the slowest to the fastest.
+enum ETCKernelSet
+{
+    ETC_KERNELS_SCALAR,
+    ETC_KERNELS_AVX2,
+};
+
+// Returns the fastest kernels the CPU supports, which the public loads use.
+ETCKernelSet GetSupportedETCKernelSet();
+
+// The loads decode the blocks that lie entirely inside the image a block at a time, and those on
+// the right and bottom edges a pixel at a time. perPixel decodes all of them a pixel at a time, to
+// compare the two in tests.
+void LoadR11EACToR8(size_t width,
+                    size_t height,
+                    size_t depth,
+                    const uint8_t *input,
+                    size_t inputRowPitch,
+                    size_t inputDepthPitch,
+                    uint8_t *output,
+                    size_t outputRowPitch,
+                    size_t outputDepthPitch,
+                    bool isSigned,
+                    bool perPixel);
+
+void LoadRG11EACToRG8(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch,
+                      bool isSigned,
+                      bool perPixel);
+
+void LoadETC2RGB8ToRGBA8(size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch,
+                         bool punchthroughAlpha,
+                         bool perPixel,
+                         ETCKernelSet kernels);
+
+void LoadETC2RGBA8ToRGBA8(size_t width,
+                          size_t height,
+                          size_t depth,
+                          const uint8_t *input,
+                          size_t inputRowPitch,
+                          size_t inputDepthPitch,
+                          uint8_t *output,
+                          size_t outputRowPitch,
+                          size_t outputDepthPitch,
+                          bool srgb,
+                          bool perPixel,
+                          ETCKernelSet kernels);
+
+}  // namespace priv
+
 }
 
 #endif  // LIBANGLE_RENDERER_D3D_LOADIMAGE_ETC_H_
@@ -0,0 +1,265 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Unit tests for the ETC and EAC loads, comparing the whole block decoding with the per-pixel
+// decoding, and the loads split over threads with the loads at once.
+//
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/WorkerThread.h"
+#include "libANGLE/renderer/d3d/loadimage.h"
+#include "libANGLE/renderer/d3d/loadimage_etc.h"
+
+using namespace rx;
+
+namespace
+{
+
+enum ETCFormat
+{
+    ETC_FORMAT_R11,
+    ETC_FORMAT_SIGNED_R11,
+    ETC_FORMAT_RG11,
+    ETC_FORMAT_SIGNED_RG11,
+    ETC_FORMAT_RGB8,
+    ETC_FORMAT_RGB8_PUNCHTHROUGH_ALPHA1,
+    ETC_FORMAT_RGBA8,
+};
+
+size_t GetBlockBytes(ETCFormat format)
+{
+    return (format == ETC_FORMAT_RG11 || format == ETC_FORMAT_SIGNED_RG11 ||
+            format == ETC_FORMAT_RGBA8)
+               ? 16
+               : 8;
+}
+
+size_t GetPixelBytes(ETCFormat format)
+{
+    switch (format)
+    {
+        case ETC_FORMAT_R11:
+        case ETC_FORMAT_SIGNED_R11:
+            return 1;
+        case ETC_FORMAT_RG11:
+        case ETC_FORMAT_SIGNED_RG11:
+            return 2;
+        default:
+            return 4;
+    }
+}
+
+struct ETCImage
+{
+    ETCImage(size_t width, size_t height, size_t depth, size_t blockBytes, size_t pixelBytes)
+        : width(width),
+          height(height),
+          depth(depth),
+          inputRowPitch(((width + 3) / 4) * blockBytes),
+          inputDepthPitch(inputRowPitch * ((height + 3) / 4)),
+          // Pad the output rows so that the pitches are not tight.
+          outputRowPitch(width * pixelBytes + 12),
+          outputDepthPitch(outputRowPitch * height + 20),
+          input(inputDepthPitch * depth),
+          output(outputDepthPitch * depth)
+    {
+    }
+
+    size_t width;
+    size_t height;
+    size_t depth;
+    size_t inputRowPitch;
+    size_t inputDepthPitch;
+    size_t outputRowPitch;
+    size_t outputDepthPitch;
+    std::vector<uint8_t> input;
+    std::vector<uint8_t> output;
+};
+
+// Random blocks cover all the modes of the RGB blocks, and all the tables and multipliers of the
+// single channel blocks.
+void FillRandom(std::vector<uint8_t> *data, std::mt19937 *random)
+{
+    for (uint8_t &byte : *data)
+    {
+        byte = static_cast<uint8_t>((*random)());
+    }
+}
+
+// The kernel sets the CPU supports, which only change how the RGB blocks are decoded.
+std::vector<priv::ETCKernelSet> GetKernelSets()
+{
+    std::vector<priv::ETCKernelSet> kernelSets;
+    for (int kernels = priv::ETC_KERNELS_SCALAR; kernels <= priv::GetSupportedETCKernelSet();
+         kernels++)
+    {
+        kernelSets.push_back(static_cast<priv::ETCKernelSet>(kernels));
+    }
+    return kernelSets;
+}
+
+void Load(ETCFormat format, bool perPixel, priv::ETCKernelSet kernels, ETCImage *image)
+{
+    const uint8_t *input = image->input.data();
+    uint8_t *output      = image->output.data();
+    switch (format)
+    {
+        case ETC_FORMAT_R11:
+        case ETC_FORMAT_SIGNED_R11:
+            priv::LoadR11EACToR8(image->width, image->height, image->depth, input,
+                                 image->inputRowPitch, image->inputDepthPitch, output,
+                                 image->outputRowPitch, image->outputDepthPitch,
+                                 format == ETC_FORMAT_SIGNED_R11, perPixel);
+            break;
+        case ETC_FORMAT_RG11:
+        case ETC_FORMAT_SIGNED_RG11:
+            priv::LoadRG11EACToRG8(image->width, image->height, image->depth, input,
+                                   image->inputRowPitch, image->inputDepthPitch, output,
+                                   image->outputRowPitch, image->outputDepthPitch,
+                                   format == ETC_FORMAT_SIGNED_RG11, perPixel);
+            break;
+        case ETC_FORMAT_RGB8:
+        case ETC_FORMAT_RGB8_PUNCHTHROUGH_ALPHA1:
+            priv::LoadETC2RGB8ToRGBA8(image->width, image->height, image->depth, input,
+                                      image->inputRowPitch, image->inputDepthPitch, output,
+                                      image->outputRowPitch, image->outputDepthPitch,
+                                      format == ETC_FORMAT_RGB8_PUNCHTHROUGH_ALPHA1, perPixel,
+                                      kernels);
+            break;
+        case ETC_FORMAT_RGBA8:
+            priv::LoadETC2RGBA8ToRGBA8(image->width, image->height, image->depth, input,
+                                       image->inputRowPitch, image->inputDepthPitch, output,
+                                       image->outputRowPitch, image->outputDepthPitch, false,
+                                       perPixel, kernels);
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
+void ExpectOutputsEqual(const ETCImage &expected, const ETCImage &actual, size_t rowBytes)
+{
+    for (size_t z = 0; z < expected.depth; z++)
+    {
+        for (size_t y = 0; y < expected.height; y++)
+        {
+            size_t offset = z * expected.outputDepthPitch + y * expected.outputRowPitch;
+            ASSERT_EQ(0, memcmp(expected.output.data() + offset, actual.output.data() + offset,
+                                rowBytes))
+                << "size " << expected.width << "x" << expected.height << "x" << expected.depth
+                << ", row " << y << ", slice " << z;
+        }
+    }
+}
+
+class LoadETCTest : public testing::TestWithParam<ETCFormat>
+{
+};
+
+// Test that decoding whole blocks with every kernel set gives the results of decoding them a pixel
+// at a time, for sizes with and without blocks on the edges.
+TEST_P(LoadETCTest, WholeBlocksMatchPerPixel)
+{
+    ETCFormat format = GetParam();
+    std::mt19937 random(1);
+
+    const size_t kSizes[][3] = {{4, 4, 1}, {64, 64, 1}, {13, 7, 1}, {1, 2, 1}, {20, 8, 3}};
+    for (const auto &size : kSizes)
+    {
+        ETCImage expected(size[0], size[1], size[2], GetBlockBytes(format), GetPixelBytes(format));
+        FillRandom(&expected.input, &random);
+        Load(format, true, priv::ETC_KERNELS_SCALAR, &expected);
+
+        for (priv::ETCKernelSet kernels : GetKernelSets())
+        {
+            SCOPED_TRACE(testing::Message() << "kernels " << kernels);
+            ETCImage actual(size[0], size[1], size[2], GetBlockBytes(format),
+                            GetPixelBytes(format));
+            actual.input = expected.input;
+            Load(format, false, kernels, &actual);
+
+            ExpectOutputsEqual(expected, actual, size[0] * GetPixelBytes(format));
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(ETCFormats,
+                        LoadETCTest,
+                        testing::Values(ETC_FORMAT_R11,
+                                        ETC_FORMAT_SIGNED_R11,
+                                        ETC_FORMAT_RG11,
+                                        ETC_FORMAT_SIGNED_RG11,
+                                        ETC_FORMAT_RGB8,
+                                        ETC_FORMAT_RGB8_PUNCHTHROUGH_ALPHA1,
+                                        ETC_FORMAT_RGBA8));
+
+// Test that splitting a load over bands of block rows or slices gives the same results as loading
+// the image at once.
+TEST(LoadCompressedImageInParallel, MatchesLoadAtOnce)
+{
+    std::mt19937 random(2);
+    angle::WorkerThreadPool pool(3);
+
+    const size_t kSizes[][3] = {{1024, 301, 1}, {64, 4096, 1}, {256, 128, 7}};
+    for (const auto &size : kSizes)
+    {
+        ETCImage expected(size[0], size[1], size[2], 16, 4);
+        ETCImage actual(size[0], size[1], size[2], 16, 4);
+        FillRandom(&expected.input, &random);
+        actual.input = expected.input;
+
+        LoadETC2RGBA8ToRGBA8(expected.width, expected.height, expected.depth,
+                             expected.input.data(), expected.inputRowPitch,
+                             expected.inputDepthPitch, expected.output.data(),
+                             expected.outputRowPitch, expected.outputDepthPitch);
+        LoadCompressedImageInParallel(&pool, LoadETC2RGBA8ToRGBA8, 4, 1, actual.width,
+                                      actual.height, actual.depth, actual.input.data(),
+                                      actual.inputRowPitch, actual.inputDepthPitch,
+                                      actual.output.data(), actual.outputRowPitch,
+                                      actual.outputDepthPitch);
+
+        ExpectOutputsEqual(expected, actual, size[0] * 4);
+    }
+}
+
+// Test splitting a load whose output is block compressed too, whose rows are blocks.
+TEST(LoadCompressedImageInParallel, CompressedOutputMatchesLoadAtOnce)
+{
+    std::mt19937 random(3);
+    angle::WorkerThreadPool pool(3);
+
+    const size_t kWidth  = 1024;
+    const size_t kHeight = 1022;
+    std::vector<uint8_t> input((kWidth / 4) * ((kHeight + 3) / 4) * 8);
+    FillRandom(&input, &random);
+
+    // Only individual blocks are transcoded to BC1, so clear the differential bit of the blocks.
+    for (size_t block = 0; block < input.size() / 8; block++)
+    {
+        input[block * 8 + 3] &= ~0x2;
+    }
+
+    size_t inputRowPitch  = (kWidth / 4) * 8;
+    size_t outputRowPitch = (kWidth / 4) * 8;
+    size_t outputSize     = outputRowPitch * ((kHeight + 3) / 4);
+    std::vector<uint8_t> expected(outputSize);
+    std::vector<uint8_t> actual(outputSize);
+
+    LoadETC1RGB8ToBC1(kWidth, kHeight, 1, input.data(), inputRowPitch, input.size(),
+                      expected.data(), outputRowPitch, outputSize);
+    LoadCompressedImageInParallel(&pool, LoadETC1RGB8ToBC1, 4, 4, kWidth, kHeight, 1, input.data(),
+                                  inputRowPitch, input.size(), actual.data(), outputRowPitch,
+                                  outputSize);
+
+    EXPECT_EQ(expected, actual);
+}
+
+}  // anonymous namespace
@@ -101,22 +101,22 @@ gl::Error BufferGL::unmap(GLboolean *result)
     return gl::Error(GL_NO_ERROR);
 }
 
-gl::Error BufferGL::getIndexRange(GLenum type,
-                                  size_t offset,
-                                  size_t count,
-                                  bool primitiveRestartEnabled,
-                                  gl::IndexRange *outRange)
+gl::Error BufferGL::mapIndexData(const uint8_t **outData)
 {
     ASSERT(!mIsMapped);
 
     mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
-    const uint8_t *bufferData = reinterpret_cast<uint8_t*>(mFunctions->mapBuffer(DestBufferOperationTarget, GL_READ_ONLY));
-    *outRange = gl::ComputeIndexRange(type, bufferData + offset, count, primitiveRestartEnabled);
-    mFunctions->unmapBuffer(DestBufferOperationTarget);
+    *outData = reinterpret_cast<uint8_t*>(mFunctions->mapBuffer(DestBufferOperationTarget, GL_READ_ONLY));
 
     return gl::Error(GL_NO_ERROR);
 }
 
+void BufferGL::unmapIndexData()
+{
+    mStateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+    mFunctions->unmapBuffer(DestBufferOperationTarget);
+}
+
 GLuint BufferGL::getBufferID() const
 {
     return mBufferID;
@@ -30,11 +30,8 @@ class BufferGL : public BufferImpl
     gl::Error mapRange(size_t offset, size_t length, GLbitfield access, GLvoid **mapPtr) override;
     gl::Error unmap(GLboolean *result) override;
 
-    gl::Error getIndexRange(GLenum type,
-                            size_t offset,
-                            size_t count,
-                            bool primitiveRestartEnabled,
-                            gl::IndexRange *outRange) override;
+    gl::Error mapIndexData(const uint8_t **outData) override;
+    void unmapIndexData() override;
 
     GLuint getBufferID() const;
 
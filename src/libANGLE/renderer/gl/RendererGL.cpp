@@ -27,6 +27,7 @@
 #include "libANGLE/renderer/gl/SamplerGL.h"
 #include "libANGLE/renderer/gl/ShaderGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 #include "libANGLE/renderer/gl/SurfaceGL.h"
 #include "libANGLE/renderer/gl/TextureGL.h"
 #include "libANGLE/renderer/gl/TransformFeedbackGL.h"
@@ -80,12 +81,21 @@ static void INTERNAL_GL_APIENTRY LogGLDebugMessage(GLenum source, GLenum type, G
 namespace rx
 {
 
+namespace
+{
+// Sizes of the ring buffers that client vertex and index data is streamed through.
+const size_t kStreamingArrayBufferSize        = 4 * 1024 * 1024;
+const size_t kStreamingElementArrayBufferSize = 1024 * 1024;
+}  // anonymous namespace
+
 RendererGL::RendererGL(const FunctionsGL *functions, const egl::AttributeMap &attribMap)
     : Renderer(),
       mMaxSupportedESVersion(0, 0),
       mFunctions(functions),
       mStateManager(nullptr),
       mBlitter(nullptr),
+      mStreamingArrayBuffer(nullptr),
+      mStreamingElementArrayBuffer(nullptr),
       mHasDebugOutput(false),
       mSkipDrawCalls(false)
 {
@@ -93,6 +103,10 @@ RendererGL::RendererGL(const FunctionsGL *functions, const egl::AttributeMap &at
     mStateManager = new StateManagerGL(mFunctions, getRendererCaps());
     nativegl_gl::GenerateWorkarounds(mFunctions, &mWorkarounds);
     mBlitter = new BlitGL(functions, mWorkarounds, mStateManager);
+    mStreamingArrayBuffer = new StreamingBufferGL(mFunctions, mStateManager, GL_ARRAY_BUFFER,
+                                                  kStreamingArrayBufferSize);
+    mStreamingElementArrayBuffer = new StreamingBufferGL(
+        mFunctions, mStateManager, GL_ELEMENT_ARRAY_BUFFER, kStreamingElementArrayBufferSize);
 
     mHasDebugOutput = mFunctions->isAtLeastGL(gl::Version(4, 3)) ||
                       mFunctions->hasGLExtension("GL_KHR_debug") ||
@@ -120,6 +134,8 @@ RendererGL::RendererGL(const FunctionsGL *functions, const egl::AttributeMap &at
 RendererGL::~RendererGL()
 {
     SafeDelete(mBlitter);
+    SafeDelete(mStreamingArrayBuffer);
+    SafeDelete(mStreamingElementArrayBuffer);
     SafeDelete(mStateManager);
 }
 
@@ -258,6 +274,95 @@ gl::Error RendererGL::drawRangeElements(const gl::Data &data,
     return gl::Error(GL_NO_ERROR);
 }
 
+gl::Error RendererGL::multiDrawArrays(const gl::Data &data,
+                                      GLenum mode,
+                                      const GLint *firsts,
+                                      const GLsizei *counts,
+                                      const GLsizei *instanceCounts,
+                                      GLsizei drawCount)
+{
+    if (instanceCounts != nullptr || mFunctions->multiDrawArrays == nullptr)
+    {
+        return Renderer::multiDrawArrays(data, mode, firsts, counts, instanceCounts, drawCount);
+    }
+
+    // Sync the vertices of all the draws at once
+    GLint rangeStart = std::numeric_limits<GLint>::max();
+    GLint rangeEnd   = 0;
+    for (GLsizei drawIndex = 0; drawIndex < drawCount; ++drawIndex)
+    {
+        if (counts[drawIndex] > 0)
+        {
+            rangeStart = std::min(rangeStart, firsts[drawIndex]);
+            rangeEnd   = std::max(rangeEnd, firsts[drawIndex] + counts[drawIndex]);
+        }
+    }
+    ASSERT(rangeStart < rangeEnd);
+
+    gl::Error error =
+        mStateManager->setDrawArraysState(data, rangeStart, rangeEnd - rangeStart, 0);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    if (!mSkipDrawCalls)
+    {
+        mFunctions->multiDrawArrays(mode, firsts, counts, drawCount);
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error RendererGL::multiDrawElements(const gl::Data &data,
+                                        GLenum mode,
+                                        const GLsizei *counts,
+                                        GLenum type,
+                                        const GLvoid *const *indices,
+                                        const GLsizei *instanceCounts,
+                                        GLsizei drawCount,
+                                        const gl::IndexRange *indexRanges)
+{
+    // Client side indices are streamed one draw at a time
+    const gl::VertexArray *vao = data.state->getVertexArray();
+    if (instanceCounts != nullptr || mFunctions->multiDrawElements == nullptr ||
+        vao->getElementArrayBuffer().get() == nullptr)
+    {
+        return Renderer::multiDrawElements(data, mode, counts, type, indices, instanceCounts,
+                                           drawCount, indexRanges);
+    }
+
+    // Sync the vertices referenced by all the draws at once
+    size_t rangeStart       = std::numeric_limits<size_t>::max();
+    size_t rangeEnd         = 0;
+    size_t vertexIndexCount = 0;
+    for (GLsizei drawIndex = 0; drawIndex < drawCount; ++drawIndex)
+    {
+        const gl::IndexRange &drawIndexRange = indexRanges[drawIndex];
+        if (counts[drawIndex] > 0 && drawIndexRange.vertexIndexCount > 0)
+        {
+            rangeStart = std::min(rangeStart, drawIndexRange.start);
+            rangeEnd   = std::max(rangeEnd, drawIndexRange.end);
+            vertexIndexCount += drawIndexRange.vertexIndexCount;
+        }
+    }
+    ASSERT(vertexIndexCount > 0);
+    gl::IndexRange indexRange(rangeStart, rangeEnd, vertexIndexCount);
+
+    gl::Error error = mStateManager->setMultiDrawElementsState(data, indexRange);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    if (!mSkipDrawCalls)
+    {
+        mFunctions->multiDrawElements(mode, counts, type, indices, drawCount);
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
 CompilerImpl *RendererGL::createCompiler()
 {
     return new CompilerGL(mFunctions);
@@ -295,7 +400,8 @@ BufferImpl *RendererGL::createBuffer()
 
 VertexArrayImpl *RendererGL::createVertexArray(const gl::VertexArray::Data &data)
 {
-    return new VertexArrayGL(data, mFunctions, mStateManager);
+    return new VertexArrayGL(data, mFunctions, mStateManager, mStreamingArrayBuffer,
+                             mStreamingElementArrayBuffer);
 }
 
 QueryImpl *RendererGL::createQuery(GLenum type)
@@ -18,6 +18,7 @@ namespace rx
 class BlitGL;
 class FunctionsGL;
 class StateManagerGL;
+class StreamingBufferGL;
 
 class RendererGL : public Renderer
 {
@@ -57,6 +58,21 @@ class RendererGL : public Renderer
                                 const GLvoid *indices,
                                 const gl::IndexRange &indexRange) override;
 
+    gl::Error multiDrawArrays(const gl::Data &data,
+                              GLenum mode,
+                              const GLint *firsts,
+                              const GLsizei *counts,
+                              const GLsizei *instanceCounts,
+                              GLsizei drawCount) override;
+    gl::Error multiDrawElements(const gl::Data &data,
+                                GLenum mode,
+                                const GLsizei *counts,
+                                GLenum type,
+                                const GLvoid *const *indices,
+                                const GLsizei *instanceCounts,
+                                GLsizei drawCount,
+                                const gl::IndexRange *indexRanges) override;
+
     // Shader creation
     CompilerImpl *createCompiler() override;
     ShaderImpl *createShader(const gl::Shader::Data &data) override;
@@ -124,6 +140,10 @@ class RendererGL : public Renderer
 
     BlitGL *mBlitter;
 
+    // Shared by all vertex arrays to stream client data
+    StreamingBufferGL *mStreamingArrayBuffer;
+    StreamingBufferGL *mStreamingElementArrayBuffer;
+
     WorkaroundsGL mWorkarounds;
 
     bool mHasDebugOutput;
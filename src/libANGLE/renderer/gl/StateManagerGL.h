@@ -134,6 +134,7 @@ class StateManagerGL final : angle::NonCopyable
                                    const GLvoid *indices,
                                    GLsizei instanceCount,
                                    const GLvoid **outIndices);
+    gl::Error setMultiDrawElementsState(const gl::Data &data, const gl::IndexRange &indexRange);
 
     void syncState(const gl::State &state, const gl::State::DirtyBits &glDirtyBits);
 
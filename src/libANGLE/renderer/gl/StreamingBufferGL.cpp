@@ -0,0 +1,267 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferGL.cpp: Implements the class methods for StreamingBufferGL.
+
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
+
+#include <algorithm>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "libANGLE/renderer/gl/FunctionsGL.h"
+#include "libANGLE/renderer/gl/StateManagerGL.h"
+
+namespace rx
+{
+
+namespace
+{
+const size_t kAlignment = 16;
+
+// A new fence replaces the previous one if that one covers less than this fraction of the buffer,
+// which bounds the number of sync objects alive at once.
+const size_t kMaxFencedRegions = 64;
+
+const GLuint64 kWaitTimeoutNanoseconds = 1000000000;
+}  // anonymous namespace
+
+StreamingBufferGL::StreamingBufferGL(const FunctionsGL *functions,
+                                     StateManagerGL *stateManager,
+                                     GLenum target,
+                                     size_t initialSize)
+    : mFunctions(functions),
+      mStateManager(stateManager),
+      mTarget(target),
+      mMapUnsynchronized(false),
+      mUseFences(false),
+      mBufferID(0),
+      mInitialSize(initialSize),
+      mBufferSize(0),
+      mHead(0),
+      mLapStart(0),
+      mPendingBegin(0),
+      mMappedOffset(0),
+      mMappedSize(0)
+{
+    ASSERT(mFunctions);
+    ASSERT(mStateManager);
+
+    mMapUnsynchronized = mFunctions->mapBufferRange != nullptr;
+    mUseFences = mMapUnsynchronized && mFunctions->fenceSync != nullptr &&
+                 mFunctions->clientWaitSync != nullptr && mFunctions->deleteSync != nullptr;
+}
+
+StreamingBufferGL::~StreamingBufferGL()
+{
+    for (const FencedRegion &region : mFencedRegions)
+    {
+        mFunctions->deleteSync(region.sync);
+    }
+    mFencedRegions.clear();
+
+    mStateManager->deleteBuffer(mBufferID);
+    mBufferID = 0;
+}
+
+GLuint StreamingBufferGL::getBufferID() const
+{
+    return mBufferID;
+}
+
+void StreamingBufferGL::bind()
+{
+    if (mBufferID == 0)
+    {
+        mFunctions->genBuffers(1, &mBufferID);
+    }
+
+    mStateManager->bindBuffer(mTarget, mBufferID);
+
+    if (mBufferSize == 0)
+    {
+        reallocate(mInitialSize);
+    }
+}
+
+gl::Error StreamingBufferGL::map(size_t size,
+                                 size_t minOffset,
+                                 size_t *outOffset,
+                                 uint8_t **outPointer)
+{
+    ASSERT(size > 0);
+
+    bind();
+
+    // Everything streamed before this call has been read by the draw calls issued since.
+    fencePendingRegion();
+
+    const size_t minBegin = roundUp(minOffset, kAlignment);
+    if (minBegin + size > mBufferSize)
+    {
+        reallocate(std::max(minBegin + size, mBufferSize * 2));
+    }
+
+    // Only the part of minOffset the head has not passed yet in this lap is skipped.
+    GLuint64 begin = std::max(roundUp<GLuint64>(mHead, kAlignment), mLapStart + minBegin);
+    if (begin + size > mLapStart + mBufferSize)
+    {
+        // Wrap around to the start of the buffer. Without fences, orphan the storage the GPU may
+        // still be reading instead of waiting for it.
+        mLapStart += mBufferSize;
+        begin = mLapStart + minBegin;
+
+        if (!mUseFences)
+        {
+            reallocate(mBufferSize);
+            begin = minBegin;
+        }
+    }
+
+    gl::Error error = waitForRegion(begin + size);
+    if (error.isError())
+    {
+        return error;
+    }
+
+    const size_t offset = static_cast<size_t>(begin - mLapStart);
+    if (mMapUnsynchronized)
+    {
+        const GLbitfield access =
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+        void *pointer = mFunctions->mapBufferRange(mTarget, offset, size, access);
+        if (pointer == nullptr)
+        {
+            return gl::Error(GL_OUT_OF_MEMORY, "Failed to map the client data streaming buffer.");
+        }
+        *outPointer = reinterpret_cast<uint8_t *>(pointer);
+    }
+    else
+    {
+        mClientCopy.resize(size);
+        *outPointer = mClientCopy.data();
+    }
+
+    mMappedOffset = offset;
+    mMappedSize   = size;
+    mHead         = begin + size;
+
+    *outOffset = offset;
+    return gl::Error(GL_NO_ERROR);
+}
+
+bool StreamingBufferGL::unmap()
+{
+    bind();
+
+    if (mMapUnsynchronized)
+    {
+        return mFunctions->unmapBuffer(mTarget) == GL_TRUE;
+    }
+
+    mFunctions->bufferSubData(mTarget, mMappedOffset, mMappedSize, mClientCopy.data());
+    return true;
+}
+
+void StreamingBufferGL::fencePendingRegion()
+{
+    if (!mUseFences || mHead == mPendingBegin)
+    {
+        return;
+    }
+
+    FencedRegion region;
+    region.sync  = mFunctions->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    region.begin = mPendingBegin;
+    region.end   = mHead;
+    mPendingBegin = mHead;
+
+    if (region.sync == 0)
+    {
+        // Without a fence, wait for everything that was streamed to be read.
+        mFunctions->finish();
+        for (const FencedRegion &fencedRegion : mFencedRegions)
+        {
+            mFunctions->deleteSync(fencedRegion.sync);
+        }
+        mFencedRegions.clear();
+        return;
+    }
+
+    // Fences signal in order, so the new fence also covers the region of the previous one.
+    if (!mFencedRegions.empty())
+    {
+        const FencedRegion &previous = mFencedRegions.back();
+        if (previous.end - previous.begin < mBufferSize / kMaxFencedRegions)
+        {
+            region.begin = previous.begin;
+            mFunctions->deleteSync(previous.sync);
+            mFencedRegions.pop_back();
+        }
+    }
+
+    mFencedRegions.push_back(region);
+}
+
+gl::Error StreamingBufferGL::waitForRegion(GLuint64 end)
+{
+    // The bytes up to end were last written at the same positions one lap earlier, wait for
+    // the fences of the regions that were streamed before that.
+    size_t waitCount = 0;
+    while (waitCount < mFencedRegions.size() &&
+           mFencedRegions[waitCount].begin + mBufferSize < end)
+    {
+        waitCount++;
+    }
+
+    if (waitCount == 0)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    // Only the last fence needs to be waited on, the earlier ones signal before it.
+    GLsync sync   = mFencedRegions[waitCount - 1].sync;
+    GLenum result = mFunctions->clientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                               kWaitTimeoutNanoseconds);
+    while (result == GL_TIMEOUT_EXPIRED)
+    {
+        result = mFunctions->clientWaitSync(sync, 0, kWaitTimeoutNanoseconds);
+    }
+
+    for (size_t regionIndex = 0; regionIndex < waitCount; regionIndex++)
+    {
+        mFunctions->deleteSync(mFencedRegions.front().sync);
+        mFencedRegions.pop_front();
+    }
+
+    if (result == GL_WAIT_FAILED)
+    {
+        return gl::Error(GL_OUT_OF_MEMORY,
+                         "Failed to wait for the client data streaming buffer to be read.");
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+void StreamingBufferGL::reallocate(size_t size)
+{
+    // Respecifying the storage orphans the previous one, which stays alive for the draw calls still
+    // reading it, so its fences are no longer needed.
+    for (const FencedRegion &region : mFencedRegions)
+    {
+        mFunctions->deleteSync(region.sync);
+    }
+    mFencedRegions.clear();
+
+    mBufferSize = roundUp(size, kAlignment);
+    mFunctions->bufferData(mTarget, mBufferSize, nullptr, GL_STREAM_DRAW);
+
+    mHead         = 0;
+    mLapStart     = 0;
+    mPendingBegin = 0;
+}
+
+}
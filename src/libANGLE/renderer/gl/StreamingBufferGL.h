@@ -0,0 +1,93 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferGL.h: Defines the class interface for StreamingBufferGL, a ring buffer that
+// client data is streamed through before draw calls.
+
+#ifndef LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+#define LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+
+#include <deque>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "libANGLE/Error.h"
+#include "libANGLE/renderer/gl/functionsgl_typedefs.h"
+
+namespace rx
+{
+
+class FunctionsGL;
+class StateManagerGL;
+
+// Hands out consecutive regions of a single buffer, mapped without synchronization. The regions
+// written before a map are assumed to be read by the draw calls issued since, and are fenced so
+// that the buffer is only waited on when wrapping around to a region the GPU may still be reading.
+//
+// Without sync objects the buffer is orphaned when wrapping around instead, and without
+// glMapBufferRange the data is written to a client copy and uploaded with glBufferSubData.
+class StreamingBufferGL : angle::NonCopyable
+{
+  public:
+    StreamingBufferGL(const FunctionsGL *functions,
+                      StateManagerGL *stateManager,
+                      GLenum target,
+                      size_t initialSize);
+    ~StreamingBufferGL();
+
+    // Returns zero until the buffer is first bound.
+    GLuint getBufferID() const;
+
+    // Binds the buffer, which is allocated on first use, to its target. The element array buffer
+    // binding is part of the vertex array state, so bind the vertex array the buffer is used with
+    // first.
+    void bind();
+
+    // Binds the buffer and maps a region of size bytes, aligned to 16 bytes, that starts at least
+    // minOffset bytes into the buffer.
+    gl::Error map(size_t size, size_t minOffset, size_t *outOffset, uint8_t **outPointer);
+
+    // Returns false if the mapped data was corrupted and needs to be written again.
+    bool unmap();
+
+  private:
+    struct FencedRegion
+    {
+        GLsync sync;
+        GLuint64 begin;
+        GLuint64 end;
+    };
+
+    void fencePendingRegion();
+    gl::Error waitForRegion(GLuint64 end);
+    void reallocate(size_t size);
+
+    const FunctionsGL *mFunctions;
+    StateManagerGL *mStateManager;
+    GLenum mTarget;
+
+    bool mMapUnsynchronized;
+    bool mUseFences;
+
+    GLuint mBufferID;
+    size_t mInitialSize;
+    size_t mBufferSize;
+
+    // Positions in the buffer count the bytes streamed since it was last allocated, the current
+    // lap around the ring starts at mLapStart.
+    GLuint64 mHead;
+    GLuint64 mLapStart;
+    GLuint64 mPendingBegin;
+    std::deque<FencedRegion> mFencedRegions;
+
+    size_t mMappedOffset;
+    size_t mMappedSize;
+    std::vector<uint8_t> mClientCopy;
+};
+
+}
+
+#endif  // LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
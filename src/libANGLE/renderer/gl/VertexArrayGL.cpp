@@ -10,6 +10,7 @@
 
 #include "common/BitSetIterator.h"
 #include "common/debug.h"
+#include "common/index_utils.h"
 #include "common/mathutil.h"
 #include "common/utilities.h"
 #include "libANGLE/Buffer.h"
@@ -18,6 +19,7 @@
 #include "libANGLE/renderer/gl/BufferGL.h"
 #include "libANGLE/renderer/gl/FunctionsGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 
 using namespace gl;
 
@@ -34,19 +36,22 @@ bool AttributeNeedsStreaming(const VertexAttribute &attribute)
 
 VertexArrayGL::VertexArrayGL(const VertexArray::Data &data,
                              const FunctionsGL *functions,
-                             StateManagerGL *stateManager)
+                             StateManagerGL *stateManager,
+                             StreamingBufferGL *streamingArrayBuffer,
+                             StreamingBufferGL *streamingElementArrayBuffer)
     : VertexArrayImpl(data),
       mFunctions(functions),
       mStateManager(stateManager),
       mVertexArrayID(0),
       mAppliedElementArrayBuffer(),
-      mStreamingElementArrayBufferSize(0),
-      mStreamingElementArrayBuffer(0),
-      mStreamingArrayBufferSize(0),
-      mStreamingArrayBuffer(0)
+      mStreamingArrayBuffer(streamingArrayBuffer),
+      mStreamingElementArrayBuffer(streamingElementArrayBuffer),
+      mStreamingElementArrayBufferBound(false)
 {
     ASSERT(mFunctions);
     ASSERT(mStateManager);
+    ASSERT(mStreamingArrayBuffer);
+    ASSERT(mStreamingElementArrayBuffer);
     mFunctions->genVertexArrays(1, &mVertexArrayID);
 
     // Set the cached vertex attribute array size
@@ -60,14 +65,6 @@ VertexArrayGL::~VertexArrayGL()
     mStateManager->deleteVertexArray(mVertexArrayID);
     mVertexArrayID = 0;
 
-    mStateManager->deleteBuffer(mStreamingElementArrayBuffer);
-    mStreamingElementArrayBufferSize = 0;
-    mStreamingElementArrayBuffer = 0;
-
-    mStateManager->deleteBuffer(mStreamingArrayBuffer);
-    mStreamingArrayBufferSize = 0;
-    mStreamingArrayBuffer = 0;
-
     mAppliedElementArrayBuffer.set(nullptr);
     for (size_t idx = 0; idx < mAppliedAttributes.size(); idx++)
     {
@@ -140,6 +137,33 @@ gl::Error VertexArrayGL::syncDrawState(const gl::AttributesMask &activeAttribute
     return Error(GL_NO_ERROR);
 }
 
+gl::Error VertexArrayGL::syncMultiDrawElementsState(const gl::AttributesMask &activeAttributesMask,
+                                                    const gl::IndexRange &indexRange) const
+{
+    ASSERT(mData.getElementArrayBuffer().get() != nullptr);
+
+    mStateManager->bindVertexArray(mVertexArrayID, getAppliedElementArrayBufferID());
+    syncElementArrayBuffer();
+
+    if (mAttributesNeedStreaming.any())
+    {
+        return streamAttributes(activeAttributesMask, 0, indexRange);
+    }
+
+    return Error(GL_NO_ERROR);
+}
+
+void VertexArrayGL::syncElementArrayBuffer() const
+{
+    gl::Buffer *elementArrayBuffer = mData.getElementArrayBuffer().get();
+    if (elementArrayBuffer != mAppliedElementArrayBuffer.get())
+    {
+        const BufferGL *bufferGL = GetImplAs<BufferGL>(elementArrayBuffer);
+        mStateManager->bindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferGL->getBufferID());
+        mAppliedElementArrayBuffer.set(elementArrayBuffer);
+    }
+}
+
 Error VertexArrayGL::syncIndexData(GLsizei count,
                                    GLenum type,
                                    const GLvoid *indices,
@@ -155,12 +179,7 @@ Error VertexArrayGL::syncIndexData(GLsizei count,
     // Need to check the range of indices if attributes need to be streamed
     if (elementArrayBuffer != nullptr)
     {
-        if (elementArrayBuffer != mAppliedElementArrayBuffer.get())
-        {
-            const BufferGL *bufferGL = GetImplAs<BufferGL>(elementArrayBuffer);
-            mStateManager->bindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferGL->getBufferID());
-            mAppliedElementArrayBuffer.set(elementArrayBuffer);
-        }
+        syncElementArrayBuffer();
 
         // Only compute the index range if the attributes also need to be streamed
         if (attributesNeedStreaming)
@@ -182,39 +201,43 @@ Error VertexArrayGL::syncIndexData(GLsizei count,
         // Need to stream the index buffer
         // TODO: if GLES, nothing needs to be streamed
 
-        // Only compute the index range if the attributes also need to be streamed
-        if (attributesNeedStreaming)
-        {
-            *outIndexRange = ComputeIndexRange(type, indices, count, primitiveRestartEnabled);
-        }
-
-        // Allocate the streaming element array buffer
-        if (mStreamingElementArrayBuffer == 0)
-        {
-            mFunctions->genBuffers(1, &mStreamingElementArrayBuffer);
-            mStreamingElementArrayBufferSize = 0;
-        }
-
-        mStateManager->bindBuffer(GL_ELEMENT_ARRAY_BUFFER, mStreamingElementArrayBuffer);
-        mAppliedElementArrayBuffer.set(nullptr);
-
-        // Make sure the element array buffer is large enough
+        // Stream the indices through the ring buffer shared by all vertex arrays, which binds it
+        // to the element array buffer of this vertex array
         const Type &indexTypeInfo          = GetTypeInfo(type);
         size_t requiredStreamingBufferSize = indexTypeInfo.bytes * count;
-        if (requiredStreamingBufferSize > mStreamingElementArrayBufferSize)
+
+        mAppliedElementArrayBuffer.set(nullptr);
+        mStreamingElementArrayBufferBound = true;
+
+        // Unmapping a buffer can return GL_FALSE to indicate that the data was corrupted, retry
+        // writing the data a few times like when streaming attributes.
+        GLboolean unmapResult     = GL_FALSE;
+        size_t unmapRetryAttempts = 5;
+        size_t streamingOffset    = 0;
+        while (unmapResult != GL_TRUE && --unmapRetryAttempts > 0)
         {
-            // Copy the indices in while resizing the buffer
-            mFunctions->bufferData(GL_ELEMENT_ARRAY_BUFFER, requiredStreamingBufferSize, indices, GL_DYNAMIC_DRAW);
-            mStreamingElementArrayBufferSize = requiredStreamingBufferSize;
+            uint8_t *bufferPointer = nullptr;
+            Error error = mStreamingElementArrayBuffer->map(requiredStreamingBufferSize, 0,
+                                                            &streamingOffset, &bufferPointer);
+            if (error.isError())
+            {
+                return error;
+            }
+
+            // Only compute the index range if the attributes also need to be streamed, in the
+            // same pass as the copy
+            ConvertIndices(type, type, indices, count, primitiveRestartEnabled, bufferPointer,
+                           attributesNeedStreaming ? outIndexRange : nullptr);
+            unmapResult = mStreamingElementArrayBuffer->unmap() ? GL_TRUE : GL_FALSE;
         }
-        else
+
+        if (unmapResult != GL_TRUE)
         {
-            // Put the indices at the beginning of the buffer
-            mFunctions->bufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, requiredStreamingBufferSize, indices);
+            return Error(GL_OUT_OF_MEMORY, "Failed to unmap the client index streaming buffer.");
         }
 
-        // Set the index offset for the draw call to zero since the supplied index pointer is to client data
-        *outIndices = nullptr;
+        // The supplied index pointer is to client data, offset the draw call to the streamed copy
+        *outIndices = reinterpret_cast<const GLvoid *>(streamingOffset);
     }
 
     return Error(GL_NO_ERROR);
@@ -263,23 +286,10 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttrib
         return gl::Error(GL_NO_ERROR);
     }
 
-    if (mStreamingArrayBuffer == 0)
-    {
-        mFunctions->genBuffers(1, &mStreamingArrayBuffer);
-        mStreamingArrayBufferSize = 0;
-    }
-
-    // If first is greater than zero, a slack space needs to be left at the beginning of the buffer so that
-    // the same 'first' argument can be passed into the draw call.
-    const size_t bufferEmptySpace = maxAttributeDataSize * indexRange.start;
-    const size_t requiredBufferSize = streamingDataSize + bufferEmptySpace;
-
-    mStateManager->bindBuffer(GL_ARRAY_BUFFER, mStreamingArrayBuffer);
-    if (requiredBufferSize > mStreamingArrayBufferSize)
-    {
-        mFunctions->bufferData(GL_ARRAY_BUFFER, requiredBufferSize, nullptr, GL_DYNAMIC_DRAW);
-        mStreamingArrayBufferSize = requiredBufferSize;
-    }
+    // If first is greater than zero, the attributes point before the streamed data so that the
+    // same 'first' argument can be passed into the draw call. Map the data far enough into the
+    // buffer for those offsets not to be negative, which only costs space near its start.
+    const size_t minStreamingOffset = maxAttributeDataSize * indexRange.start;
 
     // Unmapping a buffer can return GL_FALSE to indicate that the system has corrupted the data
     // somehow (such as by a screen change), retry writing the data a few times and return OUT_OF_MEMORY
@@ -288,8 +298,15 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttrib
     size_t unmapRetryAttempts = 5;
     while (unmapResult != GL_TRUE && --unmapRetryAttempts > 0)
     {
-        uint8_t *bufferPointer = reinterpret_cast<uint8_t*>(mFunctions->mapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY));
-        size_t curBufferOffset = bufferEmptySpace;
+        size_t streamingOffset = 0;
+        uint8_t *bufferPointer = nullptr;
+        Error error = mStreamingArrayBuffer->map(streamingDataSize, minStreamingOffset,
+                                                 &streamingOffset, &bufferPointer);
+        if (error.isError())
+        {
+            return error;
+        }
+        size_t curBufferOffset = 0;
 
         const auto &attribs = mData.getVertexAttributes();
         for (auto idx : angle::IterateBitSet(mAttributesNeedStreaming & activeAttributesMask))
@@ -326,8 +343,9 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttrib
                 }
             }
 
-            // Compute where the 0-index vertex would be.
-            const size_t vertexStartOffset = curBufferOffset - (indexRange.start * destStride);
+            // Compute where the 0-index vertex would be in the streaming buffer.
+            const size_t vertexStartOffset =
+                streamingOffset + curBufferOffset - (indexRange.start * destStride);
 
             if (attrib.pureInteger)
             {
@@ -352,7 +370,7 @@ gl::Error VertexArrayGL::streamAttributes(const gl::AttributesMask &activeAttrib
             mAppliedAttributes[idx].size = static_cast<GLuint>(-1);
         }
 
-        unmapResult = mFunctions->unmapBuffer(GL_ARRAY_BUFFER);
+        unmapResult = mStreamingArrayBuffer->unmap() ? GL_TRUE : GL_FALSE;
     }
 
     if (unmapResult != GL_TRUE)
@@ -372,7 +390,7 @@ GLuint VertexArrayGL::getAppliedElementArrayBufferID() const
 {
     if (mAppliedElementArrayBuffer.get() == nullptr)
     {
-        return mStreamingElementArrayBuffer;
+        return mStreamingElementArrayBufferBound ? mStreamingElementArrayBuffer->getBufferID() : 0;
     }
 
     return GetImplAs<BufferGL>(mAppliedElementArrayBuffer.get())->getBufferID();
@@ -16,11 +16,16 @@ namespace rx
 
 class FunctionsGL;
 class StateManagerGL;
+class StreamingBufferGL;
 
 class VertexArrayGL : public VertexArrayImpl
 {
   public:
-    VertexArrayGL(const gl::VertexArray::Data &data, const FunctionsGL *functions, StateManagerGL *stateManager);
+    VertexArrayGL(const gl::VertexArray::Data &data,
+                  const FunctionsGL *functions,
+                  StateManagerGL *stateManager,
+                  StreamingBufferGL *streamingArrayBuffer,
+                  StreamingBufferGL *streamingElementArrayBuffer);
     ~VertexArrayGL() override;
 
     gl::Error syncDrawArraysState(const gl::AttributesMask &activeAttributesMask,
@@ -35,6 +40,11 @@ class VertexArrayGL : public VertexArrayImpl
                                     bool primitiveRestartEnabled,
                                     const GLvoid **outIndices) const;
 
+    // Syncs the state of a batch of draws that read their indices from the element array buffer
+    // and together reference the vertices of indexRange.
+    gl::Error syncMultiDrawElementsState(const gl::AttributesMask &activeAttributesMask,
+                                         const gl::IndexRange &indexRange) const;
+
     GLuint getVertexArrayID() const;
     GLuint getAppliedElementArrayBufferID() const;
 
@@ -50,6 +60,9 @@ class VertexArrayGL : public VertexArrayImpl
                             bool primitiveRestartEnabled,
                             const GLvoid **outIndices) const;
 
+    // Bind the element array buffer of the vertex array if it isn't already
+    void syncElementArrayBuffer() const;
+
     // Apply index data, only sets outIndexRange if attributesNeedStreaming is true
     gl::Error syncIndexData(GLsizei count,
                             GLenum type,
@@ -84,11 +97,10 @@ class VertexArrayGL : public VertexArrayImpl
     mutable BindingPointer<gl::Buffer> mAppliedElementArrayBuffer;
     mutable std::vector<gl::VertexAttribute> mAppliedAttributes;
 
-    mutable size_t mStreamingElementArrayBufferSize;
-    mutable GLuint mStreamingElementArrayBuffer;
-
-    mutable size_t mStreamingArrayBufferSize;
-    mutable GLuint mStreamingArrayBuffer;
+    // Ring buffers shared by all vertex arrays that client data is streamed through
+    StreamingBufferGL *mStreamingArrayBuffer;
+    StreamingBufferGL *mStreamingElementArrayBuffer;
+    mutable bool mStreamingElementArrayBufferBound;
 
     gl::AttributesMask mAttributesNeedStreaming;
 };
@@ -102,8 +102,8 @@ struct InternalFormatInfo
     InternalFormat glInfo;
 };
 
-typedef std::pair<GLenum, InternalFormatInfo> InternalFormatInfoPair;
-typedef std::map<GLenum, InternalFormatInfo> InternalFormatInfoMap;
+// Indexed by gl::GetInternalFormatIndex.
+typedef std::vector<InternalFormatInfo> InternalFormatInfoMap;
 
 // A helper function to insert data into the format map with fewer characters.
 static inline void InsertFormatMapping(InternalFormatInfoMap *map, GLenum internalFormat,
@@ -119,12 +119,19 @@ static inline void InsertFormatMapping(InternalFormatInfoMap *map, GLenum intern
     formatInfo.glesInfo.filter = esTexture;
     formatInfo.glesInfo.renderbuffer = esFilter;
     formatInfo.glesInfo.framebufferAttachment = esRender;
-    map->insert(std::make_pair(internalFormat, formatInfo));
+
+    size_t index = gl::GetInternalFormatIndex(internalFormat);
+    if (index >= map->size())
+    {
+        UNREACHABLE();
+        return;
+    }
+    (*map)[index] = formatInfo;
 }
 
 static InternalFormatInfoMap BuildInternalFormatInfoMap()
 {
-    InternalFormatInfoMap map;
+    InternalFormatInfoMap map(gl::GetInternalFormatCount());
 
     // clang-format off
     //                       | Format              | OpenGL texture support                          | Filter  | OpenGL render support                        | OpenGL ES texture support                 | Filter  | OpenGL ES render support                 |
@@ -264,10 +271,10 @@ static const InternalFormatInfoMap &GetInternalFormatMap()
 const InternalFormat &GetInternalFormatInfo(GLenum internalFormat, StandardGL standard)
 {
     const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-    InternalFormatInfoMap::const_iterator iter = formatMap.find(internalFormat);
-    if (iter != formatMap.end())
+    size_t index = gl::GetInternalFormatIndex(internalFormat);
+    if (index != gl::kInvalidInternalFormatIndex)
     {
-        const InternalFormatInfo &info = iter->second;
+        const InternalFormatInfo &info = formatMap[index];
         switch (standard)
         {
           case STANDARD_GL_ES:      return info.glesInfo;
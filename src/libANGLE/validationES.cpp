@@ -1716,10 +1716,7 @@ bool ValidateCopyTexImageParametersBase(ValidationContext *context,
     return true;
 }
 
-static bool ValidateDrawBase(ValidationContext *context,
-                             GLenum mode,
-                             GLsizei count,
-                             GLsizei primcount)
+static bool ValidateDrawMode(ValidationContext *context, GLenum mode)
 {
     switch (mode)
     {
@@ -1730,18 +1727,17 @@ static bool ValidateDrawBase(ValidationContext *context,
       case GL_TRIANGLES:
       case GL_TRIANGLE_STRIP:
       case GL_TRIANGLE_FAN:
-        break;
+        return true;
       default:
         context->recordError(Error(GL_INVALID_ENUM));
         return false;
     }
+}
 
-    if (count < 0)
-    {
-        context->recordError(Error(GL_INVALID_VALUE));
-        return false;
-    }
-
+// Validates the state that doesn't depend on the ranges of the draw, which the draws of a
+// multi-draw call share.
+static bool ValidateDrawState(ValidationContext *context)
+{
     const State &state = context->getState();
 
     // Check for mapped buffers
@@ -1824,18 +1820,36 @@ static bool ValidateDrawBase(ValidationContext *context,
         }
     }
 
-    // No-op if zero count
-    return (count > 0);
+    return true;
 }
 
-bool ValidateDrawArrays(Context *context, GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+static bool ValidateDrawBase(ValidationContext *context,
+                             GLenum mode,
+                             GLsizei count,
+                             GLsizei primcount)
 {
-    if (first < 0)
+    if (!ValidateDrawMode(context, mode))
+    {
+        return false;
+    }
+
+    if (count < 0)
     {
         context->recordError(Error(GL_INVALID_VALUE));
         return false;
     }
 
+    if (!ValidateDrawState(context))
+    {
+        return false;
+    }
+
+    // No-op if zero count
+    return (count > 0);
+}
+
+static bool ValidateDrawArraysTransformFeedback(ValidationContext *context, GLenum mode)
+{
     const State &state = context->getState();
     gl::TransformFeedback *curTransformFeedback = state.getCurrentTransformFeedback();
     if (curTransformFeedback && curTransformFeedback->isActive() && !curTransformFeedback->isPaused() &&
@@ -1848,6 +1862,22 @@ bool ValidateDrawArrays(Context *context, GLenum mode, GLint first, GLsizei coun
         return false;
     }
 
+    return true;
+}
+
+bool ValidateDrawArrays(Context *context, GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+{
+    if (first < 0)
+    {
+        context->recordError(Error(GL_INVALID_VALUE));
+        return false;
+    }
+
+    if (!ValidateDrawArraysTransformFeedback(context, mode))
+    {
+        return false;
+    }
+
     if (!ValidateDrawBase(context, mode, count, primcount))
     {
         return false;
@@ -1910,13 +1940,8 @@ bool ValidateDrawArraysInstancedANGLE(Context *context, GLenum mode, GLint first
     return ValidateDrawArraysInstanced(context, mode, first, count, primcount);
 }
 
-bool ValidateDrawElements(ValidationContext *context,
-                          GLenum mode,
-                          GLsizei count,
-                          GLenum type,
-                          const GLvoid *indices,
-                          GLsizei primcount,
-                          IndexRange *indexRangeOut)
+// Validates the index type and the index buffer state of DrawElements.
+static bool ValidateDrawElementsState(ValidationContext *context, GLenum type)
 {
     switch (type)
     {
@@ -1953,7 +1978,16 @@ bool ValidateDrawElements(ValidationContext *context,
         return false;
     }
 
-    const gl::VertexArray *vao = state.getVertexArray();
+    return true;
+}
+
+// Validates that the indices of one draw can be read.
+static bool ValidateDrawElementsIndices(ValidationContext *context,
+                                        GLsizei count,
+                                        GLenum type,
+                                        const GLvoid *indices)
+{
+    const gl::VertexArray *vao = context->getState().getVertexArray();
     gl::Buffer *elementArrayBuffer = vao->getElementArrayBuffer().get();
     if (!indices && !elementArrayBuffer)
     {
@@ -1990,14 +2024,22 @@ bool ValidateDrawElements(ValidationContext *context,
         return false;
     }
 
-    if (!ValidateDrawBase(context, mode, count, primcount))
-    {
-        return false;
-    }
+    return true;
+}
+
+// Computes the range of the indices of one draw, and checks it against the maximum index.
+static bool ValidateDrawElementsIndexRange(ValidationContext *context,
+                                           GLsizei count,
+                                           GLenum type,
+                                           const GLvoid *indices,
+                                           IndexRange *indexRangeOut)
+{
+    const State &state = context->getState();
 
     // Use max index to validate if our vertex buffers are large enough for the pull.
     // TODO: offer fast path, with disabled index validation.
     // TODO: also disable index checking on back-ends that are robust to out-of-range accesses.
+    gl::Buffer *elementArrayBuffer = state.getVertexArray()->getElementArrayBuffer().get();
     if (elementArrayBuffer)
     {
         uintptr_t offset = reinterpret_cast<uintptr_t>(indices);
@@ -2024,6 +2066,37 @@ bool ValidateDrawElements(ValidationContext *context,
         return false;
     }
 
+    return true;
+}
+
+bool ValidateDrawElements(ValidationContext *context,
+                          GLenum mode,
+                          GLsizei count,
+                          GLenum type,
+                          const GLvoid *indices,
+                          GLsizei primcount,
+                          IndexRange *indexRangeOut)
+{
+    if (!ValidateDrawElementsState(context, type))
+    {
+        return false;
+    }
+
+    if (!ValidateDrawElementsIndices(context, count, type, indices))
+    {
+        return false;
+    }
+
+    if (!ValidateDrawBase(context, mode, count, primcount))
+    {
+        return false;
+    }
+
+    if (!ValidateDrawElementsIndexRange(context, count, type, indices, indexRangeOut))
+    {
+        return false;
+    }
+
     if (!ValidateDrawAttribs(context, primcount, static_cast<GLsizei>(indexRangeOut->end)))
     {
         return false;
@@ -2072,6 +2145,179 @@ bool ValidateDrawElementsInstancedANGLE(Context *context,
     return ValidateDrawElementsInstanced(context, mode, count, type, indices, primcount, indexRangeOut);
 }
 
+// Validates the parameters of GL_ANGLE_multi_draw shared by the array and element draws.
+static bool ValidateMultiDrawBase(Context *context,
+                                  GLenum mode,
+                                  const GLsizei *instanceCounts,
+                                  GLsizei drawcount)
+{
+    if (!context->getExtensions().multiDraw)
+    {
+        context->recordError(Error(GL_INVALID_OPERATION, "GL_ANGLE_multi_draw is not available."));
+        return false;
+    }
+
+    if (drawcount < 0)
+    {
+        context->recordError(Error(GL_INVALID_VALUE, "Negative draw count."));
+        return false;
+    }
+
+    if (instanceCounts != nullptr && context->getClientVersion() < 3 &&
+        !context->getExtensions().instancedArrays)
+    {
+        context->recordError(Error(GL_INVALID_OPERATION, "Instanced draws are not available."));
+        return false;
+    }
+
+    return ValidateDrawMode(context, mode);
+}
+
+// Validates the state of GL_ANGLE_multi_draw once for all the draws, and the vertex attributes
+// against the largest vertex and instance counts of the draws.
+static bool ValidateMultiDrawState(Context *context,
+                                   const GLsizei *instanceCounts,
+                                   GLint maxVertex,
+                                   GLsizei maxInstanceCount)
+{
+    if (!ValidateDrawState(context))
+    {
+        return false;
+    }
+
+    if (instanceCounts != nullptr && context->getClientVersion() < 3 &&
+        !ValidateDrawInstancedANGLE(context))
+    {
+        return false;
+    }
+
+    return ValidateDrawAttribs(context, maxInstanceCount, maxVertex);
+}
+
+bool ValidateMultiDrawArraysANGLE(Context *context,
+                                  GLenum mode,
+                                  const GLint *firsts,
+                                  const GLsizei *counts,
+                                  const GLsizei *instanceCounts,
+                                  GLsizei drawcount)
+{
+    if (!ValidateMultiDrawBase(context, mode, instanceCounts, drawcount))
+    {
+        return false;
+    }
+
+    if (!ValidateDrawArraysTransformFeedback(context, mode))
+    {
+        return false;
+    }
+
+    GLint64 maxVertex        = 0;
+    GLsizei maxInstanceCount = 0;
+    bool hasPrimitives       = false;
+    for (GLsizei drawIndex = 0; drawIndex < drawcount; ++drawIndex)
+    {
+        GLsizei instanceCount = (instanceCounts != nullptr) ? instanceCounts[drawIndex] : 1;
+        if (firsts[drawIndex] < 0 || counts[drawIndex] < 0 || instanceCount < 0)
+        {
+            context->recordError(Error(GL_INVALID_VALUE));
+            return false;
+        }
+
+        if (counts[drawIndex] > 0 && instanceCount > 0)
+        {
+            maxVertex = std::max(maxVertex, static_cast<GLint64>(firsts[drawIndex]) +
+                                                static_cast<GLint64>(counts[drawIndex]));
+            maxInstanceCount = std::max(maxInstanceCount, instanceCount);
+            hasPrimitives = true;
+        }
+    }
+
+    if (!ValidateMultiDrawState(
+            context, instanceCounts,
+            static_cast<GLint>(std::min<GLint64>(maxVertex, std::numeric_limits<GLint>::max())),
+            (instanceCounts != nullptr) ? maxInstanceCount : 0))
+    {
+        return false;
+    }
+
+    // No-op if every draw is empty
+    return hasPrimitives;
+}
+
+bool ValidateMultiDrawElementsANGLE(Context *context,
+                                    GLenum mode,
+                                    const GLsizei *counts,
+                                    GLenum type,
+                                    const GLvoid *const *indices,
+                                    const GLsizei *instanceCounts,
+                                    GLsizei drawcount,
+                                    std::vector<IndexRange> *indexRangesOut)
+{
+    if (!ValidateMultiDrawBase(context, mode, instanceCounts, drawcount))
+    {
+        return false;
+    }
+
+    if (!ValidateDrawElementsState(context, type))
+    {
+        return false;
+    }
+
+    for (GLsizei drawIndex = 0; drawIndex < drawcount; ++drawIndex)
+    {
+        if (counts[drawIndex] < 0 || (instanceCounts != nullptr && instanceCounts[drawIndex] < 0))
+        {
+            context->recordError(Error(GL_INVALID_VALUE));
+            return false;
+        }
+
+        if (!ValidateDrawElementsIndices(context, counts[drawIndex], type, indices[drawIndex]))
+        {
+            return false;
+        }
+    }
+
+    indexRangesOut->assign(drawcount, IndexRange());
+
+    GLint64 maxVertex        = 0;
+    GLsizei maxInstanceCount = 0;
+    bool hasPrimitives       = false;
+    for (GLsizei drawIndex = 0; drawIndex < drawcount; ++drawIndex)
+    {
+        GLsizei instanceCount = (instanceCounts != nullptr) ? instanceCounts[drawIndex] : 1;
+        if (counts[drawIndex] == 0 || instanceCount == 0)
+        {
+            continue;
+        }
+
+        IndexRange *indexRange = &(*indexRangesOut)[drawIndex];
+        if (!ValidateDrawElementsIndexRange(context, counts[drawIndex], type, indices[drawIndex],
+                                            indexRange))
+        {
+            return false;
+        }
+
+        // No primitives if all the indices are primitive restart
+        if (indexRange->vertexIndexCount > 0)
+        {
+            maxVertex = std::max(maxVertex, static_cast<GLint64>(indexRange->end) + 1);
+            maxInstanceCount = std::max(maxInstanceCount, instanceCount);
+            hasPrimitives = true;
+        }
+    }
+
+    if (!ValidateMultiDrawState(
+            context, instanceCounts,
+            static_cast<GLint>(std::min<GLint64>(maxVertex, std::numeric_limits<GLint>::max())),
+            (instanceCounts != nullptr) ? maxInstanceCount : 0))
+    {
+        return false;
+    }
+
+    // No-op if every draw is empty
+    return hasPrimitives;
+}
+
 bool ValidateFramebufferTextureBase(Context *context, GLenum target, GLenum attachment,
                                     GLuint texture, GLint level)
 {
@@ -14,6 +14,8 @@
 #include <GLES2/gl2.h>
 #include <GLES3/gl3.h>
 
+#include <vector>
+
 namespace egl
 {
 class Display;
@@ -170,6 +172,21 @@ bool ValidateDrawElementsInstancedANGLE(Context *context,
                                         GLsizei primcount,
                                         IndexRange *indexRangeOut);
 
+bool ValidateMultiDrawArraysANGLE(Context *context,
+                                  GLenum mode,
+                                  const GLint *firsts,
+                                  const GLsizei *counts,
+                                  const GLsizei *instanceCounts,
+                                  GLsizei drawcount);
+bool ValidateMultiDrawElementsANGLE(Context *context,
+                                    GLenum mode,
+                                    const GLsizei *counts,
+                                    GLenum type,
+                                    const GLvoid *const *indices,
+                                    const GLsizei *instanceCounts,
+                                    GLsizei drawcount,
+                                    std::vector<IndexRange> *indexRangesOut);
+
 bool ValidateFramebufferTextureBase(Context *context, GLenum target, GLenum attachment,
                                     GLuint texture, GLint level);
 bool ValidateFramebufferTexture2D(Context *context, GLenum target, GLenum attachment,
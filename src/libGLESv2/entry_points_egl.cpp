@@ -1459,6 +1459,12 @@ __eglMustCastToProperFunctionPointerType EGLAPIENTRY GetProcAddress(const char *
         INSERT_PROC_ADDRESS(gl, DrawElementsInstancedANGLE);
         INSERT_PROC_ADDRESS(gl, VertexAttribDivisorANGLE);
 
+        // GL_ANGLE_multi_draw
+        INSERT_PROC_ADDRESS(gl, MultiDrawArraysANGLE);
+        INSERT_PROC_ADDRESS(gl, MultiDrawArraysInstancedANGLE);
+        INSERT_PROC_ADDRESS(gl, MultiDrawElementsANGLE);
+        INSERT_PROC_ADDRESS(gl, MultiDrawElementsInstancedANGLE);
+
         // GL_OES_get_program_binary
         INSERT_PROC_ADDRESS(gl, GetProgramBinaryOES);
         INSERT_PROC_ADDRESS(gl, ProgramBinaryOES);
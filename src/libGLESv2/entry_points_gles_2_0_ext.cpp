@@ -357,6 +357,143 @@ void GL_APIENTRY DrawElementsInstancedANGLE(GLenum mode,
     }
 }
 
+void GL_APIENTRY MultiDrawArraysANGLE(GLenum mode,
+                                      const GLint *firsts,
+                                      const GLsizei *counts,
+                                      GLsizei drawcount)
+{
+    EVENT(
+        "(GLenum mode = 0x%X, const GLint *firsts = 0x%0.8p, const GLsizei *counts = 0x%0.8p, "
+        "GLsizei drawcount = %d)",
+        mode, firsts, counts, drawcount);
+
+    MultiDrawArraysInstancedANGLE(mode, firsts, counts, nullptr, drawcount);
+}
+
+void GL_APIENTRY MultiDrawArraysInstancedANGLE(GLenum mode,
+                                               const GLint *firsts,
+                                               const GLsizei *counts,
+                                               const GLsizei *instanceCounts,
+                                               GLsizei drawcount)
+{
+    EVENT(
+        "(GLenum mode = 0x%X, const GLint *firsts = 0x%0.8p, const GLsizei *counts = 0x%0.8p, "
+        "const GLsizei *instanceCounts = 0x%0.8p, GLsizei drawcount = %d)",
+        mode, firsts, counts, instanceCounts, drawcount);
+
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+#ifdef ANGLE_ENABLE_WINDOWS_HOLOGRAPHIC
+        // As in DrawArraysInstancedANGLE, the number of instances is doubled for Windows
+        // Holographic, and validation should occur using the original numbers of instances.
+        static bool isHolographic = rx::HolographicNativeWindow::IsInitialized() && rx::HolographicSwapChain11::getIsAutomaticStereoRenderingEnabled();
+        if (isHolographic && instanceCounts != nullptr && drawcount > 0)
+        {
+            std::vector<GLsizei> originalInstanceCounts(instanceCounts, instanceCounts + drawcount);
+            for (GLsizei &instanceCount : originalInstanceCounts)
+            {
+                instanceCount /= 2;
+            }
+            if (!ValidateMultiDrawArraysANGLE(context, mode, firsts, counts,
+                                              originalInstanceCounts.data(), drawcount))
+            {
+                return;
+            }
+        }
+        else
+#endif
+        {
+            if (!ValidateMultiDrawArraysANGLE(context, mode, firsts, counts, instanceCounts,
+                                              drawcount))
+            {
+                return;
+            }
+        }
+
+        Error error = context->multiDrawArrays(mode, firsts, counts, instanceCounts, drawcount);
+        if (error.isError())
+        {
+            context->recordError(error);
+            return;
+        }
+    }
+}
+
+void GL_APIENTRY MultiDrawElementsANGLE(GLenum mode,
+                                        const GLsizei *counts,
+                                        GLenum type,
+                                        const GLvoid *const *indices,
+                                        GLsizei drawcount)
+{
+    EVENT(
+        "(GLenum mode = 0x%X, const GLsizei *counts = 0x%0.8p, GLenum type = 0x%X, "
+        "const GLvoid *const *indices = 0x%0.8p, GLsizei drawcount = %d)",
+        mode, counts, type, indices, drawcount);
+
+    MultiDrawElementsInstancedANGLE(mode, counts, type, indices, nullptr, drawcount);
+}
+
+void GL_APIENTRY MultiDrawElementsInstancedANGLE(GLenum mode,
+                                                 const GLsizei *counts,
+                                                 GLenum type,
+                                                 const GLvoid *const *indices,
+                                                 const GLsizei *instanceCounts,
+                                                 GLsizei drawcount)
+{
+    EVENT(
+        "(GLenum mode = 0x%X, const GLsizei *counts = 0x%0.8p, GLenum type = 0x%X, "
+        "const GLvoid *const *indices = 0x%0.8p, const GLsizei *instanceCounts = 0x%0.8p, "
+        "GLsizei drawcount = %d)",
+        mode, counts, type, indices, instanceCounts, drawcount);
+
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        std::vector<IndexRange> indexRanges;
+
+#ifdef ANGLE_ENABLE_WINDOWS_HOLOGRAPHIC
+        // As in DrawElementsInstancedANGLE, the number of instances is doubled for Windows
+        // Holographic, and validation should occur using the original numbers of instances.
+        static bool isHolographic = rx::HolographicNativeWindow::IsInitialized() && rx::HolographicSwapChain11::getIsAutomaticStereoRenderingEnabled();
+        if (isHolographic && instanceCounts != nullptr && drawcount > 0)
+        {
+#ifndef ANGLE_WINDOWS_HOLOGRAPHIC_ENABLE_DANGEROUS_OPTIMIZATIONS
+            std::vector<GLsizei> originalInstanceCounts(instanceCounts, instanceCounts + drawcount);
+            for (GLsizei &instanceCount : originalInstanceCounts)
+            {
+                instanceCount /= 2;
+            }
+            if (!ValidateMultiDrawElementsANGLE(context, mode, counts, type, indices,
+                                                originalInstanceCounts.data(), drawcount,
+                                                &indexRanges))
+            {
+                return;
+            }
+#else
+            indexRanges.resize(drawcount);
+#endif
+        }
+        else
+#endif
+        {
+            if (!ValidateMultiDrawElementsANGLE(context, mode, counts, type, indices,
+                                                instanceCounts, drawcount, &indexRanges))
+            {
+                return;
+            }
+        }
+
+        Error error = context->multiDrawElements(mode, counts, type, indices, instanceCounts,
+                                                 drawcount, indexRanges.data());
+        if (error.isError())
+        {
+            context->recordError(error);
+            return;
+        }
+    }
+}
+
 void GL_APIENTRY FinishFenceNV(GLuint fence)
 {
     EVENT("(GLuint fence = %d)", fence);
@@ -1435,6 +1435,43 @@ void GL_APIENTRY glDrawElementsInstancedANGLE(GLenum mode, GLsizei count, GLenum
     return gl::DrawElementsInstancedANGLE(mode, count, type, indices, primcount * instanceCountMultiplierForStereoRendering);
 }
 
+void GL_APIENTRY glMultiDrawArraysANGLE(GLenum mode,
+                                        const GLint *firsts,
+                                        const GLsizei *counts,
+                                        GLsizei drawcount)
+{
+    return gl::MultiDrawArraysANGLE(mode, firsts, counts, drawcount);
+}
+
+void GL_APIENTRY glMultiDrawArraysInstancedANGLE(GLenum mode,
+                                                 const GLint *firsts,
+                                                 const GLsizei *counts,
+                                                 const GLsizei *instanceCounts,
+                                                 GLsizei drawcount)
+{
+    return gl::MultiDrawArraysInstancedANGLE(mode, firsts, counts, instanceCounts, drawcount);
+}
+
+void GL_APIENTRY glMultiDrawElementsANGLE(GLenum mode,
+                                          const GLsizei *counts,
+                                          GLenum type,
+                                          const void *const *indices,
+                                          GLsizei drawcount)
+{
+    return gl::MultiDrawElementsANGLE(mode, counts, type, indices, drawcount);
+}
+
+void GL_APIENTRY glMultiDrawElementsInstancedANGLE(GLenum mode,
+                                                   const GLsizei *counts,
+                                                   GLenum type,
+                                                   const void *const *indices,
+                                                   const GLsizei *instanceCounts,
+                                                   GLsizei drawcount)
+{
+    return gl::MultiDrawElementsInstancedANGLE(mode, counts, type, indices, instanceCounts,
+                                               drawcount);
+}
+
 void GL_APIENTRY glVertexAttribDivisorANGLE(GLuint index, GLuint divisor)
 {
     // For Windows Holographic, we double the number of instances to allow stereo
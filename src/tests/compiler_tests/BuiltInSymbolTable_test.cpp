@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BuiltInSymbolTable_test.cpp:
+//   Tests that compilers created with the same parameters share their built-in symbols.
+//
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+#include "compiler/translator/TranslatorESSL.h"
+
+namespace
+{
+
+class BuiltInSymbolTableTest : public testing::Test
+{
+  public:
+    BuiltInSymbolTableTest() {}
+
+  protected:
+    void SetUp() override { ShInitBuiltInResources(&mResources); }
+
+    TranslatorESSL *createTranslator(sh::GLenum shaderType, const ShBuiltInResources &resources)
+    {
+        TranslatorESSL *translator = new TranslatorESSL(shaderType, SH_GLES3_SPEC);
+        EXPECT_TRUE(translator->Init(resources));
+        return translator;
+    }
+
+    static const TSymbol *findBuiltIn(TranslatorESSL *translator, const char *mangledName)
+    {
+        return translator->getSymbolTable().findBuiltIn(mangledName, 300);
+    }
+
+    static bool compile(TranslatorESSL *translator, const char *source)
+    {
+        const char *shaderStrings[] = {source};
+        return translator->compile(shaderStrings, 1, SH_OBJECT_CODE);
+    }
+
+    ShBuiltInResources mResources;
+};
+
+const char *kFragmentShader =
+    "#version 300 es\n"
+    "precision mediump float;\n"
+    "out vec4 color;\n"
+    "void main() {\n"
+    "    color = vec4(sin(1.0), float(gl_MaxDrawBuffers), 0.0, 1.0);\n"
+    "}\n";
+
+// Test that two compilers with identical parameters look up the same built-in symbols.
+TEST_F(BuiltInSymbolTableTest, SharedBetweenIdenticalCompilers)
+{
+    TranslatorESSL *first  = createTranslator(GL_FRAGMENT_SHADER, mResources);
+    TranslatorESSL *second = createTranslator(GL_FRAGMENT_SHADER, mResources);
+
+    const TSymbol *sin = findBuiltIn(first, "sin(f1;");
+    ASSERT_NE(nullptr, sin);
+    EXPECT_EQ(sin, findBuiltIn(second, "sin(f1;"));
+
+    delete first;
+    delete second;
+}
+
+// Test that compilers with different resources or shader types get their own built-ins.
+TEST_F(BuiltInSymbolTableTest, NotSharedWithDifferentParameters)
+{
+    ShBuiltInResources otherResources = mResources;
+    otherResources.MaxDrawBuffers     = mResources.MaxDrawBuffers + 1;
+
+    TranslatorESSL *first  = createTranslator(GL_FRAGMENT_SHADER, mResources);
+    TranslatorESSL *second = createTranslator(GL_FRAGMENT_SHADER, otherResources);
+    TranslatorESSL *vertex = createTranslator(GL_VERTEX_SHADER, mResources);
+
+    const TSymbol *maxDrawBuffers = findBuiltIn(first, "gl_MaxDrawBuffers");
+    ASSERT_NE(nullptr, maxDrawBuffers);
+    EXPECT_NE(maxDrawBuffers, findBuiltIn(second, "gl_MaxDrawBuffers"));
+    EXPECT_NE(findBuiltIn(first, "sin(f1;"), findBuiltIn(vertex, "sin(f1;"));
+
+    delete first;
+    delete second;
+    delete vertex;
+}
+
+// Test that the shared built-ins outlive the compiler that created them, and are not changed by
+// the shaders compiled against them.
+TEST_F(BuiltInSymbolTableTest, UsableAfterCreatorIsDeleted)
+{
+    TranslatorESSL *first = createTranslator(GL_FRAGMENT_SHADER, mResources);
+    EXPECT_TRUE(compile(first, kFragmentShader));
+
+    TranslatorESSL *second = createTranslator(GL_FRAGMENT_SHADER, mResources);
+    delete first;
+
+    EXPECT_TRUE(compile(second, kFragmentShader));
+    EXPECT_TRUE(compile(second, kFragmentShader));
+
+    delete second;
+}
+
+}  // anonymous namespace
@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompileBudget_test.cpp:
+//   Tests that SH_LIMIT_COMPILE_BUDGET stops the compile of shaders that exceed the budget.
+//
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+
+namespace
+{
+
+class CompileBudgetTest : public testing::Test
+{
+  public:
+    CompileBudgetTest() : mCompiler(nullptr) {}
+
+  protected:
+    void SetUp() override { ShInitBuiltInResources(&mResources); }
+
+    void TearDown() override
+    {
+        if (mCompiler)
+        {
+            ShDestruct(mCompiler);
+            mCompiler = nullptr;
+        }
+    }
+
+    // Returns the info log if the compile fails, or an empty string.
+    std::string compileFailure(const char *shaderString, int compileOptions)
+    {
+        mCompiler = ShConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL_SPEC, SH_GLSL_130_OUTPUT,
+                                        &mResources);
+        EXPECT_TRUE(mCompiler != nullptr);
+
+        int options = SH_OBJECT_CODE | SH_LIMIT_COMPILE_BUDGET | compileOptions;
+        if (ShCompile(mCompiler, &shaderString, 1, options))
+        {
+            EXPECT_NE("", ShGetObjectCode(mCompiler));
+            return "";
+        }
+
+        EXPECT_EQ("", ShGetObjectCode(mCompiler));
+        return ShGetInfoLog(mCompiler);
+    }
+
+    ShBuiltInResources mResources;
+
+  private:
+    ShHandle mCompiler;
+};
+
+const char *kSimpleShader =
+    "precision mediump float;\n"
+    "uniform vec4 u;\n"
+    "void main() {\n"
+    "    gl_FragColor = u;\n"
+    "}\n";
+
+// Test that an ordinary shader compiles within the default budget.
+TEST_F(CompileBudgetTest, OrdinaryShaderWithinBudget)
+{
+    EXPECT_EQ("", compileFailure(kSimpleShader, 0));
+}
+
+// Test that macros expanding to more tokens than the budget fail the compile without expanding
+// them all.
+TEST_F(CompileBudgetTest, TooManyPreprocessedTokens)
+{
+    const char *shaderString =
+        "precision mediump float;\n"
+        "#define a(x) x + x + x + x\n"
+        "#define b(x) a(a(a(a(x))))\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(b(b(b(1.0))));\n"
+        "}\n";
+
+    std::string infoLog = compileFailure(shaderString, 0);
+    EXPECT_NE(std::string::npos, infoLog.find("too many tokens")) << infoLog;
+}
+
+// Test that the allocations of the compile count against the budget.
+TEST_F(CompileBudgetTest, TooManyAllocations)
+{
+    mResources.MaxCompileAllocations = 10;
+
+    std::string infoLog = compileFailure(kSimpleShader, 0);
+    EXPECT_NE(std::string::npos, infoLog.find("compile allocation budget exceeded")) << infoLog;
+}
+
+// Test that constant folding checks the budget and stops the parse once it is exceeded. The shader
+// has few tokens, but each of them folds a matrix product, and the parse would otherwise go on to
+// report the syntax error at its end before the budget is checked.
+TEST_F(CompileBudgetTest, TooManyAllocationsWhileFolding)
+{
+    mResources.MaxCompileAllocations = 10;
+
+    std::string shaderString =
+        "precision mediump float;\n"
+        "const mat4 m = mat4(2.0);\n"
+        "void main() {\n"
+        "    mat4 r = m";
+    for (int i = 0; i < 60; ++i)
+    {
+        shaderString += " * m";
+    }
+    shaderString +=
+        ";\n"
+        "    gl_FragColor = r[0] +;\n"
+        "}\n";
+
+    std::string infoLog = compileFailure(shaderString.c_str(), 0);
+    EXPECT_NE(std::string::npos, infoLog.find("compile allocation budget exceeded")) << infoLog;
+    EXPECT_EQ(std::string::npos, infoLog.find("syntax error")) << infoLog;
+}
+
+// Test that unrolling loops stops once the compile runs out of time.
+TEST_F(CompileBudgetTest, OutOfTime)
+{
+    mResources.MaxCompileTimeMilliseconds = 50;
+    mResources.MaxCompileAllocations      = 0;
+
+    const char *shaderString =
+        "precision mediump float;\n"
+        "uniform vec4 u[4];\n"
+        "void main() {\n"
+        "    vec4 sum = vec4(0.0);\n"
+        "    for (int i = 0; i < 1000; ++i)\n"
+        "        for (int j = 0; j < 1000; ++j)\n"
+        "            for (int k = 0; k < 1000; ++k)\n"
+        "                sum += u[i - i / 4 * 4];\n"
+        "    gl_FragColor = sum;\n"
+        "}\n";
+
+    std::string infoLog = compileFailure(shaderString, SH_UNROLL_FOR_LOOP_WITH_INTEGER_INDEX);
+    EXPECT_NE(std::string::npos, infoLog.find("compile time budget exceeded")) << infoLog;
+}
+
+}  // anonymous namespace
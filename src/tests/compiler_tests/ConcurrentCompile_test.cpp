@@ -0,0 +1,222 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ConcurrentCompile_test.cpp:
+//   Tests that separate compiler handles can compile at the same time on different threads.
+//
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+
+namespace
+{
+
+const size_t kNumThreads    = 4;
+const size_t kNumIterations = 20;
+
+const char *kVertexShader =
+    "attribute vec4 a_position;\n"
+    "uniform mat4 u_mvp;\n"
+    "varying vec4 v_color;\n"
+    "void main() {\n"
+    "    v_color = normalize(a_position);\n"
+    "    gl_Position = u_mvp * a_position;\n"
+    "}\n";
+
+const char *kFragmentShader =
+    "#version 300 es\n"
+    "precision mediump float;\n"
+    "uniform sampler2D u_texture;\n"
+    "in vec2 v_texCoord;\n"
+    "out vec4 color;\n"
+    "float f(float x) { return sin(x) * cos(x); }\n"
+    "void main() {\n"
+    "    color = texture(u_texture, v_texCoord);\n"
+    "    for (int i = 0; i < 4; ++i) {\n"
+    "        color.x += f(float(i));\n"
+    "    }\n"
+    "    color.y = gl_DepthRange.near;\n"
+    "}\n";
+
+struct CompileJob
+{
+    sh::GLenum shaderType;
+    ShShaderOutput output;
+    const char *source;
+};
+
+const CompileJob kJobs[] = {
+    {GL_VERTEX_SHADER, SH_ESSL_OUTPUT, kVertexShader},
+    {GL_FRAGMENT_SHADER, SH_ESSL_OUTPUT, kFragmentShader},
+    {GL_VERTEX_SHADER, SH_GLSL_COMPATIBILITY_OUTPUT, kVertexShader},
+    {GL_FRAGMENT_SHADER, SH_GLSL_330_CORE_OUTPUT, kFragmentShader},
+};
+
+class ConcurrentCompileTest : public testing::Test
+{
+  protected:
+    void SetUp() override { ShInitBuiltInResources(&mResources); }
+
+    ShHandle construct(const CompileJob &job)
+    {
+        ShShaderSpec spec = job.shaderType == GL_FRAGMENT_SHADER ? SH_GLES3_SPEC : SH_GLES2_SPEC;
+        return ShConstructCompiler(job.shaderType, spec, job.output, &mResources);
+    }
+
+    static bool compile(ShHandle compiler, const char *source, std::string *objectCode)
+    {
+        const char *shaderStrings[] = {source};
+        if (!ShCompile(compiler, shaderStrings, 1, SH_OBJECT_CODE | SH_VARIABLES))
+        {
+            return false;
+        }
+        *objectCode = ShGetObjectCode(compiler);
+        return true;
+    }
+
+    ShBuiltInResources mResources;
+};
+
+// Test that compiles running on several threads produce the same results as serial compiles.
+TEST_F(ConcurrentCompileTest, MatchesSerialCompile)
+{
+    std::vector<std::string> expected(kNumThreads);
+    for (size_t jobIndex = 0; jobIndex < kNumThreads; ++jobIndex)
+    {
+        ShHandle compiler = construct(kJobs[jobIndex]);
+        ASSERT_NE(nullptr, compiler);
+        ASSERT_TRUE(compile(compiler, kJobs[jobIndex].source, &expected[jobIndex]));
+        ShDestruct(compiler);
+    }
+
+    std::vector<ShHandle> compilers(kNumThreads);
+    for (size_t jobIndex = 0; jobIndex < kNumThreads; ++jobIndex)
+    {
+        compilers[jobIndex] = construct(kJobs[jobIndex]);
+        ASSERT_NE(nullptr, compilers[jobIndex]);
+    }
+
+    std::vector<size_t> numMatches(kNumThreads, 0);
+    std::vector<std::thread> threads;
+    for (size_t jobIndex = 0; jobIndex < kNumThreads; ++jobIndex)
+    {
+        threads.push_back(std::thread([&, jobIndex]() {
+            for (size_t iteration = 0; iteration < kNumIterations; ++iteration)
+            {
+                std::string objectCode;
+                if (compile(compilers[jobIndex], kJobs[jobIndex].source, &objectCode) &&
+                    objectCode == expected[jobIndex])
+                {
+                    numMatches[jobIndex]++;
+                }
+            }
+        }));
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t jobIndex = 0; jobIndex < kNumThreads; ++jobIndex)
+    {
+        EXPECT_EQ(kNumIterations, numMatches[jobIndex]) << "job " << jobIndex;
+        ShDestruct(compilers[jobIndex]);
+    }
+}
+
+// Test that compilers can be created on several threads at once while sharing built-ins.
+TEST_F(ConcurrentCompileTest, ConstructOnSeveralThreads)
+{
+    std::vector<size_t> numSuccesses(kNumThreads, 0);
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kNumThreads; ++threadIndex)
+    {
+        threads.push_back(std::thread([&, threadIndex]() {
+            for (size_t iteration = 0; iteration < kNumIterations; ++iteration)
+            {
+                const CompileJob &job = kJobs[(threadIndex + iteration) % kNumThreads];
+                ShHandle compiler     = construct(job);
+                std::string objectCode;
+                if (compiler != nullptr && compile(compiler, job.source, &objectCode))
+                {
+                    numSuccesses[threadIndex]++;
+                }
+                ShDestruct(compiler);
+            }
+        }));
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t threadIndex = 0; threadIndex < kNumThreads; ++threadIndex)
+    {
+        EXPECT_EQ(kNumIterations, numSuccesses[threadIndex]) << "thread " << threadIndex;
+    }
+}
+
+// Test that a batch compiled on several threads gives each shader the results of compiling it
+// alone, including the failures and their info logs.
+TEST_F(ConcurrentCompileTest, BatchMatchesSerialCompile)
+{
+    const char *badShader = "void main() { undeclared = 1.0; }";
+    const char *sources[] = {kVertexShader, badShader};
+    const int kOptions[]  = {SH_OBJECT_CODE | SH_VARIABLES, SH_OBJECT_CODE};
+
+    const CompileJob &job = kJobs[0];
+    ShHandle compiler     = construct(job);
+    ASSERT_NE(nullptr, compiler);
+
+    std::vector<ShBatchShader> shaders;
+    for (size_t i = 0; i < kNumIterations; ++i)
+    {
+        ShBatchShader shader = {&sources[i % 2], 1, kOptions[i % 2]};
+        shaders.push_back(shader);
+    }
+
+    std::vector<std::string> expectedInfoLogs(2);
+    std::vector<std::string> expectedObjectCode(2);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        EXPECT_EQ(i == 0, ShCompile(compiler, &sources[i], 1, kOptions[i]));
+        expectedInfoLogs[i]   = ShGetInfoLog(compiler);
+        expectedObjectCode[i] = ShGetObjectCode(compiler);
+    }
+    ASSERT_TRUE(ShCompile(compiler, &sources[0], 1, kOptions[0]));
+    std::vector<sh::Uniform> expectedUniforms = *ShGetUniforms(compiler);
+    ASSERT_EQ(1u, expectedUniforms.size());
+
+    // The second batch reuses the compilers of the first one.
+    for (size_t batch = 0; batch < 2; ++batch)
+    {
+        std::vector<ShBatchResult> results(shaders.size());
+        EXPECT_FALSE(
+            ShCompileBatch(compiler, shaders.data(), shaders.size(), kNumThreads, results.data()));
+
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            EXPECT_EQ(i % 2 == 0, results[i].success) << "shader " << i;
+            EXPECT_EQ(expectedInfoLogs[i % 2], results[i].infoLog) << "shader " << i;
+            EXPECT_EQ(expectedObjectCode[i % 2], results[i].objectCode) << "shader " << i;
+            if (i % 2 == 0)
+            {
+                EXPECT_EQ(expectedUniforms, results[i].uniforms) << "shader " << i;
+            }
+        }
+        EXPECT_EQ("", ShGetObjectCode(compiler));
+    }
+
+    ShDestruct(compiler);
+}
+
+}  // anonymous namespace
@@ -744,3 +744,142 @@ TEST_F(ConstantFoldingTest, FoldNestedIdenticalStructEqualityComparison)
     compile(shaderString);
     ASSERT_TRUE(constantFoundInAST(1.0f));
 }
+
+// Test that a scalar on the left of a binary operation applies to every component of a vector.
+TEST_F(ConstantFoldingTest, FoldScalarPlusVector)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "in float i;\n"
+        "out vec4 my_Vec;\n"
+        "void main() {\n"
+        "   const vec4 v = 1.5 + vec4(1.0, 2.0, 3.0, 4.0);\n"
+        "   my_Vec = v * i;\n"
+        "}\n";
+    compile(shaderString);
+    float outputElements[] = {2.5f, 3.5f, 4.5f, 5.5f};
+    std::vector<float> result(outputElements, outputElements + 4);
+    ASSERT_TRUE(constantVectorFoundInAST(result));
+}
+
+// Test that a scalar on the right of a binary operation applies to every component of a vector.
+TEST_F(ConstantFoldingTest, FoldIntegerVectorTimesScalar)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "in float i;\n"
+        "out vec3 my_Vec;\n"
+        "void main() {\n"
+        "   const ivec3 v = ivec3(1, -2, 7) * 3;\n"
+        "   my_Vec = vec3(v) * i;\n"
+        "}\n";
+    compile(shaderString);
+    // The conversion to vec3 is folded too.
+    float outputElements[] = {3.0f, -6.0f, 21.0f};
+    std::vector<float> result(outputElements, outputElements + 3);
+    ASSERT_TRUE(constantVectorFoundInAST(result));
+}
+
+// Test that bitwise operations between an unsigned vector and a scalar are folded per component.
+TEST_F(ConstantFoldingTest, FoldUnsignedVectorBitwiseAndScalar)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "precision highp int;\n"
+        "in float i;\n"
+        "out vec2 my_Vec;\n"
+        "void main() {\n"
+        "   const uvec2 v = (uvec2(0xF0u, 0x0Fu) & 0x3Cu) | uvec2(1u, 2u);\n"
+        "   my_Vec = vec2(v) * i;\n"
+        "}\n";
+    compile(shaderString);
+    float outputElements[] = {49.0f, 14.0f};
+    std::vector<float> result(outputElements, outputElements + 2);
+    ASSERT_TRUE(constantVectorFoundInAST(result));
+}
+
+// Test that unary minus and radians() are folded for every component of a vector.
+TEST_F(ConstantFoldingTest, FoldUnaryOperationsOnVectors)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "in float i;\n"
+        "out vec4 my_Vec;\n"
+        "void main() {\n"
+        "   const ivec2 n = -ivec2(5, -6);\n"
+        "   const vec2 r = radians(vec2(180.0, -90.0));\n"
+        "   my_Vec = vec4(vec2(n), r) * i;\n"
+        "}\n";
+    compile(shaderString);
+    float outputElements[] = {-5.0f, 6.0f, 3.14159265f, -1.57079633f};
+    std::vector<float> result(outputElements, outputElements + 4);
+    ASSERT_TRUE(constantVectorNearFoundInAST(result, 1.0e-5f));
+}
+
+// Test that the product of non-square matrices is folded. All the matrices are in column-major
+// order.
+TEST_F(ConstantFoldingTest, FoldNonSquareMatrixTimesMatrix)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "in float i;\n"
+        "out vec4 my_Vec;\n"
+        "void main() {\n"
+        "   const mat2 m = mat3x2(1.0, 2.0, 3.0, 4.0, 5.0, 6.0) *\n"
+        "                  mat2x3(1.0, 0.0, 1.0, 0.0, 1.0, 0.0);\n"
+        "   mat2 r = m * i;\n"
+        "   my_Vec = vec4(r[0], r[1]);\n"
+        "}\n";
+    compile(shaderString);
+    float outputElements[] =
+    {
+        6.0f, 8.0f,
+        3.0f, 4.0f
+    };
+    std::vector<float> result(outputElements, outputElements + 4);
+    ASSERT_TRUE(constantVectorFoundInAST(result));
+}
+
+// Test that the products of a matrix and a vector are folded in both orders.
+TEST_F(ConstantFoldingTest, FoldMatrixTimesVectorAndVectorTimesMatrix)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "in float i;\n"
+        "out vec4 my_Vec;\n"
+        "void main() {\n"
+        "   const mat2x3 m = mat2x3(1.0, 2.0, 3.0, 4.0, 5.0, 6.0);\n"
+        "   const vec3 mv = m * vec2(1.0, 2.0);\n"
+        "   const vec2 vm = vec3(1.0, 1.0, 2.0) * m;\n"
+        "   my_Vec = vec4(mv, vm.x + vm.y) * i;\n"
+        "}\n";
+    compile(shaderString);
+    // m * vec2(1.0, 2.0) is vec3(9.0, 12.0, 15.0) and vec3(1.0, 1.0, 2.0) * m is vec2(9.0, 21.0).
+    float outputElements[] = {9.0f, 12.0f, 15.0f, 30.0f};
+    std::vector<float> result(outputElements, outputElements + 4);
+    ASSERT_TRUE(constantVectorFoundInAST(result));
+}
+
+// Test that a constructor folds arguments of the result type and arguments to convert together.
+TEST_F(ConstantFoldingTest, FoldVec4ConstructorTakingIvec2AndVec2)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "in float i;\n"
+        "out vec4 my_Vec;\n"
+        "void main() {\n"
+        "   const vec4 v = vec4(ivec2(1, 2), vec2(3.5, 4.5));\n"
+        "   my_Vec = v * i;\n"
+        "}\n";
+    compile(shaderString);
+    float outputElements[] = {1.0f, 2.0f, 3.5f, 4.5f};
+    std::vector<float> result(outputElements, outputElements + 4);
+    ASSERT_TRUE(constantVectorFoundInAST(result));
+}
@@ -0,0 +1,121 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser_test.cpp:
+//   Tests that passes sharing a traversal see the same nodes as when traversing alone.
+//
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "compiler/translator/FusedTraverser.h"
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/PoolAlloc.h"
+
+namespace
+{
+
+// Records the names of the visited symbols, and skips the children of the nodes with the given
+// operator.
+class SymbolRecorder : public TIntermTraverser
+{
+  public:
+    SymbolRecorder(TOperator skippedOp) : TIntermTraverser(true, false, false), mSkippedOp(skippedOp)
+    {
+    }
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        mSymbols += node->getSymbol().c_str();
+    }
+    bool visitBinary(Visit, TIntermBinary *node) override { return node->getOp() != mSkippedOp; }
+    bool visitUnary(Visit, TIntermUnary *node) override { return node->getOp() != mSkippedOp; }
+    bool visitAggregate(Visit, TIntermAggregate *node) override
+    {
+        return node->getOp() != mSkippedOp;
+    }
+
+    const std::string &getSymbols() const { return mSymbols; }
+
+  private:
+    TOperator mSkippedOp;
+    std::string mSymbols;
+};
+
+class FusedTraverserTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        mAllocator.push();
+        SetGlobalPoolAllocator(&mAllocator);
+    }
+
+    void TearDown() override
+    {
+        SetGlobalPoolAllocator(nullptr);
+        mAllocator.pop();
+    }
+
+    TIntermSymbol *createSymbol(const char *name)
+    {
+        return new TIntermSymbol(0, TString(name), TType(EbtFloat, EbpHigh));
+    }
+
+    TIntermBinary *createBinary(TOperator op, const char *left, const char *right)
+    {
+        TIntermBinary *node = new TIntermBinary(op);
+        node->setLeft(createSymbol(left));
+        node->setRight(createSymbol(right));
+        return node;
+    }
+
+    // Builds the sequence {a + b; -(c * d); e}.
+    TIntermAggregate *createTree()
+    {
+        TIntermUnary *negate = new TIntermUnary(EOpNegative);
+        negate->setOperand(createBinary(EOpMul, "c", "d"));
+
+        TIntermAggregate *sequence = new TIntermAggregate(EOpSequence);
+        sequence->getSequence()->push_back(createBinary(EOpAdd, "a", "b"));
+        sequence->getSequence()->push_back(negate);
+        sequence->getSequence()->push_back(createSymbol("e"));
+        return sequence;
+    }
+
+  private:
+    TPoolAllocator mAllocator;
+};
+
+// Test that each fused pass only skips the children of its own skipped nodes.
+TEST_F(FusedTraverserTest, PassesSkipChildrenIndependently)
+{
+    TIntermAggregate *root = createTree();
+
+    const TOperator kSkippedOps[] = {EOpNull, EOpAdd, EOpMul, EOpNegative, EOpSequence};
+
+    TFusedTraverser fused;
+    std::vector<std::unique_ptr<SymbolRecorder>> fusedRecorders;
+    for (TOperator op : kSkippedOps)
+    {
+        fusedRecorders.push_back(std::unique_ptr<SymbolRecorder>(new SymbolRecorder(op)));
+        fused.addPass(fusedRecorders.back().get());
+    }
+    root->traverse(&fused);
+
+    for (size_t i = 0; i < fusedRecorders.size(); ++i)
+    {
+        SymbolRecorder alone(kSkippedOps[i]);
+        root->traverse(&alone);
+        EXPECT_EQ(alone.getSymbols(), fusedRecorders[i]->getSymbols()) << i;
+    }
+
+    EXPECT_EQ("abcde", fusedRecorders[0]->getSymbols());
+    EXPECT_EQ("cde", fusedRecorders[1]->getSymbols());
+    EXPECT_EQ("abe", fusedRecorders[2]->getSymbols());
+    EXPECT_EQ("abe", fusedRecorders[3]->getSymbols());
+    EXPECT_EQ("", fusedRecorders[4]->getSymbols());
+}
+
+}  // anonymous namespace
@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// InfoSink_test.cpp:
+//   Tests that TInfoSinkBase formats numbers the same way as the string streams it used to.
+//
+
+#include <limits>
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "compiler/translator/InfoSink.h"
+
+namespace
+{
+
+std::string FormatFloatWithStream(float f)
+{
+    std::ostringstream stream;
+    if (fractionalPart(f) == 0.0f)
+    {
+        stream.precision(1);
+        stream << std::showpoint << std::fixed << f;
+    }
+    else
+    {
+        stream.unsetf(std::ios::fixed);
+        stream.unsetf(std::ios::scientific);
+        stream.precision(8);
+        stream << f;
+    }
+    return stream.str();
+}
+
+template <typename T>
+std::string FormatWithStream(T value)
+{
+    std::ostringstream stream;
+    stream << value;
+    return stream.str();
+}
+
+template <typename T>
+std::string FormatWithSink(T value)
+{
+    TInfoSinkBase sink;
+    sink << value;
+    return sink.str();
+}
+
+// Test that floats are written with the precision of the string stream, and with a decimal point
+// when they are integral.
+TEST(InfoSinkTest, Floats)
+{
+    const float kValues[] = {0.0f,
+                             -0.0f,
+                             1.0f,
+                             -3.0f,
+                             0.5f,
+                             0.1f,
+                             -1.25f,
+                             3.14159265f,
+                             1.0e-7f,
+                             1.0e20f,
+                             123456.789f,
+                             16777216.0f,
+                             std::numeric_limits<float>::max(),
+                             std::numeric_limits<float>::lowest(),
+                             std::numeric_limits<float>::min(),
+                             std::numeric_limits<float>::denorm_min()};
+
+    for (float value : kValues)
+    {
+        EXPECT_EQ(FormatFloatWithStream(value), FormatWithSink(value)) << value;
+    }
+
+    EXPECT_EQ("1.0", FormatWithSink(1.0f));
+    EXPECT_EQ("0.1", FormatWithSink(0.1f));
+}
+
+// Test that integers of every size are written like the string stream writes them.
+TEST(InfoSinkTest, Integers)
+{
+    const int kInts[] = {0, 1, -1, 10, -10, 123456789, std::numeric_limits<int>::max(),
+                         std::numeric_limits<int>::min()};
+    for (int value : kInts)
+    {
+        EXPECT_EQ(FormatWithStream(value), FormatWithSink(value));
+    }
+
+    EXPECT_EQ(FormatWithStream(std::numeric_limits<unsigned int>::max()),
+              FormatWithSink(std::numeric_limits<unsigned int>::max()));
+    EXPECT_EQ(FormatWithStream(std::numeric_limits<long long>::min()),
+              FormatWithSink(std::numeric_limits<long long>::min()));
+    EXPECT_EQ(FormatWithStream(std::numeric_limits<unsigned long long>::max()),
+              FormatWithSink(std::numeric_limits<unsigned long long>::max()));
+    EXPECT_EQ(FormatWithStream(static_cast<size_t>(42)), FormatWithSink(static_cast<size_t>(42)));
+}
+
+// Test that appending a sink appends all of its contents.
+TEST(InfoSinkTest, AppendSink)
+{
+    TInfoSinkBase header;
+    header << "header " << 1 << "\n";
+
+    TInfoSinkBase body;
+    body << "body " << 2.5f << "\n";
+
+    TInfoSinkBase out;
+    out.reserve(header.size() + body.size());
+    out << header << body;
+    EXPECT_EQ("header 1\nbody 2.5\n", out.str());
+}
+
+}  // anonymous namespace
@@ -763,6 +763,46 @@ TEST_F(MalformedShaderTest, TwoOutputsNoLayoutQualifiers)
     }
 }
 
+// Loop and indexing validation only reports its errors if the outputs are valid, as it runs after
+// output validation.
+TEST_F(MalformedShaderTest, InvalidOutputsSkipLoopIndexingErrors)
+{
+    const std::string &shaderString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "out vec4 my_FragColor;\n"
+        "out vec4 my_SecondaryFragColor;\n"
+        "void main() {\n"
+        "    for (int i = 0; i < 4; i++) { i = 2; }\n"
+        "    my_FragColor = vec4(1.0);\n"
+        "    my_SecondaryFragColor = vec4(0.5);\n"
+        "}\n";
+    mExtraCompileOptions = SH_VALIDATE_LOOP_INDEXING;
+    if (compile(shaderString))
+    {
+        FAIL() << "Shader compilation succeeded, expecting failure " << mInfoLog;
+    }
+    EXPECT_NE(std::string::npos, mInfoLog.find("my_SecondaryFragColor")) << mInfoLog;
+    EXPECT_EQ(std::string::npos, mInfoLog.find("Loop index cannot be statically assigned"))
+        << mInfoLog;
+
+    // With valid outputs, the loop index error is reported.
+    const std::string &validOutputsString =
+        "#version 300 es\n"
+        "precision mediump float;\n"
+        "out vec4 my_FragColor;\n"
+        "void main() {\n"
+        "    for (int i = 0; i < 4; i++) { i = 2; }\n"
+        "    my_FragColor = vec4(1.0);\n"
+        "}\n";
+    if (compile(validOutputsString))
+    {
+        FAIL() << "Shader compilation succeeded, expecting failure " << mInfoLog;
+    }
+    EXPECT_NE(std::string::npos, mInfoLog.find("Loop index cannot be statically assigned"))
+        << mInfoLog;
+}
+
 // (ESSL 3.00.04 section 4.3.8.2)
 TEST_F(MalformedShaderTest, TwoOutputsFirstLayoutQualifier)
 {
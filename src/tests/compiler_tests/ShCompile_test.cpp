@@ -11,6 +11,8 @@
 #include "gtest/gtest.h"
 #include "GLSLANG/ShaderLang.h"
 
+#include <string.h>
+
 class ShCompileTest : public testing::Test
 {
   public:
@@ -34,13 +36,18 @@ class ShCompileTest : public testing::Test
         }
     }
 
-    void testCompile(const char **shaderStrings, int stringCount, bool expectation)
+    void testCompile(const char **shaderStrings,
+                     int stringCount,
+                     bool expectation,
+                     int compileOptions = 0)
     {
-        bool success                  = ShCompile(mCompiler, shaderStrings, stringCount, 0);
+        bool success = ShCompile(mCompiler, shaderStrings, stringCount, compileOptions);
         const std::string &compileLog = ShGetInfoLog(mCompiler);
         EXPECT_EQ(expectation, success) << compileLog;
     }
 
+    const ShCompileStatistics *getStatistics() const { return ShGetCompileStatistics(mCompiler); }
+
   private:
     ShBuiltInResources mResources;
     ShHandle mCompiler;
@@ -81,3 +88,60 @@ TEST_F(ShCompileTest, TokensSplitInShaderStrings)
 
     testCompile(shaderStrings, 3, true);
 }
+
+// Test that the compile statistics report the phases in order when they are asked for.
+TEST_F(ShCompileTest, CompileStatistics)
+{
+    const char *shaderString =
+        "precision mediump float;\n"
+        "uniform vec4 u;\n"
+        "void main() {\n"
+        "    gl_FragColor = u;\n"
+        "}";
+
+    testCompile(&shaderString, 1, true,
+                SH_OBJECT_CODE | SH_VARIABLES | SH_COLLECT_COMPILE_STATISTICS);
+
+    const ShCompileStatistics *statistics = getStatistics();
+    ASSERT_TRUE(statistics != nullptr);
+    const std::vector<ShPhaseTiming> &timings = statistics->phaseTimings;
+    ASSERT_GE(timings.size(), 4u);
+    EXPECT_STREQ("Preprocess", timings.front().name);
+    EXPECT_STREQ("Parse", timings[1].name);
+    EXPECT_STREQ("Output", timings.back().name);
+
+    bool hasCollectVariables = false;
+    for (const ShPhaseTiming &timing : timings)
+    {
+        EXPECT_GE(timing.seconds, 0.0) << timing.name;
+        if (strcmp(timing.name, "CollectVariables") == 0)
+            hasCollectVariables = true;
+    }
+    EXPECT_TRUE(hasCollectVariables);
+
+    EXPECT_GT(statistics->poolPeakBytes, 0u);
+    EXPECT_GT(statistics->poolPagesAllocated + statistics->poolPagesReused, 0u);
+    EXPECT_GT(statistics->poolAllocations, 0u);
+    EXPECT_GE(statistics->poolAllocatedBytes, statistics->poolAllocations);
+}
+
+// Test that the pool usage is reported without the phase timings, and that the pages of the
+// previous compile are reused.
+TEST_F(ShCompileTest, PoolStatisticsWithoutTimings)
+{
+    const char *shaderString =
+        "precision mediump float;\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(0.0);\n"
+        "}";
+
+    testCompile(&shaderString, 1, true, SH_OBJECT_CODE);
+    testCompile(&shaderString, 1, true, SH_OBJECT_CODE);
+
+    const ShCompileStatistics *statistics = getStatistics();
+    ASSERT_TRUE(statistics != nullptr);
+    EXPECT_TRUE(statistics->phaseTimings.empty());
+    EXPECT_GT(statistics->poolPeakBytes, 0u);
+    EXPECT_GT(statistics->poolPagesReused, 0u);
+    EXPECT_GT(statistics->poolAllocations, 0u);
+}
@@ -216,3 +216,27 @@ TEST_F(ShaderExtensionTest, BuiltinRewritingBug)
     TestShaderExtension(shaderStrings, 1, false);
     TestShaderExtension(shaderStrings, 1, false);
 }
+
+// Test that the extension macros are defined by every compile, and that the macros defined by a
+// shader are not kept for the next compiles.
+TEST_F(ShaderExtensionTest, ExtensionMacrosOnRecompile)
+{
+    mResources.OES_standard_derivatives = 1;
+    InitializeCompiler();
+
+    const char *defineShader[] = {
+        "#ifndef GL_OES_standard_derivatives\n"
+        "#error GL_OES_standard_derivatives is not defined\n"
+        "#endif\n"
+        "#define SHADER_MACRO 1\n"
+        "void main() {}\n"};
+    const char *checkShader[] = {
+        "#if !defined(GL_OES_standard_derivatives) || defined(SHADER_MACRO)\n"
+        "#error wrong macros\n"
+        "#endif\n"
+        "void main() {}\n"};
+
+    TestShaderExtension(defineShader, 1, true);
+    TestShaderExtension(checkShader, 1, true);
+    TestShaderExtension(defineShader, 1, true);
+}
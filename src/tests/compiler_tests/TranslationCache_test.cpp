@@ -0,0 +1,336 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TranslationCache_test.cpp:
+//   Tests for the translation cache used by compiles that pass SH_CACHE_TRANSLATION.
+//
+
+#include <stdio.h>
+
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "GLSLANG/ShaderLang.h"
+#include "compiler/translator/TranslationCache.h"
+
+namespace
+{
+
+const char *kCacheFileName = "angle_translation_cache_test.bin";
+
+const char *kFragmentShader =
+    "precision mediump float;\n"
+    "uniform vec4 u_color;\n"
+    "varying vec2 v_texCoord;\n"
+    "void main() {\n"
+    "    gl_FragColor = u_color * vec4(v_texCoord, 0.0, 1.0);\n"
+    "}\n";
+
+// A shader of the same length as kFragmentShader, with its own results.
+std::string MakeShaderVariant(int index)
+{
+    std::string uniformName = "u_col";
+    uniformName += static_cast<char>('a' + index / 26);
+    uniformName += static_cast<char>('a' + index % 26);
+    std::string shader      = kFragmentShader;
+    shader.replace(shader.find("u_color"), 7, uniformName);
+    shader.replace(shader.find("u_color"), 7, uniformName);
+    return shader;
+}
+
+size_t GetFileSize(const char *fileName)
+{
+    FILE *file = fopen(fileName, "rb");
+    if (file == nullptr)
+    {
+        return 0;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return static_cast<size_t>(size);
+}
+
+class TranslationCacheTest : public testing::Test
+{
+  public:
+    TranslationCacheTest() : mCompiler(nullptr) {}
+
+  protected:
+    void SetUp() override
+    {
+        ShInitBuiltInResources(&mResources);
+        mCompiler = ShConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC,
+                                        SH_GLSL_COMPATIBILITY_OUTPUT, &mResources);
+        ASSERT_TRUE(mCompiler != nullptr) << "Compiler could not be constructed.";
+
+        ASSERT_TRUE(ShSetTranslationCacheOptions(TranslationCache::kDefaultMaxMemoryBytes, nullptr));
+        ShClearTranslationCache();
+    }
+
+    void TearDown() override
+    {
+        ShSetTranslationCacheOptions(TranslationCache::kDefaultMaxMemoryBytes, nullptr);
+        ShClearTranslationCache();
+        remove(kCacheFileName);
+
+        if (mCompiler)
+        {
+            ShDestruct(mCompiler);
+            mCompiler = nullptr;
+        }
+    }
+
+    bool compile(const char *source, int extraOptions)
+    {
+        const char *shaderStrings[] = {source};
+        return ShCompile(mCompiler, shaderStrings, 1,
+                         SH_OBJECT_CODE | SH_VARIABLES | SH_CACHE_TRANSLATION | extraOptions);
+    }
+
+    size_t hitCount() const { return TranslationCache::GetInstance()->getHitCount(); }
+
+    ShBuiltInResources mResources;
+    ShHandle mCompiler;
+};
+
+// Test that a second compile of the same source is served from the cache with the same results.
+TEST_F(TranslationCacheTest, IdenticalCompileHits)
+{
+    ASSERT_TRUE(compile(kFragmentShader, 0));
+    EXPECT_EQ(0u, hitCount());
+
+    std::string objectCode           = ShGetObjectCode(mCompiler);
+    std::vector<sh::Uniform> uniforms = *ShGetUniforms(mCompiler);
+    std::vector<sh::Varying> varyings = *ShGetVaryings(mCompiler);
+    ASSERT_EQ(1u, uniforms.size());
+    ASSERT_EQ(1u, varyings.size());
+
+    ShClearResults(mCompiler);
+    ASSERT_TRUE(compile(kFragmentShader, 0));
+    EXPECT_EQ(1u, hitCount());
+
+    EXPECT_EQ(objectCode, ShGetObjectCode(mCompiler));
+    EXPECT_EQ(uniforms, *ShGetUniforms(mCompiler));
+    EXPECT_EQ(varyings, *ShGetVaryings(mCompiler));
+}
+
+// Test that compiles with different options don't share results.
+TEST_F(TranslationCacheTest, DifferentOptionsMiss)
+{
+    ASSERT_TRUE(compile(kFragmentShader, 0));
+    ASSERT_TRUE(compile(kFragmentShader, SH_INTERMEDIATE_TREE));
+    EXPECT_EQ(0u, hitCount());
+}
+
+// Test that compilers with different array index clamping strategies don't share results.
+TEST_F(TranslationCacheTest, DifferentClampingStrategiesMiss)
+{
+    const char *shader =
+        "precision mediump float;\n"
+        "uniform vec4 u_values[4];\n"
+        "uniform int u_index;\n"
+        "void main() {\n"
+        "    gl_FragColor = u_values[u_index];\n"
+        "}\n";
+
+    mResources.ArrayIndexClampingStrategy = SH_CLAMP_WITH_USER_DEFINED_INT_CLAMP_FUNCTION;
+    ShHandle userClampCompiler = ShConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC,
+                                                     SH_GLSL_COMPATIBILITY_OUTPUT, &mResources);
+    ASSERT_TRUE(userClampCompiler != nullptr);
+
+    ASSERT_TRUE(compile(shader, SH_CLAMP_INDIRECT_ARRAY_BOUNDS));
+    EXPECT_EQ(std::string::npos, std::string(ShGetObjectCode(mCompiler)).find("webgl_int_clamp"));
+
+    const char *shaderStrings[] = {shader};
+    ASSERT_TRUE(ShCompile(userClampCompiler, shaderStrings, 1,
+                          SH_OBJECT_CODE | SH_VARIABLES | SH_CACHE_TRANSLATION |
+                              SH_CLAMP_INDIRECT_ARRAY_BOUNDS));
+    EXPECT_EQ(0u, hitCount());
+    EXPECT_NE(std::string::npos,
+              std::string(ShGetObjectCode(userClampCompiler)).find("webgl_int_clamp"));
+
+    ShDestruct(userClampCompiler);
+}
+
+// Test that failed compiles are cached along with their info log.
+TEST_F(TranslationCacheTest, FailedCompileIsCached)
+{
+    const char *badShader = "void main() { undeclared = 1.0; }";
+
+    ASSERT_FALSE(compile(badShader, 0));
+    std::string infoLog = ShGetInfoLog(mCompiler);
+    EXPECT_NE(std::string::npos, infoLog.find("undeclared"));
+
+    ASSERT_FALSE(compile(badShader, 0));
+    EXPECT_EQ(1u, hitCount());
+    EXPECT_EQ(infoLog, ShGetInfoLog(mCompiler));
+}
+
+// Test that results stored in the cache file are picked up again after the in-memory entries are
+// gone, which is what a fresh process sees.
+TEST_F(TranslationCacheTest, CacheFilePersistsResults)
+{
+    remove(kCacheFileName);
+    ASSERT_TRUE(ShSetTranslationCacheOptions(TranslationCache::kDefaultMaxMemoryBytes,
+                                             kCacheFileName));
+
+    ASSERT_TRUE(compile(kFragmentShader, 0));
+    std::string objectCode = ShGetObjectCode(mCompiler);
+
+    ShClearTranslationCache();
+    ASSERT_TRUE(ShSetTranslationCacheOptions(TranslationCache::kDefaultMaxMemoryBytes,
+                                             kCacheFileName));
+
+    ASSERT_TRUE(compile(kFragmentShader, 0));
+    EXPECT_EQ(1u, hitCount());
+    EXPECT_EQ(objectCode, ShGetObjectCode(mCompiler));
+}
+
+// Test that the cache file is rewritten from the cached results instead of growing past its
+// budget, and that the rewritten file keeps the most recent results.
+TEST_F(TranslationCacheTest, CacheFileIsCompacted)
+{
+    ASSERT_TRUE(compile(MakeShaderVariant(0).c_str(), 0));
+    size_t compileSize = TranslationCache::GetInstance()->getMemorySize();
+    ASSERT_NE(0u, compileSize);
+
+    size_t budget = 4 * compileSize;
+    remove(kCacheFileName);
+    ASSERT_TRUE(ShSetTranslationCacheOptions(budget, kCacheFileName));
+
+    for (int index = 1; index <= 40; ++index)
+    {
+        ASSERT_TRUE(compile(MakeShaderVariant(index).c_str(), 0));
+        EXPECT_LE(GetFileSize(kCacheFileName), TranslationCache::kMaxFileSizeFactor * budget);
+    }
+    std::string objectCode = ShGetObjectCode(mCompiler);
+
+    ShClearTranslationCache();
+    ASSERT_TRUE(ShSetTranslationCacheOptions(budget, kCacheFileName));
+    ASSERT_TRUE(compile(MakeShaderVariant(40).c_str(), 0));
+    EXPECT_EQ(1u, hitCount());
+    EXPECT_EQ(objectCode, ShGetObjectCode(mCompiler));
+}
+
+// Test that only the most recent results of the cache file that fit in the memory budget are
+// loaded.
+TEST_F(TranslationCacheTest, CacheFileLoadStopsAtBudget)
+{
+    ASSERT_TRUE(compile(MakeShaderVariant(0).c_str(), 0));
+    size_t compileSize = TranslationCache::GetInstance()->getMemorySize();
+    ShClearTranslationCache();
+
+    remove(kCacheFileName);
+    ASSERT_TRUE(ShSetTranslationCacheOptions(TranslationCache::kDefaultMaxMemoryBytes,
+                                             kCacheFileName));
+    for (int index = 1; index <= 4; ++index)
+    {
+        ASSERT_TRUE(compile(MakeShaderVariant(index).c_str(), 0));
+    }
+
+    ShClearTranslationCache();
+    ASSERT_TRUE(ShSetTranslationCacheOptions(2 * compileSize, kCacheFileName));
+    EXPECT_EQ(2 * compileSize, TranslationCache::GetInstance()->getMemorySize());
+
+    ASSERT_TRUE(compile(MakeShaderVariant(4).c_str(), 0));
+    ASSERT_TRUE(compile(MakeShaderVariant(3).c_str(), 0));
+    EXPECT_EQ(2u, hitCount());
+    ASSERT_TRUE(compile(MakeShaderVariant(1).c_str(), 0));
+    EXPECT_EQ(2u, hitCount());
+}
+
+// Test that variants of a shader whose defines don't change the preprocessed shader share their
+// results, while the variants that do change it are translated.
+TEST_F(TranslationCacheTest, EquivalentDefineVariantsHit)
+{
+    std::string unusedScale = std::string("#define UNUSED_SCALE 2.0\n") + kFragmentShader;
+    ASSERT_TRUE(compile(unusedScale.c_str(), 0));
+    EXPECT_EQ(0u, hitCount());
+    std::string objectCode = ShGetObjectCode(mCompiler);
+    std::string infoLog    = ShGetInfoLog(mCompiler);
+    std::vector<sh::Uniform> uniforms = *ShGetUniforms(mCompiler);
+
+    // Only the value of the unused define differs, and the comment is removed by the
+    // preprocessor.
+    std::string otherUnusedScale =
+        std::string("#define UNUSED_SCALE 4.0 // other\n") + kFragmentShader;
+    ASSERT_TRUE(compile(otherUnusedScale.c_str(), 0));
+    EXPECT_EQ(1u, hitCount());
+    EXPECT_EQ(objectCode, ShGetObjectCode(mCompiler));
+    EXPECT_EQ(infoLog, ShGetInfoLog(mCompiler));
+    EXPECT_EQ(uniforms, *ShGetUniforms(mCompiler));
+
+    // The same source is now found by its own key too.
+    ASSERT_TRUE(compile(otherUnusedScale.c_str(), 0));
+    EXPECT_EQ(2u, hitCount());
+
+    // A define shifting the lines of the shader only moves its tokens, which doesn't change a
+    // result without lines in it.
+    std::string shiftedLines = std::string("#define UNUSED_SCALE 2.0\n\n") + kFragmentShader;
+    ASSERT_TRUE(compile(shiftedLines.c_str(), 0));
+    EXPECT_EQ(3u, hitCount());
+    EXPECT_EQ(objectCode, ShGetObjectCode(mCompiler));
+}
+
+// Test that results reporting lines aren't shared with sources whose lines are shifted.
+TEST_F(TranslationCacheTest, LineDependentResultsMissWhenShifted)
+{
+    const char *badShader = "void main() {\n undeclared = 1.0;\n}\n";
+
+    std::string oneDefine = std::string("#define UNUSED 1\n") + badShader;
+    ASSERT_FALSE(compile(oneDefine.c_str(), 0));
+    EXPECT_NE(std::string::npos, std::string(ShGetInfoLog(mCompiler)).find("0:3:"));
+
+    std::string otherDefine = std::string("#define OTHER 2\n") + badShader;
+    ASSERT_FALSE(compile(otherDefine.c_str(), 0));
+    EXPECT_EQ(1u, hitCount());
+
+    std::string twoDefines = std::string("#define UNUSED 1\n#define OTHER 2\n") + badShader;
+    ASSERT_FALSE(compile(twoDefines.c_str(), 0));
+    EXPECT_EQ(1u, hitCount());
+    EXPECT_NE(std::string::npos, std::string(ShGetInfoLog(mCompiler)).find("0:4:"));
+}
+
+// Test that a define used by the shader changes the translation.
+TEST_F(TranslationCacheTest, UsedDefineVariantsMiss)
+{
+    const char *shader =
+        "precision mediump float;\n"
+        "void main() {\n"
+        "    gl_FragColor = vec4(SCALE);\n"
+        "}\n";
+
+    std::string half = std::string("#define SCALE 0.5\n") + shader;
+    ASSERT_TRUE(compile(half.c_str(), 0));
+    std::string objectCode = ShGetObjectCode(mCompiler);
+
+    std::string quarter = std::string("#define SCALE 0.25\n") + shader;
+    ASSERT_TRUE(compile(quarter.c_str(), 0));
+    EXPECT_EQ(0u, hitCount());
+    EXPECT_NE(objectCode, ShGetObjectCode(mCompiler));
+}
+
+// Test that the least recently used results are evicted when the memory budget is exceeded.
+TEST_F(TranslationCacheTest, MemoryBudgetEvicts)
+{
+    ASSERT_TRUE(compile(kFragmentShader, 0));
+    size_t entrySize = TranslationCache::GetInstance()->getMemorySize();
+    ASSERT_NE(0u, entrySize);
+
+    // A shader of the same length produces a result of the same size.
+    std::string otherShader = kFragmentShader;
+    otherShader.replace(otherShader.find("u_color"), 7, "u_colr2");
+    otherShader.replace(otherShader.find("u_color"), 7, "u_colr2");
+
+    ASSERT_TRUE(ShSetTranslationCacheOptions(entrySize, nullptr));
+    ASSERT_TRUE(compile(otherShader.c_str(), 0));
+    EXPECT_EQ(entrySize, TranslationCache::GetInstance()->getMemorySize());
+
+    // The first result was evicted to make room for the second.
+    ASSERT_TRUE(compile(kFragmentShader, 0));
+    EXPECT_EQ(0u, hitCount());
+}
+
+}  // anonymous namespace
@@ -0,0 +1,168 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MultiDrawTest:
+//   Tests for GL_ANGLE_multi_draw, drawing the two halves of the window in one call.
+//
+
+#include "test_utils/ANGLETest.h"
+
+using namespace angle;
+
+namespace
+{
+
+class MultiDrawTest : public ANGLETest
+{
+  protected:
+    MultiDrawTest()
+        : mProgram(0),
+          mPositionLocation(-1),
+          mMultiDrawArraysANGLE(nullptr),
+          mMultiDrawElementsANGLE(nullptr)
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void SetUp() override
+    {
+        ANGLETest::SetUp();
+
+        if (extensionEnabled("GL_ANGLE_multi_draw"))
+        {
+            mMultiDrawArraysANGLE = reinterpret_cast<PFNGLMULTIDRAWARRAYSANGLEPROC>(
+                eglGetProcAddress("glMultiDrawArraysANGLE"));
+            mMultiDrawElementsANGLE = reinterpret_cast<PFNGLMULTIDRAWELEMENTSANGLEPROC>(
+                eglGetProcAddress("glMultiDrawElementsANGLE"));
+        }
+
+        ASSERT_NE(nullptr, mMultiDrawArraysANGLE);
+        ASSERT_NE(nullptr, mMultiDrawElementsANGLE);
+
+        const std::string &vertexShader =
+            "attribute vec2 position;\n"
+            "void main() {\n"
+            "  gl_Position = vec4(position, 0, 1);\n"
+            "}";
+
+        const std::string &fragmentShader =
+            "void main() {\n"
+            "  gl_FragColor = vec4(0, 1, 0, 1);\n"
+            "}";
+
+        mProgram = CompileProgram(vertexShader, fragmentShader);
+        ASSERT_NE(0u, mProgram);
+        glUseProgram(mProgram);
+
+        mPositionLocation = glGetAttribLocation(mProgram, "position");
+        ASSERT_NE(-1, mPositionLocation);
+
+        // Two quads of two triangles each, covering the left and the right halves of the window.
+        const GLfloat halfQuads[2][12] = {
+            {-1, -1, 0, -1, 0, 1, -1, -1, 0, 1, -1, 1},
+            {0, -1, 1, -1, 1, 1, 0, -1, 1, 1, 0, 1},
+        };
+        mPositions.assign(&halfQuads[0][0], &halfQuads[0][0] + 24);
+
+        glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, mPositions.data());
+        glEnableVertexAttribArray(mPositionLocation);
+
+        glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+
+    void TearDown() override
+    {
+        glDeleteProgram(mProgram);
+        ANGLETest::TearDown();
+    }
+
+    void checkBothHalvesDrawn()
+    {
+        EXPECT_PIXEL_EQ(getWindowWidth() / 4, getWindowHeight() / 2, 0, 255, 0, 255);
+        EXPECT_PIXEL_EQ(getWindowWidth() * 3 / 4, getWindowHeight() / 2, 0, 255, 0, 255);
+    }
+
+    GLuint mProgram;
+    GLint mPositionLocation;
+    std::vector<GLfloat> mPositions;
+
+    PFNGLMULTIDRAWARRAYSANGLEPROC mMultiDrawArraysANGLE;
+    PFNGLMULTIDRAWELEMENTSANGLEPROC mMultiDrawElementsANGLE;
+};
+
+// Test drawing both halves with one MultiDrawArrays, with an empty draw in between.
+TEST_P(MultiDrawTest, MultiDrawArrays)
+{
+    const GLint firsts[]   = {0, 3, 6};
+    const GLsizei counts[] = {6, 0, 6};
+    mMultiDrawArraysANGLE(GL_TRIANGLES, firsts, counts, 3);
+    ASSERT_GL_NO_ERROR();
+
+    checkBothHalvesDrawn();
+}
+
+// Test drawing both halves with one MultiDrawElements reading from an index buffer.
+TEST_P(MultiDrawTest, MultiDrawElementsBuffer)
+{
+    const GLushort indices[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+    GLuint indexBuffer = 0;
+    glGenBuffers(1, &indexBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+    const GLsizei counts[]        = {6, 6};
+    const GLvoid *const offsets[] = {reinterpret_cast<const GLvoid *>(0),
+                                     reinterpret_cast<const GLvoid *>(6 * sizeof(GLushort))};
+    mMultiDrawElementsANGLE(GL_TRIANGLES, counts, GL_UNSIGNED_SHORT, offsets, 2);
+    ASSERT_GL_NO_ERROR();
+
+    checkBothHalvesDrawn();
+
+    glDeleteBuffers(1, &indexBuffer);
+}
+
+// Test drawing both halves with one MultiDrawElements reading client side indices.
+TEST_P(MultiDrawTest, MultiDrawElementsClientIndices)
+{
+    const GLushort leftIndices[]  = {0, 1, 2, 3, 4, 5};
+    const GLushort rightIndices[] = {6, 7, 8, 9, 10, 11};
+
+    const GLsizei counts[]        = {6, 6};
+    const GLvoid *const indices[] = {leftIndices, rightIndices};
+    mMultiDrawElementsANGLE(GL_TRIANGLES, counts, GL_UNSIGNED_SHORT, indices, 2);
+    ASSERT_GL_NO_ERROR();
+
+    checkBothHalvesDrawn();
+}
+
+// Test that an invalid range fails the whole call, and that nothing is drawn.
+TEST_P(MultiDrawTest, InvalidRangeDrawsNothing)
+{
+    const GLint firsts[]   = {0, -1};
+    const GLsizei counts[] = {6, 6};
+    mMultiDrawArraysANGLE(GL_TRIANGLES, firsts, counts, 2);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    mMultiDrawArraysANGLE(GL_TRIANGLES, firsts, counts, -1);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    EXPECT_PIXEL_EQ(getWindowWidth() / 4, getWindowHeight() / 2, 255, 0, 0, 255);
+}
+
+ANGLE_INSTANTIATE_TEST(MultiDrawTest,
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES2_OPENGL(),
+                       ES2_OPENGLES(),
+                       ES3_OPENGL());
+
+}  // anonymous namespace
@@ -0,0 +1,251 @@
+//
+// Copyright 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferTest.cpp: Tests drawing with client vertex and index data, streaming more data
+// than the streaming buffers of the GL back-end hold over several draws without reading back in
+// between, so that the buffers wrap around onto regions earlier draws may still be reading.
+
+#include "test_utils/ANGLETest.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace angle;
+
+namespace
+{
+
+// Each draw covers one cell of a grid over the window, in its own color.
+const int kGridSize  = 8;
+const int kCellSize  = 16;
+const int kCellCount = kGridSize * kGridSize;
+
+// The GL back-end streams vertices through a 4 MB buffer and indices through a 1 MB one.
+const size_t kVertexBufferSize = 4 * 1024 * 1024;
+const size_t kIndexBufferSize  = 1024 * 1024;
+
+GLColor CellColor(int cell)
+{
+    return MakeGLColor(cell * 4, 255 - cell * 4, (cell * 37) % 256, 255);
+}
+
+class StreamingBufferTest : public ANGLETest
+{
+  protected:
+    StreamingBufferTest() : mProgram(0), mPositionLocation(-1), mColorLocation(-1)
+    {
+        setWindowWidth(kGridSize * kCellSize);
+        setWindowHeight(kGridSize * kCellSize);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void SetUp() override
+    {
+        ANGLETest::SetUp();
+
+        const std::string vertexShaderSource =
+            SHADER_SOURCE(precision highp float; attribute vec2 position; attribute vec4 color;
+                          varying vec4 vColor;
+
+                          void main()
+                          {
+                              gl_Position = vec4(position, 0.0, 1.0);
+                              vColor      = color;
+                          });
+
+        const std::string fragmentShaderSource =
+            SHADER_SOURCE(precision highp float; varying vec4 vColor;
+
+                          void main()
+                          {
+                              gl_FragColor = vColor;
+                          });
+
+        mProgram = CompileProgram(vertexShaderSource, fragmentShaderSource);
+        ASSERT_NE(0u, mProgram);
+
+        mPositionLocation = glGetAttribLocation(mProgram, "position");
+        mColorLocation    = glGetAttribLocation(mProgram, "color");
+        ASSERT_NE(-1, mPositionLocation);
+        ASSERT_NE(-1, mColorLocation);
+
+        glUseProgram(mProgram);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+
+    void TearDown() override
+    {
+        glDeleteProgram(mProgram);
+        ANGLETest::TearDown();
+    }
+
+    // Makes the vertices vertexCount long, with vertices [first, first + 6) drawing a quad over
+    // the viewport in the given color. The other vertices are all at the same position, and only
+    // make degenerate triangles.
+    void setVertices(size_t vertexCount, size_t first, const GLColor &color)
+    {
+        mPositions.assign(vertexCount * 2, 0.0f);
+        mColors.assign(vertexCount, color);
+
+        const GLfloat quad[] = {-1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f,
+                                -1.0f, -1.0f, 1.0f, 1.0f,  -1.0f, 1.0f};
+        std::copy(quad, quad + ArraySize(quad), mPositions.begin() + first * 2);
+
+        glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, mPositions.data());
+        glVertexAttribPointer(mColorLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(GLColor),
+                              mColors.data());
+        glEnableVertexAttribArray(mPositionLocation);
+        glEnableVertexAttribArray(mColorLocation);
+    }
+
+    void setCell(int cell)
+    {
+        glViewport((cell % kGridSize) * kCellSize, (cell / kGridSize) * kCellSize, kCellSize,
+                   kCellSize);
+    }
+
+    void expectCells(int cellCount)
+    {
+        for (int cell = 0; cell < cellCount; cell++)
+        {
+            EXPECT_PIXEL_COLOR_EQ((cell % kGridSize) * kCellSize + kCellSize / 2,
+                                  (cell / kGridSize) * kCellSize + kCellSize / 2,
+                                  CellColor(cell))
+                << "cell " << cell;
+        }
+    }
+
+    GLuint mProgram;
+    GLint mPositionLocation;
+    GLint mColorLocation;
+
+    std::vector<GLfloat> mPositions;
+    std::vector<GLColor> mColors;
+};
+
+// Test draws that each stream a fifth of the vertex buffer, so that the buffer wraps around
+// several times and waits for the draws still reading the regions it wraps onto.
+TEST_P(StreamingBufferTest, DrawArraysWrapsAround)
+{
+    const size_t vertexCount =
+        kVertexBufferSize / 5 / (2 * sizeof(GLfloat) + sizeof(GLColor)) / 3 * 3;
+
+    for (int cell = 0; cell < kCellCount; cell++)
+    {
+        setCell(cell);
+        setVertices(vertexCount, 0, CellColor(cell));
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount));
+    }
+
+    EXPECT_GL_NO_ERROR();
+    expectCells(kCellCount);
+}
+
+// Test draws with a first vertex, for which the attributes point before the streamed data, mixing
+// small ones with ones that point further than the vertex buffer is long and make it grow.
+TEST_P(StreamingBufferTest, DrawArraysWithFirst)
+{
+    const size_t kFirstStep = 100000;
+    const size_t maxFirst   = (kGridSize - 1) * kFirstStep;
+    ASSERT_GT(maxFirst * 2 * sizeof(GLfloat), kVertexBufferSize);
+
+    for (int cell = 0; cell < kCellCount; cell++)
+    {
+        const size_t first = (cell % kGridSize) * kFirstStep + cell;
+        setCell(cell);
+        setVertices(first + 6, first, CellColor(cell));
+        glDrawArrays(GL_TRIANGLES, static_cast<GLint>(first), 6);
+    }
+
+    EXPECT_GL_NO_ERROR();
+    expectCells(kCellCount);
+}
+
+// Test a draw that streams more than the vertex buffer holds, in between draws that stream little.
+TEST_P(StreamingBufferTest, DrawArraysLargerThanBuffer)
+{
+    const size_t largeVertexCount =
+        (kVertexBufferSize * 3 / 2) / (2 * sizeof(GLfloat) + sizeof(GLColor)) / 3 * 3;
+
+    for (int cell = 0; cell < kCellCount; cell++)
+    {
+        const size_t vertexCount = (cell % 16 == 5) ? largeVertexCount : 6;
+        setCell(cell);
+        setVertices(vertexCount, 0, CellColor(cell));
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount));
+    }
+
+    EXPECT_GL_NO_ERROR();
+    expectCells(kCellCount);
+}
+
+// Test draws that each stream a third of the index buffer, so that it wraps around several times,
+// along with the vertices they use.
+TEST_P(StreamingBufferTest, DrawElementsWrapsAround)
+{
+    const size_t indexCount = kIndexBufferSize / 3 / sizeof(GLushort) / 3 * 3;
+
+    // The quad is drawn by the first indices, the others all use the degenerate vertex 6.
+    std::vector<GLushort> indices(indexCount, 6);
+    for (GLushort index = 0; index < 6; index++)
+    {
+        indices[index] = index;
+    }
+
+    for (int cell = 0; cell < kCellCount; cell++)
+    {
+        setCell(cell);
+        setVertices(7, 0, CellColor(cell));
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_SHORT,
+                       indices.data());
+    }
+
+    EXPECT_GL_NO_ERROR();
+    expectCells(kCellCount);
+}
+
+// Test draws of client indices whose smallest index is large, for which the attributes point
+// before the streamed vertices.
+TEST_P(StreamingBufferTest, DrawElementsWithIndexRangeStart)
+{
+    const size_t kStartStep = 9000;
+
+    for (int cell = 0; cell < kCellCount; cell++)
+    {
+        const size_t start = (cell % kGridSize) * kStartStep + cell;
+        std::vector<GLushort> indices;
+        for (size_t index = start; index < start + 6; index++)
+        {
+            indices.push_back(static_cast<GLushort>(index));
+        }
+
+        setCell(cell);
+        setVertices(start + 6, start, CellColor(cell));
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, indices.data());
+    }
+
+    EXPECT_GL_NO_ERROR();
+    expectCells(kCellCount);
+}
+
+}  // anonymous namespace
+
+// The desktop GL back-end only maps the streaming buffers from GL 3.0 and fences them from GL 3.2,
+// so the 2.1 context uploads with glBufferSubData and a 3.1 context without GL_ARB_sync orphans
+// the buffers when they wrap around.
+ANGLE_INSTANTIATE_TEST(StreamingBufferTest,
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES2_OPENGL(),
+                       ES3_OPENGL(),
+                       ES2_OPENGL(3, 1),
+                       ES2_OPENGL(2, 1),
+                       ES2_OPENGLES(),
+                       ES3_OPENGLES());
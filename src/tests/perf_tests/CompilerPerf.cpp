@@ -0,0 +1,386 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompilerPerf:
+//   Performance tests for the shader translator, using a large generated shader that calls many
+//   built-in functions, and constant folding of large constant matrices.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "angle_gl.h"
+#include "GLSLANG/ShaderLang.h"
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/PoolAlloc.h"
+#include "compiler/translator/TranslatorESSL.h"
+
+namespace
+{
+
+// Built-ins called by the generated shader, with their mangled names for a vec4 argument.
+const char *kBuiltInCalls[][2] = {
+    {"sin", "sin(vf4;"},
+    {"cos", "cos(vf4;"},
+    {"abs", "abs(vf4;"},
+    {"fract", "fract(vf4;"},
+    {"normalize", "normalize(vf4;"},
+    {"sqrt", "sqrt(vf4;"},
+    {"exp2", "exp2(vf4;"},
+    {"floor", "floor(vf4;"},
+};
+
+// Generates a fragment shader made of numFunctions functions that each call every built-in in
+// kBuiltInCalls several times.
+std::string GenerateLargeShader(size_t numFunctions)
+{
+    std::stringstream shader;
+    shader << "#version 300 es\n"
+              "precision highp float;\n"
+              "uniform vec4 u_input;\n"
+              "out vec4 color;\n";
+
+    for (size_t function = 0; function < numFunctions; ++function)
+    {
+        shader << "vec4 f" << function << "(vec4 v) {\n"
+               << "    vec4 result = v;\n";
+        for (size_t repeat = 0; repeat < 4; ++repeat)
+        {
+            for (const auto &builtIn : kBuiltInCalls)
+            {
+                shader << "    result = " << builtIn[0] << "(result) + v;\n";
+            }
+        }
+        shader << "    return result;\n"
+               << "}\n";
+    }
+
+    shader << "void main() {\n"
+           << "    vec4 result = u_input;\n";
+    for (size_t function = 0; function < numFunctions; ++function)
+    {
+        shader << "    result = f" << function << "(result);\n";
+    }
+    shader << "    color = result;\n"
+           << "}\n";
+
+    return shader.str();
+}
+
+class CompilerPerfTest : public ANGLEPerfTest
+{
+  public:
+    CompilerPerfTest(const std::string &name);
+
+    void SetUp() override;
+    void TearDown() override;
+
+  protected:
+    TranslatorESSL *mTranslator;
+};
+
+CompilerPerfTest::CompilerPerfTest(const std::string &name)
+    : ANGLEPerfTest(name, "_essl3"), mTranslator(nullptr)
+{
+}
+
+void CompilerPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    ASSERT_TRUE(ShInitialize());
+
+    ShBuiltInResources resources;
+    ShInitBuiltInResources(&resources);
+
+    mTranslator = new TranslatorESSL(GL_FRAGMENT_SHADER, SH_GLES3_SPEC);
+    ASSERT_TRUE(mTranslator->Init(resources));
+}
+
+void CompilerPerfTest::TearDown()
+{
+    SafeDelete(mTranslator);
+    ShFinalize();
+
+    ANGLEPerfTest::TearDown();
+}
+
+// Measures the lookups the parser makes for the identifiers of the large shader. The built-in
+// calls are found in the built-in levels, while the user-defined names miss in every level.
+class SymbolLookupPerfTest : public CompilerPerfTest
+{
+  public:
+    SymbolLookupPerfTest() : CompilerPerfTest("SymbolLookup") {}
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    std::vector<TString> mNames;
+};
+
+void SymbolLookupPerfTest::SetUp()
+{
+    CompilerPerfTest::SetUp();
+
+    for (size_t function = 0; function < 256; ++function)
+    {
+        for (const auto &builtIn : kBuiltInCalls)
+        {
+            mNames.push_back(builtIn[1]);
+        }
+
+        std::stringstream userFunction;
+        userFunction << "f" << function << "(vf4;";
+        mNames.push_back(userFunction.str().c_str());
+        mNames.push_back("result");
+        mNames.push_back("v");
+    }
+
+    for (const auto &builtIn : kBuiltInCalls)
+    {
+        ASSERT_NE(nullptr, mTranslator->getSymbolTable().findBuiltIn(builtIn[1], 300))
+            << builtIn[1];
+    }
+}
+
+void SymbolLookupPerfTest::TearDown()
+{
+    // The names are allocated from the pool of the translator.
+    mNames.clear();
+
+    CompilerPerfTest::TearDown();
+}
+
+void SymbolLookupPerfTest::step()
+{
+    const TSymbolTable &symbolTable = mTranslator->getSymbolTable();
+
+    size_t numFound = 0;
+    for (unsigned int iteration = 0; iteration < 100; ++iteration)
+    {
+        for (const TString &name : mNames)
+        {
+            if (symbolTable.find(name, 300) != nullptr)
+            {
+                ++numFound;
+            }
+        }
+    }
+
+    // Keep the lookups from being optimized out.
+    if (numFound == 0)
+    {
+        abortTest();
+    }
+}
+
+// Measures a full compile of the large shader, of which symbol lookup is a part.
+class CompileLargeShaderPerfTest : public CompilerPerfTest
+{
+  public:
+    CompileLargeShaderPerfTest() : CompilerPerfTest("CompileLargeShader") {}
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    std::string mSource;
+};
+
+void CompileLargeShaderPerfTest::SetUp()
+{
+    CompilerPerfTest::SetUp();
+    mSource = GenerateLargeShader(256);
+}
+
+void CompileLargeShaderPerfTest::step()
+{
+    const char *shaderStrings[] = {mSource.c_str()};
+    if (!mTranslator->compile(shaderStrings, 1, SH_OBJECT_CODE))
+    {
+        ADD_FAILURE() << mTranslator->getInfoSink().info.c_str();
+        abortTest();
+    }
+}
+
+// Measures compiles of a corpus of shaders of different sizes, each by a new compiler as when
+// compiling the shaders of an application, and reports how many pool pages the compiles take
+// from the OS rather than reuse.
+class CompileCorpusPerfTest : public CompilerPerfTest
+{
+  public:
+    CompileCorpusPerfTest() : CompilerPerfTest("CompileCorpus") {}
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    ShBuiltInResources mResources;
+    std::vector<std::string> mSources;
+    size_t mNumPagesAllocated;
+    size_t mNumPagesReused;
+};
+
+void CompileCorpusPerfTest::SetUp()
+{
+    CompilerPerfTest::SetUp();
+
+    ShInitBuiltInResources(&mResources);
+    for (size_t numFunctions : {1u, 4u, 16u, 64u, 256u})
+    {
+        mSources.push_back(GenerateLargeShader(numFunctions));
+    }
+    mNumPagesAllocated = 0;
+    mNumPagesReused    = 0;
+}
+
+void CompileCorpusPerfTest::TearDown()
+{
+    printResult("pool_pages_allocated", normalizedTime(mNumPagesAllocated), "pages", false);
+    printResult("pool_pages_reused", normalizedTime(mNumPagesReused), "pages", false);
+
+    CompilerPerfTest::TearDown();
+}
+
+void CompileCorpusPerfTest::step()
+{
+    for (const std::string &source : mSources)
+    {
+        TranslatorESSL translator(GL_FRAGMENT_SHADER, SH_GLES3_SPEC);
+        if (!translator.Init(mResources))
+        {
+            ADD_FAILURE() << "Compiler could not be initialized.";
+            abortTest();
+            return;
+        }
+
+        const char *shaderStrings[] = {source.c_str()};
+        if (!translator.compile(shaderStrings, 1, SH_OBJECT_CODE))
+        {
+            ADD_FAILURE() << translator.getInfoSink().info.c_str();
+            abortTest();
+            return;
+        }
+
+        const ShCompileStatistics &statistics = translator.getStatistics();
+        mNumPagesAllocated += statistics.poolPagesAllocated;
+        mNumPagesReused += statistics.poolPagesReused;
+    }
+}
+
+// Measures the constant folding of large constant matrices: component-wise operations on arrays
+// of matrices as in skinning palettes, scaling and negating them, and products of matrices.
+class ConstantFoldingPerfTest : public CompilerPerfTest
+{
+  public:
+    ConstantFoldingPerfTest() : CompilerPerfTest("ConstantFolding") {}
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    TIntermConstantUnion *createConstant(const TType &type, float seed);
+
+    TPoolAllocator mAllocator;
+    TInfoSink mInfoSink;
+    TIntermConstantUnion *mMatrixArrayA;
+    TIntermConstantUnion *mMatrixArrayB;
+    TIntermConstantUnion *mMatrix;
+    TIntermConstantUnion *mScalar;
+};
+
+void ConstantFoldingPerfTest::SetUp()
+{
+    CompilerPerfTest::SetUp();
+
+    mAllocator.push();
+    SetGlobalPoolAllocator(&mAllocator);
+
+    TType matrixArrayType(EbtFloat, EbpHigh, EvqConst, 4, 4);
+    matrixArrayType.setArraySize(256);
+    mMatrixArrayA = createConstant(matrixArrayType, 1.0f);
+    mMatrixArrayB = createConstant(matrixArrayType, 2.0f);
+    mMatrix       = createConstant(TType(EbtFloat, EbpHigh, EvqConst, 4, 4), 0.5f);
+    mScalar       = createConstant(TType(EbtFloat, EbpHigh, EvqConst), 3.0f);
+}
+
+void ConstantFoldingPerfTest::TearDown()
+{
+    SetGlobalPoolAllocator(nullptr);
+    mAllocator.pop();
+
+    CompilerPerfTest::TearDown();
+}
+
+TIntermConstantUnion *ConstantFoldingPerfTest::createConstant(const TType &type, float seed)
+{
+    size_t size = type.getObjectSize();
+    TConstantUnion *values = new TConstantUnion[size];
+    for (size_t i = 0; i < size; ++i)
+    {
+        values[i].setFConst(seed + static_cast<float>(i % 17) * 0.25f);
+    }
+    return new TIntermConstantUnion(values, type);
+}
+
+void ConstantFoldingPerfTest::step()
+{
+    // The folded values are freed after each step.
+    mAllocator.push();
+
+    size_t numFolded = 0;
+    for (unsigned int iteration = 0; iteration < 10; ++iteration)
+    {
+        for (TOperator op : {EOpAdd, EOpSub, EOpMul})
+        {
+            numFolded +=
+                mMatrixArrayA->foldBinary(op, mMatrixArrayB, mInfoSink, nullptr) != nullptr;
+        }
+        numFolded +=
+            mMatrixArrayA->foldBinary(EOpMatrixTimesScalar, mScalar, mInfoSink, nullptr) != nullptr;
+        numFolded += mMatrixArrayA->foldUnaryWithSameReturnType(EOpNegative, mInfoSink,
+                                                                nullptr) != nullptr;
+
+        for (unsigned int product = 0; product < 256; ++product)
+        {
+            numFolded +=
+                mMatrix->foldBinary(EOpMatrixTimesMatrix, mMatrix, mInfoSink, nullptr) != nullptr;
+        }
+    }
+
+    mAllocator.pop();
+
+    if (numFolded != 10 * (5 + 256))
+    {
+        abortTest();
+    }
+}
+
+TEST_F(SymbolLookupPerfTest, Run)
+{
+    run();
+}
+
+TEST_F(CompileLargeShaderPerfTest, Run)
+{
+    run();
+}
+
+TEST_F(CompileCorpusPerfTest, Run)
+{
+    run();
+}
+
+TEST_F(ConstantFoldingPerfTest, Run)
+{
+    run();
+}
+
+}  // anonymous namespace
@@ -0,0 +1,212 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ETCDecodePerf:
+//   Performance tests for decoding ETC2 and EAC textures on the CPU, a pixel at a time, a block at
+//   a time and over several threads.
+//
+
+#include <random>
+#include <sstream>
+
+#include "ANGLEPerfTest.h"
+#include "libANGLE/WorkerThread.h"
+#include "libANGLE/renderer/d3d/loadimage.h"
+#include "libANGLE/renderer/d3d/loadimage_etc.h"
+
+using namespace rx;
+
+namespace
+{
+
+enum ETCDecodeMode
+{
+    // Every block with the per-pixel decoding.
+    ETC_DECODE_PER_PIXEL,
+    // The whole blocks a block at a time.
+    ETC_DECODE_BLOCKS,
+    // The whole blocks a block at a time, with LoadCompressedImageInParallel.
+    ETC_DECODE_PARALLEL,
+};
+
+enum ETCDecodeFormat
+{
+    ETC_DECODE_FORMAT_RGB8,
+    ETC_DECODE_FORMAT_RGBA8,
+    ETC_DECODE_FORMAT_R11,
+    ETC_DECODE_FORMAT_RG11,
+};
+
+struct ETCDecodePerfParams
+{
+    ETCDecodeMode mode;
+    ETCDecodeFormat format;
+    size_t size;
+};
+
+std::string ETCDecodePerfSuffix(const ETCDecodePerfParams &param)
+{
+    const char *modeNames[]   = {"per_pixel", "blocks", "parallel"};
+    const char *formatNames[] = {"rgb8", "rgba8", "r11", "rg11"};
+
+    std::stringstream strstr;
+    strstr << "_" << modeNames[param.mode] << "_" << formatNames[param.format] << "_"
+           << param.size;
+    return strstr.str();
+}
+
+void LoadETC2RGB8ToRGBA8PerPixel(size_t width, size_t height, size_t depth,
+                                 const uint8_t *input, size_t inputRowPitch,
+                                 size_t inputDepthPitch, uint8_t *output, size_t outputRowPitch,
+                                 size_t outputDepthPitch)
+{
+    priv::LoadETC2RGB8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                              outputRowPitch, outputDepthPitch, false, true,
+                              priv::GetSupportedETCKernelSet());
+}
+
+void LoadETC2RGBA8ToRGBA8PerPixel(size_t width, size_t height, size_t depth,
+                                  const uint8_t *input, size_t inputRowPitch,
+                                  size_t inputDepthPitch, uint8_t *output, size_t outputRowPitch,
+                                  size_t outputDepthPitch)
+{
+    priv::LoadETC2RGBA8ToRGBA8(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                               output, outputRowPitch, outputDepthPitch, false, true,
+                               priv::GetSupportedETCKernelSet());
+}
+
+void LoadEACR11ToR8PerPixel(size_t width, size_t height, size_t depth, const uint8_t *input,
+                            size_t inputRowPitch, size_t inputDepthPitch, uint8_t *output,
+                            size_t outputRowPitch, size_t outputDepthPitch)
+{
+    priv::LoadR11EACToR8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                         outputRowPitch, outputDepthPitch, false, true);
+}
+
+void LoadEACRG11ToRG8PerPixel(size_t width, size_t height, size_t depth, const uint8_t *input,
+                              size_t inputRowPitch, size_t inputDepthPitch, uint8_t *output,
+                              size_t outputRowPitch, size_t outputDepthPitch)
+{
+    priv::LoadRG11EACToRG8(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                           outputRowPitch, outputDepthPitch, false, true);
+}
+
+// Measures decoding a square 2D texture, and reports the texels decoded per second. The textures
+// are made of blocks with fixed pseudo-random contents, which like encoded images are mostly
+// individual and differential blocks, with some T, H and planar ones.
+class ETCDecodePerfTest : public ANGLEPerfTest,
+                          public ::testing::WithParamInterface<ETCDecodePerfParams>
+{
+  public:
+    ETCDecodePerfTest()
+        : ANGLEPerfTest("ETCDecodePerfTest", ETCDecodePerfSuffix(GetParam())),
+          mFunction(nullptr),
+          mInputRowPitch(0),
+          mOutputRowPitch(0),
+          mPool(angle::WorkerThreadPool::GetDefaultThreadCount())
+    {
+    }
+
+    void SetUp() override
+    {
+        ANGLEPerfTest::SetUp();
+
+        const auto &params = GetParam();
+        bool perPixel      = (params.mode == ETC_DECODE_PER_PIXEL);
+        size_t blockBytes  = 0;
+        size_t pixelBytes  = 0;
+        switch (params.format)
+        {
+            case ETC_DECODE_FORMAT_RGB8:
+                mFunction  = perPixel ? LoadETC2RGB8ToRGBA8PerPixel : LoadETC2RGB8ToRGBA8;
+                blockBytes = 8;
+                pixelBytes = 4;
+                break;
+            case ETC_DECODE_FORMAT_RGBA8:
+                mFunction  = perPixel ? LoadETC2RGBA8ToRGBA8PerPixel : LoadETC2RGBA8ToRGBA8;
+                blockBytes = 16;
+                pixelBytes = 4;
+                break;
+            case ETC_DECODE_FORMAT_R11:
+                mFunction  = perPixel ? LoadEACR11ToR8PerPixel : LoadEACR11ToR8;
+                blockBytes = 8;
+                pixelBytes = 1;
+                break;
+            case ETC_DECODE_FORMAT_RG11:
+                mFunction  = perPixel ? LoadEACRG11ToRG8PerPixel : LoadEACRG11ToRG8;
+                blockBytes = 16;
+                pixelBytes = 2;
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+
+        mInputRowPitch  = (params.size / 4) * blockBytes;
+        mOutputRowPitch = params.size * pixelBytes;
+        mInput.resize(mInputRowPitch * (params.size / 4));
+        mOutput.resize(mOutputRowPitch * params.size);
+
+        std::mt19937 random(static_cast<unsigned int>(params.format) + 1);
+        for (uint8_t &byte : mInput)
+        {
+            byte = static_cast<uint8_t>(random());
+        }
+    }
+
+    void TearDown() override
+    {
+        size_t size      = GetParam().size;
+        double megapixels = static_cast<double>(size * size) * getNumStepsPerformed() / 1e6;
+        printResult("megapixels_per_second", megapixels / mTimer->getElapsedTime(), "MP/s",
+                    true);
+        ANGLEPerfTest::TearDown();
+    }
+
+    void step() override
+    {
+        const auto &params = GetParam();
+        LoadCompressedImageInParallel(params.mode == ETC_DECODE_PARALLEL ? &mPool : nullptr,
+                                      mFunction, 4, 1, params.size, params.size, 1, mInput.data(),
+                                      mInputRowPitch, mInput.size(), mOutput.data(),
+                                      mOutputRowPitch, mOutput.size());
+    }
+
+  private:
+    LoadImageFunction mFunction;
+    size_t mInputRowPitch;
+    size_t mOutputRowPitch;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+    angle::WorkerThreadPool mPool;
+};
+
+std::vector<ETCDecodePerfParams> ETCDecodePerfParamsList()
+{
+    std::vector<ETCDecodePerfParams> paramsList;
+    for (int mode = ETC_DECODE_PER_PIXEL; mode <= ETC_DECODE_PARALLEL; ++mode)
+    {
+        for (int format = ETC_DECODE_FORMAT_RGB8; format <= ETC_DECODE_FORMAT_RG11; ++format)
+        {
+            ETCDecodePerfParams params;
+            params.mode   = static_cast<ETCDecodeMode>(mode);
+            params.format = static_cast<ETCDecodeFormat>(format);
+            params.size   = 2048;
+            paramsList.push_back(params);
+        }
+    }
+    return paramsList;
+}
+
+TEST_P(ETCDecodePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(ETCDecode,
+                        ETCDecodePerfTest,
+                        ::testing::ValuesIn(ETCDecodePerfParamsList()));
+
+}  // anonymous namespace
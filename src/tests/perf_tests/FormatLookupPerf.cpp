@@ -0,0 +1,123 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FormatLookupPerf:
+//   Performance tests for the format tables queried by the TexImage, ReadPixels and validation
+//   entry points, over the whole 16-bit enum space.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "libANGLE/Caps.h"
+#include "libANGLE/formatutils.h"
+
+namespace
+{
+
+// Every enum below 0x10000, which holds all the format and type enums, valid or not.
+const GLenum kNumEnums = 0x10000;
+
+// The format and type pairs of the TexImage calls. Invalid types are looked up with all formats
+// by GetSizedInternalFormat.
+const GLenum kUnsizedFormats[] = {
+    GL_RGBA, GL_RGB, GL_RG, GL_RED, GL_RGBA_INTEGER, GL_LUMINANCE_ALPHA, GL_ALPHA,
+    GL_DEPTH_COMPONENT, GL_DEPTH_STENCIL, GL_BGRA_EXT,
+};
+
+class FormatLookupPerfTest : public ANGLEPerfTest
+{
+  public:
+    FormatLookupPerfTest(const std::string &name) : ANGLEPerfTest(name, ""), mNumFound(0) {}
+
+    void TearDown() override
+    {
+        // Keep the lookups from being optimized out.
+        EXPECT_NE(0u, mNumFound);
+        ANGLEPerfTest::TearDown();
+    }
+
+  protected:
+    size_t mNumFound;
+};
+
+// Measures GetInternalFormatInfo over all the enums.
+class InternalFormatInfoPerfTest : public FormatLookupPerfTest
+{
+  public:
+    InternalFormatInfoPerfTest() : FormatLookupPerfTest("InternalFormatInfo") {}
+
+    void step() override
+    {
+        for (GLenum value = 0; value < kNumEnums; ++value)
+        {
+            mNumFound += gl::GetInternalFormatInfo(value).pixelBytes;
+        }
+    }
+};
+
+// Measures GetSizedInternalFormat with the unsized formats and all the enums as types.
+class SizedInternalFormatPerfTest : public FormatLookupPerfTest
+{
+  public:
+    SizedInternalFormatPerfTest() : FormatLookupPerfTest("SizedInternalFormat") {}
+
+    void step() override
+    {
+        for (GLenum format : kUnsizedFormats)
+        {
+            for (GLenum type = 0; type < kNumEnums; type += 4)
+            {
+                mNumFound += gl::GetSizedInternalFormat(format, type);
+            }
+        }
+    }
+};
+
+// Measures TextureCapsMap::get over all the enums, with caps for all the sized formats.
+class TextureCapsPerfTest : public FormatLookupPerfTest
+{
+  public:
+    TextureCapsPerfTest() : FormatLookupPerfTest("TextureCaps") {}
+
+    void SetUp() override
+    {
+        FormatLookupPerfTest::SetUp();
+
+        gl::TextureCaps caps;
+        caps.texturable = true;
+        for (GLenum format : gl::GetAllSizedInternalFormats())
+        {
+            mTextureCaps.insert(format, caps);
+        }
+    }
+
+    void step() override
+    {
+        for (GLenum value = 0; value < kNumEnums; ++value)
+        {
+            mNumFound += mTextureCaps.get(value).texturable ? 1 : 0;
+        }
+    }
+
+  private:
+    gl::TextureCapsMap mTextureCaps;
+};
+
+TEST_F(InternalFormatInfoPerfTest, Run)
+{
+    run();
+}
+
+TEST_F(SizedInternalFormatPerfTest, Run)
+{
+    run();
+}
+
+TEST_F(TextureCapsPerfTest, Run)
+{
+    run();
+}
+
+}  // anonymous namespace
@@ -0,0 +1,230 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GenerateMipPerf:
+//   Performance tests for generating the mip chains of D3D images on the CPU, with the per-pixel
+//   functions, the row kernels, several threads and a band of the chain at a time.
+//
+
+#include <sstream>
+
+#include "ANGLEPerfTest.h"
+#include "libANGLE/WorkerThread.h"
+#include "libANGLE/renderer/d3d/generatemip.h"
+
+using namespace rx;
+
+namespace
+{
+
+enum GenerateMipMode
+{
+    // Each level from the previous one, with the per-pixel functions.
+    GENERATE_MIP_PER_PIXEL,
+    // Each level from the previous one, with GenerateMip.
+    GENERATE_MIP_ROWS,
+    // Each level from the previous one, with GenerateMipInParallel.
+    GENERATE_MIP_PARALLEL,
+    // The whole chain with GenerateMipChain.
+    GENERATE_MIP_CHAIN,
+};
+
+enum GenerateMipFormat
+{
+    GENERATE_MIP_FORMAT_R8G8B8A8,
+    GENERATE_MIP_FORMAT_R16G16B16A16F,
+    GENERATE_MIP_FORMAT_R32G32B32A32F,
+};
+
+struct GenerateMipPerfParams
+{
+    GenerateMipMode mode;
+    GenerateMipFormat format;
+    size_t size;
+};
+
+std::string GenerateMipPerfSuffix(const GenerateMipPerfParams &param)
+{
+    const char *modeNames[]   = {"per_pixel", "rows", "parallel", "chain"};
+    const char *formatNames[] = {"rgba8", "rgba16f", "rgba32f"};
+
+    std::stringstream strstr;
+    strstr << "_" << modeNames[param.mode] << "_" << formatNames[param.format] << "_"
+           << param.size;
+    return strstr.str();
+}
+
+template <typename T>
+void GenerateMipPerPixel(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                         const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                         uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+    priv::MipGenerationFunction function =
+        priv::GetMipGenerationFunction<T>(sourceWidth, sourceHeight, sourceDepth);
+    function(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch, sourceDepthPitch,
+             std::max<size_t>(1, sourceWidth >> 1), std::max<size_t>(1, sourceHeight >> 1),
+             std::max<size_t>(1, sourceDepth >> 1), destData, destRowPitch, destDepthPitch);
+}
+
+template <typename T>
+MipGenerationFunction GetFunction(GenerateMipMode mode)
+{
+    return (mode == GENERATE_MIP_PER_PIXEL) ? GenerateMipPerPixel<T> : GenerateMip<T>;
+}
+
+// Measures generating the whole mip chain of a square 2D image, and reports the source texels
+// averaged per second.
+class GenerateMipPerfTest : public ANGLEPerfTest,
+                            public ::testing::WithParamInterface<GenerateMipPerfParams>
+{
+  public:
+    GenerateMipPerfTest()
+        : ANGLEPerfTest("GenerateMipPerfTest", GenerateMipPerfSuffix(GetParam())),
+          mFunction(nullptr),
+          mPixelBytes(0),
+          mComponentBytes(0),
+          mSourcePixels(0),
+          mPool(angle::WorkerThreadPool::GetDefaultThreadCount())
+    {
+    }
+
+    void SetUp() override
+    {
+        ANGLEPerfTest::SetUp();
+
+        const auto &params = GetParam();
+        switch (params.format)
+        {
+            case GENERATE_MIP_FORMAT_R8G8B8A8:
+                mFunction       = GetFunction<R8G8B8A8>(params.mode);
+                mPixelBytes     = sizeof(R8G8B8A8);
+                mComponentBytes = 1;
+                break;
+            case GENERATE_MIP_FORMAT_R16G16B16A16F:
+                mFunction       = GetFunction<R16G16B16A16F>(params.mode);
+                mPixelBytes     = sizeof(R16G16B16A16F);
+                mComponentBytes = 2;
+                break;
+            case GENERATE_MIP_FORMAT_R32G32B32A32F:
+                mFunction       = GetFunction<R32G32B32A32F>(params.mode);
+                mPixelBytes     = sizeof(R32G32B32A32F);
+                mComponentBytes = 4;
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+
+        size_t totalBytes = 0;
+        for (size_t size = params.size; size > 0; size >>= 1)
+        {
+            MipLevelData level = {nullptr, size, size, 1, size * mPixelBytes,
+                                  size * size * mPixelBytes};
+            mLevels.push_back(level);
+            totalBytes += level.depthPitch;
+        }
+
+        // Fill level 0 with gradients of normalized values, avoiding the slow paths of denormals.
+        mData.resize(totalBytes);
+        for (size_t i = 0; i < mLevels[0].depthPitch / mComponentBytes; i++)
+        {
+            float value = static_cast<float>((i * 7) % 61) / 60.0f;
+            switch (params.format)
+            {
+                case GENERATE_MIP_FORMAT_R8G8B8A8:
+                    mData[i] = static_cast<uint8_t>(value * 255.0f);
+                    break;
+                case GENERATE_MIP_FORMAT_R16G16B16A16F:
+                    reinterpret_cast<uint16_t *>(mData.data())[i] = gl::float32ToFloat16(value);
+                    break;
+                case GENERATE_MIP_FORMAT_R32G32B32A32F:
+                    reinterpret_cast<float *>(mData.data())[i] = value;
+                    break;
+                default:
+                    UNREACHABLE();
+                    break;
+            }
+        }
+
+        uint8_t *data = mData.data();
+        for (MipLevelData &level : mLevels)
+        {
+            level.data = data;
+            data += level.depthPitch;
+        }
+
+        for (size_t level = 0; level + 1 < mLevels.size(); level++)
+        {
+            mSourcePixels += mLevels[level].width * mLevels[level].height;
+        }
+    }
+
+    void TearDown() override
+    {
+        double megapixels = static_cast<double>(mSourcePixels) * getNumStepsPerformed() / 1e6;
+        printResult("megapixels_per_second", megapixels / mTimer->getElapsedTime(), "MP/s",
+                    true);
+        ANGLEPerfTest::TearDown();
+    }
+
+    void step() override
+    {
+        GenerateMipMode mode = GetParam().mode;
+        if (mode == GENERATE_MIP_CHAIN)
+        {
+            GenerateMipChain(&mPool, mFunction, mPixelBytes, mLevels.data(), mLevels.size());
+            return;
+        }
+
+        for (size_t level = 1; level < mLevels.size(); level++)
+        {
+            const MipLevelData &source = mLevels[level - 1];
+            const MipLevelData &dest   = mLevels[level];
+            GenerateMipInParallel(mode == GENERATE_MIP_PARALLEL ? &mPool : nullptr, mFunction,
+                                  source.width, source.height, source.depth, source.data,
+                                  source.rowPitch, source.depthPitch, dest.data, dest.rowPitch,
+                                  dest.depthPitch);
+        }
+    }
+
+  private:
+    MipGenerationFunction mFunction;
+    size_t mPixelBytes;
+    size_t mComponentBytes;
+    size_t mSourcePixels;
+    std::vector<uint8_t> mData;
+    std::vector<MipLevelData> mLevels;
+    angle::WorkerThreadPool mPool;
+};
+
+std::vector<GenerateMipPerfParams> GenerateMipPerfParamsList()
+{
+    std::vector<GenerateMipPerfParams> paramsList;
+    for (int mode = GENERATE_MIP_PER_PIXEL; mode <= GENERATE_MIP_CHAIN; ++mode)
+    {
+        for (int format = GENERATE_MIP_FORMAT_R8G8B8A8;
+             format <= GENERATE_MIP_FORMAT_R32G32B32A32F; ++format)
+        {
+            GenerateMipPerfParams params;
+            params.mode   = static_cast<GenerateMipMode>(mode);
+            params.format = static_cast<GenerateMipFormat>(format);
+            // Keep level 0 of the wider formats at 64MB at most.
+            params.size = (format == GENERATE_MIP_FORMAT_R8G8B8A8) ? 4096 : 2048;
+            paramsList.push_back(params);
+        }
+    }
+    return paramsList;
+}
+
+TEST_P(GenerateMipPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(GenerateMip,
+                        GenerateMipPerfTest,
+                        ::testing::ValuesIn(GenerateMipPerfParamsList()));
+
+}  // anonymous namespace
@@ -4,12 +4,17 @@
 // found in the LICENSE file.
 //
 // IndexConversionPerf:
-//   Performance tests for ANGLE index conversion in D3D11.
+//   Performance tests for ANGLE index conversion in D3D11, and for the index range and
+//   conversion kernels with each instruction set.
 //
 
+#include <iostream>
 #include <sstream>
 
 #include "ANGLEPerfTest.h"
+#include "common/index_utils.h"
+#include "common/utilities.h"
+#include "libANGLE/formatutils.h"
 #include "shader_utils.h"
 
 using namespace angle;
@@ -17,19 +22,41 @@ using namespace angle;
 namespace
 {
 
+const char *GetIndexTypeName(GLenum indexType)
+{
+    switch (indexType)
+    {
+        case GL_UNSIGNED_BYTE:
+            return "ubyte";
+        case GL_UNSIGNED_SHORT:
+            return "ushort";
+        case GL_UNSIGNED_INT:
+            return "uint";
+        default:
+            UNREACHABLE();
+            return "";
+    }
+}
+
 struct IndexConversionPerfParams final : public RenderTestParams
 {
     std::string suffix() const override
     {
         std::stringstream strstr;
 
-        strstr << RenderTestParams::suffix();
+        strstr << RenderTestParams::suffix() << "_" << GetIndexTypeName(indexType);
+        if (primitiveRestart)
+        {
+            strstr << "_restart";
+        }
 
         return strstr.str();
     }
 
     unsigned int iterations;
     unsigned int numIndexTris;
+    GLenum indexType;
+    bool primitiveRestart;
 };
 
 // Provide a custom gtest parameter name function for IndexConversionPerfParams
@@ -38,7 +65,8 @@ struct IndexConversionPerfParams final : public RenderTestParams
 std::ostream &operator<<(std::ostream &stream, const IndexConversionPerfParams &param)
 {
     const PlatformParameters &platform = param;
-    stream << platform << "_" << param.iterations << "_" << param.numIndexTris;
+    stream << platform << "_" << param.iterations << "_" << param.numIndexTris << "_"
+           << GetIndexTypeName(param.indexType) << (param.primitiveRestart ? "_restart" : "");
     return stream;
 }
 
@@ -58,7 +86,7 @@ class IndexConversionPerfTest : public ANGLERenderTest,
     GLuint mProgram;
     GLuint mVertexBuffer;
     GLuint mIndexBuffer;
-    std::vector<GLushort> mIndexData;
+    std::vector<uint8_t> mIndexData;
 };
 
 IndexConversionPerfTest::IndexConversionPerfTest()
@@ -126,12 +154,21 @@ void IndexConversionPerfTest::initializeBenchmark()
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
     glEnableVertexAttribArray(0);
 
-    // Initialize the index buffer
+    // Initialize the index buffer, starting each triangle with the primitive restart index
+    const GLuint triIndices[] = {gl::GetPrimitiveRestartIndex(params.indexType), 1, 2};
+    const size_t indexSize    = gl::GetTypeInfo(params.indexType).bytes;
     for (unsigned int triIndex = 0; triIndex < params.numIndexTris; ++triIndex)
     {
-        mIndexData.push_back(std::numeric_limits<GLushort>::max());
-        mIndexData.push_back(1);
-        mIndexData.push_back(2);
+        for (GLuint index : triIndices)
+        {
+            const uint8_t *indexBytes = reinterpret_cast<const uint8_t *>(&index);
+            mIndexData.insert(mIndexData.end(), indexBytes, indexBytes + indexSize);
+        }
+    }
+
+    if (params.primitiveRestart)
+    {
+        glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
     }
 
     glGenBuffers(1, &mIndexBuffer);
@@ -152,7 +189,7 @@ void IndexConversionPerfTest::initializeBenchmark()
 
 void IndexConversionPerfTest::updateBufferData()
 {
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndexData.size() * sizeof(mIndexData[0]), &mIndexData[0], GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndexData.size(), &mIndexData[0], GL_STATIC_DRAW);
 }
 
 void IndexConversionPerfTest::destroyBenchmark()
@@ -175,23 +212,25 @@ void IndexConversionPerfTest::drawBenchmark()
     {
         glDrawElements(GL_TRIANGLES,
                        static_cast<GLsizei>(params.numIndexTris * 3 - 1),
-                       GL_UNSIGNED_SHORT,
+                       params.indexType,
                        reinterpret_cast<GLvoid*>(0));
     }
 
     ASSERT_GL_NO_ERROR();
 }
 
-IndexConversionPerfParams IndexConversionPerfD3D11Params()
+IndexConversionPerfParams IndexConversionPerfD3D11Params(GLenum indexType, bool primitiveRestart)
 {
     IndexConversionPerfParams params;
     params.eglParameters = egl_platform::D3D11_NULL();
-    params.majorVersion = 2;
+    params.majorVersion     = primitiveRestart ? 3 : 2;
     params.minorVersion = 0;
     params.windowWidth = 256;
     params.windowHeight = 256;
     params.iterations    = 225;
     params.numIndexTris = 3000;
+    params.indexType        = indexType;
+    params.primitiveRestart = primitiveRestart;
     return params;
 }
 
@@ -201,6 +240,138 @@ TEST_P(IndexConversionPerfTest, Run)
 }
 
 ANGLE_INSTANTIATE_TEST(IndexConversionPerfTest,
-                       IndexConversionPerfD3D11Params());
+                       IndexConversionPerfD3D11Params(GL_UNSIGNED_BYTE, false),
+                       IndexConversionPerfD3D11Params(GL_UNSIGNED_BYTE, true),
+                       IndexConversionPerfD3D11Params(GL_UNSIGNED_SHORT, false),
+                       IndexConversionPerfD3D11Params(GL_UNSIGNED_SHORT, true),
+                       IndexConversionPerfD3D11Params(GL_UNSIGNED_INT, false),
+                       IndexConversionPerfD3D11Params(GL_UNSIGNED_INT, true));
+
+struct IndexKernelPerfParams
+{
+    gl::IndexKernelSet kernels;
+    GLenum indexType;
+    bool primitiveRestart;
+    // Whether to convert the indices to the next wider type, or to copy the unsigned int ones,
+    // while computing their range, instead of only computing it.
+    bool convert;
+};
+
+std::ostream &operator<<(std::ostream &stream, const IndexKernelPerfParams &param)
+{
+    const char *kernelNames[] = {"scalar", "sse2", "avx2"};
+    stream << kernelNames[param.kernels] << "_" << GetIndexTypeName(param.indexType)
+           << (param.primitiveRestart ? "_restart" : "") << (param.convert ? "_convert" : "");
+    return stream;
+}
+
+std::string IndexKernelPerfSuffix(const IndexKernelPerfParams &param)
+{
+    std::stringstream strstr;
+    strstr << "_" << param;
+    return strstr.str();
+}
+
+// Measures the index range and conversion kernels on a dynamic index buffer of 150k indices.
+class IndexKernelPerfTest : public ANGLEPerfTest,
+                            public ::testing::WithParamInterface<IndexKernelPerfParams>
+{
+  public:
+    IndexKernelPerfTest()
+        : ANGLEPerfTest("IndexKernelPerfTest", IndexKernelPerfSuffix(GetParam())), mNumVertices(0)
+    {
+    }
+
+    void SetUp() override
+    {
+        ANGLEPerfTest::SetUp();
+
+        const auto &params  = GetParam();
+        const size_t kCount = 150000;
+        const size_t indexSize = gl::GetTypeInfo(params.indexType).bytes;
+
+        // Strips of vertices with a primitive restart index every 64 indices.
+        mInput.resize(kCount * indexSize);
+        for (size_t i = 0; i < kCount; ++i)
+        {
+            GLuint index = (i % 64 == 63) ? gl::GetPrimitiveRestartIndex(params.indexType)
+                                          : static_cast<GLuint>((i * 7) % 251);
+            memcpy(&mInput[i * indexSize], &index, indexSize);
+        }
+        mOutput.resize(kCount * 4);
+    }
+
+    void TearDown() override
+    {
+        // Keep the kernels from being optimized out.
+        EXPECT_NE(0u, mNumVertices);
+        ANGLEPerfTest::TearDown();
+    }
+
+    void step() override
+    {
+        const auto &params = GetParam();
+        const size_t count = mInput.size() / gl::GetTypeInfo(params.indexType).bytes;
+
+        gl::IndexRange range;
+        if (params.convert)
+        {
+            GLenum destinationType =
+                params.indexType == GL_UNSIGNED_BYTE ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+            gl::ConvertIndices(params.kernels, params.indexType, destinationType, &mInput[0],
+                               count, params.primitiveRestart, &mOutput[0], &range);
+        }
+        else
+        {
+            range = gl::ComputeIndexRange(params.kernels, params.indexType, &mInput[0], count,
+                                          params.primitiveRestart);
+        }
+        mNumVertices += range.vertexCount();
+    }
+
+  private:
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+    size_t mNumVertices;
+};
+
+std::vector<IndexKernelPerfParams> IndexKernelPerfParamsList()
+{
+    std::vector<IndexKernelPerfParams> paramsList;
+    for (int kernels = gl::INDEX_KERNELS_SCALAR; kernels <= gl::INDEX_KERNELS_AVX2; ++kernels)
+    {
+        for (GLenum indexType : {GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT})
+        {
+            for (bool primitiveRestart : {false, true})
+            {
+                for (bool convert : {false, true})
+                {
+                    IndexKernelPerfParams params;
+                    params.kernels          = static_cast<gl::IndexKernelSet>(kernels);
+                    params.indexType        = indexType;
+                    params.primitiveRestart = primitiveRestart;
+                    params.convert          = convert;
+                    paramsList.push_back(params);
+                }
+            }
+        }
+    }
+    return paramsList;
+}
+
+TEST_P(IndexKernelPerfTest, Run)
+{
+    if (GetParam().kernels > gl::GetSupportedIndexKernelSet())
+    {
+        std::cout << "Test skipped because the CPU does not support these kernels." << std::endl;
+        return;
+    }
+
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(IndexKernels,
+                        IndexKernelPerfTest,
+                        ::testing::ValuesIn(IndexKernelPerfParamsList()));
 
 } // namespace
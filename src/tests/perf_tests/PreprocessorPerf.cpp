@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PreprocessorPerf:
+//   Performance tests for the GLSL preprocessor, using a large generated shader that defines and
+//   invokes many object-like and function-like macros, as uber-shaders do.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/DirectiveHandlerBase.h"
+#include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
+
+namespace
+{
+
+class NullDiagnostics : public pp::Diagnostics
+{
+  protected:
+    void print(ID id, const pp::SourceLocation &loc, const std::string &text) override {}
+};
+
+class NullDirectiveHandler : public pp::DirectiveHandler
+{
+  public:
+    void handleError(const pp::SourceLocation &loc, const std::string &msg) override {}
+    void handlePragma(const pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {
+    }
+    void handleExtension(const pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {
+    }
+    void handleVersion(const pp::SourceLocation &loc, int version) override {}
+};
+
+// Generates a shader with numFeatures feature toggles, each guarding a block of helper macro
+// invocations, and a main function that expands every helper numCalls times.
+std::string GenerateMacroHeavyShader(size_t numFeatures, size_t numCalls)
+{
+    std::stringstream shader;
+    shader << "#version 300 es\n"
+              "precision highp float;\n"
+              "#define SCALE 2.0\n"
+              "#define BIAS (0.5 * SCALE)\n"
+              "#define MAD(a, b, c) ((a) * (b) + (c))\n"
+              "#define SATURATE(x) clamp((x), 0.0, 1.0)\n"
+              "#define LAYER(tex, uv, weight) MAD(texture(tex, (uv) * SCALE), weight, vec4(BIAS))\n"
+              "#define BLEND(a, b, t) mix(SATURATE(a), SATURATE(b), SATURATE(t))\n"
+              "uniform sampler2D uTexture;\n"
+              "in vec2 vUV;\n"
+              "out vec4 fragColor;\n";
+
+    for (size_t feature = 0; feature < numFeatures; ++feature)
+    {
+        shader << "#define FEATURE_" << feature << " " << (feature % 2) << "\n";
+    }
+
+    shader << "void main()\n"
+              "{\n"
+              "    vec4 color = vec4(0.0);\n";
+    for (size_t feature = 0; feature < numFeatures; ++feature)
+    {
+        shader << "#if defined(FEATURE_" << feature << ") && FEATURE_" << feature << " > 0\n";
+        for (size_t call = 0; call < numCalls; ++call)
+        {
+            shader << "    color = BLEND(color, LAYER(uTexture, vUV + vec2(" << call
+                   << ".0), BIAS), SCALE * 0.25);\n";
+        }
+        shader << "#else\n"
+                  "    color += vec4(BIAS);\n"
+                  "#endif\n";
+    }
+    shader << "    fragColor = color;\n"
+              "}\n";
+
+    return shader.str();
+}
+
+class PreprocessorPerfTest : public ANGLEPerfTest
+{
+  public:
+    PreprocessorPerfTest() : ANGLEPerfTest("Preprocessor", "_macro_heavy"), mNumTokens(0) {}
+
+    void SetUp() override
+    {
+        ANGLEPerfTest::SetUp();
+        mShader = GenerateMacroHeavyShader(64, 16);
+    }
+
+    void TearDown() override
+    {
+        // Keep the preprocessing from being optimized out.
+        EXPECT_NE(0u, mNumTokens);
+        ANGLEPerfTest::TearDown();
+    }
+
+    void step() override
+    {
+        NullDiagnostics diagnostics;
+        NullDirectiveHandler directiveHandler;
+        pp::Preprocessor preprocessor(&diagnostics, &directiveHandler);
+
+        const char *shaderStrings[] = {mShader.c_str()};
+        if (!preprocessor.init(1, shaderStrings, nullptr))
+        {
+            abortTest();
+            return;
+        }
+
+        pp::Token token;
+        do
+        {
+            preprocessor.lex(&token);
+            mNumTokens++;
+        } while (token.type != pp::Token::LAST);
+    }
+
+  private:
+    std::string mShader;
+    size_t mNumTokens;
+};
+
+TEST_F(PreprocessorPerfTest, Run)
+{
+    run();
+}
+
+}  // anonymous namespace
@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2016 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "compiler/preprocessor/PreprocessedShader.h"
+#include "compiler/preprocessor/Preprocessor.h"
+
+namespace
+{
+
+// Logs the tokens, diagnostics and directives in the order they are seen.
+class LoggingClient : public pp::Diagnostics, public pp::DirectiveHandler
+{
+  public:
+    void addToken(const pp::Token &token)
+    {
+        mLog << token.location.file << ":" << token.location.line << " " << token << "\n";
+    }
+
+    void handleError(const pp::SourceLocation &loc, const std::string &msg) override
+    {
+        mLog << "error " << loc.line << " " << msg << "\n";
+    }
+    void handlePragma(const pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {
+        mLog << "pragma " << loc.line << " " << name << "(" << value << ") " << stdgl << "\n";
+    }
+    void handleExtension(const pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {
+        mLog << "extension " << loc.line << " " << name << " " << behavior << "\n";
+    }
+    void handleVersion(const pp::SourceLocation &loc, int version) override
+    {
+        mLog << "version " << loc.line << " " << version << "\n";
+    }
+
+    std::string getLog() const { return mLog.str(); }
+
+  protected:
+    void print(ID id, const pp::SourceLocation &loc, const std::string &text) override
+    {
+        mLog << "diagnostic " << loc.line << " " << id << " " << text << "\n";
+    }
+
+  private:
+    std::ostringstream mLog;
+};
+
+const char *kShader =
+    "#version 100\n"
+    "#extension GL_OES_standard_derivatives : enable\n"
+    "#define SCALE 2.0\n"
+    "#pragma optimize(off)\n"
+    "float f = SCALE * 1.0;\n"
+    "#if 0\n"
+    "removed;\n"
+    "#endif\n"
+    "#error stop here\n"
+    "int i = 0x;\n"
+    "#pragma STDGL invariant(all)\n"
+    "#undef __LINE__\n"
+    "int line = __LINE__;\n";
+
+// Test that replaying a recording reports the same tokens, diagnostics and directives in the same
+// order as running the preprocessor.
+TEST(PreprocessedShaderTest, ReplayMatchesPreprocessor)
+{
+    LoggingClient direct;
+    pp::Preprocessor preprocessor(&direct, &direct);
+    ASSERT_TRUE(preprocessor.init(1, &kShader, nullptr));
+    pp::Token token;
+    do
+    {
+        preprocessor.lex(&token);
+        direct.addToken(token);
+    } while (token.type != pp::Token::LAST);
+
+    pp::PreprocessedShader recording;
+    pp::Preprocessor recordingPreprocessor(&recording, &recording);
+    ASSERT_TRUE(recordingPreprocessor.init(1, &kShader, nullptr));
+    recording.record(&recordingPreprocessor);
+    EXPECT_EQ(pp::Token::LAST, recording.getTokens().back().type);
+    EXPECT_FALSE(recording.getEvents().empty());
+
+    LoggingClient replayed;
+    do
+    {
+        recording.replay(&token, &replayed, &replayed);
+        replayed.addToken(token);
+    } while (token.type != pp::Token::LAST);
+
+    EXPECT_EQ(direct.getLog(), replayed.getLog());
+
+    // Lexing past the end keeps returning the end of the input.
+    recording.replay(&token, &replayed, &replayed);
+    EXPECT_EQ(pp::Token::LAST, token.type);
+}
+
+}  // anonymous namespace
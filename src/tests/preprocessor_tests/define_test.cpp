@@ -918,3 +918,68 @@ TEST_F(DefineTest, ExpandedDefinedNotParsedOutsideIf)
         "defined(bar)\n";
     preprocess(input, expected);
 }
+
+// Macros predefined by another preprocessor should be shared, and defining macros should not
+// affect the other preprocessor.
+TEST_F(DefineTest, SharedPredefinedMacros)
+{
+    pp::Preprocessor other(&mDiagnostics, &mDirectiveHandler);
+    const char *otherInput = "";
+    ASSERT_TRUE(other.init(1, &otherInput, NULL));
+    other.predefineMacro("GL_OES_standard_derivatives", 1);
+
+    mPreprocessor.setPredefinedMacros(other.getMacroSet());
+
+    const char *input =
+        "#define foo 2\n"
+        "foo GL_OES_standard_derivatives GL_ES __VERSION__\n";
+    const char *expected =
+        "\n"
+        "2 1 1 100\n";
+    preprocess(input, expected);
+
+    EXPECT_EQ(other.getMacroSet().end(), other.getMacroSet().find("foo"));
+}
+
+// Tokens past the token limit should be reported once and end the input. Macro names count as
+// tokens as well as their expansion.
+TEST_F(DefineTest, TokenLimit)
+{
+    mPreprocessor.setMaxTokens(4);
+
+    const char *input =
+        "#define foo 1 2\n"
+        "foo foo foo\n";
+    const char *expected =
+        "\n"
+        "1 2";
+
+    EXPECT_CALL(mDiagnostics,
+                print(pp::Diagnostics::PP_TOO_MANY_TOKENS, pp::SourceLocation(0, 2), "1"));
+
+    preprocess(input, expected);
+}
+
+// The tokens of macro arguments, which are expanded by themselves before being substituted,
+// should count towards the token limit, so that nested invocations can't expand exponentially.
+TEST_F(DefineTest, TokenLimitInNestedArguments)
+{
+    mPreprocessor.setMaxTokens(1000);
+
+    const char *input =
+        "#define a(x) x x x x\n"
+        "#define b(x) a(a(a(a(x))))\n"
+        "b(b(b(b(b(1)))))\n";
+    ASSERT_TRUE(mPreprocessor.init(1, &input, NULL));
+
+    EXPECT_CALL(mDiagnostics, print(pp::Diagnostics::PP_TOO_MANY_TOKENS, testing::_, testing::_));
+    EXPECT_CALL(mDiagnostics,
+                print(pp::Diagnostics::PP_MACRO_UNTERMINATED_INVOCATION, testing::_, testing::_))
+        .Times(0);
+
+    size_t numTokens = 0;
+    pp::Token token;
+    for (mPreprocessor.lex(&token); token.type != pp::Token::LAST; mPreprocessor.lex(&token))
+        ++numTokens;
+    EXPECT_LE(numTokens, 1000u);
+}
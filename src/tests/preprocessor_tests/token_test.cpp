@@ -20,12 +20,13 @@ TEST(TokenTest, DefaultConstructor)
 
 TEST(TokenTest, Assignment)
 {
+    pp::TokenTextPool pool;
     pp::Token token;
     token.type = 1;
     token.flags = 1;
     token.location.line = 1;
     token.location.file = 1;
-    token.text.assign("foo");
+    token.text = pool.intern("foo");
 
     token = pp::Token();
     EXPECT_EQ(0, token.type);
@@ -37,6 +38,7 @@ TEST(TokenTest, Assignment)
 
 TEST(TokenTest, Equals)
 {
+    pp::TokenTextPool pool;
     pp::Token token;
     EXPECT_TRUE(token.equals(pp::Token()));
 
@@ -56,7 +58,7 @@ TEST(TokenTest, Equals)
     EXPECT_FALSE(token.equals(pp::Token()));
     token.location.file = 0;
 
-    token.text.assign("foo");
+    token.text = pool.intern("foo");
     EXPECT_FALSE(token.equals(pp::Token()));
     token.text.clear();
 
@@ -75,8 +77,9 @@ TEST(TokenTest, HasLeadingSpace)
 
 TEST(TokenTest, Write)
 {
+    pp::TokenTextPool pool;
     pp::Token token;
-    token.text.assign("foo");
+    token.text = pool.intern("foo");
     std::stringstream out1;
     out1 << token;
     EXPECT_TRUE(out1.good());
@@ -88,3 +91,20 @@ TEST(TokenTest, Write)
     EXPECT_TRUE(out2.good());
     EXPECT_EQ(" foo", out2.str());
 }
+
+TEST(TokenTest, InternedText)
+{
+    pp::TokenTextPool pool;
+    const std::string *foo = pool.intern("foo");
+    EXPECT_EQ(foo, pool.intern(std::string("fo") + "o"));
+    EXPECT_NE(foo, pool.intern("bar"));
+
+    // Tokens with the same text from different pools are equal.
+    pp::TokenTextPool otherPool;
+    pp::Token token;
+    pp::Token otherToken;
+    token.text      = foo;
+    otherToken.text = otherPool.intern("foo");
+    EXPECT_TRUE(token.equals(otherToken));
+    EXPECT_EQ("foo", otherToken.text);
+}
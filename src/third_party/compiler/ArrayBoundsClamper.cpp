@@ -42,9 +42,10 @@ namespace {
 
 class ArrayBoundsClamperMarker : public TIntermTraverser {
 public:
-    ArrayBoundsClamperMarker()
+    // Sets *needsClamp if any node needs clamping.
+    ArrayBoundsClamperMarker(bool *needsClamp)
         : TIntermTraverser(true, false, false),
-          mNeedsClamp(false)
+          mNeedsClamp(needsClamp)
    {
    }
 
@@ -56,16 +57,14 @@ public:
            if (left->isArray() || left->isVector() || left->isMatrix())
            {
                node->setAddIndexClamp();
-               mNeedsClamp = true;
+               *mNeedsClamp = true;
            }
        }
        return true;
    }
 
-    bool GetNeedsClamp() { return mNeedsClamp; }
-
 private:
-    bool mNeedsClamp;
+    bool *mNeedsClamp;
 };
 
 }  // anonymous namespace
@@ -85,12 +84,14 @@ void ArrayBoundsClamper::MarkIndirectArrayBoundsForClamping(TIntermNode* root)
 {
     ASSERT(root);
 
-    ArrayBoundsClamperMarker clamper;
+    ArrayBoundsClamperMarker clamper(&mArrayBoundsClampDefinitionNeeded);
     root->traverse(&clamper);
-    if (clamper.GetNeedsClamp())
-    {
-        SetArrayBoundsClampDefinitionNeeded();
-    }
+}
+
+std::unique_ptr<TIntermTraverser> ArrayBoundsClamper::CreateIndirectArrayBoundsMarker()
+{
+    return std::unique_ptr<TIntermTraverser>(
+        new ArrayBoundsClamperMarker(&mArrayBoundsClampDefinitionNeeded));
 }
 
 void ArrayBoundsClamper::OutputClampingFunctionDefinition(TInfoSinkBase& out) const
@@ -26,6 +26,8 @@
 #ifndef THIRD_PARTY_COMPILER_ARRAYBOUNDSCLAMPER_H_
 #define THIRD_PARTY_COMPILER_ARRAYBOUNDSCLAMPER_H_
 
+#include <memory>
+
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/IntermNode.h"
 
@@ -41,6 +43,10 @@ public:
     // requiring clamping.
     void MarkIndirectArrayBoundsForClamping(TIntermNode* root);
 
+    // Returns the traverser used by MarkIndirectArrayBoundsForClamping, to
+    // run it along with other passes in a TFusedTraverser.
+    std::unique_ptr<TIntermTraverser> CreateIndirectArrayBoundsMarker();
+
     // If necessary, output array clamp function source into the shader source.
     void OutputClampingFunctionDefinition(TInfoSinkBase& out) const;
 
@@ -51,7 +57,6 @@ public:
 
 private:
     bool GetArrayBoundsClampDefinitionNeeded() const { return mArrayBoundsClampDefinitionNeeded; }
-    void SetArrayBoundsClampDefinitionNeeded() { mArrayBoundsClampDefinitionNeeded = true; }
 
     ShArrayIndexClampingStrategy mClampingStrategy;
     bool mArrayBoundsClampDefinitionNeeded;